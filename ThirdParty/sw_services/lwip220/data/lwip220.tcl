@@ -1575,6 +1575,12 @@ proc generate_adapterconfig_include {libhandle} {
 		set ncoalesce [common::get_property CONFIG.n_rx_coalesce $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_COALESCE $ncoalesce"
 		puts $fd ""
+
+		set nqueues [common::get_property CONFIG.n_rx_queues $libhandle]
+		if {$nqueues > 1} {
+			puts $fd "\#define XLWIP_CONFIG_N_RX_QUEUES $nqueues"
+			puts $fd ""
+		}
 	}
 	if {$have_ps_ethernet == 1} {
 		set emacnum [common::get_property CONFIG.emac_number $libhandle]
@@ -1584,6 +1590,22 @@ proc generate_adapterconfig_include {libhandle} {
 		set ndesc [common::get_property CONFIG.n_rx_descriptors $libhandle]
 		puts $fd "\#define XLWIP_CONFIG_N_RX_DESC $ndesc"
 		puts $fd ""
+
+		set rx_zero_copy [expr [common::get_property CONFIG.temac_rx_zero_copy $libhandle] == true]
+		if {$rx_zero_copy == 1} {
+			set nbufs [common::get_property CONFIG.n_rx_zero_copy_buffers $libhandle]
+			puts $fd "\#define XLWIP_CONFIG_RX_ZERO_COPY 1"
+			puts $fd "\#define XLWIP_CONFIG_N_RX_ZC_BUFS $nbufs"
+			puts $fd ""
+		}
+	}
+
+	set rx_poll [expr [common::get_property CONFIG.temac_rx_poll $libhandle] == true]
+	if {$rx_poll == 1 && ($have_axi_ethernet == 1 || $have_ps_ethernet == 1)} {
+		set budget [common::get_property CONFIG.rx_poll_budget $libhandle]
+		puts $fd "\#define XLWIP_CONFIG_RX_POLL 1"
+		puts $fd "\#define XLWIP_CONFIG_RX_POLL_BUDGET $budget"
+		puts $fd ""
 	}
 
 	puts $fd "\#endif"
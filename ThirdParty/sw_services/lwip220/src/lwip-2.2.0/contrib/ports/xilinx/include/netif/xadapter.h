@@ -66,10 +66,26 @@ enum ethernet_link_status {
 	ETH_LINK_NEGOTIATING
 };
 
+#if !NO_SYS
+/* argument of xemacif_input_queue_thread() */
+struct xemacif_rx_queue {
+	struct netif *netif;
+	u32_t queue;
+};
+#endif
+
 void eth_link_detect(struct netif *netif);
 void 		lwip_raw_init();
 int 		xemacif_input(struct netif *netif);
 void 		xemacif_input_thread(struct netif *netif);
+u32_t		xemacif_rx_queues(struct netif *netif);
+#if !NO_SYS
+void		xemacif_input_queue_thread(struct xemacif_rx_queue *rxq);
+#endif
+void		xemac_tx_batch_begin(struct netif *netif);
+void		xemac_tx_batch_end(struct netif *netif);
+void		xemacif_set_rx_poll_budget(struct netif *netif, u32_t budget);
+err_t		xemacif_set_rx_coalesce(struct netif *netif, u32_t count, u32_t timer);
 struct netif *	xemac_add(struct netif *netif,
 	ip_addr_t *ipaddr, ip_addr_t *netmask, ip_addr_t *gw,
 	unsigned char *mac_ethernet_address,
@@ -57,6 +57,24 @@ extern "C" {
 #include "netif/xpqueue.h"
 #include "xlwipconfig.h"
 
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+/* number of queues the MCDMA path steers received frames to by flow */
+#ifdef XLWIP_CONFIG_N_RX_QUEUES
+#define XAXIEMACIF_N_RX_QUEUES	XLWIP_CONFIG_N_RX_QUEUES
+#else
+#define XAXIEMACIF_N_RX_QUEUES	1
+#endif
+#if (XAXIEMACIF_N_RX_QUEUES < 1) || (XAXIEMACIF_N_RX_QUEUES > 16)
+#error "XLWIP_CONFIG_N_RX_QUEUES must be 1 to 16"
+#endif
+#endif
+
+/* RX polling is implemented for the AXI DMA path */
+#if defined(XLWIP_CONFIG_RX_POLL) && !defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO) && \
+	!defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+#define XAXIEMACIF_RX_POLL
+#endif
+
 #if XLWIP_CONFIG_INCLUDE_AXIETH_ON_ZYNQ == 1
 #define AXIDMA_TX_INTR_PRIORITY_SET_IN_GIC      0xA0
 #define AXIDMA_RX_INTR_PRIORITY_SET_IN_GIC      0xA0
@@ -70,6 +88,14 @@ void 	xaxiemacif_setmac(u32_t index, u8_t *addr);
 u8_t*	xaxiemacif_getmac(u32_t index);
 err_t 	xaxiemacif_init(struct netif *netif);
 int 	xaxiemacif_input(struct netif *netif);
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+int	xaxiemacif_input_queue(struct netif *netif, u32_t queue);
+#if !NO_SYS
+void	xaxiemacif_input_queue_thread(struct netif *netif, u32_t queue);
+#endif
+#endif
+void	xaxiemacif_set_rx_poll_budget(struct netif *netif, u32_t budget);
+err_t	xaxiemacif_set_rx_coalesce(struct netif *netif, u32_t count, u32_t timer);
 
 unsigned get_IEEE_phy_speed(XAxiEthernet *xaxiemacp);
 void enable_sgmii_clock(XAxiEthernet *xaxiemacp);
@@ -101,6 +127,22 @@ typedef struct {
 	void *tx_bdspace;
 
 	enum ethernet_link_status eth_link_status;
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+	/* per flow queues of received frames, rx_q[0] is recv_q */
+	pq_queue_t *rx_q[XAXIEMACIF_N_RX_QUEUES];
+#if !NO_SYS
+	/* signalled when frames are added to the matching rx_q */
+	sys_sem_t rx_q_sem[XAXIEMACIF_N_RX_QUEUES];
+#endif
+	/* next queue served by xaxiemacif_input() */
+	u32_t rx_q_next;
+#endif
+#ifdef XAXIEMACIF_RX_POLL
+	/* set while the RX interrupts are off and the ring is polled */
+	volatile u32_t rx_polling;
+	/* most frames taken from the ring per poll */
+	u32_t rx_poll_budget;
+#endif
 } xaxiemacif_s;
 
 extern xaxiemacif_s xaxiemacif;
@@ -127,6 +169,11 @@ XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p,
 #else
 XStatus axidma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p);
 #endif
+XStatus axidma_set_rx_coalesce(xaxiemacif_s *xaxiemacif, u32_t count,
+		u32_t timer);
+#ifdef XAXIEMACIF_RX_POLL
+u32_t axidma_rx_poll(xaxiemacif_s *xaxiemacif, u32_t budget);
+#endif
 #endif
 #endif
 
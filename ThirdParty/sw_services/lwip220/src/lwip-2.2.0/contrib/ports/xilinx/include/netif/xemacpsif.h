@@ -112,10 +112,18 @@ extern "C" {
 
 #define MAX_FRAME_SIZE_JUMBO (XEMACPS_MTU_JUMBO + XEMACPS_HDR_SIZE + XEMACPS_TRL_SIZE)
 
+/* TX frames made of more pbufs than this are copied into a single pbuf */
+#ifndef XEMACPS_TX_MAX_FRAGS
+#define XEMACPS_TX_MAX_FRAGS	4
+#endif
+
 void 	xemacpsif_setmac(u32_t index, u8_t *addr);
 u8_t*	xemacpsif_getmac(u32_t index);
 err_t 	xemacpsif_init(struct netif *netif);
 s32_t 	xemacpsif_input(struct netif *netif);
+void	xemacpsif_tx_batch_begin(struct netif *netif);
+void	xemacpsif_tx_batch_end(struct netif *netif);
+void	xemacpsif_set_rx_poll_budget(struct netif *netif, u32_t budget);
 
 /* xaxiemacif_hw.c */
 void 	xemacps_error_handler(XEmacPs * Temac);
@@ -136,6 +144,19 @@ typedef struct {
 
 	unsigned int last_rx_frms_cntr;
 	enum ethernet_link_status eth_link_status;
+	/* TX batch nesting depth and frames queued without start */
+	u32_t tx_batch;
+	u32_t tx_pending;
+#ifdef XLWIP_CONFIG_RX_ZERO_COPY
+	/* set when RX BDs were left empty because the buffer pool ran dry */
+	volatile u32_t rx_zc_starved;
+#endif
+#ifdef XLWIP_CONFIG_RX_POLL
+	/* set while the RX interrupt is masked and the ring is polled */
+	volatile u32_t rx_polling;
+	/* most frames taken from the ring per poll */
+	u32_t rx_poll_budget;
+#endif
 } xemacpsif_s;
 
 extern xemacpsif_s xemacpsif;
@@ -151,6 +172,8 @@ u32_t pcs_setup_emacps (XEmacPs *xemacps);
 #endif
 void detect_phy(XEmacPs *xemacpsp);
 void emacps_send_handler(void *arg);
+void emacps_tx_batch_begin(xemacpsif_s *xemacpsif);
+void emacps_tx_batch_end(xemacpsif_s *xemacpsif);
 #if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 		u32_t block_till_tx_complete, u32_t *to_block_index);
@@ -158,6 +181,9 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p,
 XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p);
 #endif
 void emacps_recv_handler(void *arg);
+#ifdef XLWIP_CONFIG_RX_POLL
+u32_t emacps_rx_poll(xemacpsif_s *xemacpsif, u32_t budget);
+#endif
 void emacps_error_handler(void *arg,u8 Direction, u32 ErrorWord);
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring);
 void HandleTxErrors(struct xemac_s *xemac);
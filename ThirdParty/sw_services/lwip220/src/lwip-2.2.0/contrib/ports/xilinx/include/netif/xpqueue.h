@@ -38,16 +38,33 @@ extern "C" {
 
 #include "lwip/debug.h"
 
+/*
+ * Single-producer/single-consumer ring. One context (usually the ISR)
+ * enqueues and one context dequeues; neither needs interrupts disabled.
+ * head is only written by the producer and tail only by the consumer, each
+ * in its own cache line so the two sides do not contend for it.
+ */
 #define PQ_QUEUE_SIZE 4096
+#define PQ_QUEUE_MASK (PQ_QUEUE_SIZE - 1)
+
+#if (PQ_QUEUE_SIZE & PQ_QUEUE_MASK) != 0
+#error "PQ_QUEUE_SIZE must be a power of two"
+#endif
+
+#ifndef PQ_CACHE_LINE_SIZE
+#define PQ_CACHE_LINE_SIZE 64
+#endif
 
 typedef struct {
-	void *data[PQ_QUEUE_SIZE];
-	int head, tail, len;
+	unsigned int head __attribute__((aligned(PQ_CACHE_LINE_SIZE)));
+	unsigned int tail __attribute__((aligned(PQ_CACHE_LINE_SIZE)));
+	void *data[PQ_QUEUE_SIZE] __attribute__((aligned(PQ_CACHE_LINE_SIZE)));
 } pq_queue_t;
 
 pq_queue_t*	pq_create_queue();
 int 		pq_enqueue(pq_queue_t *q, void *p);
 void*		pq_dequeue(pq_queue_t *q);
+int		pq_dequeue_batch(pq_queue_t *q, void **p, int n);
 int		pq_qlength(pq_queue_t *q);
 
 #ifdef __cplusplus
@@ -227,6 +227,48 @@ xemacif_input_thread(struct netif *netif)
 }
 #endif
 
+/*
+ * xemacif_rx_queues():
+ *
+ * Returns the number of queues received frames are steered to by flow.
+ * It is 1, except for Axi-Ethernet with MCDMA built with n_rx_queues.
+ */
+u32_t
+xemacif_rx_queues(struct netif *netif)
+{
+#if defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET) && defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	if (emac->type == xemac_type_axi_ethernet)
+		return XAXIEMACIF_N_RX_QUEUES;
+#else
+	(void)netif;
+#endif
+	return 1;
+}
+
+#if !NO_SYS
+/*
+ * The queue input thread moves the frames of one RX queue to lwIP. With
+ * several queues, one thread is created per queue, each of them possibly
+ * bound to a different core, instead of xemacif_input_thread(). Adapters
+ * with a single queue fall back to xemacif_input_thread().
+ */
+void
+xemacif_input_queue_thread(struct xemacif_rx_queue *rxq)
+{
+#if defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET) && defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+	struct xemac_s *emac = (struct xemac_s *)rxq->netif->state;
+
+	/* the queue semaphores are only signalled with several queues */
+	if ((emac->type == xemac_type_axi_ethernet) &&
+	    (xemacif_rx_queues(rxq->netif) > 1))
+		xaxiemacif_input_queue_thread(rxq->netif, rxq->queue);
+#endif
+	xemacif_input_thread(rxq->netif);
+}
+#endif
+
 int
 xemacif_input(struct netif *netif)
 {
@@ -450,6 +492,99 @@ void emaclite_link_status(struct netif *netif, xemacliteif_s *xemacs, XEmacLite
 }
 #endif
 
+/*
+ * xemac_tx_batch_begin() / xemac_tx_batch_end():
+ *
+ * Frames output between the two calls are handed to the MAC as one batch
+ * where the adapter supports it (GEM); on other adapters they are no-ops.
+ * Calls can be nested, the batch is started by the outermost end. UDP
+ * frames sent with LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE are not held back
+ * by a batch, since the sender blocks until they are transmitted.
+ */
+void xemac_tx_batch_begin(struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#if defined (__arm__) || defined (__aarch64__)
+		case xemac_type_emacps:
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+			xemacpsif_tx_batch_begin(netif);
+#endif
+			break;
+#endif
+		default:
+			break;
+	}
+}
+
+void xemac_tx_batch_end(struct netif *netif)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#if defined (__arm__) || defined (__aarch64__)
+		case xemac_type_emacps:
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+			xemacpsif_tx_batch_end(netif);
+#endif
+			break;
+#endif
+		default:
+			break;
+	}
+}
+
+/*
+ * xemacif_set_rx_poll_budget():
+ *
+ * With RX polling (temac_rx_poll), the receive interrupt only wakes up
+ * xemacif_input(), which takes at most budget frames from the RX ring per
+ * poll and enables the interrupt again once the ring is empty.
+ */
+void xemacif_set_rx_poll_budget(struct netif *netif, u32_t budget)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+		case xemac_type_axi_ethernet:
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET
+			xaxiemacif_set_rx_poll_budget(netif, budget);
+#endif
+			break;
+#if defined (__arm__) || defined (__aarch64__)
+		case xemac_type_emacps:
+#ifdef XLWIP_CONFIG_INCLUDE_GEM
+			xemacpsif_set_rx_poll_budget(netif, budget);
+#endif
+			break;
+#endif
+		default:
+			break;
+	}
+}
+
+/*
+ * xemacif_set_rx_coalesce():
+ *
+ * Changes the RX interrupt coalescing thresholds at runtime: one interrupt
+ * per count frames, or after timer delay periods when fewer arrived.
+ * Supported by Axi-Ethernet with AXI DMA only, ERR_IF otherwise.
+ */
+err_t xemacif_set_rx_coalesce(struct netif *netif, u32_t count, u32_t timer)
+{
+	struct xemac_s *emac = (struct xemac_s *)netif->state;
+
+	switch (emac->type) {
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET
+		case xemac_type_axi_ethernet:
+			return xaxiemacif_set_rx_coalesce(netif, count, timer);
+#endif
+		default:
+			return ERR_IF;
+	}
+}
+
 void eth_link_detect(struct netif *netif)
 {
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
@@ -121,7 +121,6 @@ static err_t _unbuffered_low_level_output(xaxiemacif_s *xaxiemacif,
 #endif
 	} else if (XAxiEthernet_IsMcDma(&xaxiemacif->axi_ethernet)) {
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
-		xil_printf("lwip support with mcdma is deprecated\n");
 		status = axi_mcdma_sgsend(xaxiemacif, p);
 #endif
 	} else {
@@ -238,6 +237,55 @@ return_pack_dropped:
         return err;
 }
 
+/*
+ * xaxiemacif_set_rx_poll_budget():
+ *
+ * Sets the most frames taken from the RX ring per poll when the receive
+ * interrupts are off. Applies to the AXI DMA path built with RX polling.
+ */
+void xaxiemacif_set_rx_poll_budget(struct netif *netif, u32_t budget)
+{
+#ifdef XAXIEMACIF_RX_POLL
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+
+	if (budget == 0)
+		budget = 1;
+	xaxiemacif->rx_poll_budget = budget;
+#else
+	(void)netif;
+	(void)budget;
+#endif
+}
+
+/*
+ * xaxiemacif_set_rx_coalesce():
+ *
+ * Sets the RX interrupt coalescing thresholds of the AXI DMA at runtime:
+ * count frames per interrupt (1 - 255) and the delay timer (0 - 255, 0
+ * disables it). Returns ERR_IF for the FIFO and MCDMA paths.
+ */
+err_t xaxiemacif_set_rx_coalesce(struct netif *netif, u32_t count, u32_t timer)
+{
+#if !defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_FIFO) && !defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA)
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+	XStatus status;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	status = axidma_set_rx_coalesce(xaxiemacif, count, timer);
+	SYS_ARCH_UNPROTECT(lev);
+
+	return (status == XST_SUCCESS) ? ERR_OK : ERR_ARG;
+#else
+	(void)netif;
+	(void)count;
+	(void)timer;
+	return ERR_IF;
+#endif
+}
+
 /*
  * low_level_input():
  *
@@ -249,15 +297,39 @@ static struct pbuf *low_level_input(struct netif *netif)
 {
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+#if defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA) && (XAXIEMACIF_N_RX_QUEUES > 1)
 	struct pbuf *p;
+	u32_t i;
+#endif
 
-	/* see if there is data to process */
-	if (pq_qlength(xaxiemacif->recv_q) == 0)
-		return NULL;
+#ifdef XAXIEMACIF_RX_POLL
+	SYS_ARCH_DECL_PROTECT(lev);
 
-	/* return one packet from receive q */
-	p = (struct pbuf *)pq_dequeue(xaxiemacif->recv_q);
-	return p;
+	/* take the next batch of frames from the RX ring */
+	if (pq_qlength(xaxiemacif->recv_q) == 0) {
+		SYS_ARCH_PROTECT(lev);
+		(void)axidma_rx_poll(xaxiemacif, xaxiemacif->rx_poll_budget);
+		SYS_ARCH_UNPROTECT(lev);
+	}
+#endif
+
+#if defined(XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA) && (XAXIEMACIF_N_RX_QUEUES > 1)
+
+	/* serve the flow queues in turn */
+	for (i = 0; i < XAXIEMACIF_N_RX_QUEUES; i++) {
+		pq_queue_t *q = xaxiemacif->rx_q[xaxiemacif->rx_q_next];
+
+		if (++xaxiemacif->rx_q_next == XAXIEMACIF_N_RX_QUEUES)
+			xaxiemacif->rx_q_next = 0;
+		p = (struct pbuf *)pq_dequeue(q);
+		if (p != NULL)
+			return p;
+	}
+	return NULL;
+#else
+	/* return one packet from receive q, NULL if there is none */
+	return (struct pbuf *)pq_dequeue(xaxiemacif->recv_q);
+#endif
 }
 
 /*
@@ -276,6 +348,49 @@ static err_t xaxiemacif_output(struct netif *netif, struct pbuf *p,
 	return etharp_output(netif, p, ipaddr);
 }
 
+/*
+ * input_frame():
+ *
+ * Hands a received frame to the stack, or drops it if its type is not
+ * handled.
+ */
+static void input_frame(struct netif *netif, struct pbuf *p)
+{
+	struct eth_hdr *ethhdr;
+
+	/* points to packet payload, which starts with an Ethernet header */
+	ethhdr = p->payload;
+
+#if LINK_STATS
+	lwip_stats.link.recv++;
+#endif /* LINK_STATS */
+
+	switch (htons(ethhdr->type)) {
+		/* IP or ARP packet? */
+		case ETHTYPE_IP:
+		case ETHTYPE_ARP:
+#if LWIP_IPV6
+		/*IPv6 Packet?*/
+		case ETHTYPE_IPV6:
+#endif
+#if PPPOE_SUPPORT
+			/* PPPoE packet? */
+		case ETHTYPE_PPPOEDISC:
+		case ETHTYPE_PPPOE:
+#endif /* PPPOE_SUPPORT */
+			/* full packet send to tcpip_thread to process */
+			if (netif->input(p, netif) != ERR_OK) {
+				LWIP_DEBUGF(NETIF_DEBUG, ("xaxiemacif_input: IP input error\r\n"));
+				pbuf_free(p);
+			}
+			break;
+
+		default:
+			pbuf_free(p);
+			break;
+	}
+}
+
 /*
  * xaxiemacif_input():
  *
@@ -291,66 +406,118 @@ static err_t xaxiemacif_output(struct netif *netif, struct pbuf *p,
 
 int xaxiemacif_input(struct netif *netif)
 {
-	struct eth_hdr *ethhdr;
 	struct pbuf *p;
-	SYS_ARCH_DECL_PROTECT(lev);
+#if defined(XAXIEMACIF_RX_POLL) && !NO_SYS
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+	u32_t n_frames = 0;
+#endif
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
+#if defined(XAXIEMACIF_RX_POLL) && !NO_SYS
+		/*
+		 * budget used up: come back after other threads ran, unless
+		 * the ring was found empty and all its frames are taken
+		 */
+		if (n_frames == xaxiemacif->rx_poll_budget) {
+			if (xaxiemacif->rx_polling ||
+			    pq_qlength(xaxiemacif->recv_q) != 0)
+				sys_sem_signal(&xemac->sem_rx_data_available);
+			return 1;
+		}
+#endif
+
 		/* move received packet into a new pbuf */
-		SYS_ARCH_PROTECT(lev);
 		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL)
 			return 0;
 
-		/* points to packet payload, which starts with an Ethernet header */
-		ethhdr = p->payload;
+		input_frame(netif, p);
+#if defined(XAXIEMACIF_RX_POLL) && !NO_SYS
+		n_frames++;
+#endif
+	}
+	return 1;
+}
 
-#if LINK_STATS
-		lwip_stats.link.recv++;
-#endif /* LINK_STATS */
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+/* frames taken from a flow queue at once; one in RAW mode */
+#if !NO_SYS
+#define RX_QUEUE_BATCH	16
+#else
+#define RX_QUEUE_BATCH	1
+#endif
 
-		switch (htons(ethhdr->type)) {
-			/* IP or ARP packet? */
-			case ETHTYPE_IP:
-			case ETHTYPE_ARP:
-#if LWIP_IPV6
-			/*IPv6 Packet?*/
-			case ETHTYPE_IPV6:
+/*
+ * xaxiemacif_input_queue():
+ *
+ * Like xaxiemacif_input(), but only takes frames from one of the flow
+ * queues (0 to XAXIEMACIF_N_RX_QUEUES - 1). A connection always lands on
+ * the same queue, so a queue must be served by a single thread to keep
+ * its frames in order.
+ */
+int xaxiemacif_input_queue(struct netif *netif, u32_t queue)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+	void *frames[RX_QUEUE_BATCH];
+	int n_frames;
+	int i;
+
+	if (queue >= XAXIEMACIF_N_RX_QUEUES)
+		return 0;
+
+#if !NO_SYS
+	while (1)
 #endif
-#if PPPOE_SUPPORT
-				/* PPPoE packet? */
-			case ETHTYPE_PPPOEDISC:
-			case ETHTYPE_PPPOE:
-#endif /* PPPOE_SUPPORT */
-				/* full packet send to tcpip_thread to process */
-				if (netif->input(p, netif) != ERR_OK) {
-					LWIP_DEBUGF(NETIF_DEBUG, ("xaxiemacif_input: IP input error\r\n"));
-					pbuf_free(p);
-					p = NULL;
-				}
-				break;
+	{
+		n_frames = pq_dequeue_batch(xaxiemacif->rx_q[queue], frames,
+					    RX_QUEUE_BATCH);
+		if (n_frames == 0)
+			return 0;
 
-			default:
-				pbuf_free(p);
-				p = NULL;
-				break;
-		}
+		for (i = 0; i < n_frames; i++)
+			input_frame(netif, (struct pbuf *)frames[i]);
 	}
 	return 1;
 }
 
+#if !NO_SYS
+/*
+ * xaxiemacif_input_queue_thread():
+ *
+ * Serves one flow queue; create one such thread per queue, possibly on
+ * different cores, instead of xemacif_input_thread(). Only for
+ * XAXIEMACIF_N_RX_QUEUES > 1, the queue semaphores are not signalled
+ * with a single queue.
+ */
+void xaxiemacif_input_queue_thread(struct netif *netif, u32_t queue)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
+
+	while (1) {
+		sys_sem_wait(&xaxiemacif->rx_q_sem[queue]);
+		xaxiemacif_input_queue(netif, queue);
+	}
+}
+#endif
+#endif
+
 static err_t low_level_init(struct netif *netif)
 {
 	unsigned mac_address = (unsigned)(UINTPTR)(netif->state);
 	struct xemac_s *xemac;
 	xaxiemacif_s *xaxiemacif;
 	XAxiEthernet_Config *mac_config;
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+	u32_t i;
+#endif
 
 	xaxiemacif = mem_malloc(sizeof *xaxiemacif);
 	if (xaxiemacif == NULL) {
@@ -369,9 +536,26 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_axi_ethernet;
 
 	xaxiemacif->send_q = NULL;
+#ifdef XAXIEMACIF_RX_POLL
+	xaxiemacif->rx_polling = 0;
+	xaxiemacif->rx_poll_budget = XLWIP_CONFIG_RX_POLL_BUDGET;
+#endif
 	xaxiemacif->recv_q = pq_create_queue();
 	if (!xaxiemacif->recv_q)
 		return ERR_MEM;
+#ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+	xaxiemacif->rx_q[0] = xaxiemacif->recv_q;
+	for (i = 1; i < XAXIEMACIF_N_RX_QUEUES; i++) {
+		xaxiemacif->rx_q[i] = pq_create_queue();
+		if (!xaxiemacif->rx_q[i])
+			return ERR_MEM;
+	}
+	xaxiemacif->rx_q_next = 0;
+#if !NO_SYS
+	for (i = 0; i < XAXIEMACIF_N_RX_QUEUES; i++)
+		sys_sem_new(&xaxiemacif->rx_q_sem[i], 0);
+#endif
+#endif
 
 	/* maximum transfer unit */
 #ifdef USE_JUMBO_FRAMES
@@ -426,6 +610,7 @@ static err_t low_level_init(struct netif *netif)
 #endif
 	} else if (XAxiEthernet_IsMcDma(&xaxiemacif->axi_ethernet)) {
 #ifdef XLWIP_CONFIG_INCLUDE_AXI_ETHERNET_MCDMA
+		xil_printf("lwip support with mcdma is deprecated\n");
 		/* Initialize MCDMA engine */
 		init_axi_mcdma(xemac);
 #endif
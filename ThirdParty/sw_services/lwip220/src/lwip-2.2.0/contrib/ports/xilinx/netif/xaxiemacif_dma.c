@@ -388,11 +388,71 @@ static void setup_rx_bds(XAxiDma_BdRing *rxring)
 	}
 }
 
-static void axidma_recv_handler(void *arg)
+/*
+ * Moves up to budget received frames from the RX ring to recv_q and gives
+ * the BDs back to the DMA. Returns the number of frames moved.
+ */
+static u32_t axidma_rx_drain(xaxiemacif_s *xaxiemacif, u32_t budget)
 {
 	struct pbuf *p;
-	u32 irq_status, i, timeOut;
+	u32 i;
 	XAxiDma_Bd *rxbd, *rxbdset;
+	XAxiDma_BdRing *rxring;
+	u32 bd_processed;
+	u32 rx_bytes;
+
+	rxring = XAxiDma_GetRxRing(&xaxiemacif->axidma);
+
+	if (budget > XAXIDMA_ALL_BDS) {
+		budget = XAXIDMA_ALL_BDS;
+	}
+	bd_processed = XAxiDma_BdRingFromHw(rxring, (int)budget, &rxbdset);
+
+	for (i = 0, rxbd = rxbdset; i < bd_processed; i++) {
+		p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
+		/* Adjust the buffer size to the actual number of bytes received.*/
+		rx_bytes = extract_packet_len(rxbd);
+		pbuf_realloc(p, rx_bytes);
+
+#if defined(__aarch64__)
+#ifdef USE_JUMBO_FRAMES
+		XCACHE_INVALIDATE_DCACHE_RANGE(p->payload,
+						XAE_MAX_JUMBO_FRAME_SIZE);
+#else
+		XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAE_MAX_FRAME_SIZE);
+#endif
+#endif
+
+#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
+		/* Verify for partial checksum offload case */
+		if (!is_checksum_valid(rxbd, p)) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
+		}
+#endif
+		/* store it in the receive queue,
+		 * where it'll be processed by a different handler
+		 */
+		if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
+#if LINK_STATS
+			lwip_stats.link.memerr++;
+			lwip_stats.link.drop++;
+#endif
+			pbuf_free(p);
+		}
+		rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
+	}
+	/* free up the BD's */
+	XAxiDma_BdRingFree(rxring, bd_processed, rxbdset);
+	/* return all the processed bd's back to the stack */
+	/* setup_rx_bds -> use XAxiDma_BdRingGetFreeCnt */
+	setup_rx_bds(rxring);
+
+	return bd_processed;
+}
+
+static void axidma_recv_handler(void *arg)
+{
+	u32 irq_status, timeOut;
 	struct xemac_s *xemac;
 	xaxiemacif_s *xaxiemacif;
 	XAxiDma_BdRing *rxring;
@@ -429,6 +489,9 @@ static void axidma_recv_handler(void *arg)
 			}
 			timeOut -= 1;
 		}
+#ifdef XAXIEMACIF_RX_POLL
+		xaxiemacif->rx_polling = 0;
+#endif
 		XAxiDma_BdRingIntEnable(rxring, XAXIDMA_IRQ_ALL_MASK);
 		XAxiDma_Resume(&xaxiemacif->axidma);
 #if !NO_SYS
@@ -439,52 +502,22 @@ static void axidma_recv_handler(void *arg)
 	/* If Reception done interrupt is asserted, call RX call back function
 	 * to handle the processed BDs and then raise the according flag.
 	 */
+#ifdef XAXIEMACIF_RX_POLL
 	if (irq_status & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK)) {
-		u32 bd_processed;
-		u32 rx_bytes;
-
-		bd_processed = XAxiDma_BdRingFromHw(rxring, XAXIDMA_ALL_BDS, &rxbdset);
-
-		for (i = 0, rxbd = rxbdset; i < bd_processed; i++) {
-			p = (struct pbuf *)(UINTPTR)XAxiDma_BdGetId(rxbd);
-			/* Adjust the buffer size to the actual number of bytes received.*/
-			rx_bytes = extract_packet_len(rxbd);
-			pbuf_realloc(p, rx_bytes);
-
-#if defined(__aarch64__)
-#ifdef USE_JUMBO_FRAMES
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload,
-							XAE_MAX_JUMBO_FRAME_SIZE);
+		/*
+		 * Leave the frames in the ring and the RX interrupts off,
+		 * xaxiemacif_input() polls the ring until it is empty.
+		 */
+		xaxiemacif->rx_polling = 1;
+	} else {
+		XAxiDma_BdRingIntEnable(rxring, XAXIDMA_IRQ_ALL_MASK);
+	}
 #else
-			XCACHE_INVALIDATE_DCACHE_RANGE(p->payload, XAE_MAX_FRAME_SIZE);
-#endif
-#endif
-
-#if LWIP_PARTIAL_CSUM_OFFLOAD_RX==1
-			/* Verify for partial checksum offload case */
-			if (!is_checksum_valid(rxbd, p)) {
-				LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
-			}
-#endif
-			/* store it in the receive queue,
-			 * where it'll be processed by a different handler
-			 */
-			if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
-#if LINK_STATS
-				lwip_stats.link.memerr++;
-				lwip_stats.link.drop++;
-#endif
-				pbuf_free(p);
-			}
-			rxbd = (XAxiDma_Bd *)XAxiDma_BdRingNext(rxring, rxbd);
-		}
-		/* free up the BD's */
-		XAxiDma_BdRingFree(rxring, bd_processed, rxbdset);
-		/* return all the processed bd's back to the stack */
-		/* setup_rx_bds -> use XAxiDma_BdRingGetFreeCnt */
-		setup_rx_bds(rxring);
+	if (irq_status & (XAXIDMA_IRQ_DELAY_MASK | XAXIDMA_IRQ_IOC_MASK)) {
+		(void)axidma_rx_drain(xaxiemacif, XAXIDMA_ALL_BDS);
 	}
 	XAxiDma_BdRingIntEnable(rxring, XAXIDMA_IRQ_ALL_MASK);
+#endif
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
@@ -492,6 +525,52 @@ static void axidma_recv_handler(void *arg)
 
 }
 
+#ifdef XAXIEMACIF_RX_POLL
+/*
+ * axidma_rx_poll():
+ *
+ * Moves up to budget frames from the RX ring to recv_q while the RX
+ * interrupts are off. When fewer frames than the budget are found the ring
+ * is empty: polling stops and the RX interrupts are enabled again. The DMA
+ * keeps the completion status of a frame received in between, so the
+ * interrupt fires right away and nothing is lost. Must be called with
+ * interrupts off.
+ *
+ * Returns the number of frames moved.
+ */
+u32_t axidma_rx_poll(xaxiemacif_s *xaxiemacif, u32_t budget)
+{
+	u32_t n_frames;
+
+	if (xaxiemacif->rx_polling == 0) {
+		return 0;
+	}
+
+	n_frames = axidma_rx_drain(xaxiemacif, budget);
+	if (n_frames < budget) {
+		xaxiemacif->rx_polling = 0;
+		XAxiDma_BdRingIntEnable(XAxiDma_GetRxRing(&xaxiemacif->axidma),
+					XAXIDMA_IRQ_ALL_MASK);
+	}
+
+	return n_frames;
+}
+#endif
+
+/*
+ * axidma_set_rx_coalesce():
+ *
+ * Changes the RX interrupt coalescing of the DMA: an interrupt is raised
+ * after count frames, or timer delay periods after the last frame when
+ * fewer arrived. A timer of 0 disables the delay interrupt.
+ */
+XStatus axidma_set_rx_coalesce(xaxiemacif_s *xaxiemacif, u32_t count,
+			       u32_t timer)
+{
+	return XAxiDma_BdRingSetCoalesce(XAxiDma_GetRxRing(&xaxiemacif->axidma),
+					 count, timer);
+}
+
 s32_t xaxiemac_is_tx_space_available(xaxiemacif_s *emac)
 {
 	XAxiDma_BdRing *txring;
@@ -38,6 +38,8 @@
 
 #include "lwip/stats.h"
 #include "lwip/inet_chksum.h"
+#include "lwip/prot/ip4.h"
+#include "lwip/prot/ip6.h"
 
 #include "netif/xadapter.h"
 #include "netif/xaxiemacif.h"
@@ -224,6 +226,64 @@ s32_t is_checksum_valid(XMcdma_Bd *rxbd, struct pbuf *p)
 	}
 }
 
+#if XAXIEMACIF_N_RX_QUEUES > 1
+/*
+ * Hashes the addresses, protocol and TCP/UDP ports of an IPv4 or IPv6
+ * frame. Source and destination are folded symmetrically, so both
+ * directions of a connection get the same value. Fragments are hashed on
+ * their addresses only, frames of other types hash to 0.
+ */
+static u32_t flow_hash(const struct pbuf *p)
+{
+	const u8_t *f = (const u8_t *)p->payload;
+	u32_t off = SIZEOF_ETH_HDR;
+	u32_t addr, alen, l4, i;
+	u32_t hash = 0;
+	u16_t type;
+	u8_t proto;
+
+	if (p->len < SIZEOF_ETH_HDR)
+		return 0;
+
+	type = lwip_htons(((const struct eth_hdr *)p->payload)->type);
+	if ((type == ETHTYPE_VLAN) && (p->len >= (off + SIZEOF_VLAN_HDR))) {
+		type = ((u16_t)f[off + 2] << 8) | f[off + 3];
+		off += SIZEOF_VLAN_HDR;
+	}
+
+	if ((type == ETHTYPE_IP) && (p->len >= (off + IP_HLEN))) {
+		proto = f[off + 9];
+		addr = off + 12;
+		alen = 4;
+		l4 = off + ((f[off] & 0x0f) * 4);
+		/* only the first fragment holds the ports */
+		if (((f[off + 6] & 0x3f) | f[off + 7]) != 0)
+			proto = 0;
+	} else if ((type == ETHTYPE_IPV6) && (p->len >= (off + IP6_HLEN))) {
+		proto = f[off + 6];
+		addr = off + 8;
+		alen = 16;
+		l4 = off + IP6_HLEN;
+	} else {
+		return 0;
+	}
+
+	for (i = 0; i < alen; i += 2) {
+		hash += (((u32_t)f[addr + i] << 8) | f[addr + i + 1]) +
+			(((u32_t)f[addr + alen + i] << 8) | f[addr + alen + i + 1]);
+	}
+	if (((proto == IP_PROTO_TCP) || (proto == IP_PROTO_UDP)) &&
+	    (p->len >= (l4 + 4))) {
+		hash += ((((u32_t)f[l4] << 8) | f[l4 + 1]) ^
+			 (((u32_t)f[l4 + 2] << 8) | f[l4 + 3])) << 16;
+	}
+	hash ^= proto;
+
+	hash *= 0x9E3779B1U;
+	return hash ^ (hash >> 16);
+}
+#endif
+
 #define XMcdma_BdMemCalc(Alignment, NumBd) \
 	(int)((sizeof(XMcdma_Bd)+((Alignment)-1)) & ~((Alignment)-1))*(NumBd)
 
@@ -393,6 +453,10 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 	xaxiemacif_s *xaxiemacif = (xaxiemacif_s *)(xemac->state);
 	XMcdma *McDmaInstPtr = &xaxiemacif->aximcdma;
 	XMcdma_ChanCtrl *Rx_Chan;
+	u32_t queue = 0;
+#if (XAXIEMACIF_N_RX_QUEUES > 1) && !NO_SYS
+	u32_t queued = 0;
+#endif
 
 #if !NO_SYS
 	xInsideISR++;
@@ -419,17 +483,24 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 		if (!is_checksum_valid(rxbd, p)) {
 			LWIP_DEBUGF(NETIF_DEBUG, ("Incorrect csum as calculated by the hw\r\n"));
 		}
+#endif
+#if XAXIEMACIF_N_RX_QUEUES > 1
+		/* keep all the frames of a flow on the same queue */
+		queue = flow_hash(p) % XAXIEMACIF_N_RX_QUEUES;
 #endif
 		/* store it in the receive queue,
 		 * where it'll be processed by a different handler
 		 */
-		if (pq_enqueue(xaxiemacif->recv_q, (void*)p) < 0) {
+		if (pq_enqueue(xaxiemacif->rx_q[queue], (void*)p) < 0) {
 #if LINK_STATS
 			lwip_stats.link.memerr++;
 			lwip_stats.link.drop++;
 #endif
 			pbuf_free(p);
 		}
+#if (XAXIEMACIF_N_RX_QUEUES > 1) && !NO_SYS
+		queued |= 1U << queue;
+#endif
 		rxbd = (XMcdma_Bd *)XMcdma_BdChainNextBd(Rx_Chan, rxbd);
 	}
 
@@ -439,6 +510,13 @@ static void axi_mcdma_recv_handler(void *CallBackRef, u32 ChanId)
 	/* return all the processed bd's back to the stack */
 	setup_rx_bds(Rx_Chan, Rx_Chan->BdCnt);
 #if !NO_SYS
+#if XAXIEMACIF_N_RX_QUEUES > 1
+	/* wake up the threads serving the queues that got frames */
+	for (queue = 0; queued != 0; queue++, queued >>= 1) {
+		if (queued & 1U)
+			sys_sem_signal(&xaxiemacif->rx_q_sem[queue]);
+	}
+#endif
 	sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
 #endif
@@ -535,13 +613,34 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 	XMcdma_Bd *txbdset, *txbd, *last_txbd = NULL;
 	XMcdma_ChanCtrl *Tx_Chan;
 	XStatus status;
+#if XAXIEMACIF_N_RX_QUEUES > 1
+	u8_t ChanId;
+#else
 	static u8_t ChanId = 1;
 	u8_t next_ChanId = ChanId;
+#endif
 
 	/* first count the number of pbufs */
 	for (q = p; q != NULL; q = q->next)
 		n_pbufs++;
 
+#if XAXIEMACIF_N_RX_QUEUES > 1
+	/*
+	 * Send all the frames of a flow through the same channel, so they
+	 * leave in order.
+	 */
+	ChanId = (flow_hash(p) %
+		  xaxiemacif->axi_ethernet.Config.AxiMcDmaChan_Cnt) + 1;
+	Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma, ChanId);
+	if (n_pbufs > Tx_Chan->BdCnt) {
+		process_sent_bds(Tx_Chan);
+		if (n_pbufs > Tx_Chan->BdCnt) {
+			LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error, not enough BD space in Chan %d\r\n",
+					ChanId));
+			return ERR_IF;
+		}
+	}
+#else
 	/* Transfer packets to TX DMA Channels in round-robin manner */
 	do {
 		Tx_Chan = XMcdma_GetMcdmaTxChan(&xaxiemacif->aximcdma, ChanId);
@@ -555,6 +654,7 @@ XStatus axi_mcdma_sgsend(xaxiemacif_s *xaxiemacif, struct pbuf *p)
 		}
 
 	} while (n_pbufs > Tx_Chan->BdCnt);
+#endif
 
 	txbdset = (XMcdma_Bd *)XMcdma_GetChanCurBd(Tx_Chan);
 
@@ -381,11 +381,7 @@ low_level_input(struct netif *netif)
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
 	xemacliteif_s *xemacliteif = (xemacliteif_s *)(xemac->state);
 
-	/* see if there is data to process */
-	if (pq_qlength(xemacliteif->recv_q) == 0)
-		return NULL;
-
-	/* return one packet from receive q */
+	/* return one packet from receive q, NULL if there is none */
 	return (struct pbuf *)pq_dequeue(xemacliteif->recv_q);
 }
 
@@ -423,16 +419,13 @@ xemacliteif_input(struct netif *netif)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
-	SYS_ARCH_DECL_PROTECT(lev);
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
-		SYS_ARCH_PROTECT(lev);
 		/* move received packet into a new pbuf */
 		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL)
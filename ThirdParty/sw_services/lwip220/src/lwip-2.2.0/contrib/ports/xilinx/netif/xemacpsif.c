@@ -205,6 +205,59 @@ return_pack_dropped:
 	return err;
 }
 
+/*
+ * xemacpsif_tx_batch_begin() / xemacpsif_tx_batch_end():
+ *
+ * Frames output between the two calls, e.g. all the segments emitted by
+ * one tcp_output(), are queued to the TX ring as one batch and the
+ * transmitter is started once for the whole batch. Frames sent with
+ * block_till_tx_complete are started at once, as their sender waits for
+ * the completion inside the batch.
+ */
+void xemacpsif_tx_batch_begin(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	emacps_tx_batch_begin(xemacpsif);
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+void xemacpsif_tx_batch_end(struct netif *netif)
+{
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	emacps_tx_batch_end(xemacpsif);
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/*
+ * xemacpsif_set_rx_poll_budget():
+ *
+ * Sets the most frames taken from the RX ring per poll when the receive
+ * interrupt is masked. Smaller budgets give other work more CPU time under
+ * load, larger ones fewer passes through the input loop.
+ */
+void xemacpsif_set_rx_poll_budget(struct netif *netif, u32_t budget)
+{
+#ifdef XLWIP_CONFIG_RX_POLL
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+
+	if (budget == 0)
+		budget = 1;
+	xemacpsif->rx_poll_budget = budget;
+#else
+	(void)netif;
+	(void)budget;
+#endif
+}
+
 /*
  * low_level_input():
  *
@@ -216,15 +269,19 @@ static struct pbuf * low_level_input(struct netif *netif)
 {
 	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
 	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
-	struct pbuf *p;
+#ifdef XLWIP_CONFIG_RX_POLL
+	SYS_ARCH_DECL_PROTECT(lev);
 
-	/* see if there is data to process */
-	if (pq_qlength(xemacpsif->recv_q) == 0)
-		return NULL;
+	/* take the next batch of frames from the RX ring */
+	if (pq_qlength(xemacpsif->recv_q) == 0) {
+		SYS_ARCH_PROTECT(lev);
+		(void)emacps_rx_poll(xemacpsif, xemacpsif->rx_poll_budget);
+		SYS_ARCH_UNPROTECT(lev);
+	}
+#endif
 
-	/* return one packet from receive q */
-	p = (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
-	return p;
+	/* return one packet from receive q, NULL if there is none */
+	return (struct pbuf *)pq_dequeue(xemacpsif->recv_q);
 }
 
 /*
@@ -260,21 +317,40 @@ s32_t xemacpsif_input(struct netif *netif)
 {
 	struct eth_hdr *ethhdr;
 	struct pbuf *p;
-	SYS_ARCH_DECL_PROTECT(lev);
+#if defined(XLWIP_CONFIG_RX_POLL) && !NO_SYS
+	struct xemac_s *xemac = (struct xemac_s *)(netif->state);
+	xemacpsif_s *xemacpsif = (xemacpsif_s *)(xemac->state);
+	u32_t n_frames = 0;
+#endif
 
 #if !NO_SYS
 	while (1)
 #endif
 	{
+#if defined(XLWIP_CONFIG_RX_POLL) && !NO_SYS
+		/*
+		 * budget used up: come back after other threads ran, unless
+		 * the ring was found empty and all its frames are taken
+		 */
+		if (n_frames == xemacpsif->rx_poll_budget) {
+			if (xemacpsif->rx_polling ||
+			    pq_qlength(xemacpsif->recv_q) != 0) {
+				sys_sem_signal(&xemac->sem_rx_data_available);
+			}
+			return 1;
+		}
+#endif
+
 		/* move received packet into a new pbuf */
-		SYS_ARCH_PROTECT(lev);
 		p = low_level_input(netif);
-		SYS_ARCH_UNPROTECT(lev);
 
 		/* no packet could be read, silently ignore this */
 		if (p == NULL) {
 			return 0;
 		}
+#if defined(XLWIP_CONFIG_RX_POLL) && !NO_SYS
+		n_frames++;
+#endif
 
 		/* points to packet payload, which starts with an Ethernet header */
 		ethhdr = p->payload;
@@ -359,6 +435,12 @@ static err_t low_level_init(struct netif *netif)
 	xemac->type = xemac_type_emacps;
 
 	xemacpsif->send_q = NULL;
+	xemacpsif->tx_batch = 0;
+	xemacpsif->tx_pending = 0;
+#ifdef XLWIP_CONFIG_RX_POLL
+	xemacpsif->rx_polling = 0;
+	xemacpsif->rx_poll_budget = XLWIP_CONFIG_RX_POLL_BUDGET;
+#endif
 	xemacpsif->recv_q = pq_create_queue();
 	if (!xemacpsif->recv_q)
 		return ERR_MEM;
@@ -490,6 +572,7 @@ void HandleTxErrors(struct xemac_s *xemac)
 	free_onlytx_pbufs(xemacpsif);
 
 	clean_dma_txdescs(xemac);
+	xemacpsif->tx_pending = 0;
 	netctrlreg = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress,
 													XEMACPS_NWCTRL_OFFSET);
 	netctrlreg = netctrlreg | (XEMACPS_NWCTRL_TXEN_MASK);
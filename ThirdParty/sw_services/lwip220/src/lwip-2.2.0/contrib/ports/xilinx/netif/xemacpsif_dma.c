@@ -133,6 +133,107 @@ extern u32 xInsideISR;
 #define XEMACPS_BD_TO_INDEX(ringptr, bdptr)				\
 	(((UINTPTR)bdptr - (UINTPTR)(ringptr)->BaseBdAddr) / (ringptr)->Separation)
 
+/* budget for draining the whole RX ring */
+#define EMACPS_RX_NO_BUDGET	0xFFFFFFFFU
+
+#ifdef XLWIP_CONFIG_RX_ZERO_COPY
+/******************************************************************************
+ * Zero-copy receive.
+ *
+ * Instead of a PBUF_POOL pbuf per RX BD, frames are received into a static
+ * pool of buffers shared by all GEM interfaces. A received buffer is handed
+ * to the stack as a custom pbuf that wraps it in place, so there is neither
+ * an allocation nor a copy per frame. When the stack frees the pbuf, the
+ * buffer goes back to the pool and, if a ring was left with empty BDs
+ * because the pool ran dry, the ring is refilled right away.
+ *
+ * Each buffer is a whole number of cache lines so that the invalidation done
+ * before handing it to the hardware never touches a neighbouring buffer.
+ * Buffers held by the stack (queued TCP segments, reassembly) are not
+ * available to the rings, so the pool should be well above the number of RX
+ * BDs of all interfaces.
+ *********************************************************************************/
+#if !LWIP_SUPPORT_CUSTOM_PBUF
+#error "Zero-copy receive requires LWIP_SUPPORT_CUSTOM_PBUF"
+#endif
+
+#ifdef ZYNQMP_USE_JUMBO
+#define RX_ZC_FRAME_SIZE	MAX_FRAME_SIZE_JUMBO
+#else
+#define RX_ZC_FRAME_SIZE	XEMACPS_MAX_FRAME_SIZE
+#endif
+#define RX_ZC_ALIGN		64
+#define RX_ZC_BUF_SIZE		((RX_ZC_FRAME_SIZE + RX_ZC_ALIGN - 1) & ~(RX_ZC_ALIGN - 1))
+
+typedef struct rx_zc_buf {
+	struct pbuf_custom pc;	/* first member, the pbuf is cast back */
+	xemacpsif_s *owner;	/* interface that received into the buffer */
+	struct rx_zc_buf *next;	/* free list link */
+	u8_t *data;		/* DMA buffer */
+} rx_zc_buf_t;
+
+static u8_t rx_zc_data[XLWIP_CONFIG_N_RX_ZC_BUFS][RX_ZC_BUF_SIZE]
+				__attribute__ ((aligned (RX_ZC_ALIGN)));
+static rx_zc_buf_t rx_zc_bufs[XLWIP_CONFIG_N_RX_ZC_BUFS];
+static rx_zc_buf_t *rx_zc_free_list;
+static u32_t rx_zc_free_cnt;
+static u32_t rx_zc_pool_ready;
+/* A max of 4 different ethernet interfaces are supported */
+static xemacpsif_s *rx_zc_emacs[4];
+
+static void rx_zc_pbuf_free(struct pbuf *p);
+
+static void rx_zc_pool_init(void)
+{
+	u32_t i;
+
+	rx_zc_free_list = NULL;
+	for (i = 0; i < XLWIP_CONFIG_N_RX_ZC_BUFS; i++) {
+		rx_zc_bufs[i].pc.custom_free_function = rx_zc_pbuf_free;
+		rx_zc_bufs[i].owner = NULL;
+		rx_zc_bufs[i].data = rx_zc_data[i];
+		rx_zc_bufs[i].next = rx_zc_free_list;
+		rx_zc_free_list = &rx_zc_bufs[i];
+	}
+	rx_zc_free_cnt = XLWIP_CONFIG_N_RX_ZC_BUFS;
+	rx_zc_pool_ready = 1;
+}
+
+/* Returns a buffer to the pool, called with interrupts disabled */
+static inline void rx_zc_put(rx_zc_buf_t *b)
+{
+	b->owner = NULL;
+	b->next = rx_zc_free_list;
+	rx_zc_free_list = b;
+	rx_zc_free_cnt++;
+}
+
+/* custom_free_function of the pbufs wrapping received frames */
+static void rx_zc_pbuf_free(struct pbuf *p)
+{
+	xemacpsif_s *xemacpsif;
+	u32_t i;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	SYS_ARCH_PROTECT(lev);
+	rx_zc_put((rx_zc_buf_t *)(void *)p);
+	for (i = 0; i < 4; i++) {
+		xemacpsif = rx_zc_emacs[i];
+		if ((xemacpsif != NULL) && (xemacpsif->rx_zc_starved != 0)) {
+			setup_rx_bds(xemacpsif, &XEmacPs_GetRxRing(&xemacpsif->emacps));
+		}
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+
+/* Wraps a received buffer into a pbuf of the frame length */
+static inline struct pbuf *rx_zc_wrap(rx_zc_buf_t *b, u32_t len)
+{
+	return pbuf_alloced_custom(PBUF_RAW, (u16_t)len, PBUF_REF, &b->pc,
+				   b->data, (u16_t)RX_ZC_BUF_SIZE);
+}
+#endif
+
 
 s32_t xemacps_is_tx_space_available(xemacpsif_s *emac)
 {
@@ -292,6 +393,42 @@ void xemacps_process_sent_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *txring)
 	return;
 }
 
+/* Tells the controller to fetch the TX BDs queued to the ring */
+static inline void emacps_start_tx(xemacpsif_s *xemacpsif)
+{
+	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET,
+	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
+	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+}
+
+/*
+ * emacps_tx_batch_begin() / emacps_tx_batch_end():
+ *
+ * Between the two calls, frames are queued to the TX ring without starting
+ * the transmitter for each of them; the whole batch is started once at the
+ * end. The transmitter is still started early when half of the ring is in
+ * use, so a long batch never waits for BDs that nobody will release, and
+ * for a frame sent with block_till_tx_complete, whose sender waits for its
+ * completion before the batch can end. Must be called with interrupts off.
+ */
+void emacps_tx_batch_begin(xemacpsif_s *xemacpsif)
+{
+	xemacpsif->tx_batch++;
+}
+
+void emacps_tx_batch_end(xemacpsif_s *xemacpsif)
+{
+	if (xemacpsif->tx_batch == 0) {
+		return;
+	}
+	xemacpsif->tx_batch--;
+	if ((xemacpsif->tx_batch == 0) && (xemacpsif->tx_pending != 0)) {
+		xemacpsif->tx_pending = 0;
+		emacps_start_tx(xemacpsif);
+	}
+}
+
 void emacps_send_handler(void *arg)
 {
 	struct xemac_s *xemac;
@@ -344,6 +481,25 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 	for (q = p, n_pbufs = 0; q != NULL; q = q->next)
 		n_pbufs++;
 
+	/*
+	 * Chains of many small pbufs cost a BD and a cache flush each;
+	 * send them from a single contiguous copy instead.
+	 */
+	if (n_pbufs > XEMACPS_TX_MAX_FRAGS) {
+		q = pbuf_clone(PBUF_RAW, PBUF_RAM, p);
+		if (q != NULL) {
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+			status = emacps_sgsend(xemacpsif, q, block_till_tx_complete,
+					       to_block_index);
+#else
+			status = emacps_sgsend(xemacpsif, q);
+#endif
+			/* the BD keeps its own reference */
+			pbuf_free(q);
+			return status;
+		}
+	}
+
 	/* obtain as many BD's */
 	status = XEmacPs_BdRingAlloc(txring, n_pbufs, &txbdset);
 	if (status != XST_SUCCESS) {
@@ -411,14 +567,93 @@ XStatus emacps_sgsend(xemacpsif_s *xemacpsif, struct pbuf *p)
 		LWIP_DEBUGF(NETIF_DEBUG, ("sgsend: Error submitting TxBD\r\n"));
 		return XST_FAILURE;
 	}
-	/* Start transmit */
-	XEmacPs_WriteReg((xemacpsif->emacps).Config.BaseAddress,
-	XEMACPS_NWCTRL_OFFSET,
-	(XEmacPs_ReadReg((xemacpsif->emacps).Config.BaseAddress,
-	XEMACPS_NWCTRL_OFFSET) | XEMACPS_NWCTRL_STARTTX_MASK));
+	/* Start transmit, unless a batch is open, the ring has room and
+	   nobody waits for this frame to complete */
+	if ((xemacpsif->tx_batch != 0) &&
+#if LWIP_UDP_OPT_BLOCK_TX_TILL_COMPLETE
+	    (block_till_tx_complete == 0) &&
+#endif
+	    (XEmacPs_BdRingGetFreeCnt(txring) > (XLWIP_CONFIG_N_TX_DESC / 2))) {
+		xemacpsif->tx_pending = 1;
+	} else {
+		xemacpsif->tx_pending = 0;
+		emacps_start_tx(xemacpsif);
+	}
 	return status;
 }
 
+#ifdef XLWIP_CONFIG_RX_ZERO_COPY
+void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
+{
+	XEmacPs_Bd *rxbdset, *rxbd;
+	rx_zc_buf_t *b;
+	XStatus status;
+	u32_t freebds;
+	u32_t bdindex;
+	u32_t n;
+	u32 *temp;
+	u32_t index;
+	SYS_ARCH_DECL_PROTECT(lev);
+
+	index = get_base_index_rxpbufsstorage (xemacpsif);
+
+	/* Take as many buffers as there are empty BDs and arm them in one go */
+	SYS_ARCH_PROTECT(lev);
+	freebds = XEmacPs_BdRingGetFreeCnt (rxring);
+	n = (freebds < rx_zc_free_cnt) ? freebds : rx_zc_free_cnt;
+	xemacpsif->rx_zc_starved = (n < freebds) ? 1 : 0;
+	if (n == 0) {
+		SYS_ARCH_UNPROTECT(lev);
+		return;
+	}
+	status = XEmacPs_BdRingAlloc(rxring, n, &rxbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("setup_rx_bds: Error allocating RxBD\r\n"));
+		SYS_ARCH_UNPROTECT(lev);
+		return;
+	}
+	status = XEmacPs_BdRingToHw(rxring, n, rxbdset);
+	if (status != XST_SUCCESS) {
+		LWIP_DEBUGF(NETIF_DEBUG, ("Error committing RxBD to hardware\r\n"));
+		XEmacPs_BdRingUnAlloc(rxring, n, rxbdset);
+		SYS_ARCH_UNPROTECT(lev);
+		return;
+	}
+
+	for (rxbd = rxbdset; n > 0; n--) {
+		b = rx_zc_free_list;
+		rx_zc_free_list = b->next;
+		rx_zc_free_cnt--;
+		b->owner = xemacpsif;
+
+		if (xemacpsif->emacps.Config.IsCacheCoherent == 0) {
+			Xil_DCacheInvalidateRange((UINTPTR)b->data, (UINTPTR)RX_ZC_BUF_SIZE);
+		}
+		bdindex = XEMACPS_BD_TO_INDEX(rxring, rxbd);
+		temp = (u32 *)rxbd;
+		temp++;
+		/* Status field should be cleared first to avoid drops */
+		*temp = 0;
+		dsb();
+
+		/* Set high address when required */
+#ifdef __aarch64__
+		XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_HI_OFFSET,
+			(((UINTPTR)b->data) & ULONG64_HI_MASK) >> 32U);
+#endif
+		/* Set address field; add WRAP bit on last descriptor  */
+		if (bdindex == (XLWIP_CONFIG_N_RX_DESC - 1)) {
+			XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, ((UINTPTR)b->data | XEMACPS_RXBUF_WRAP_MASK));
+		} else {
+			XEmacPs_BdWrite(rxbd, XEMACPS_BD_ADDR_OFFSET, (UINTPTR)b->data);
+		}
+
+		rx_pbufs_storage[index + bdindex] = (UINTPTR)b;
+		rxbd = XEmacPs_BdRingNext(rxring, rxbd);
+	}
+	SYS_ARCH_UNPROTECT(lev);
+}
+#else
 void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 {
 	XEmacPs_Bd *rxbd;
@@ -498,44 +733,34 @@ void setup_rx_bds(xemacpsif_s *xemacpsif, XEmacPs_BdRing *rxring)
 		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
 	}
 }
+#endif
 
-void emacps_recv_handler(void *arg)
+/*
+ * Moves up to budget received frames from the RX ring to recv_q and gives
+ * the BDs back to the controller. Returns the number of frames moved.
+ */
+static u32_t emacps_rx_drain(xemacpsif_s *xemacpsif, u32_t budget)
 {
 	struct pbuf *p;
 	XEmacPs_Bd *rxbdset, *curbdptr;
-	struct xemac_s *xemac;
-	xemacpsif_s *xemacpsif;
 	XEmacPs_BdRing *rxring;
 	volatile s32_t bd_processed;
 	s32_t rx_bytes, k;
 	u32_t bdindex;
-	u32_t regval;
 	u32_t index;
-	u32_t gigeversion;
+	u32_t limit;
+	u32_t done = 0;
 
-	xemac = (struct xemac_s *)(arg);
-	xemacpsif = (xemacpsif_s *)(xemac->state);
 	rxring = &XEmacPs_GetRxRing(&xemacpsif->emacps);
-
-#if !NO_SYS
-	xInsideISR++;
-#endif
-
-	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
 	index = get_base_index_rxpbufsstorage (xemacpsif);
-	/*
-	 * If Reception done interrupt is asserted, call RX call back function
-	 * to handle the processed BDs and then raise the according flag.
-	 */
-	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
-	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
-	if (gigeversion <= 2) {
-			resetrx_on_no_rxdata(xemacpsif);
-	}
 
-	while(1) {
+	while (done < budget) {
 
-		bd_processed = XEmacPs_BdRingFromHwRx(rxring, XLWIP_CONFIG_N_RX_DESC, &rxbdset);
+		limit = budget - done;
+		if (limit > XLWIP_CONFIG_N_RX_DESC) {
+			limit = XLWIP_CONFIG_N_RX_DESC;
+		}
+		bd_processed = XEmacPs_BdRingFromHwRx(rxring, limit, &rxbdset);
 		if (bd_processed <= 0) {
 			break;
 		}
@@ -543,7 +768,6 @@ void emacps_recv_handler(void *arg)
 		for (k = 0, curbdptr=rxbdset; k < bd_processed; k++) {
 
 			bdindex = XEMACPS_BD_TO_INDEX(rxring, curbdptr);
-			p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
 
 			/*
 			 * Adjust the buffer size to the actual number of bytes received.
@@ -553,7 +777,13 @@ void emacps_recv_handler(void *arg)
 #else
 			rx_bytes = XEmacPs_BdGetLength(curbdptr);
 #endif
+#ifdef XLWIP_CONFIG_RX_ZERO_COPY
+			p = rx_zc_wrap((rx_zc_buf_t *)rx_pbufs_storage[index + bdindex], rx_bytes);
+			rx_pbufs_storage[index + bdindex] = 0;
+#else
+			p = (struct pbuf *)rx_pbufs_storage[index + bdindex];
 			pbuf_realloc(p, rx_bytes);
+#endif
 
 			/* Invalidate RX frame before queuing to handle
 			 * L1 cache prefetch conditions on any architecture.
@@ -577,7 +807,47 @@ void emacps_recv_handler(void *arg)
 		/* free up the BD's */
 		XEmacPs_BdRingFree(rxring, bd_processed, rxbdset);
 		setup_rx_bds(xemacpsif, rxring);
+		done += bd_processed;
 	}
+
+	return done;
+}
+
+void emacps_recv_handler(void *arg)
+{
+	struct xemac_s *xemac;
+	xemacpsif_s *xemacpsif;
+	u32_t regval;
+	u32_t gigeversion;
+
+	xemac = (struct xemac_s *)(arg);
+	xemacpsif = (xemacpsif_s *)(xemac->state);
+
+#if !NO_SYS
+	xInsideISR++;
+#endif
+
+	gigeversion = ((Xil_In32(xemacpsif->emacps.Config.BaseAddress + 0xFC)) >> 16) & 0xFFF;
+	/*
+	 * If Reception done interrupt is asserted, call RX call back function
+	 * to handle the processed BDs and then raise the according flag.
+	 */
+	regval = XEmacPs_ReadReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET);
+	XEmacPs_WriteReg(xemacpsif->emacps.Config.BaseAddress, XEMACPS_RXSR_OFFSET, regval);
+	if (gigeversion <= 2) {
+			resetrx_on_no_rxdata(xemacpsif);
+	}
+
+#ifdef XLWIP_CONFIG_RX_POLL
+	/*
+	 * Leave the frames in the ring and stop further RX interrupts,
+	 * xemacpsif_input() polls the ring until it is empty.
+	 */
+	XEmacPs_IntDisable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	xemacpsif->rx_polling = 1;
+#else
+	(void)emacps_rx_drain(xemacpsif, EMACPS_RX_NO_BUDGET);
+#endif
 #if !NO_SYS
 	sys_sem_signal(&xemac->sem_rx_data_available);
 	xInsideISR--;
@@ -586,6 +856,36 @@ void emacps_recv_handler(void *arg)
 	return;
 }
 
+#ifdef XLWIP_CONFIG_RX_POLL
+/*
+ * emacps_rx_poll():
+ *
+ * Moves up to budget frames from the RX ring to recv_q while the RX
+ * interrupt is masked. When fewer frames than the budget are found the ring
+ * is empty: polling stops and the RX interrupt is unmasked. A frame received
+ * in between leaves its status latched, so the interrupt fires right away
+ * and nothing is lost. Must be called with interrupts off.
+ *
+ * Returns the number of frames moved.
+ */
+u32_t emacps_rx_poll(xemacpsif_s *xemacpsif, u32_t budget)
+{
+	u32_t n_frames;
+
+	if (xemacpsif->rx_polling == 0) {
+		return 0;
+	}
+
+	n_frames = emacps_rx_drain(xemacpsif, budget);
+	if (n_frames < budget) {
+		xemacpsif->rx_polling = 0;
+		XEmacPs_IntEnable(&xemacpsif->emacps, XEMACPS_IXR_FRAMERX_MASK);
+	}
+
+	return n_frames;
+}
+#endif
+
 void clean_dma_txdescs(struct xemac_s *xemac)
 {
 	XEmacPs_Bd bdtemplate;
@@ -611,10 +911,12 @@ XStatus init_dma(struct xemac_s *xemac)
 	XEmacPs_Bd bdtemplate;
 	XEmacPs_BdRing *rxringptr, *txringptr;
 	XEmacPs_Bd *rxbd;
+#ifndef XLWIP_CONFIG_RX_ZERO_COPY
 	struct pbuf *p;
+	u32_t bdindex;
+#endif
 	XStatus status;
 	s32_t i;
-	u32_t bdindex;
 	volatile UINTPTR tempaddress;
 	u32_t index;
 	u32_t gigeversion;
@@ -725,6 +1027,32 @@ XStatus init_dma(struct xemac_s *xemac)
 		return ERR_IF;
 	}
 
+#ifdef XLWIP_CONFIG_RX_ZERO_COPY
+	if (rx_zc_pool_ready == 0) {
+		rx_zc_pool_init();
+	}
+	/* xemacpsif_s comes from mem_malloc, clear the flag before it is seen */
+	xemacpsif->rx_zc_starved = 0;
+	rx_zc_emacs[index / XLWIP_CONFIG_N_RX_DESC] = xemacpsif;
+
+	/*
+	 * Keep every RxBD owned by software until a buffer is attached to it,
+	 * then attach buffers from the pool to all of them in one batch.
+	 */
+	rxbd = (XEmacPs_Bd *)rxringptr->BaseBdAddr;
+	for (i = 0; i < XLWIP_CONFIG_N_RX_DESC; i++) {
+		temp = (u32 *)rxbd;
+		*temp = XEMACPS_RXBUF_NEW_MASK;
+		if (i == (XLWIP_CONFIG_N_RX_DESC - 1)) {
+			*temp |= XEMACPS_RXBUF_WRAP_MASK;
+		}
+		temp++;
+		*temp = 0;
+		rxbd = XEmacPs_BdRingNext(rxringptr, rxbd);
+	}
+	dsb();
+	setup_rx_bds(xemacpsif, rxringptr);
+#else
 	/*
 	 * Allocate RX descriptors, 1 RxBD at a time.
 	 */
@@ -779,6 +1107,7 @@ XStatus init_dma(struct xemac_s *xemac)
 
 		rx_pbufs_storage[index + bdindex] = (UINTPTR)p;
 	}
+#endif
 	XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.RxBdRing.BaseBdAddr, 0, XEMACPS_RECV);
 	if (gigeversion > 2) {
 		XEmacPs_SetQueuePtr(&(xemacpsif->emacps), xemacpsif->emacps.TxBdRing.BaseBdAddr, 1, XEMACPS_SEND);
@@ -898,9 +1227,16 @@ void free_txrx_pbufs(xemacpsif_s *xemacpsif)
 
 	index1 = get_base_index_rxpbufsstorage(xemacpsif);
 	for (index = index1; index < (index1 + XLWIP_CONFIG_N_RX_DESC); index++) {
+#ifdef XLWIP_CONFIG_RX_ZERO_COPY
+		/* Buffers still attached to BDs were never handed to the stack */
+		if (rx_pbufs_storage[index] != 0) {
+			rx_zc_put((rx_zc_buf_t *)rx_pbufs_storage[index]);
+			rx_pbufs_storage[index] = 0;
+		}
+#else
 		p = (struct pbuf *)rx_pbufs_storage[index];
 		pbuf_free(p);
-
+#endif
 	}
 }
 
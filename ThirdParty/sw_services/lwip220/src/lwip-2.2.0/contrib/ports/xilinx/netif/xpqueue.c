@@ -32,8 +32,23 @@
 #include <stdlib.h>
 
 #include "netif/xpqueue.h"
+#include "xlwipconfig.h"
 
+/* send and receive queue, plus the extra flow queues of MCDMA */
+#ifdef XLWIP_CONFIG_N_RX_QUEUES
+#define NUM_QUEUES	(1 + XLWIP_CONFIG_N_RX_QUEUES)
+#else
 #define NUM_QUEUES	2
+#endif
+
+/*
+ * The producer fills a slot before it publishes the new head, and the
+ * consumer reads a slot before it hands it back through tail. The
+ * release/acquire pairs order these accesses between the ISR and the
+ * thread, and between cores.
+ */
+#define PQ_LOAD_ACQUIRE(x)	__atomic_load_n(&(x), __ATOMIC_ACQUIRE)
+#define PQ_STORE_RELEASE(x, v)	__atomic_store_n(&(x), (v), __ATOMIC_RELEASE)
 
 pq_queue_t pq_queue[NUM_QUEUES];
 
@@ -53,41 +68,69 @@ pq_create_queue()
 	if (!q)
 		return q;
 
-	q->head = q->tail = q->len = 0;
+	q->head = q->tail = 0;
 
 	return q;
 }
 
+/*
+ * Producer side. Head and tail run freely; their difference is the number
+ * of queued entries.
+ */
 int
 pq_enqueue(pq_queue_t *q, void *p)
 {
-	if (q->len == PQ_QUEUE_SIZE)
+	unsigned int head = q->head;
+
+	if (head - PQ_LOAD_ACQUIRE(q->tail) == PQ_QUEUE_SIZE)
 		return -1;
 
-	q->data[q->head] = p;
-	q->head = (q->head + 1)%PQ_QUEUE_SIZE;
-	q->len++;
+	q->data[head & PQ_QUEUE_MASK] = p;
+	PQ_STORE_RELEASE(q->head, head + 1);
 
 	return 0;
 }
 
+/* Consumer side */
 void*
 pq_dequeue(pq_queue_t *q)
 {
-	int ptail;
+	unsigned int tail = q->tail;
+	void *p;
 
-	if (q->len == 0)
+	if (PQ_LOAD_ACQUIRE(q->head) == tail)
 		return NULL;
 
-	ptail = q->tail;
-	q->tail = (q->tail + 1)%PQ_QUEUE_SIZE;
-	q->len--;
+	p = q->data[tail & PQ_QUEUE_MASK];
+	PQ_STORE_RELEASE(q->tail, tail + 1);
+
+	return p;
+}
+
+/*
+ * Consumer side. Takes up to n entries with a single update of tail.
+ * Returns the number of entries stored in p.
+ */
+int
+pq_dequeue_batch(pq_queue_t *q, void **p, int n)
+{
+	unsigned int tail = q->tail;
+	unsigned int avail = PQ_LOAD_ACQUIRE(q->head) - tail;
+	int i;
+
+	if ((unsigned int)n > avail)
+		n = (int)avail;
+
+	for (i = 0; i < n; i++)
+		p[i] = q->data[(tail + i) & PQ_QUEUE_MASK];
+	if (n > 0)
+		PQ_STORE_RELEASE(q->tail, tail + n);
 
-	return q->data[ptail];
+	return n;
 }
 
 int
 pq_qlength(pq_queue_t *q)
 {
-	return q->len;
+	return (int)(PQ_LOAD_ACQUIRE(q->head) - PQ_LOAD_ACQUIRE(q->tail));
 }
@@ -15,6 +15,7 @@ set(lwip220_n_tx_descriptors 64 CACHE STRING "Number of TX Buffer Descriptors to
 set(lwip220_n_rx_descriptors 64 CACHE STRING "Number of RX Buffer Descriptors to be used in SDMA mode")
 set(lwip220_n_tx_coalesce 1 CACHE STRING "Setting for TX Interrupt coalescing.")
 set(lwip220_n_rx_coalesce 1 CACHE STRING "Setting for RX Interrupt coalescing.")
+set(lwip220_n_rx_queues 1 CACHE STRING "Number of receive queues frames are steered to by flow hash, each served by its own input thread. Applicable only for Axi-Ethernet with MCDMA.")
 option(lwip220_temac_tcp_rx_checksum_offload "Offload TCP Receive checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_tx_checksum_offload "Offload TCP Transmit checksum calculation (hardware support required)" OFF)
 option(lwip220_temac_tcp_ip_rx_checksum_offload "Offload TCP and IP Receive checksum calculation (hardware support required)" OFF)
@@ -23,6 +24,10 @@ set(lwip220_temac_phy_link_speed CONFIG_LINKSPEED_AUTODETECT CACHE STRING "link
 set_property(CACHE lwip220_temac_phy_link_speed PROPERTY STRINGS CONFIG_LINKSPEED10 CONFIG_LINKSPEED100 CONFIG_LINKSPEED1000 CONFIG_LINKSPEED_AUTODETECT)
 option(lwip220_temac_use_jumbo_frames "use jumbo frames" OFF)
 set(lwip220_temac_emac_number 0 CACHE STRING "Zynq Ethernet Interface number")
+option(lwip220_temac_rx_zero_copy "Receive into a static buffer pool wrapped in custom pbufs instead of copying through PBUF_POOL pbufs. Applicable only for GEM." OFF)
+set(lwip220_n_rx_zero_copy_buffers 128 CACHE STRING "Number of receive buffers in the zero-copy pool shared by all GEM interfaces")
+option(lwip220_temac_rx_poll "Mask the receive interrupt after the first frame and poll the RX ring from xemacif_input() until it is empty. Applicable only for GEM and Axi-Ethernet with AXI DMA." OFF)
+set(lwip220_rx_poll_budget 64 CACHE STRING "Maximum number of frames taken from the RX ring per poll when temac_rx_poll is enabled")
 
 set(lwip220_mem_size 131072 CACHE STRING "Size of the heap memory (bytes).")
 set(lwip220_memp_n_pbuf 16 CACHE STRING "Number of memp struct pbufs. Set this high if application sends lot of data out of ROM")
@@ -385,12 +390,23 @@ endif()
 
 if (${CONFIG_EMACPS})
     set(XLWIP_CONFIG_INCLUDE_GEM 1)
+    if (${lwip220_temac_rx_zero_copy})
+        set(XLWIP_CONFIG_RX_ZERO_COPY 1)
+        set(XLWIP_CONFIG_N_RX_ZC_BUFS ${lwip220_n_rx_zero_copy_buffers})
+    endif()
 endif()
 
 set(XLWIP_CONFIG_N_TX_DESC ${lwip220_n_tx_descriptors})
 set(XLWIP_CONFIG_N_RX_DESC ${lwip220_n_rx_descriptors})
 set(XLWIP_CONFIG_N_TX_COALESCE ${lwip220_n_tx_coalesce})
 set(XLWIP_CONFIG_N_RX_COALESCE ${lwip220_n_rx_coalesce})
+if (${lwip220_n_rx_queues} GREATER 1)
+    set(XLWIP_CONFIG_N_RX_QUEUES ${lwip220_n_rx_queues})
+endif()
+if (${lwip220_temac_rx_poll})
+    set(XLWIP_CONFIG_RX_POLL 1)
+    set(XLWIP_CONFIG_RX_POLL_BUDGET ${lwip220_rx_poll_budget})
+endif()
 
 if(("${CMAKE_SYSTEM_NAME}" STREQUAL "FreeRTOS") AND
    ("${lwip220_api_mode}" STREQUAL SOCKET_API))
@@ -102,6 +102,7 @@
 * 4.3   ap     11/29/23 Add support for Sanitize feature.
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
 * 4.4   ht     09/30/24 Fix IAR warnings.
+*       sb     10/16/26 Add non-blocking scatter-gather read/write APIs.
 *
 * </pre>
 *
@@ -245,6 +246,15 @@ typedef struct {
 }  __attribute__((__packed__))XSdPs_Adma2Descriptor64;
 #endif
 
+/**
+ * Buffer of a scatter-gather transfer. The blocks of all entries of a list
+ * are chained in the ADMA2 descriptor table and moved by one command.
+ */
+typedef struct {
+	u8 *Buff;		/**< Data buffer of the entry */
+	u32 BlkCnt;		/**< Number of blocks held by the buffer */
+} XSdPs_SgEntry;
+
 /**
  * The XSdPs driver instance data. The user is required to allocate a
  * variable of this type for every SD device in the system. A pointer
@@ -340,6 +350,10 @@ s32 XSdPs_StartReadTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckReadTransfer(XSdPs *InstancePtr);
 s32 XSdPs_StartWriteTransfer(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_CheckWriteTransfer(XSdPs *InstancePtr);
+s32 XSdPs_StartReadTransferSg(XSdPs *InstancePtr, u32 Arg,
+			       const XSdPs_SgEntry *SgList, u32 SgCnt);
+s32 XSdPs_StartWriteTransferSg(XSdPs *InstancePtr, u32 Arg,
+				const XSdPs_SgEntry *SgList, u32 SgCnt);
 s32 XSdPs_Erase(XSdPs *InstancePtr, u32 StartAddr, u32 EndAddr);
 s32 XSdPs_Sanitize(XSdPs *InstancePtr);
 
@@ -40,6 +40,8 @@
 * 	sa     01/25/23 Use instance structure to store DMA descriptor tables.
 * 4.2   ap     08/09/23 reordered function XSdPs_Identify_UhsMode.
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+* 4.4   sb     10/16/26 Add XSdPs_TransferSg for chained multi-buffer transfers.
+*                       Clear busy flag when a non-blocking transfer fails.
 * </pre>
 *
 ******************************************************************************/
@@ -151,6 +153,54 @@ s32 XSdPs_Write(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff)
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* Issues an SD read or write whose data is spread over a list of buffers.
+* The buffers are chained in one ADMA2 descriptor table and moved with a
+* single single/multiple block command.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	Arg Address passed by the user that is to be sent as
+* 		argument along with the command.
+* @param	SgList Pointer to the list of buffers.
+* @param	SgCnt Number of entries in the list.
+* @param	IsRead TRUE to read from the card, FALSE to write to it.
+*
+* @return
+* 		- XST_SUCCESS if the command was issued
+* 		- XST_FAILURE if the list does not fit the descriptor table
+* 		or the command failed
+*
+******************************************************************************/
+s32 XSdPs_TransferSg(XSdPs *InstancePtr, u32 Arg, const XSdPs_SgEntry *SgList,
+		     u32 SgCnt, u8 IsRead)
+{
+	s32 Status;
+	u32 BlkCnt = 0U;
+	u32 Cmd;
+
+	Status = XSdPs_SetupSgDma(InstancePtr, SgList, SgCnt, IsRead, &BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	if (IsRead == TRUE) {
+		Cmd = (BlkCnt == 1U) ? CMD17 : CMD18;
+	} else {
+		Cmd = (BlkCnt == 1U) ? CMD24 : CMD25;
+	}
+
+	Status = XSdPs_CmdTransfer(InstancePtr, Cmd, Arg, BlkCnt);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+	}
+
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * @brief
@@ -184,6 +234,8 @@ s32 XSdPs_CheckTransferComplete(XSdPs *InstancePtr)
 		XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
 				 XSDPS_ERR_INTR_STS_OFFSET,
 				 XSDPS_ERROR_INTR_ALL_MASK);
+		/* The failed transfer is over, allow the next one to start */
+		InstancePtr->IsBusy = FALSE;
 		Status = XST_FAILURE;
 		goto RETURN_PATH;
 	}
@@ -28,6 +28,7 @@
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 * 4.1   sa     01/06/23 Include xil_util.h in this file.
 * 4.2   ap     08/09/23 Add XSdPs_SetTapDelay APIs.
+* 4.4   sb     10/16/26 Add scatter-gather transfer helpers.
 * </pre>
 *
 ******************************************************************************/
@@ -54,6 +55,8 @@ s32 XSdPs_CmdTransfer(XSdPs *InstancePtr, u32 Cmd, u32 Arg, u32 BlkCnt);
 s32 XSdPs_SetupTransfer(XSdPs *InstancePtr);
 s32 XSdPs_Read(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, u8 *Buff);
 s32 XSdPs_Write(XSdPs *InstancePtr, u32 Arg, u32 BlkCnt, const u8 *Buff);
+s32 XSdPs_TransferSg(XSdPs *InstancePtr, u32 Arg, const XSdPs_SgEntry *SgList,
+		     u32 SgCnt, u8 IsRead);
 s32 XSdPs_CheckTransferComplete(XSdPs *InstancePtr);
 void XSdPs_Identify_UhsMode(XSdPs *InstancePtr, u8 *ReadBuff);
 s32 XSdPs_DllReset(XSdPs *InstancePtr);
@@ -101,6 +104,8 @@ s32 XSdPs_Change_MmcBusSpeed(XSdPs *InstancePtr);
 s32 XSdPs_CalcBusSpeed(XSdPs *InstancePtr, u32 *Arg);
 void XSdPs_SetupReadDma(XSdPs *InstancePtr, u16 BlkCnt, u16 BlkSize, u8 *Buff);
 void XSdPs_SetupWriteDma(XSdPs *InstancePtr, u16 BlkCnt, u16 BlkSize, const u8 *Buff);
+s32 XSdPs_SetupSgDma(XSdPs *InstancePtr, const XSdPs_SgEntry *SgList,
+		     u32 SgCnt, u8 IsRead, u32 *BlkCnt);
 s32 XSdPs_SetVoltage18(XSdPs *InstancePtr);
 s32 XSdPs_SendCmd(XSdPs *InstancePtr, u32 Cmd);
 void XSdPs_IdentifyEmmcMode(XSdPs *InstancePtr, const u8 *ExtCsd);
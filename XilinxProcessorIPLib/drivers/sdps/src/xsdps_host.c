@@ -41,6 +41,8 @@
 * 	sa     01/25/23 Use instance structure to store DMA descriptor tables.
 * 4.2   ap     08/09/23 Restructured XSdPs_FrameCmd API
 * 4.3   ap     12/22/23 Add support to read custom HS400 tap delay value from design for eMMC.
+* 4.4   sb     10/16/26 Add XSdPs_SetupSgDma to chain ADMA2 descriptors over
+*                       a list of buffers.
 * </pre>
 *
 ******************************************************************************/
@@ -1048,6 +1050,127 @@ void XSdPs_SetupWriteDma(XSdPs *InstancePtr, u16 BlkCnt, u16 BlkSize, const u8 *
 	}
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* This function chains one ADMA2 descriptor table over a list of buffers so
+* that the blocks of all entries are moved by a single DMA transfer.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	SgList Pointer to the list of buffers.
+* @param	SgCnt Number of entries in the list.
+* @param	IsRead TRUE for a card to memory transfer, FALSE otherwise.
+* @param	BlkCnt Pointer to return the total block count.
+*
+* @return
+* 		- XST_SUCCESS if the descriptor table was set up
+* 		- XST_FAILURE if an entry is empty or the list needs more than
+* 			32 descriptors
+*
+******************************************************************************/
+s32 XSdPs_SetupSgDma(XSdPs *InstancePtr, const XSdPs_SgEntry *SgList,
+		     u32 SgCnt, u8 IsRead, u32 *BlkCnt)
+{
+	u32 BlkSize = InstancePtr->BlkSize & XSDPS_BLK_SIZE_MASK;
+	u32 DescNum = 0U;
+	u32 TotalBlkCnt = 0U;
+	u32 Entry;
+	u32 Offset;
+	u32 Length;
+	u32 DescLen;
+	UINTPTR Addr;
+	s32 Status = XST_FAILURE;
+
+	for (Entry = 0U; Entry < SgCnt; Entry++) {
+		Length = SgList[Entry].BlkCnt * BlkSize;
+		if (Length == 0U) {
+			goto RETURN_PATH;
+		}
+
+		for (Offset = 0U; Offset < Length; Offset += XSDPS_DESC_MAX_LENGTH) {
+			if (DescNum == 32U) {
+#ifdef XSDPS_DEBUG
+				xil_printf("Max transfer length supported is 2MB\n");
+#endif
+				goto RETURN_PATH;
+			}
+
+			Addr = (UINTPTR)SgList[Entry].Buff + (UINTPTR)Offset;
+			DescLen = Length - Offset;
+			if (DescLen > XSDPS_DESC_MAX_LENGTH) {
+				DescLen = XSDPS_DESC_MAX_LENGTH;
+			}
+
+			/* A length of 0 stands for XSDPS_DESC_MAX_LENGTH bytes */
+			if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+				InstancePtr->Adma2_DescrTbl64[DescNum].Address = (u64)Addr;
+				InstancePtr->Adma2_DescrTbl64[DescNum].Attribute =
+					XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+				InstancePtr->Adma2_DescrTbl64[DescNum].Length = (u16)DescLen;
+			} else {
+				InstancePtr->Adma2_DescrTbl32[DescNum].Address = (u32)Addr;
+				InstancePtr->Adma2_DescrTbl32[DescNum].Attribute =
+					XSDPS_DESC_TRAN | XSDPS_DESC_VALID;
+				InstancePtr->Adma2_DescrTbl32[DescNum].Length = (u16)DescLen;
+			}
+			DescNum++;
+		}
+
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			if (IsRead == TRUE) {
+				Xil_DCacheInvalidateRange((INTPTR)SgList[Entry].Buff, (INTPTR)Length);
+			} else {
+				Xil_DCacheFlushRange((INTPTR)SgList[Entry].Buff, (INTPTR)Length);
+			}
+		}
+		TotalBlkCnt += SgList[Entry].BlkCnt;
+	}
+
+	if (DescNum == 0U) {
+		goto RETURN_PATH;
+	}
+
+	XSdPs_WriteReg16(InstancePtr->Config.BaseAddress,
+			 XSDPS_BLK_SIZE_OFFSET, (u16)BlkSize);
+
+	if (InstancePtr->HC_Version == XSDPS_HC_SPEC_V3) {
+		InstancePtr->Adma2_DescrTbl64[DescNum - 1U].Attribute |= XSDPS_DESC_END;
+#if defined(__aarch64__) || defined(__arch64__)
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_EXT_OFFSET,
+			       (u32)((UINTPTR)(InstancePtr->Adma2_DescrTbl64) >> 32U));
+#endif
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			       (u32)((UINTPTR) & (InstancePtr->Adma2_DescrTbl64[0]) & ~(u32)0x0U));
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR) & (InstancePtr->Adma2_DescrTbl64[0]),
+					     (INTPTR)sizeof(XSdPs_Adma2Descriptor64) * (INTPTR)32U);
+		}
+	} else {
+		InstancePtr->Adma2_DescrTbl32[DescNum - 1U].Attribute |= XSDPS_DESC_END;
+		XSdPs_WriteReg(InstancePtr->Config.BaseAddress, XSDPS_ADMA_SAR_OFFSET,
+			       (u32)((UINTPTR) & (InstancePtr->Adma2_DescrTbl32[0]) & ~(u32)0x0U));
+		if (InstancePtr->Config.IsCacheCoherent == 0U) {
+			Xil_DCacheFlushRange((INTPTR) & (InstancePtr->Adma2_DescrTbl32[0]),
+					     (INTPTR)sizeof(XSdPs_Adma2Descriptor32) * (INTPTR)32U);
+		}
+	}
+
+	InstancePtr->TransferMode = XSDPS_TM_BLK_CNT_EN_MASK | XSDPS_TM_DMA_EN_MASK;
+	if (IsRead == TRUE) {
+		InstancePtr->TransferMode |= XSDPS_TM_DAT_DIR_SEL_MASK;
+	}
+	if (TotalBlkCnt > 1U) {
+		InstancePtr->TransferMode |= XSDPS_TM_AUTO_CMD12_EN_MASK |
+					     XSDPS_TM_MUL_SIN_BLK_SEL_MASK;
+	}
+
+	*BlkCnt = TotalBlkCnt;
+	Status = XST_SUCCESS;
+
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 *
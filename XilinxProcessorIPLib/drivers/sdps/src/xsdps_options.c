@@ -64,6 +64,8 @@
 * 3.14  mn     11/28/21 Fix MISRA-C violations.
 * 4.0   sk     02/25/22 Add support for eMMC5.1.
 * 4.1   sk     11/10/22 Add SD/eMMC Tap delay support for Versal Net.
+* 4.4   sb     10/16/26 Add XSdPs_StartReadTransferSg and
+*                       XSdPs_StartWriteTransferSg.
 *
 * </pre>
 *
@@ -841,6 +843,115 @@ RETURN_PATH:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief
+* Starts an SD read transfer into a list of buffers. All entries are chained
+* in the ADMA2 descriptor table, so up to 2MB spread over several buffers is
+* read by one command. Completion is checked with XSdPs_CheckReadTransfer.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	Arg Address passed by the user that is to be sent as
+* 		argument along with the command.
+* @param	SgList Pointer to the list of buffers.
+* @param	SgCnt Number of entries in the list.
+*
+* @return
+* 		- XST_SUCCESS if Transfer initialization was successful
+* 		- XST_FAILURE if failure - could be because another transfer
+* 		is in progress, the list needs more than 32 descriptors or
+* 		command or data inhibit is set
+*
+******************************************************************************/
+s32 XSdPs_StartReadTransferSg(XSdPs *InstancePtr, u32 Arg,
+			       const XSdPs_SgEntry *SgList, u32 SgCnt)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(SgList != NULL);
+
+	if (InstancePtr->IsBusy == TRUE) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Setup the Read Transfer */
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Read from the card */
+	Status = XSdPs_TransferSg(InstancePtr, Arg, SgList, SgCnt, (u8)TRUE);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->IsBusy = TRUE;
+
+RETURN_PATH:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief
+* Starts an SD write transfer from a list of buffers. All entries are
+* chained in the ADMA2 descriptor table, so up to 2MB spread over several
+* buffers is written by one command. Completion is checked with
+* XSdPs_CheckWriteTransfer.
+*
+* @param	InstancePtr Pointer to the instance to be worked on.
+* @param	Arg Address passed by the user that is to be sent as
+* 		argument along with the command.
+* @param	SgList Pointer to the list of buffers.
+* @param	SgCnt Number of entries in the list.
+*
+* @return
+* 		- XST_SUCCESS if Transfer initialization was successful
+* 		- XST_FAILURE if failure - could be because another transfer
+* 		is in progress, the list needs more than 32 descriptors or
+* 		command or data inhibit is set
+*
+******************************************************************************/
+s32 XSdPs_StartWriteTransferSg(XSdPs *InstancePtr, u32 Arg,
+				const XSdPs_SgEntry *SgList, u32 SgCnt)
+{
+	s32 Status;
+
+	Xil_AssertNonvoid(InstancePtr != NULL);
+	Xil_AssertNonvoid(InstancePtr->IsReady == XIL_COMPONENT_IS_READY);
+	Xil_AssertNonvoid(SgList != NULL);
+
+	if (InstancePtr->IsBusy == TRUE) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Setup the Write Transfer */
+	Status = XSdPs_SetupTransfer(InstancePtr);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	/* Write to the card */
+	Status = XSdPs_TransferSg(InstancePtr, Arg, SgList, SgCnt, (u8)FALSE);
+	if (Status != XST_SUCCESS) {
+		Status = XST_FAILURE;
+		goto RETURN_PATH;
+	}
+
+	InstancePtr->IsBusy = TRUE;
+
+RETURN_PATH:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
 * @brief
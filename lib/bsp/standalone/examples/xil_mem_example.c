@@ -0,0 +1,223 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All rights reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/**
+*
+* @file xil_mem_example.c
+*
+* Implements example that checks Xil_MemCpy, Xil_MemSet, Xil_MemCmp and
+* Xil_MemCmp_CT against byte-wise reference loops for every combination of
+* source/destination offset within a word and short lengths. On ARM
+* processors it then reports the time taken by each routine and by the
+* byte-wise loop for aligned and unaligned buffers of a few sizes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.2   sb   10/16/26 First release
+* </pre>
+******************************************************************************/
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xil_mem.h"
+#include "xil_util.h"
+#include "xstatus.h"
+#if !defined (__MICROBLAZE__) && !defined (__riscv)
+#include "xtime_l.h"
+#define XIL_MEM_EXAMPLE_TIMING
+#endif
+
+#define BUF_SIZE	(64U * 1024U)	/* Largest benchmarked transfer */
+#define CHECK_LEN	80U		/* Lengths checked exhaustively */
+#define MAX_OFFSET	16U		/* Offsets checked exhaustively */
+#define BENCH_ITERS	16U		/* Repetitions of each measurement */
+
+static u8 SrcBuf[BUF_SIZE + MAX_OFFSET] __attribute__((aligned(64)));
+static u8 DstBuf[BUF_SIZE + (2U * MAX_OFFSET)] __attribute__((aligned(64)));
+static u8 RefBuf[BUF_SIZE + (2U * MAX_OFFSET)] __attribute__((aligned(64)));
+
+/* Byte-wise reference, kept out of line so it is not turned into memcpy */
+static void __attribute__((noinline)) ByteCopy(volatile u8 *Dst,
+		const u8 *Src, u32 Len)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		Dst[Index] = Src[Index];
+	}
+}
+
+static void Fill(u8 *Buf, u32 Len, u32 Seed)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		Buf[Index] = (u8)((Index * 31U) + Seed);
+	}
+}
+
+static s32 CheckCopySet(void)
+{
+	u32 SrcOff;
+	u32 DstOff;
+	u32 Len;
+	u32 Index;
+
+	Fill(SrcBuf, CHECK_LEN + MAX_OFFSET, 7U);
+	for (SrcOff = 0U; SrcOff < MAX_OFFSET; SrcOff++) {
+		for (DstOff = 0U; DstOff < MAX_OFFSET; DstOff++) {
+			for (Len = 0U; Len <= CHECK_LEN; Len++) {
+				Fill(DstBuf, CHECK_LEN + (2U * MAX_OFFSET), 3U);
+				Fill(RefBuf, CHECK_LEN + (2U * MAX_OFFSET), 3U);
+				Xil_MemCpy(&DstBuf[DstOff], &SrcBuf[SrcOff], Len);
+				ByteCopy(&RefBuf[DstOff], &SrcBuf[SrcOff], Len);
+				for (Index = 0U; Index < (CHECK_LEN + (2U * MAX_OFFSET)); Index++) {
+					if (DstBuf[Index] != RefBuf[Index]) {
+						xil_printf("Xil_MemCpy mismatch: src %d dst %d len %d\r\n",
+							   SrcOff, DstOff, Len);
+						return XST_FAILURE;
+					}
+				}
+			}
+		}
+	}
+
+	for (DstOff = 0U; DstOff < MAX_OFFSET; DstOff++) {
+		for (Len = 0U; Len <= CHECK_LEN; Len++) {
+			Fill(DstBuf, CHECK_LEN + (2U * MAX_OFFSET), 3U);
+			Xil_MemSet(&DstBuf[DstOff], 0x1A5, Len);
+			for (Index = 0U; Index < (CHECK_LEN + (2U * MAX_OFFSET)); Index++) {
+				if (((Index >= DstOff) && (Index < (DstOff + Len)) &&
+				     (DstBuf[Index] != 0xA5U)) ||
+				    (((Index < DstOff) || (Index >= (DstOff + Len))) &&
+				     (DstBuf[Index] != (u8)((Index * 31U) + 3U)))) {
+					xil_printf("Xil_MemSet mismatch: dst %d len %d\r\n",
+						   DstOff, Len);
+					return XST_FAILURE;
+				}
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+static s32 CheckCmp(void)
+{
+	u32 Off1;
+	u32 Off2;
+	u32 Len;
+	u32 Pos;
+	s32 Expected;
+
+	for (Off1 = 0U; Off1 < MAX_OFFSET; Off1++) {
+		for (Off2 = 0U; Off2 < MAX_OFFSET; Off2++) {
+			for (Len = 1U; Len <= CHECK_LEN; Len++) {
+				Fill(&SrcBuf[Off1], Len, 5U);
+				Fill(&DstBuf[Off2], Len, 5U);
+				if ((Xil_MemCmp(&SrcBuf[Off1], &DstBuf[Off2], Len) != 0) ||
+				    (Xil_MemCmp_CT(&SrcBuf[Off1], &DstBuf[Off2], Len) != 0)) {
+					xil_printf("Equal buffers differ: %d %d len %d\r\n",
+						   Off1, Off2, Len);
+					return XST_FAILURE;
+				}
+				for (Pos = 0U; Pos < Len; Pos++) {
+					DstBuf[Off2 + Pos] ^= (u8)(0x80U >> (Pos & 7U));
+					Expected = (SrcBuf[Off1 + Pos] > DstBuf[Off2 + Pos]) ? 1 : -1;
+					if ((Xil_MemCmp(&SrcBuf[Off1], &DstBuf[Off2], Len) != Expected) ||
+					    (Xil_MemCmp_CT(&SrcBuf[Off1], &DstBuf[Off2], Len) != 1)) {
+						xil_printf("Difference missed: %d %d len %d pos %d\r\n",
+							   Off1, Off2, Len, Pos);
+						return XST_FAILURE;
+					}
+					DstBuf[Off2 + Pos] ^= (u8)(0x80U >> (Pos & 7U));
+				}
+			}
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+#ifdef XIL_MEM_EXAMPLE_TIMING
+static u32 Elapsed(XTime Start)
+{
+	XTime End;
+
+	XTime_GetTime(&End);
+	return (u32)(End - Start);
+}
+
+static void Bench(u32 Len, u32 SrcOff, u32 DstOff)
+{
+	XTime Start;
+	u32 Iter;
+	u32 Byte;
+	u32 Cpy;
+	u32 Set;
+	u32 Cmp;
+
+	XTime_GetTime(&Start);
+	for (Iter = 0U; Iter < BENCH_ITERS; Iter++) {
+		ByteCopy(&DstBuf[DstOff], &SrcBuf[SrcOff], Len);
+	}
+	Byte = Elapsed(Start);
+
+	XTime_GetTime(&Start);
+	for (Iter = 0U; Iter < BENCH_ITERS; Iter++) {
+		Xil_MemCpy(&DstBuf[DstOff], &SrcBuf[SrcOff], Len);
+	}
+	Cpy = Elapsed(Start);
+
+	XTime_GetTime(&Start);
+	for (Iter = 0U; Iter < BENCH_ITERS; Iter++) {
+		Xil_MemSet(&DstBuf[DstOff], 0, Len);
+	}
+	Set = Elapsed(Start);
+
+	Xil_MemCpy(&DstBuf[DstOff], &SrcBuf[SrcOff], Len);
+	XTime_GetTime(&Start);
+	for (Iter = 0U; Iter < BENCH_ITERS; Iter++) {
+		(void)Xil_MemCmp(&DstBuf[DstOff], &SrcBuf[SrcOff], Len);
+	}
+	Cmp = Elapsed(Start);
+
+	xil_printf("%6d bytes src+%d dst+%d: byte %8d cpy %8d set %8d cmp %8d ticks\r\n",
+		   Len, SrcOff, DstOff, Byte, Cpy, Set, Cmp);
+}
+#endif
+
+int main(void)
+{
+	s32 Status;
+
+	xil_printf("Start of Xil_Mem example\r\n");
+
+	Status = CheckCopySet();
+	if (Status == XST_SUCCESS) {
+		Status = CheckCmp();
+	}
+	if (Status != XST_SUCCESS) {
+		xil_printf("Xil_Mem example has FAILED\r\n");
+		goto END;
+	}
+
+#ifdef XIL_MEM_EXAMPLE_TIMING
+	Fill(SrcBuf, BUF_SIZE + MAX_OFFSET, 9U);
+	Bench(64U, 0U, 0U);
+	Bench(64U, 1U, 0U);
+	Bench(4096U, 0U, 0U);
+	Bench(4096U, 3U, 1U);
+	Bench(BUF_SIZE, 0U, 0U);
+	Bench(BUF_SIZE, 5U, 2U);
+#endif
+
+	xil_printf("Successfully ran Xil_Mem example\r\n");
+
+END:
+	return 0;
+}
@@ -0,0 +1,241 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_mem_bench.c
+*
+* This file contains the host benchmark of Xil_MemCpy. It times the current
+* Xil_MemCpy of xil_mem.c against the Xil_MemCpy of standalone 9.1, kept in
+* xil_mem_old.c, for aligned and misaligned buffers of a few sizes. Xil_MemCpy
+* is first checked against memcpy for every source and destination offset up
+* to MAX_OFFSET and every length up to CHECK_LEN, and both routines are
+* checked for every timed transfer.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.2   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "xil_types.h"
+#include "xil_mem.h"
+#include "xil_mem_bench.h"
+
+/************************** Constant Definitions *****************************/
+#define BUF_SIZE	(64U * 1024U)	/* Largest benchmarked transfer */
+#define MAX_OFFSET	16U		/* Largest source or destination offset */
+#define CHECK_LEN	256U		/* Lengths checked exhaustively */
+#define BYTES_PER_RUN	(64U * 1024U * 1024U)	/* Bytes copied per timed run */
+
+/**************************** Type Definitions *******************************/
+typedef void (*XilMemBench_CpyFunc)(void *dst, const void *src, u32 cnt);
+
+/** Benchmarked transfer */
+typedef struct {
+	u32 Len;	/**< Length in bytes */
+	u32 SrcOff;	/**< Source offset from a 64 byte boundary */
+	u32 DstOff;	/**< Destination offset from a 64 byte boundary */
+} XilMemBench_Case;
+
+/************************** Variable Definitions *****************************/
+static u8 SrcBuf[BUF_SIZE + MAX_OFFSET] __attribute__((aligned(64)));
+static u8 DstBuf[BUF_SIZE + MAX_OFFSET] __attribute__((aligned(64)));
+static u8 RefBuf[BUF_SIZE + MAX_OFFSET] __attribute__((aligned(64)));
+
+static const XilMemBench_Case Cases[] = {
+	{ 64U, 0U, 0U },
+	{ 64U, 1U, 0U },
+	{ 256U, 0U, 0U },
+	{ 4096U, 0U, 0U },
+	{ 4096U, 3U, 1U },
+	{ BUF_SIZE, 0U, 0U },
+	{ BUF_SIZE, 3U, 0U },
+	{ BUF_SIZE, 5U, 2U },
+};
+
+/*****************************************************************************/
+/**
+*
+* Returns the monotonic time in ns.
+*
+* @return	Time in ns
+*
+******************************************************************************/
+static u64 XilMemBench_TimeNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000ULL) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks a copy routine against memcpy for a transfer, including the bytes
+* around the destination.
+*
+* @param	Cpy - Copy routine
+* @param	Case - Transfer
+*
+* @return	0 if the result matches, -1 otherwise
+*
+******************************************************************************/
+static int XilMemBench_Check(XilMemBench_CpyFunc Cpy, const XilMemBench_Case *Case)
+{
+	(void)memset(DstBuf, 0x5A, sizeof(DstBuf));
+	(void)memset(RefBuf, 0x5A, sizeof(RefBuf));
+	Cpy(&DstBuf[Case->DstOff], &SrcBuf[Case->SrcOff], Case->Len);
+	(void)memcpy(&RefBuf[Case->DstOff], &SrcBuf[Case->SrcOff], Case->Len);
+
+	return (memcmp(DstBuf, RefBuf, sizeof(DstBuf)) == 0) ? 0 : -1;
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks Xil_MemCpy against memcpy for all offsets and short lengths.
+*
+* @return	0 if all results match, -1 otherwise
+*
+******************************************************************************/
+static int XilMemBench_CheckAll(void)
+{
+	XilMemBench_Case Case;
+
+	for (Case.SrcOff = 0U; Case.SrcOff < MAX_OFFSET; Case.SrcOff++) {
+		for (Case.DstOff = 0U; Case.DstOff < MAX_OFFSET; Case.DstOff++) {
+			for (Case.Len = 0U; Case.Len <= CHECK_LEN; Case.Len++) {
+				if (XilMemBench_Check(Xil_MemCpy, &Case) != 0) {
+					printf("Copy of %u bytes src+%u dst+%u differs from "
+					       "memcpy\n", Case.Len, Case.SrcOff, Case.DstOff);
+					return -1;
+				}
+			}
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Times a copy routine for a transfer.
+*
+* @param	Cpy - Copy routine
+* @param	Case - Transfer
+* @param	Runs - Timed runs, the fastest one counts
+*
+* @return	ns per copy
+*
+******************************************************************************/
+static double XilMemBench_Time(XilMemBench_CpyFunc Cpy, const XilMemBench_Case *Case,
+			       u32 Runs)
+{
+	u32 Iters = BYTES_PER_RUN / Case->Len;
+	double Best = 0.0;
+	double Ns;
+	u64 Start;
+	u32 Run;
+	u32 Iter;
+
+	for (Run = 0U; Run < Runs; Run++) {
+		Start = XilMemBench_TimeNs();
+		for (Iter = 0U; Iter < Iters; Iter++) {
+			Cpy(&DstBuf[Case->DstOff], &SrcBuf[Case->SrcOff], Case->Len);
+		}
+		Ns = (double)(XilMemBench_TimeNs() - Start) / Iters;
+		if ((Run == 0U) || (Ns < Best)) {
+			Best = Ns;
+		}
+	}
+
+	return Best;
+}
+
+/*****************************************************************************/
+/**
+*
+* Main function of the Xil_MemCpy benchmark.
+*
+* @param	argc - Argument count
+* @param	argv - Arguments
+*
+* @return	0 if all checks pass, 1 otherwise
+*
+******************************************************************************/
+int main(int argc, char *argv[])
+{
+	/* Called through volatile pointers, so the loops are not optimized away */
+	XilMemBench_CpyFunc volatile OldCpy = XilMemBench_OldMemCpy;
+	XilMemBench_CpyFunc volatile NewCpy = Xil_MemCpy;
+	u32 Runs = 5U;
+	u32 Idx;
+	double Old;
+	double New;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "r:h")) != -1) {
+		switch (Opt) {
+			case 'r':
+				Runs = (u32)strtoul(optarg, NULL, 0);
+				break;
+			default:
+				printf("Usage: %s [-r runs]\n", argv[0]);
+				return (Opt == 'h') ? 0 : 1;
+		}
+	}
+	if (Runs == 0U) {
+		Runs = 1U;
+	}
+
+	for (Idx = 0U; Idx < sizeof(SrcBuf); Idx++) {
+		SrcBuf[Idx] = (u8)((Idx * 31U) + 7U);
+	}
+
+	if (XilMemBench_CheckAll() != 0) {
+		printf("FAILED\n");
+		return 1;
+	}
+
+#if defined(__ARM_FEATURE_UNALIGNED)
+	printf("Misaligned sources read with unaligned loads\n");
+#else
+	printf("Misaligned sources merged from aligned words\n");
+#endif
+	printf("%8s %4s %4s %10s %10s %8s\n", "bytes", "src", "dst", "old ns",
+	       "new ns", "speedup");
+	for (Idx = 0U; Idx < (sizeof(Cases) / sizeof(Cases[0])); Idx++) {
+		if ((XilMemBench_Check(OldCpy, &Cases[Idx]) != 0) ||
+		    (XilMemBench_Check(NewCpy, &Cases[Idx]) != 0)) {
+			printf("Copy of %u bytes src+%u dst+%u differs from memcpy\n",
+			       Cases[Idx].Len, Cases[Idx].SrcOff, Cases[Idx].DstOff);
+			printf("FAILED\n");
+			return 1;
+		}
+		Old = XilMemBench_Time(OldCpy, &Cases[Idx], Runs);
+		New = XilMemBench_Time(NewCpy, &Cases[Idx], Runs);
+		printf("%8u %4u %4u %10.1f %10.1f %7.2fx\n", Cases[Idx].Len,
+		       Cases[Idx].SrcOff, Cases[Idx].DstOff, Old, New, Old / New);
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
@@ -0,0 +1,30 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_mem_bench.h
+*
+* Declarations of the host benchmark of Xil_MemCpy.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 9.2   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XIL_MEM_BENCH_H
+#define XIL_MEM_BENCH_H
+
+#include "xil_types.h"
+
+void XilMemBench_OldMemCpy(void* dst, const void* src, u32 cnt);
+
+#endif /* XIL_MEM_BENCH_H */
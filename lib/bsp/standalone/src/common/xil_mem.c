@@ -1,6 +1,7 @@
 /******************************************************************************/
 /**
 * Copyright (c) 2015 - 2022 Xilinx, Inc.  All rights reserved.
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
 * SPDX-License-Identifier: MIT
 ******************************************************************************/
 
@@ -8,8 +9,16 @@
 /**
 * @file xil_mem.c
 *
-* This file contains xil mem copy function to use in case of word aligned
-* data copies.
+* This file contains xil mem copy and set functions optimized for the
+* supported processors.
+*
+* The destination is aligned with byte accesses first. Blocks are then moved
+* with native words: 64-bit words and NEON registers on AArch64, 32-bit words
+* unrolled by four on the 32-bit processors, which the compiler turns into
+* LDP/STP and LDM/STM sequences. When the source is not aligned like the
+* destination, processors handling unaligned loads in hardware read it
+* directly; MicroBlaze and RISC-V merge aligned source words with shifts
+* instead.
 *
 * <pre>
 * MODIFICATION HISTORY:
@@ -22,6 +31,10 @@
 * 			  violations.
 * 7.7	sk	 01/10/22 Include xil_mem.h header file to fix Xil_MemCpy
 * 			  prototype misra_c_2012_rule_8_4 violation.
+* 9.2   sb       10/16/26 Align the destination and avoid unaligned source
+* 			  accesses in Xil_MemCpy, use 64-bit and NEON
+* 			  transfers on AArch64 and add Xil_MemSet.
+*       sb       10/16/26 Unroll the merged copy of misaligned sources.
 *
 * </pre>
 *
@@ -31,8 +44,181 @@
 
 #include "xil_types.h"
 #include "xil_mem.h"
+#if defined(__aarch64__) && defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+/************************** Constant Definitions ****************************/
+#if defined(__aarch64__)
+typedef u64 XilMemWord;		/**< Native transfer word */
+#else
+typedef u32 XilMemWord;		/**< Native transfer word */
+#endif
+
+#define XIL_MEM_WORD_SIZE	((u32)sizeof(XilMemWord))	/**< Word size */
+#define XIL_MEM_WORD_MASK	((UINTPTR)XIL_MEM_WORD_SIZE - 1U)	/**< Word alignment mask */
+#define XIL_MEM_BLOCK_SIZE	(4U * XIL_MEM_WORD_SIZE)	/**< Unrolled block size */
+#define XIL_MEM_MIN_WORD_CNT	(2U * XIL_MEM_WORD_SIZE)	/**< Shorter transfers go byte-wise */
+
+#if !defined(__ARM_FEATURE_UNALIGNED)
+/** Destination word merged from two aligned source words */
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+#define XIL_MEM_MERGE(First, Second, Shift, Rest) \
+	(((First) << (Shift)) | ((Second) >> (Rest)))
+#else
+#define XIL_MEM_MERGE(First, Second, Shift, Rest) \
+	(((First) >> (Shift)) | ((Second) << (Rest)))
+#endif
+#endif
+
+#if defined(__ARM_FEATURE_UNALIGNED)
+/** Word read from an address of any alignment with a single load */
+typedef struct {
+	XilMemWord Word;
+} __attribute__((packed, may_alias)) XilMemUnalignedWord;
+#endif
 
 /***************** Inline Functions Definitions ********************/
+/*****************************************************************************/
+/**
+* @brief       Copies the word aligned blocks of a transfer whose source and
+*              destination are both word aligned.
+*
+* @param       d: word aligned destination
+* @param       s: word aligned source
+* @param       cnt: number of bytes, the copied ones are subtracted
+*
+*****************************************************************************/
+static inline void Xil_MemCpyAligned(u8 **d, const u8 **s, u32 *cnt)
+{
+	XilMemWord *Dst = (XilMemWord *)(void *)*d;
+	const XilMemWord *Src = (const XilMemWord *)(const void *)*s;
+	u32 Len = *cnt;
+
+#if defined(__aarch64__) && defined(__ARM_NEON)
+	while (Len >= 64U) {
+		uint8x16_t V0 = vld1q_u8((const u8 *)Src);
+		uint8x16_t V1 = vld1q_u8((const u8 *)Src + 16U);
+		uint8x16_t V2 = vld1q_u8((const u8 *)Src + 32U);
+		uint8x16_t V3 = vld1q_u8((const u8 *)Src + 48U);
+
+		vst1q_u8((u8 *)Dst, V0);
+		vst1q_u8((u8 *)Dst + 16U, V1);
+		vst1q_u8((u8 *)Dst + 32U, V2);
+		vst1q_u8((u8 *)Dst + 48U, V3);
+		Dst += 64U / XIL_MEM_WORD_SIZE;
+		Src += 64U / XIL_MEM_WORD_SIZE;
+		Len -= 64U;
+	}
+#endif
+	while (Len >= XIL_MEM_BLOCK_SIZE) {
+		XilMemWord W0 = Src[0];
+		XilMemWord W1 = Src[1];
+		XilMemWord W2 = Src[2];
+		XilMemWord W3 = Src[3];
+
+		Dst[0] = W0;
+		Dst[1] = W1;
+		Dst[2] = W2;
+		Dst[3] = W3;
+		Dst += 4U;
+		Src += 4U;
+		Len -= XIL_MEM_BLOCK_SIZE;
+	}
+	while (Len >= XIL_MEM_WORD_SIZE) {
+		*Dst = *Src;
+		Dst++;
+		Src++;
+		Len -= XIL_MEM_WORD_SIZE;
+	}
+
+	*d = (u8 *)(void *)Dst;
+	*s = (const u8 *)(const void *)Src;
+	*cnt = Len;
+}
+
+/*****************************************************************************/
+/**
+* @brief       Copies the words of a transfer whose destination is word
+*              aligned and whose source is not.
+*
+* @param       d: word aligned destination
+* @param       s: unaligned source
+* @param       cnt: number of bytes, the copied ones are subtracted
+*
+*****************************************************************************/
+static inline void Xil_MemCpyShifted(u8 **d, const u8 **s, u32 *cnt)
+{
+	XilMemWord *Dst = (XilMemWord *)(void *)*d;
+	u32 Len = *cnt;
+#if defined(__ARM_FEATURE_UNALIGNED)
+	const XilMemUnalignedWord *Src = (const XilMemUnalignedWord *)(const void *)*s;
+
+	while (Len >= XIL_MEM_BLOCK_SIZE) {
+		XilMemWord W0 = Src[0].Word;
+		XilMemWord W1 = Src[1].Word;
+		XilMemWord W2 = Src[2].Word;
+		XilMemWord W3 = Src[3].Word;
+
+		Dst[0] = W0;
+		Dst[1] = W1;
+		Dst[2] = W2;
+		Dst[3] = W3;
+		Dst += 4U;
+		Src += 4U;
+		Len -= XIL_MEM_BLOCK_SIZE;
+	}
+	while (Len >= XIL_MEM_WORD_SIZE) {
+		*Dst = Src->Word;
+		Dst++;
+		Src++;
+		Len -= XIL_MEM_WORD_SIZE;
+	}
+	*s = (const u8 *)(const void *)Src;
+#else
+	u32 Shift = (u32)((UINTPTR)*s & XIL_MEM_WORD_MASK) * 8U;
+	const XilMemWord *Src = (const XilMemWord *)(const void *)((UINTPTR)*s & ~XIL_MEM_WORD_MASK);
+	XilMemWord Prev = *Src;
+	XilMemWord Next;
+
+	u32 Rest = (XIL_MEM_WORD_SIZE * 8U) - Shift;
+	XilMemWord W0;
+	XilMemWord W1;
+	XilMemWord W2;
+
+	/*
+	 * Every destination word is merged from two aligned source words, so
+	 * no access crosses the aligned word holding the last source byte.
+	 */
+	while (Len >= XIL_MEM_BLOCK_SIZE) {
+		W0 = Src[1];
+		W1 = Src[2];
+		W2 = Src[3];
+		Next = Src[4];
+		Dst[0] = XIL_MEM_MERGE(Prev, W0, Shift, Rest);
+		Dst[1] = XIL_MEM_MERGE(W0, W1, Shift, Rest);
+		Dst[2] = XIL_MEM_MERGE(W1, W2, Shift, Rest);
+		Dst[3] = XIL_MEM_MERGE(W2, Next, Shift, Rest);
+		Prev = Next;
+		Src += 4U;
+		Dst += 4U;
+		Len -= XIL_MEM_BLOCK_SIZE;
+	}
+	while (Len >= XIL_MEM_WORD_SIZE) {
+		Src++;
+		Next = *Src;
+		*Dst = XIL_MEM_MERGE(Prev, Next, Shift, Rest);
+		Prev = Next;
+		Dst++;
+		Len -= XIL_MEM_WORD_SIZE;
+	}
+	*s += *cnt - Len;
+#endif
+
+	*d = (u8 *)(void *)Dst;
+	*cnt = Len;
+}
+
 /*****************************************************************************/
 /**
 * @brief       This  function copies memory from once location to other.
@@ -46,21 +232,25 @@
 *****************************************************************************/
 void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 {
-	char *d = (char*)(void *)dst;
-	const char *s = src;
-
-	while (cnt >= sizeof (s32)) {
-		*(s32*)d = *(s32*)s;
-		d += sizeof (s32);
-		s += sizeof (s32);
-		cnt -= sizeof (s32);
-	}
-	while (cnt >= sizeof (u16)) {
-		*(u16*)d = *(u16*)s;
-		d += sizeof (u16);
-		s += sizeof (u16);
-		cnt -= sizeof (u16);
+	u8 *d = (u8 *)dst;
+	const u8 *s = (const u8 *)src;
+
+	if (cnt >= XIL_MEM_MIN_WORD_CNT) {
+		/* Align the destination */
+		while (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) {
+			*d = *s;
+			d += 1U;
+			s += 1U;
+			cnt -= 1U;
+		}
+
+		if (((UINTPTR)s & XIL_MEM_WORD_MASK) == 0U) {
+			Xil_MemCpyAligned(&d, &s, &cnt);
+		} else {
+			Xil_MemCpyShifted(&d, &s, &cnt);
+		}
 	}
+
 	while ((cnt) > 0U){
 		*d = *s;
 		d += 1U;
@@ -68,3 +258,68 @@ void Xil_MemCpy(void* dst, const void* src, u32 cnt)
 		cnt -= 1U;
 	}
 }
+
+/*****************************************************************************/
+/**
+* @brief       This function fills memory with a byte value.
+*
+* @param       dst: pointer pointing to destination memory
+*
+* @param       val: byte value to be written, only the low 8 bits are used
+*
+* @param       cnt: 32 bit length of bytes to be written
+*
+*****************************************************************************/
+void Xil_MemSet(void* dst, s32 val, u32 cnt)
+{
+	u8 *d = (u8 *)dst;
+	u8 Byte = (u8)val;
+	XilMemWord Pattern;
+	XilMemWord *Dst;
+
+	if (cnt >= XIL_MEM_MIN_WORD_CNT) {
+		/* Align the destination */
+		while (((UINTPTR)d & XIL_MEM_WORD_MASK) != 0U) {
+			*d = Byte;
+			d += 1U;
+			cnt -= 1U;
+		}
+
+		Pattern = ((XilMemWord)~(XilMemWord)0U / 0xFFU) * (XilMemWord)Byte;
+		Dst = (XilMemWord *)(void *)d;
+#if defined(__aarch64__) && defined(__ARM_NEON)
+		{
+			uint8x16_t V = vdupq_n_u8(Byte);
+
+			while (cnt >= 64U) {
+				vst1q_u8((u8 *)Dst, V);
+				vst1q_u8((u8 *)Dst + 16U, V);
+				vst1q_u8((u8 *)Dst + 32U, V);
+				vst1q_u8((u8 *)Dst + 48U, V);
+				Dst += 64U / XIL_MEM_WORD_SIZE;
+				cnt -= 64U;
+			}
+		}
+#endif
+		while (cnt >= XIL_MEM_BLOCK_SIZE) {
+			Dst[0] = Pattern;
+			Dst[1] = Pattern;
+			Dst[2] = Pattern;
+			Dst[3] = Pattern;
+			Dst += 4U;
+			cnt -= XIL_MEM_BLOCK_SIZE;
+		}
+		while (cnt >= XIL_MEM_WORD_SIZE) {
+			*Dst = Pattern;
+			Dst++;
+			cnt -= XIL_MEM_WORD_SIZE;
+		}
+		d = (u8 *)(void *)Dst;
+	}
+
+	while (cnt > 0U) {
+		*d = Byte;
+		d += 1U;
+		cnt -= 1U;
+	}
+}
@@ -24,6 +24,7 @@
 * 6.1   nsk      11/07/16 First release.
 * 7.0   mus      01/07/19 Add cpp extern macro
 * 9.0   ml       03/03/23 Add description to fix doxygen warnings.
+* 9.2   sb       10/16/26 Add Xil_MemSet.
 * </pre>
 *
 *****************************************************************************/
@@ -37,6 +38,7 @@ extern "C" {
 /************************** Function Prototypes *****************************/
 
 void Xil_MemCpy(void* dst, const void* src, u32 cnt);
+void Xil_MemSet(void* dst, s32 val, u32 cnt);
 
 #ifdef __cplusplus
 }
@@ -94,6 +94,8 @@
 *       pre      08/16/24 Added Xil_MemCpy64 function
 *       pre      08/29/24 Fixed compilation warning
 *       kpt      10/17/24 Move API's used in secure libs to xil_sutil.c
+*       sb       10/16/26 Compare word-wise in Xil_MemCmp and added
+*                         Xil_MemCmp_CT function
 *
 * </pre>
 *
@@ -107,6 +109,8 @@
 #endif
 
 /************************** Constant Definitions ****************************/
+#define XIL_WORD_ALIGN_MASK	((UINTPTR)sizeof(UINTPTR) - 1U) /**< Mask of the
+								 offset within a native word */
 
 /************************** Function Prototypes *****************************/
 
@@ -560,6 +564,28 @@ s32 Xil_MemCmp(const void *Buf1Ptr, const void *Buf2Ptr, u32 Len)
 		goto END;
 	}
 
+	/*
+	 * Skip equal words when both buffers share the same alignment, the
+	 * first different word is then resolved byte-wise below
+	 */
+	if ((((UINTPTR)Buf1 ^ (UINTPTR)Buf2) & XIL_WORD_ALIGN_MASK) == 0U) {
+		while ((Size != 0U) && (((UINTPTR)Buf1 & XIL_WORD_ALIGN_MASK) != 0U) &&
+		       (*Buf1 == *Buf2)) {
+			Buf1++;
+			Buf2++;
+			Size--;
+		}
+		if (((UINTPTR)Buf1 & XIL_WORD_ALIGN_MASK) == 0U) {
+			while ((Size >= (u32)sizeof(UINTPTR)) &&
+			       (*(const UINTPTR *)(const void *)Buf1 ==
+				*(const UINTPTR *)(const void *)Buf2)) {
+				Buf1 = &Buf1[sizeof(UINTPTR)];
+				Buf2 = &Buf2[sizeof(UINTPTR)];
+				Size -= (u32)sizeof(UINTPTR);
+			}
+		}
+	}
+
 	/* Loop and compare */
 	while (Size != 0U) {
 		if (*Buf1 > *Buf2) {
@@ -583,3 +609,57 @@ s32 Xil_MemCmp(const void *Buf1Ptr, const void *Buf2Ptr, u32 Len)
 END:
 	return RetVal;
 }
+
+/*****************************************************************************/
+/**
+ * @brief	This function compares Len bytes from memory1 and memory2 in
+ * 			constant time. The execution time depends on Len only, not
+ * 			on the contents or the position of the first difference,
+ * 			so it can be used on secrets such as tags and digests.
+ *
+ * @param	Buf1Ptr is pointer to memory1
+ * @param	Buf2Ptr is pointer to memory2
+ * @param	Len is number of bytes to be compared
+ *
+ * @return	0 if contents of both the memory regions are same,
+ * 			1 if they differ or in case of invalid arguments
+ *
+ ******************************************************************************/
+s32 Xil_MemCmp_CT(const void *Buf1Ptr, const void *Buf2Ptr, u32 Len)
+{
+	volatile s32 RetVal = 1;
+	const u8 *Buf1 = Buf1Ptr;
+	const u8 *Buf2 = Buf2Ptr;
+	volatile UINTPTR Diff = 0U;
+	u32 Size = Len;
+
+	/* Assert validates the input arguments */
+	if ((Buf1 == NULL) || (Buf2 == NULL) || (Len == 0x0U)) {
+		goto END;
+	}
+
+	/* Accumulate differences word-wise when both buffers are aligned */
+	if (((((UINTPTR)Buf1) | ((UINTPTR)Buf2)) & XIL_WORD_ALIGN_MASK) == 0U) {
+		while (Size >= (u32)sizeof(UINTPTR)) {
+			Diff |= (*(const UINTPTR *)(const void *)Buf1) ^
+				(*(const UINTPTR *)(const void *)Buf2);
+			Buf1 = &Buf1[sizeof(UINTPTR)];
+			Buf2 = &Buf2[sizeof(UINTPTR)];
+			Size -= (u32)sizeof(UINTPTR);
+		}
+	}
+	while (Size != 0U) {
+		Diff |= (UINTPTR)(*Buf1) ^ (UINTPTR)(*Buf2);
+		Buf1++;
+		Buf2++;
+		Size--;
+	}
+
+	/* Make sure size is zero to know the whole of data is compared */
+	if ((Size == 0U) && (Diff == 0U)) {
+		RetVal = 0;
+	}
+
+END:
+	return RetVal;
+}
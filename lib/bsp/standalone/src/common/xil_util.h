@@ -69,6 +69,7 @@
 * 9.2  kpt       06/24/24 Added Xil_SReverseData function
 * 9.2  pre       08/16/24 Added Xil_MemCpy64 function
 *      kpt       10/17/24 Move API's used in secure libs to xil_sutil.c
+*      sb        10/16/26 Added Xil_MemCmp_CT function
 *
 * </pre>
 *
@@ -129,6 +130,9 @@ s32 Xil_Strcat(char *Str1Ptr, const char *Str2Ptr, const u32 Size);
 /**< Compares Len bytes from memory1 and memory2 */
 s32 Xil_MemCmp(const void *Buf1Ptr, const void *Buf2Ptr, u32 Len);
 
+/**< Compares Len bytes from memory1 and memory2 in constant time */
+s32 Xil_MemCmp_CT(const void *Buf1Ptr, const void *Buf2Ptr, u32 Len);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,29 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file bspconfig.h
+ *
+ * Host replacement of the BSP configuration of the ASU processor.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#define VERSAL_AIEPG2
+#define SDT
+
+#endif /* BSPCONFIG_H */
@@ -0,0 +1,28 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file sleep.h
+ *
+ * Host replacement of sleep.h. Delays are waited for on the host clock.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef SLEEP_H
+#define SLEEP_H
+
+#include <unistd.h>
+
+#endif /* SLEEP_H */
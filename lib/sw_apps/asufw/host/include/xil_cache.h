@@ -0,0 +1,31 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xil_cache.h
+ *
+ * Host replacement of xil_cache.h. Cache maintenance is not needed on the host.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#include "xil_types.h"
+
+#define Xil_DCacheFlushRange(Addr, Len)		((void)(Addr), (void)(Len))
+#define Xil_DCacheInvalidateRange(Addr, Len)	((void)(Addr), (void)(Len))
+
+#endif /* XIL_CACHE_H */
@@ -0,0 +1,33 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xil_exception.h
+ *
+ * Host replacement of xil_exception.h. Interrupts are signals on the host, disabling interrupts
+ * blocks them in the firmware thread.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef XIL_EXCEPTION_H
+#define XIL_EXCEPTION_H
+
+void XAsufwHost_EnableInterrupts(void);
+void XAsufwHost_DisableInterrupts(void);
+
+#define Xil_ExceptionEnable()	XAsufwHost_EnableInterrupts()
+#define Xil_ExceptionDisable()	XAsufwHost_DisableInterrupts()
+
+#endif /* XIL_EXCEPTION_H */
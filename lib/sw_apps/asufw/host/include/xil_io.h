@@ -0,0 +1,61 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xil_io.h
+ *
+ * Host replacement of xil_io.h. Register accesses of the ASUFW sources and the IPI driver are
+ * routed to the IPI register model of xasufw_host.c.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+
+#define INLINE		inline
+#define INST_SYNC
+#define DATA_SYNC
+#define SYNCHRONIZE_IO
+
+u32 XAsufwHost_In32(UINTPTR Addr);
+void XAsufwHost_Out32(UINTPTR Addr, u32 Value);
+
+static INLINE u32 Xil_In32(UINTPTR Addr)
+{
+	return XAsufwHost_In32(Addr);
+}
+
+static INLINE void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	XAsufwHost_Out32(Addr, Value);
+}
+
+static INLINE int Xil_SecureOut32(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Value);
+
+	return (Xil_In32(Addr) == Value) ? XST_SUCCESS : XST_FAILURE;
+}
+
+static INLINE u32 Xil_EndianSwap32(u32 Data)
+{
+	return __builtin_bswap32(Data);
+}
+
+#endif /* XIL_IO_H */
@@ -0,0 +1,39 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xparameters.h
+ *
+ * Host replacement of the generated hardware parameters. Only the values used by the
+ * ASUFW queue scheduler and the IPI and DMA drivers are provided.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define XPAR_XIPIPSU_NUM_INSTANCES	1U /**< ASU IPI instances */
+#define XPAR_XIPIPSU_0_BASEADDR		0xEB340000U /**< ASU IPI base address */
+#define XPAR_XIPIPSU_0_BIT_MASK		0x00000001U /**< ASU IPI bit mask */
+#define XPAR_XIPIPSU_0_INT_ID		0U /**< ASU IPI interrupt ID */
+#define XPAR_XIPIPSU_0_IPI_TARGET_COUNT	16U /**< IPI targets */
+
+#define XPAR_XCSUDMA_NUM_INSTANCES	2U /**< ASU DMA instances */
+#define XPAR_ASU_DMA0_DMA_TYPE		2U /**< ASU DMA 0 type */
+#define XPAR_ASU_DMA1_DMA_TYPE		3U /**< ASU DMA 1 type */
+#define XPAR_XCSUDMA_0_BASEADDR		0xEBE10000U /**< ASU DMA 0 base address */
+#define XPAR_XCSUDMA_1_BASEADDR		0xEBE20000U /**< ASU DMA 1 base address */
+
+#endif /* XPARAMETERS_H */
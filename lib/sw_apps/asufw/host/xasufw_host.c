@@ -0,0 +1,580 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xasufw_host.c
+ *
+ * This file contains the host environment of the ASUFW load generator.
+ *
+ * The RTCA, the channel memory and a transport area are one POSIX shared memory segment, mapped
+ * at the ASU data RAM address, so the ASUFW sources and the clients use the addresses they use on
+ * silicon. The segment is created by the process running ASUFW and unlinked once it is mapped,
+ * client processes are forked from it and inherit the mapping.
+ *
+ * The ASU IPI registers are modelled on the transport area. Clients set their bit in the
+ * interrupt status and raise SIGUSR1 to the ASUFW process, whose handler is the ASUFW IPI
+ * handler. A write of ASUFW to the trigger register posts the doorbell semaphore of the channel.
+ * SIGALRM stands for the PIT3 tick and advances the task time by 10ms. While ASUFW has
+ * interrupts disabled, signals are kept pending and handled when interrupts are enabled again,
+ * as the interrupt controller does.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+/*************************************** Include Files *******************************************/
+#define _GNU_SOURCE
+#include <fcntl.h>
+#include <signal.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/time.h>
+#include "xasufw_host.h"
+#include "xasufw_dma.h"
+#include "xasufw_ipi.h"
+#include "xasufw_queuescheduler.h"
+#include "xasufw_resourcemanager.h"
+#include "xasufw_trnghandler.h"
+#include "xasufw_status.h"
+#include "xasufw_memory.h"
+#include "xasufw_util.h"
+#include "xtask.h"
+#include "xil_exception.h"
+
+/************************************ Constant Definitions ***************************************/
+#define XASUFWHOST_SHM_BASEADDR		XASU_RTCA_BASEADDR /**< Start of the segment */
+#define XASUFWHOST_TRANSPORT_ADDR	(XASU_CHANNEL_MEMORY_BASEADDR + \
+					 (XASU_MAX_IPI_CHANNELS * XASU_CHANNEL_MEMORY_OFFSET))
+									/**< Transport area */
+#define XASUFWHOST_PIT3_TICK		(10U) /**< PIT3 tick in ms */
+#define XASUFWHOST_IPI_PENDING		(0x1U) /**< IPI interrupt pending */
+#define XASUFWHOST_TIMER_PENDING	(0x2U) /**< PIT3 interrupt pending */
+#define XASUFWHOST_CHANNEL_IPI_SHIFT	(2U) /**< IPI mask of channel 0 is 1 << 2, next to PMC */
+
+/************************************ Variable Definitions ***************************************/
+static XAsufwHost_Transport *Transport;
+static u32 ShmSize;
+static u32 VerbosePrints;
+static XAsufw_Dma HostDma[XPAR_XCSUDMA_NUM_INSTANCES];
+static volatile u32 IntrDisabled = 1U;
+static u32 IntrPending;
+
+/** Host IPI configuration, in the layout of the SDT flow */
+XIpiPsu_Config XIpiPsu_ConfigTable[] = {
+	{
+		.Name = "asu_ipi",
+		.BaseAddress = XPAR_XIPIPSU_0_BASEADDR,
+		.BitMask = XPAR_XIPIPSU_0_BIT_MASK,
+		.BufferIndex = 0U,
+		.IntId = XPAR_XIPIPSU_0_INT_ID,
+		.TargetCount = 0U,
+	},
+	{
+		.Name = NULL,
+	},
+};
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the time of the monotonic clock.
+ *
+ * @return
+ *	- Time in ns.
+ *
+ *************************************************************************************************/
+u64 XAsufwHost_TimeNs(void)
+{
+	struct timespec Now;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Now);
+
+	return ((u64)Now.tv_sec * 1000000000ULL) + (u64)Now.tv_nsec;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function runs the interrupt handlers of the pending interrupts, with interrupts
+ * 		disabled as on the processor.
+ *
+ * @param	Pending	Pending interrupts.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_RunInterrupts(u32 Pending)
+{
+	if ((Pending & XASUFWHOST_TIMER_PENDING) != 0U) {
+		TaskTimeNow += XASUFWHOST_PIT3_TICK;
+	}
+	if ((Pending & XASUFWHOST_IPI_PENDING) != 0U) {
+		__atomic_add_fetch(&Transport->IpiInterrupts, 1U, __ATOMIC_RELAXED);
+		XAsufw_IpiHandler(NULL);
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the signal handler of the IPI and PIT3 interrupts. The interrupt
+ * 		is kept pending if interrupts are disabled.
+ *
+ * @param	Signal	Received signal.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_SignalHandler(int Signal)
+{
+	u32 Pending = (Signal == SIGUSR1) ? XASUFWHOST_IPI_PENDING : XASUFWHOST_TIMER_PENDING;
+
+	if (IntrDisabled != 0U) {
+		(void)__atomic_fetch_or(&IntrPending, Pending, __ATOMIC_SEQ_CST);
+	} else {
+		IntrDisabled = 1U;
+		XAsufwHost_RunInterrupts(Pending);
+		IntrDisabled = 0U;
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function disables the interrupts of ASUFW.
+ *
+ *************************************************************************************************/
+void XAsufwHost_DisableInterrupts(void)
+{
+	IntrDisabled = 1U;
+	__atomic_signal_fence(__ATOMIC_SEQ_CST);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function enables the interrupts of ASUFW and runs the handlers of the
+ * 		interrupts that came while they were disabled.
+ *
+ *************************************************************************************************/
+void XAsufwHost_EnableInterrupts(void)
+{
+	u32 Pending;
+
+	for (;;) {
+		IntrDisabled = 0U;
+		__atomic_signal_fence(__ATOMIC_SEQ_CST);
+		if (__atomic_load_n(&IntrPending, __ATOMIC_SEQ_CST) == 0U) {
+			break;
+		}
+		IntrDisabled = 1U;
+		__atomic_signal_fence(__ATOMIC_SEQ_CST);
+		Pending = __atomic_exchange_n(&IntrPending, 0U, __ATOMIC_SEQ_CST);
+		XAsufwHost_RunInterrupts(Pending);
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function blocks the interrupt signals in the calling thread, so that they are
+ * 		delivered to the thread running ASUFW only. Threads created afterwards inherit it.
+ *
+ *************************************************************************************************/
+void XAsufwHost_BlockInterrupts(void)
+{
+	sigset_t Set;
+
+	(void)sigemptyset(&Set);
+	(void)sigaddset(&Set, SIGUSR1);
+	(void)sigaddset(&Set, SIGALRM);
+	(void)pthread_sigmask(SIG_BLOCK, &Set, NULL);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the transport area of the shared memory segment.
+ *
+ * @return
+ *	- Pointer to the transport area.
+ *
+ *************************************************************************************************/
+XAsufwHost_Transport *XAsufwHost_GetTransport(void)
+{
+	return Transport;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the channel memory of a channel.
+ *
+ * @param	ChannelIdx	Channel index.
+ *
+ * @return
+ *	- Pointer to the channel memory.
+ *
+ *************************************************************************************************/
+XAsu_ChannelMemory *XAsufwHost_GetChannelMemory(u32 ChannelIdx)
+{
+	return (XAsu_ChannelMemory *)(UINTPTR)(XASU_CHANNEL_MEMORY_BASEADDR +
+					      (ChannelIdx * XASU_CHANNEL_MEMORY_OFFSET));
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the IPI mask of a channel.
+ *
+ * @param	ChannelIdx	Channel index.
+ *
+ * @return
+ *	- IPI mask of the channel.
+ *
+ *************************************************************************************************/
+u32 XAsufwHost_GetIpiMask(u32 ChannelIdx)
+{
+	return (u32)1U << (ChannelIdx + XASUFWHOST_CHANNEL_IPI_SHIFT);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function sends an IPI to ASUFW. The signal is raised only if the status bit was
+ * 		clear, otherwise the handler has not acknowledged the previous IPI and reads the
+ * 		queues after this request is written.
+ *
+ * @param	IpiMask	IPI mask of the sender.
+ *
+ *************************************************************************************************/
+void XAsufwHost_SendIpi(u32 IpiMask)
+{
+	u32 Old = __atomic_fetch_or(&Transport->IpiIsr, IpiMask, __ATOMIC_SEQ_CST);
+
+	if (((Old & IpiMask) == 0U) &&
+	    ((__atomic_load_n(&Transport->IpiEnabled, __ATOMIC_RELAXED) & IpiMask) != 0U)) {
+		(void)kill(Transport->ServerPid, SIGUSR1);
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function posts the doorbells of the channels whose IPI mask is triggered.
+ *
+ * @param	Value	Value written to the trigger register.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_Trigger(u32 Value)
+{
+	const XAsu_CommChannelInfo *Info = (const XAsu_CommChannelInfo *)(UINTPTR)
+					   XASU_RTCA_COMM_CHANNEL_INFO_ADDR;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < Info->NumOfIpiChannels; ++Idx) {
+		if ((Value & Info->Channel[Idx].IpiBitMask) != 0U) {
+			__atomic_add_fetch(&Transport->RespDoorbells[Idx], 1U, __ATOMIC_RELAXED);
+			(void)sem_post(&Transport->Doorbell[Idx]);
+		}
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function reads a register. Addresses in the shared memory segment read memory,
+ * 		the IPI registers read the transport area and other registers read 0.
+ *
+ * @param	Addr	Register address.
+ *
+ * @return
+ *	- Register value.
+ *
+ *************************************************************************************************/
+u32 XAsufwHost_In32(UINTPTR Addr)
+{
+	u32 Value = 0U;
+
+	if ((Addr >= XASUFWHOST_SHM_BASEADDR) && (Addr < (XASUFWHOST_SHM_BASEADDR + ShmSize))) {
+		Value = *(volatile u32 *)Addr;
+	} else if (Addr == IPI_ASU_ISR) {
+		Value = __atomic_load_n(&Transport->IpiIsr, __ATOMIC_SEQ_CST);
+	} else if (Addr == IPI_ASU_IMR) {
+		Value = ~Transport->IpiEnabled;
+	} else {
+		/* Other registers are not modelled */
+	}
+
+	return Value;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function writes a register. Addresses in the shared memory segment write
+ * 		memory, the IPI registers update the transport area and other writes are dropped.
+ *
+ * @param	Addr	Register address.
+ * @param	Value	Value to be written.
+ *
+ *************************************************************************************************/
+void XAsufwHost_Out32(UINTPTR Addr, u32 Value)
+{
+	if ((Addr >= XASUFWHOST_SHM_BASEADDR) && (Addr < (XASUFWHOST_SHM_BASEADDR + ShmSize))) {
+		*(volatile u32 *)Addr = Value;
+	} else if (Addr == IPI_ASU_TRIG) {
+		XAsufwHost_Trigger(Value);
+	} else if (Addr == IPI_ASU_ISR) {
+		(void)__atomic_and_fetch(&Transport->IpiIsr, ~Value, __ATOMIC_SEQ_CST);
+	} else if (Addr == IPI_ASU_IER) {
+		(void)__atomic_or_fetch(&Transport->IpiEnabled, Value, __ATOMIC_SEQ_CST);
+	} else if (Addr == IPI_ASU_IDR) {
+		(void)__atomic_and_fetch(&Transport->IpiEnabled, ~Value, __ATOMIC_SEQ_CST);
+	} else {
+		/* Other registers are not modelled */
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function creates the shared memory segment, maps it at the ASU data RAM
+ * 		address and writes the communication channel information, as the ASU CDO does.
+ *
+ * @param	NumChannels	Number of IPI channels.
+ * @param	P0Priority	Task priority of the P0 queues.
+ * @param	P1Priority	Task priority of the P1 queues.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the segment is mapped.
+ *	- XASUFW_FAILURE, otherwise.
+ *
+ *************************************************************************************************/
+s32 XAsufwHost_Init(u32 NumChannels, u8 P0Priority, u8 P1Priority)
+{
+	s32 Status = XASUFW_FAILURE;
+	XAsu_CommChannelInfo *Info;
+	char Name[32U];
+	void *Ptr;
+	int Fd;
+	u32 Idx;
+
+	ShmSize = (u32)(XASUFWHOST_TRANSPORT_ADDR - XASUFWHOST_SHM_BASEADDR) +
+		  (u32)sizeof(XAsufwHost_Transport);
+	ShmSize = (ShmSize + 0xFFFU) & ~0xFFFU;
+
+	(void)snprintf(Name, sizeof(Name), "/asufw_host.%d", (int)getpid());
+	Fd = shm_open(Name, O_RDWR | O_CREAT | O_EXCL, 0600);
+	if (Fd < 0) {
+		perror("shm_open");
+		goto END;
+	}
+	if (ftruncate(Fd, ShmSize) != 0) {
+		perror("ftruncate");
+		(void)close(Fd);
+		(void)shm_unlink(Name);
+		goto END;
+	}
+	Ptr = mmap((void *)(UINTPTR)XASUFWHOST_SHM_BASEADDR, ShmSize, PROT_READ | PROT_WRITE,
+		   MAP_SHARED | MAP_FIXED_NOREPLACE, Fd, 0);
+	(void)close(Fd);
+	(void)shm_unlink(Name);
+	if (Ptr != (void *)(UINTPTR)XASUFWHOST_SHM_BASEADDR) {
+		perror("mmap");
+		goto END;
+	}
+
+	Transport = (XAsufwHost_Transport *)(UINTPTR)XASUFWHOST_TRANSPORT_ADDR;
+	Transport->ServerPid = getpid();
+	for (Idx = 0U; Idx < XASU_MAX_IPI_CHANNELS; ++Idx) {
+		if (sem_init(&Transport->Doorbell[Idx], 1, 0U) != 0) {
+			perror("sem_init");
+			goto END;
+		}
+	}
+
+	Info = (XAsu_CommChannelInfo *)(UINTPTR)XASU_RTCA_COMM_CHANNEL_INFO_ADDR;
+	Info->NumOfIpiChannels = NumChannels;
+	for (Idx = 0U; Idx < NumChannels; ++Idx) {
+		Info->Channel[Idx].P0QueuePriority = P0Priority;
+		Info->Channel[Idx].P1QueuePriority = P1Priority;
+		Info->Channel[Idx].IpiBitMask = (u16)XAsufwHost_GetIpiMask(Idx);
+	}
+
+	Status = XASUFW_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function initializes ASUFW in the order of XAsufw_Init, with the engine models
+ * 		in place of the modules, and runs the task dispatch loop. It does not return.
+ *
+ *************************************************************************************************/
+void XAsufwHost_RunFirmware(void)
+{
+	struct sigaction Action;
+	struct itimerval Timer;
+	sigset_t Set;
+
+	XTask_Init();
+	XAsufw_ResourceInit();
+	XAsufw_WriteReg(XASUFW_RTCA_IDENTIFICATION_ADDR, XASUFW_RTCA_IDENTIFICATION_STRING);
+	(void)XAsufw_DmaInit();
+	if (XAsufw_IpiInit() != XASUFW_SUCCESS) {
+		fprintf(stderr, "IPI init failed\n");
+		_exit(1);
+	}
+	XAsufw_ChannelConfigInit();
+	if (XAsufwHost_EnginesInit() != XASUFW_SUCCESS) {
+		fprintf(stderr, "Engine models init failed\n");
+		_exit(1);
+	}
+
+	/* Both interrupts are handled on this thread, one at a time */
+	(void)memset(&Action, 0, sizeof(Action));
+	Action.sa_handler = XAsufwHost_SignalHandler;
+	Action.sa_flags = SA_RESTART;
+	(void)sigemptyset(&Action.sa_mask);
+	(void)sigaddset(&Action.sa_mask, SIGUSR1);
+	(void)sigaddset(&Action.sa_mask, SIGALRM);
+	(void)sigaction(SIGUSR1, &Action, NULL);
+	(void)sigaction(SIGALRM, &Action, NULL);
+
+	Timer.it_interval.tv_sec = 0;
+	Timer.it_interval.tv_usec = XASUFWHOST_PIT3_TICK * 1000;
+	Timer.it_value = Timer.it_interval;
+	(void)setitimer(ITIMER_REAL, &Timer, NULL);
+
+	(void)sigemptyset(&Set);
+	(void)sigaddset(&Set, SIGUSR1);
+	(void)sigaddset(&Set, SIGALRM);
+	(void)pthread_sigmask(SIG_UNBLOCK, &Set, NULL);
+
+	__atomic_store_n(&Transport->IsReady, XASU_TRUE, __ATOMIC_RELEASE);
+	Xil_ExceptionEnable();
+
+	XTask_DispatchLoop();
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function prints the status of all queue buffers, when the load generator
+ * 		detects a stall.
+ *
+ *************************************************************************************************/
+void XAsufwHost_DumpQueues(void)
+{
+	const XAsu_CommChannelInfo *Info = (const XAsu_CommChannelInfo *)(UINTPTR)
+					   XASU_RTCA_COMM_CHANNEL_INFO_ADDR;
+	const XAsu_ChannelQueue *Queue;
+	u32 Idx;
+	u32 PxQueue;
+	u32 BufIdx;
+	const XAsu_ChannelQueueBuf *Buf;
+
+	fprintf(stderr, "IPI status 0x%x, enabled 0x%x, task time %u ms\n", Transport->IpiIsr,
+		Transport->IpiEnabled, TaskTimeNow);
+	for (Idx = 0U; Idx < Info->NumOfIpiChannels; ++Idx) {
+		for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+			Queue = (PxQueue == 0U) ?
+				&XAsufwHost_GetChannelMemory(Idx)->P0ChannelQueue :
+				&XAsufwHost_GetChannelMemory(Idx)->P1ChannelQueue;
+			fprintf(stderr, "Channel %u P%u: IsCmdPresent %u, req/resp", Idx, PxQueue,
+				Queue->IsCmdPresent);
+			for (BufIdx = 0U; BufIdx < XASU_MAX_BUFFERS; ++BufIdx) {
+				Buf = &Queue->ChannelQueueBufs[BufIdx];
+				fprintf(stderr, " %u/%u", Buf->ReqBufStatus, Buf->RespBufStatus);
+			}
+			fprintf(stderr, "\n");
+		}
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function enables the ASUFW prints.
+ *
+ * @param	Verbose	TRUE to print, FALSE to drop the prints.
+ *
+ *************************************************************************************************/
+void XAsufwHost_SetVerbose(u32 Verbose)
+{
+	VerbosePrints = Verbose;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the host xil_printf. ASUFW prints a line per command, so the prints
+ * 		are dropped unless enabled.
+ *
+ * @param	Format	Format string.
+ *
+ *************************************************************************************************/
+void xil_printf(const char8 *Format, ...)
+{
+	va_list Args;
+
+	if (VerbosePrints != 0U) {
+		va_start(Args, Format);
+		(void)vprintf(Format, Args);
+		va_end(Args);
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function initializes the DMA instances the resource manager hands out. The
+ * 		engine models do not program them.
+ *
+ * @return
+ *	- XASUFW_SUCCESS always.
+ *
+ *************************************************************************************************/
+s32 XAsufw_DmaInit(void)
+{
+	HostDma[0U].AsuDma.Config.DmaType = XPAR_ASU_DMA0_DMA_TYPE;
+	HostDma[0U].AsuDma.IsReady = XIL_COMPONENT_IS_READY;
+	HostDma[1U].AsuDma.Config.DmaType = XPAR_ASU_DMA1_DMA_TYPE;
+	HostDma[1U].AsuDma.IsReady = XIL_COMPONENT_IS_READY;
+
+	return XASUFW_SUCCESS;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the DMA instance of the given base address.
+ *
+ * @param	BaseAddress	DMA base address.
+ *
+ * @return
+ *	- Pointer to the DMA instance.
+ *	- NULL, if the base address is not an ASU DMA.
+ *
+ *************************************************************************************************/
+XAsufw_Dma *XAsufw_GetDmaInstance(u32 BaseAddress)
+{
+	XAsufw_Dma *AsuDmaPtr = NULL;
+
+	if (BaseAddress == ASUDMA_0_DEVICE_ID) {
+		AsuDmaPtr = &HostDma[0U];
+	} else if (BaseAddress == ASUDMA_1_DEVICE_ID) {
+		AsuDmaPtr = &HostDma[1U];
+	} else {
+		/* Do nothing */
+	}
+
+	return AsuDmaPtr;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function reports random numbers as available, the TRNG is not modelled.
+ *
+ * @return
+ *	- XASUFW_SUCCESS always.
+ *
+ *************************************************************************************************/
+s32 XAsufw_TrngIsRandomNumAvailable(void)
+{
+	return XASUFW_SUCCESS;
+}
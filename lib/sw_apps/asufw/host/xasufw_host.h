@@ -0,0 +1,130 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xasufw_host.h
+ *
+ * This file contains declarations of the host environment in which the ASUFW queue scheduler runs
+ * on Linux, with the shared memory in a POSIX shared memory segment and software models of the
+ * crypto engines.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+#ifndef XASUFW_HOST_H
+#define XASUFW_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*************************************** Include Files *******************************************/
+#include <semaphore.h>
+#include <sys/types.h>
+#include "xil_types.h"
+#include "xasu_sharedmem.h"
+#include "xasu_aesinfo.h"
+
+/************************************ Constant Definitions ***************************************/
+#define XASUFWHOST_MAX_PAYLOAD		(64U * 1024U) /**< Largest data size of one command */
+#define XASUFWHOST_HIST_SUB_BUCKETS	(16U) /**< Latency histogram buckets per power of two */
+#define XASUFWHOST_HIST_BUCKETS		(64U * XASUFWHOST_HIST_SUB_BUCKETS) /**< Latency
+										histogram buckets */
+#define XASUFWHOST_QUEUES		(2U) /**< P0 and P1 queues of a channel */
+#define XASUFWHOST_HASH_SIZE		(64U) /**< Largest digest size */
+
+/* Engine models */
+#define XASUFWHOST_ENGINE_SHA2		(0U) /**< SHA2 engine model */
+#define XASUFWHOST_ENGINE_SHA3		(1U) /**< SHA3 engine model */
+#define XASUFWHOST_ENGINE_AES		(2U) /**< AES engine model */
+#define XASUFWHOST_ENGINES		(3U) /**< Number of engine models */
+
+/************************************** Type Definitions *****************************************/
+/** @brief This structure contains the timing of an engine model. */
+typedef struct {
+	u32 SetupNs; /**< Time of a start or init, key load included */
+	u32 MBps; /**< Data rate of an update in MB/s */
+	u32 FinishNs; /**< Time of a finish, digest or tag read out included */
+} XAsufwHost_EngineModel;
+
+/** @brief This structure contains the results measured for a channel queue. */
+typedef struct {
+	u64 Cmds; /**< Commands completed in the measured window */
+	u64 Ops; /**< Operations completed in the measured window, one per stream */
+	u64 Errors; /**< Commands completed with an error response */
+	u64 Bytes; /**< Payload bytes of the completed commands */
+	u64 MaxNs; /**< Largest command latency */
+	u64 Completed; /**< All completed commands, progress of the watchdog */
+	u64 Hist[XASUFWHOST_HIST_BUCKETS]; /**< Command latency histogram */
+} XAsufwHost_QueueStats;
+
+/** @brief This structure contains the payload buffers of a channel queue. */
+typedef struct {
+	u8 Data[XASUFWHOST_MAX_PAYLOAD]; /**< Input data */
+	u8 Out[XASUFWHOST_MAX_PAYLOAD]; /**< AES output data */
+	u8 Hash[XASUFWHOST_HASH_SIZE]; /**< SHA digest */
+	u8 Key[32U]; /**< AES key */
+	u8 Iv[16U]; /**< AES IV */
+	u8 Tag[16U]; /**< AES tag */
+	XAsu_AesKeyObject KeyObject; /**< AES key object */
+} XAsufwHost_Payload;
+
+/**
+ * @brief This structure is the transport area of the shared memory segment, next to the RTCA
+ * and the channel memory. It holds the IPI state that is a register block on silicon, the
+ * response doorbells of the channels, the payload buffers and the results.
+ */
+typedef struct {
+	pid_t ServerPid; /**< Process running ASUFW, target of the IPI signal */
+	u32 IsReady; /**< ASUFW is initialized and runs the dispatch loop */
+	u32 IpiIsr; /**< IPI interrupt status, set by clients and cleared by ASUFW */
+	u32 IpiEnabled; /**< IPI interrupts enabled by ASUFW */
+	u32 Stop; /**< Clients stop starting new operations */
+	u32 Failed; /**< A client saw an unexpected response */
+	u32 ClientsDone; /**< Clients that completed all their requests after the stop */
+	u64 MeasureStartNs; /**< Start of the measured window */
+	u64 MeasureEndNs; /**< End of the measured window */
+	sem_t Doorbell[XASU_MAX_IPI_CHANNELS]; /**< Response IPI of every channel */
+	u64 IpiInterrupts; /**< IPI handler runs */
+	u64 RespDoorbells[XASU_MAX_IPI_CHANNELS]; /**< Response IPIs sent to every channel */
+	u64 EngineCmds[XASUFWHOST_ENGINES]; /**< Commands run by every engine model */
+	u64 EngineBusyNs[XASUFWHOST_ENGINES]; /**< Time every engine model was busy */
+	u64 EngineBytes[XASUFWHOST_ENGINES]; /**< Bytes processed by every engine model */
+	XAsufwHost_QueueStats Stats[XASU_MAX_IPI_CHANNELS][XASUFWHOST_QUEUES]; /**< Results */
+	XAsufwHost_Payload Payload[XASU_MAX_IPI_CHANNELS][XASUFWHOST_QUEUES]; /**< Payloads */
+} XAsufwHost_Transport;
+
+/*************************** Macros (Inline Functions) Definitions *******************************/
+
+/************************************ Function Prototypes ****************************************/
+s32 XAsufwHost_Init(u32 NumChannels, u8 P0Priority, u8 P1Priority);
+void XAsufwHost_RunFirmware(void);
+XAsufwHost_Transport *XAsufwHost_GetTransport(void);
+XAsu_ChannelMemory *XAsufwHost_GetChannelMemory(u32 ChannelIdx);
+u32 XAsufwHost_GetIpiMask(u32 ChannelIdx);
+void XAsufwHost_SendIpi(u32 IpiMask);
+void XAsufwHost_BlockInterrupts(void);
+u64 XAsufwHost_TimeNs(void);
+void XAsufwHost_SetVerbose(u32 Verbose);
+void XAsufwHost_DumpQueues(void);
+s32 XAsufwHost_EnginesInit(void);
+void XAsufwHost_SetEngineModel(u32 Engine, const XAsufwHost_EngineModel *Model);
+const XAsufwHost_EngineModel *XAsufwHost_GetEngineModel(u32 Engine);
+void XAsufwHost_EngineRun(u32 Engine, u32 Ns, u64 DataAddr, u32 Len);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XASUFW_HOST_H */
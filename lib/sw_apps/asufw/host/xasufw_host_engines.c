@@ -0,0 +1,577 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xasufw_host_engines.c
+ *
+ * This file contains the software models of the SHA2, SHA3 and AES engines of the ASUFW load
+ * generator. The models register the modules with the command IDs and required resources of
+ * xasufw_sha2handler.c, xasufw_sha3handler.c and xasufw_aeshandler.c, and allocate and release
+ * the resources as those handlers do. Instead of programming the engine and DMA, a command
+ * reads its payload, busy waits for the time of the engine model and writes a digest, output
+ * data or tag that is derived from the payload, not a real one.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+/*************************************** Include Files *******************************************/
+#include <string.h>
+#include "xasufw_host.h"
+#include "xasufw_modules.h"
+#include "xasufw_resourcemanager.h"
+#include "xasufw_status.h"
+#include "xasufw_util.h"
+#include "xasu_shainfo.h"
+#include "xasu_aesinfo.h"
+
+/************************************ Constant Definitions ***************************************/
+#define XASUFWHOST_SHA_NEXT_XOF_ENABLE_MASK	(0x1U) /**< SHAKE256 next XOF enable, as in
+							xsha_hw.h */
+#define XASUFWHOST_KAT_BYTES			(64U) /**< Data processed by a KAT */
+
+/************************************** Type Definitions *****************************************/
+/** @brief This structure contains the state of an engine model. */
+typedef struct {
+	u32 IsStarted; /**< An operation is started and not finished */
+	u32 Digest; /**< Running checksum of the processed data */
+} XAsufwHost_EngineState;
+
+/************************************ Function Prototypes ****************************************/
+static s32 XAsufwHost_Sha2Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+static s32 XAsufwHost_Sha3Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+static s32 XAsufwHost_Sha2Kat(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+static s32 XAsufwHost_Sha3Kat(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+static s32 XAsufwHost_AesOperation(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+static s32 XAsufwHost_AesKat(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+static s32 XAsufwHost_GetInfo(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+
+/************************************ Variable Definitions ***************************************/
+static XAsufwHost_EngineModel EngineModels[XASUFWHOST_ENGINES] = {
+	[XASUFWHOST_ENGINE_SHA2] = { .SetupNs = 1000U, .MBps = 500U, .FinishNs = 1000U },
+	[XASUFWHOST_ENGINE_SHA3] = { .SetupNs = 1000U, .MBps = 800U, .FinishNs = 1000U },
+	[XASUFWHOST_ENGINE_AES] = { .SetupNs = 2000U, .MBps = 1000U, .FinishNs = 1000U },
+};
+static XAsufwHost_EngineState EngineStates[XASUFWHOST_ENGINES];
+static XAsufw_Module Sha2Module;
+static XAsufw_Module Sha3Module;
+static XAsufw_Module AesModule;
+
+/*************************************************************************************************/
+/**
+ * @brief	This function sets the timing of an engine model.
+ *
+ * @param	Engine	Engine model index.
+ * @param	Model	Pointer to the timing.
+ *
+ *************************************************************************************************/
+void XAsufwHost_SetEngineModel(u32 Engine, const XAsufwHost_EngineModel *Model)
+{
+	EngineModels[Engine] = *Model;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the timing of an engine model.
+ *
+ * @param	Engine	Engine model index.
+ *
+ * @return
+ *	- Pointer to the timing.
+ *
+ *************************************************************************************************/
+const XAsufwHost_EngineModel *XAsufwHost_GetEngineModel(u32 Engine)
+{
+	return &EngineModels[Engine];
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function runs one step of an engine model. The data is read, as the DMA does,
+ * 		and the caller waits until the fixed time and the data time of the model have
+ * 		passed, as the handlers wait for the DMA and the engine to be done.
+ *
+ * @param	Engine		Engine model index.
+ * @param	Ns		Fixed time of the step.
+ * @param	DataAddr	Address of the data, 0 if there is none.
+ * @param	Len		Length of the data in bytes.
+ *
+ *************************************************************************************************/
+void XAsufwHost_EngineRun(u32 Engine, u32 Ns, u64 DataAddr, u32 Len)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	u64 Start = XAsufwHost_TimeNs();
+	u64 Wait = Ns;
+	const u8 *Data = (const u8 *)(UINTPTR)DataAddr;
+	u32 Sum = EngineStates[Engine].Digest;
+	u32 Idx;
+
+	if ((Data != NULL) && (Len != 0U)) {
+		for (Idx = 0U; Idx < Len; Idx += sizeof(u32)) {
+			Sum = (Sum * 31U) + Data[Idx];
+		}
+		EngineStates[Engine].Digest = Sum;
+		/* MB/s is bytes per us, so the data time in ns is Len * 1000 / MBps */
+		Wait += ((u64)Len * 1000U) / EngineModels[Engine].MBps;
+	}
+
+	while ((XAsufwHost_TimeNs() - Start) < Wait) {
+		/* Engine and DMA are busy */
+	}
+
+	Transport->EngineCmds[Engine]++;
+	Transport->EngineBytes[Engine] += Len;
+	Transport->EngineBusyNs[Engine] += XAsufwHost_TimeNs() - Start;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function releases the DMA allocated for an update, as the handlers do.
+ *
+ * @param	AsuDmaPtr	Pointer to the allocated DMA.
+ * @param	QueueId		Queue Unique ID.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the DMA is released.
+ *	- XASUFW_RESOURCE_RELEASE_NOT_ALLOWED, upon illegal resource release.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_ReleaseDma(const XAsufw_Dma *AsuDmaPtr, u32 QueueId)
+{
+	s32 Status = XASUFW_SUCCESS;
+	XAsufw_Resource Resource;
+
+	Resource = (AsuDmaPtr->AsuDma.Config.DmaType == XPAR_ASU_DMA0_DMA_TYPE) ?
+		   XASUFW_DMA0 : XASUFW_DMA1;
+	if (XAsufw_ReleaseResource(Resource, QueueId) != XASUFW_SUCCESS) {
+		Status = XASUFW_RESOURCE_RELEASE_NOT_ALLOWED;
+	}
+
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the SHA2/SHA3 operation command of the engine models. It follows
+ * 		XAsufw_Sha2Operation and XAsufw_Sha3Operation.
+ *
+ * @param	ReqBuf		Pointer to the request buffer.
+ * @param	QueueId		Queue Unique ID.
+ * @param	Engine		XASUFWHOST_ENGINE_SHA2 or XASUFWHOST_ENGINE_SHA3.
+ *
+ * @return
+ * 	- XASUFW_SUCCESS, if the operation is successful.
+ * 	- XASUFW_SHA2/3_START/UPDATE/FINISH_FAILED, if a step is not expected in the state of the
+ * 	  engine model.
+ * 	- XASUFW_DMA_RESOURCE_ALLOCATION_FAILED, if DMA resource allocation fails.
+ * 	- XASUFW_RESOURCE_RELEASE_NOT_ALLOWED, upon illegal resource release.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_ShaOperation(const XAsu_ReqBuf *ReqBuf, u32 QueueId, u32 Engine)
+{
+	s32 Status = XASUFW_FAILURE;
+	const XAsu_ShaOperationCmd *Cmd = (const XAsu_ShaOperationCmd *)ReqBuf->Arg;
+	XAsufwHost_EngineState *State = &EngineStates[Engine];
+	XAsufw_Resource ShaResource = (Engine == XASUFWHOST_ENGINE_SHA2) ? XASUFW_SHA2 :
+				      XASUFW_SHA3;
+	u32 IsSha2 = (Engine == XASUFWHOST_ENGINE_SHA2) ? XASU_TRUE : XASU_FALSE;
+	XAsufw_Dma *AsuDmaPtr = NULL;
+	u32 HashSize;
+
+	if ((Cmd->OperationFlags & XASU_SHA_START) == XASU_SHA_START) {
+		XAsufw_AllocateResource(ShaResource, QueueId);
+		State->IsStarted = XASU_TRUE;
+		State->Digest = Cmd->ShaMode;
+		XAsufwHost_EngineRun(Engine, EngineModels[Engine].SetupNs, 0U, 0U);
+	}
+
+	if ((Cmd->OperationFlags & XASU_SHA_UPDATE) == XASU_SHA_UPDATE) {
+		if (State->IsStarted != XASU_TRUE) {
+			Status = (IsSha2 == XASU_TRUE) ? XASUFW_SHA2_UPDATE_FAILED :
+				 XASUFW_SHA3_UPDATE_FAILED;
+			goto END;
+		}
+		AsuDmaPtr = XAsufw_AllocateDmaResource(ShaResource, QueueId);
+		if (AsuDmaPtr == NULL) {
+			Status = XASUFW_DMA_RESOURCE_ALLOCATION_FAILED;
+			goto END;
+		}
+		XAsufwHost_EngineRun(Engine, 0U, Cmd->DataAddr, Cmd->DataSize);
+		Status = XAsufwHost_ReleaseDma(AsuDmaPtr, QueueId);
+		if (Status != XASUFW_SUCCESS) {
+			goto END;
+		}
+	}
+
+	if ((Cmd->OperationFlags & XASU_SHA_FINISH) == XASU_SHA_FINISH) {
+		if (State->IsStarted != XASU_TRUE) {
+			Status = (IsSha2 == XASU_TRUE) ? XASUFW_SHA2_FINISH_FAILED :
+				 XASUFW_SHA3_FINISH_FAILED;
+			goto END;
+		}
+		XAsufwHost_EngineRun(Engine, EngineModels[Engine].FinishNs, 0U, 0U);
+		HashSize = (Cmd->HashBufSize < XASUFWHOST_HASH_SIZE) ? Cmd->HashBufSize :
+			   XASUFWHOST_HASH_SIZE;
+		if (Cmd->HashAddr != 0U) {
+			(void)memset((void *)(UINTPTR)Cmd->HashAddr, (int)(State->Digest & 0xFFU),
+				     HashSize);
+		}
+		State->IsStarted = XASU_FALSE;
+		if ((IsSha2 == XASU_TRUE) || (Cmd->ShaMode != XASU_SHA_MODE_SHAKE256) ||
+		    (Cmd->ShakeReserved != XASUFWHOST_SHA_NEXT_XOF_ENABLE_MASK)) {
+			if (XAsufw_ReleaseResource(ShaResource, QueueId) != XASUFW_SUCCESS) {
+				Status = XASUFW_RESOURCE_RELEASE_NOT_ALLOWED;
+				goto END;
+			}
+		}
+	}
+
+	Status = XASUFW_SUCCESS;
+
+END:
+	if (Status != XASUFW_SUCCESS) {
+		State->IsStarted = XASU_FALSE;
+		/** Release resources. */
+		if (XAsufw_ReleaseResource(ShaResource, QueueId) != XASUFW_SUCCESS) {
+			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_RESOURCE_RELEASE_NOT_ALLOWED);
+		}
+	}
+
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the SHA2 operation command of the engine model.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- Status of XAsufwHost_ShaOperation.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_Sha2Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	return XAsufwHost_ShaOperation(ReqBuf, QueueId, XASUFWHOST_ENGINE_SHA2);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the SHA3 operation command of the engine model.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- Status of XAsufwHost_ShaOperation.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_Sha3Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	return XAsufwHost_ShaOperation(ReqBuf, QueueId, XASUFWHOST_ENGINE_SHA3);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the KAT command of an engine model. It takes the engine and a DMA
+ * 		for a short operation and releases both.
+ *
+ * @param	QueueId		Queue Unique ID.
+ * @param	Engine		Engine model index.
+ * @param	Resource	Engine resource.
+ *
+ * @return
+ * 	- XASUFW_SUCCESS, if the KAT is run.
+ * 	- XASUFW_DMA_RESOURCE_ALLOCATION_FAILED, if DMA resource allocation fails.
+ * 	- XASUFW_RESOURCE_RELEASE_NOT_ALLOWED, upon illegal resource release.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_Kat(u32 QueueId, u32 Engine, XAsufw_Resource Resource)
+{
+	s32 Status = XASUFW_FAILURE;
+	XAsufw_Dma *AsuDmaPtr;
+
+	XAsufw_AllocateResource(Resource, QueueId);
+	AsuDmaPtr = XAsufw_AllocateDmaResource(Resource, QueueId);
+	if (AsuDmaPtr == NULL) {
+		Status = XASUFW_DMA_RESOURCE_ALLOCATION_FAILED;
+		goto END;
+	}
+	XAsufwHost_EngineRun(Engine, EngineModels[Engine].SetupNs + EngineModels[Engine].FinishNs,
+			     0U, 0U);
+	XAsufwHost_EngineRun(Engine, 0U, 0U, XASUFWHOST_KAT_BYTES);
+	Status = XAsufwHost_ReleaseDma(AsuDmaPtr, QueueId);
+
+END:
+	if (XAsufw_ReleaseResource(Resource, QueueId) != XASUFW_SUCCESS) {
+		Status = XAsufw_UpdateErrorStatus(Status, XASUFW_RESOURCE_RELEASE_NOT_ALLOWED);
+	}
+
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the SHA2 KAT command of the engine model.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- Status of XAsufwHost_Kat.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_Sha2Kat(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	(void)ReqBuf;
+
+	return XAsufwHost_Kat(QueueId, XASUFWHOST_ENGINE_SHA2, XASUFW_SHA2);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the SHA3 KAT command of the engine model.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- Status of XAsufwHost_Kat.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_Sha3Kat(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	(void)ReqBuf;
+
+	return XAsufwHost_Kat(QueueId, XASUFWHOST_ENGINE_SHA3, XASUFW_SHA3);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the AES operation command of the engine model. It follows
+ * 		XAsufw_AesOperation. The output is the input XORed with the first key byte.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- XASUFW_SUCCESS, if the operation is successful.
+ * 	- XASUFW_AES_UPDATE_FAILED/XASUFW_AES_FINAL_FAILED, if a step is not expected in the
+ * 	  state of the engine model.
+ * 	- XASUFW_DMA_RESOURCE_ALLOCATION_FAILED, if DMA resource allocation fails.
+ * 	- XASUFW_RESOURCE_RELEASE_NOT_ALLOWED, upon illegal resource release.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_AesOperation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	s32 Status = XASUFW_FAILURE;
+	const Asu_AesParams *AesParamsPtr = (const Asu_AesParams *)ReqBuf->Arg;
+	XAsufwHost_EngineState *State = &EngineStates[XASUFWHOST_ENGINE_AES];
+	const XAsu_AesKeyObject *KeyObject;
+	XAsufw_Dma *AsuDmaPtr = NULL;
+	const u8 *Input;
+	u8 *Output;
+	u8 KeyByte;
+	u32 Idx;
+
+	/** Check and allocate DMA resource to AES, based on DMA availability. */
+	AsuDmaPtr = XAsufw_AllocateDmaResource(XASUFW_AES, QueueId);
+	if (AsuDmaPtr == NULL) {
+		Status = XASUFW_DMA_RESOURCE_ALLOCATION_FAILED;
+		goto END;
+	}
+
+	if ((AesParamsPtr->OperationFlags & XASU_AES_INIT) == XASU_AES_INIT) {
+		XAsufw_AllocateResource(XASUFW_AES, QueueId);
+		KeyObject = (const XAsu_AesKeyObject *)(UINTPTR)AesParamsPtr->KeyObjectAddr;
+		State->IsStarted = XASU_TRUE;
+		State->Digest = (KeyObject != NULL) ?
+				*(const u8 *)(UINTPTR)KeyObject->KeyAddress : 0U;
+		XAsufwHost_EngineRun(XASUFWHOST_ENGINE_AES,
+				     EngineModels[XASUFWHOST_ENGINE_AES].SetupNs,
+				     AesParamsPtr->IvAddr, AesParamsPtr->IvLen);
+	}
+
+	if ((AesParamsPtr->OperationFlags & XASU_AES_UPDATE) == XASU_AES_UPDATE) {
+		if (State->IsStarted != XASU_TRUE) {
+			Status = XASUFW_AES_UPDATE_FAILED;
+			goto END;
+		}
+		if ((AesParamsPtr->AadAddr != 0U) &&
+		    ((AesParamsPtr->EngineMode == XASU_AES_GCM_MODE) ||
+		     (AesParamsPtr->EngineMode == XASU_AES_CCM_MODE) ||
+		     (AesParamsPtr->EngineMode == XASU_AES_CMAC_MODE))) {
+			XAsufwHost_EngineRun(XASUFWHOST_ENGINE_AES, 0U, AesParamsPtr->AadAddr,
+					     AesParamsPtr->AadLen);
+		}
+		if ((AesParamsPtr->InputDataAddr != 0U) &&
+		    (AesParamsPtr->EngineMode != XASU_AES_CMAC_MODE)) {
+			KeyByte = (u8)State->Digest;
+			XAsufwHost_EngineRun(XASUFWHOST_ENGINE_AES, 0U, AesParamsPtr->InputDataAddr,
+					     AesParamsPtr->DataLen);
+			if (AesParamsPtr->OutputDataAddr != 0U) {
+				Input = (const u8 *)(UINTPTR)AesParamsPtr->InputDataAddr;
+				Output = (u8 *)(UINTPTR)AesParamsPtr->OutputDataAddr;
+				for (Idx = 0U; Idx < AesParamsPtr->DataLen; ++Idx) {
+					Output[Idx] = Input[Idx] ^ KeyByte;
+				}
+			}
+		}
+	}
+
+	if ((AesParamsPtr->OperationFlags & XASU_AES_FINAL) == XASU_AES_FINAL) {
+		if (State->IsStarted != XASU_TRUE) {
+			Status = XASUFW_AES_FINAL_FAILED;
+			goto END;
+		}
+		XAsufwHost_EngineRun(XASUFWHOST_ENGINE_AES,
+				     EngineModels[XASUFWHOST_ENGINE_AES].FinishNs, 0U, 0U);
+		if ((AesParamsPtr->TagAddr != 0U) && (AesParamsPtr->TagLen <= 16U)) {
+			(void)memset((void *)(UINTPTR)AesParamsPtr->TagAddr,
+				     (int)(State->Digest & 0xFFU), AesParamsPtr->TagLen);
+		}
+		State->IsStarted = XASU_FALSE;
+
+		/** Release the AES resource. */
+		if (XAsufw_ReleaseResource(XASUFW_AES, QueueId) != XASUFW_SUCCESS) {
+			Status = XASUFW_RESOURCE_RELEASE_NOT_ALLOWED;
+			goto END;
+		}
+	}
+
+	/* Release the respective allocated DMA resource(DMA0, DMA1) for AES. */
+	Status = XAsufwHost_ReleaseDma(AsuDmaPtr, QueueId);
+
+END:
+	if (Status != XASUFW_SUCCESS) {
+		State->IsStarted = XASU_FALSE;
+		/** Release the resource in the event of failure. */
+		if (XAsufw_ReleaseResource(XASUFW_AES, QueueId) != XASUFW_SUCCESS) {
+			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_RESOURCE_RELEASE_NOT_ALLOWED);
+		}
+	}
+
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the AES KAT command of the engine model.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- Status of XAsufwHost_Kat.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_AesKat(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	(void)ReqBuf;
+
+	return XAsufwHost_Kat(QueueId, XASUFWHOST_ENGINE_AES, XASUFW_AES);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the Get Info command of the engine models, which is not
+ * 		implemented by the handlers either.
+ *
+ * @param	ReqBuf	Pointer to the request buffer.
+ * @param	QueueId	Queue Unique ID.
+ *
+ * @return
+ * 	- XASUFW_FAILURE always.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_GetInfo(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+{
+	(void)ReqBuf;
+	(void)QueueId;
+
+	return XASUFW_FAILURE;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function registers the SHA2, SHA3 and AES modules with the engine model
+ * 		commands.
+ *
+ * @return
+ * 	- XASUFW_SUCCESS, if all modules are registered.
+ * 	- Error code of the module registration, otherwise.
+ *
+ *************************************************************************************************/
+s32 XAsufwHost_EnginesInit(void)
+{
+	s32 Status = XASUFW_FAILURE;
+
+	static const XAsufw_ModuleCmd Sha2Cmds[] = {
+		[XASU_SHA_OPERATION_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_Sha2Operation),
+		[XASU_SHA_KAT_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_Sha2Kat),
+		[XASU_SHA_GET_INFO_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_GetInfo),
+	};
+	static XAsufw_ResourcesRequired Sha2Resources[XASUFW_ARRAY_SIZE(Sha2Cmds)] = {
+		[XASU_SHA_OPERATION_CMD_ID] = XASUFW_DMA_RESOURCE_MASK | XASUFW_SHA2_RESOURCE_MASK,
+		[XASU_SHA_KAT_CMD_ID] = XASUFW_DMA_RESOURCE_MASK | XASUFW_SHA2_RESOURCE_MASK,
+		[XASU_SHA_GET_INFO_CMD_ID] = 0U,
+	};
+	static const XAsufw_ModuleCmd Sha3Cmds[] = {
+		[XASU_SHA_OPERATION_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_Sha3Operation),
+		[XASU_SHA_KAT_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_Sha3Kat),
+		[XASU_SHA_GET_INFO_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_GetInfo),
+	};
+	static XAsufw_ResourcesRequired Sha3Resources[XASUFW_ARRAY_SIZE(Sha3Cmds)] = {
+		[XASU_SHA_OPERATION_CMD_ID] = XASUFW_DMA_RESOURCE_MASK | XASUFW_SHA3_RESOURCE_MASK,
+		[XASU_SHA_KAT_CMD_ID] = XASUFW_DMA_RESOURCE_MASK | XASUFW_SHA3_RESOURCE_MASK,
+		[XASU_SHA_GET_INFO_CMD_ID] = 0U,
+	};
+	static const XAsufw_ModuleCmd AesCmds[] = {
+		[XASU_AES_OPERATION_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_AesOperation),
+		[XASU_AES_KAT_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_AesKat),
+		[XASU_AES_GET_INFO_CMD_ID] = XASUFW_MODULE_COMMAND(XAsufwHost_GetInfo),
+	};
+	static XAsufw_ResourcesRequired AesResources[XASUFW_ARRAY_SIZE(AesCmds)] = {
+		[XASU_AES_OPERATION_CMD_ID] = XASUFW_DMA_RESOURCE_MASK | XASUFW_AES_RESOURCE_MASK,
+		[XASU_AES_KAT_CMD_ID] = XASUFW_DMA_RESOURCE_MASK | XASUFW_AES_RESOURCE_MASK,
+		[XASU_AES_GET_INFO_CMD_ID] = 0U,
+	};
+
+	Sha2Module.Id = XASU_MODULE_SHA2_ID;
+	Sha2Module.Cmds = Sha2Cmds;
+	Sha2Module.ResourcesRequired = Sha2Resources;
+	Sha2Module.CmdCnt = XASUFW_ARRAY_SIZE(Sha2Cmds);
+	Status = XAsufw_ModuleRegister(&Sha2Module);
+	if (Status != XASUFW_SUCCESS) {
+		goto END;
+	}
+
+	Sha3Module.Id = XASU_MODULE_SHA3_ID;
+	Sha3Module.Cmds = Sha3Cmds;
+	Sha3Module.ResourcesRequired = Sha3Resources;
+	Sha3Module.CmdCnt = XASUFW_ARRAY_SIZE(Sha3Cmds);
+	Status = XAsufw_ModuleRegister(&Sha3Module);
+	if (Status != XASUFW_SUCCESS) {
+		goto END;
+	}
+
+	AesModule.Id = XASU_MODULE_AES_ID;
+	AesModule.Cmds = AesCmds;
+	AesModule.ResourcesRequired = AesResources;
+	AesModule.CmdCnt = XASUFW_ARRAY_SIZE(AesCmds);
+	Status = XAsufw_ModuleRegister(&AesModule);
+
+END:
+	return Status;
+}
@@ -0,0 +1,996 @@
+/**************************************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+**************************************************************************************************/
+
+/*************************************************************************************************/
+/**
+ *
+ * @file xasufw_loadgen.c
+ *
+ * This file contains the ASUFW load generator. ASUFW runs on the main thread with the engine
+ * models of xasufw_host_engines.c. One client per channel, a thread or with -P a process,
+ * keeps a configured number of requests outstanding on the P0 and P1 queues of its channel and
+ * measures the time from writing a request to seeing its response. The requests are SHA2, SHA3
+ * and AES operations of a configured mix, optionally split into several commands that are sent
+ * in order on the same queue, as a client of the xilasu library does.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date     Changes
+ * ----- ---- -------- ----------------------------------------------------------------------------
+ * 1.0   sb   10/16/26 Initial release
+ *
+ * </pre>
+ *
+ *************************************************************************************************/
+/*************************************** Include Files *******************************************/
+#define _GNU_SOURCE
+#include <errno.h>
+#include <pthread.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/wait.h>
+#include "xasufw_host.h"
+#include "xasu_def.h"
+#include "xasu_shainfo.h"
+#include "xasu_aesinfo.h"
+#include "xasufw_status.h"
+
+/************************************ Constant Definitions ***************************************/
+#define XASUFWHOST_MAX_MIX		(8U) /**< Entries of the request mix */
+#define XASUFWHOST_STALL_NS		(2000000000ULL) /**< No progress for this long is a stall */
+#define XASUFWHOST_POLL_NS		(100000000ULL) /**< Doorbell wait and watchdog period */
+#define XASUFWHOST_SHA_HASH_LEN		(32U) /**< SHA-256 digest */
+#define XASUFWHOST_AES_TAG_LEN		(16U) /**< GCM tag */
+#define XASUFWHOST_AES_ARG_LEN		(offsetof(Asu_AesParams, OperationType) + 1U) /**< AES
+							parameters sent in the request */
+
+/************************************** Type Definitions *****************************************/
+/** @brief This structure contains an entry of the request mix. */
+typedef struct {
+	const char *Name; /**< sha2, sha3 or aes */
+	u32 ModuleId; /**< Module of the commands */
+	u32 Bytes; /**< Data size of an operation */
+	u32 Chunks; /**< Commands an operation is split into */
+} XAsufwHost_MixEntry;
+
+/** @brief This structure contains the load generator configuration. */
+typedef struct {
+	u32 Channels; /**< Number of channels */
+	u32 Depth[XASUFWHOST_QUEUES]; /**< Outstanding requests of every P0 and P1 queue */
+	u8 Priority[XASUFWHOST_QUEUES]; /**< Task priorities of the P0 and P1 queues */
+	u32 Seconds; /**< Measured time */
+	u32 WarmupMs; /**< Time before the measurement starts */
+	u32 UseProcesses; /**< Clients are processes instead of threads */
+	u32 Csv; /**< Print the results as CSV */
+	u32 MixCnt; /**< Entries of the request mix */
+	XAsufwHost_MixEntry Mix[XASUFWHOST_MAX_MIX]; /**< Request mix */
+	char MixText[128U]; /**< Request mix as given */
+} XAsufwHost_Config;
+
+/** @brief This structure contains the client state of a queue. */
+typedef struct {
+	XAsu_ChannelQueue *Queue; /**< Channel queue in shared memory */
+	XAsufwHost_Payload *Payload; /**< Payload buffers */
+	XAsufwHost_QueueStats *Stats; /**< Results */
+	u32 Depth; /**< Outstanding requests allowed */
+	u32 Outstanding; /**< Outstanding requests */
+	u32 PendingMask; /**< Buffers with an outstanding request */
+	u32 NextIdx; /**< Next buffer to be used */
+	u32 UniqueId; /**< Unique ID of the next request */
+	const XAsufwHost_MixEntry *Op; /**< Operation in progress */
+	u32 ChunksLeft; /**< Commands of the operation still to be sent */
+	u32 ChunkIdx; /**< Index of the next command of the operation */
+	u64 SubmitNs[XASU_MAX_BUFFERS]; /**< Submit time of every buffer */
+	u32 Header[XASU_MAX_BUFFERS]; /**< Header of every buffer */
+	u32 Bytes[XASU_MAX_BUFFERS]; /**< Data size of every buffer */
+	u32 IsLast[XASU_MAX_BUFFERS]; /**< Buffer holds the last command of an operation */
+} XAsufwHost_Lane;
+
+/************************************ Variable Definitions ***************************************/
+static XAsufwHost_Config Config = {
+	.Channels = 4U,
+	.Depth = { 4U, 4U },
+	.Priority = { 0U, 1U },
+	.Seconds = 5U,
+	.WarmupMs = 200U,
+};
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the histogram bucket of a latency. Values below 16 ns have a
+ * 		bucket each, larger values have 16 buckets per power of two.
+ *
+ * @param	Ns	Latency in ns.
+ *
+ * @return
+ *	- Bucket index.
+ *
+ *************************************************************************************************/
+static u32 XAsufwHost_HistBucket(u64 Ns)
+{
+	u32 Msb;
+	u32 Bucket;
+
+	if (Ns < XASUFWHOST_HIST_SUB_BUCKETS) {
+		Bucket = (u32)Ns;
+	} else {
+		Msb = 63U - (u32)__builtin_clzll(Ns);
+		Bucket = ((Msb - 3U) * XASUFWHOST_HIST_SUB_BUCKETS) +
+			 (u32)((Ns >> (Msb - 4U)) & (XASUFWHOST_HIST_SUB_BUCKETS - 1U));
+		if (Bucket >= XASUFWHOST_HIST_BUCKETS) {
+			Bucket = XASUFWHOST_HIST_BUCKETS - 1U;
+		}
+	}
+
+	return Bucket;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the largest latency of a histogram bucket.
+ *
+ * @param	Bucket	Bucket index.
+ *
+ * @return
+ *	- Latency in ns.
+ *
+ *************************************************************************************************/
+static u64 XAsufwHost_HistValue(u32 Bucket)
+{
+	u64 Value;
+	u32 Msb;
+
+	if (Bucket < XASUFWHOST_HIST_SUB_BUCKETS) {
+		Value = Bucket;
+	} else {
+		Msb = (Bucket / XASUFWHOST_HIST_SUB_BUCKETS) + 3U;
+		Value = (u64)XASUFWHOST_HIST_SUB_BUCKETS + (Bucket % XASUFWHOST_HIST_SUB_BUCKETS);
+		Value = ((Value + 1U) << (Msb - 4U)) - 1U;
+	}
+
+	return Value;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns a percentile of a histogram.
+ *
+ * @param	Stats		Pointer to the results.
+ * @param	Percentile	Percentile, 0 to 100.
+ *
+ * @return
+ *	- Latency in ns, capped by the largest latency seen.
+ *
+ *************************************************************************************************/
+static u64 XAsufwHost_Percentile(const XAsufwHost_QueueStats *Stats, double Percentile)
+{
+	u64 Target = (u64)((((double)Stats->Cmds * Percentile) / 100.0) + 0.999999);
+	u64 Sum = 0U;
+	u64 Value = 0U;
+	u32 Bucket;
+
+	if (Target == 0U) {
+		Target = 1U;
+	}
+	for (Bucket = 0U; Bucket < XASUFWHOST_HIST_BUCKETS; ++Bucket) {
+		Sum += Stats->Hist[Bucket];
+		if (Sum >= Target) {
+			Value = XAsufwHost_HistValue(Bucket);
+			break;
+		}
+	}
+	if ((Value > Stats->MaxNs) || (Stats->Cmds == 0U)) {
+		Value = Stats->MaxNs;
+	}
+
+	return Value;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the next free buffer of a queue, in the order of
+ * 		XAsu_GetFreeIndex.
+ *
+ * @param	Lane	Pointer to the client state of the queue.
+ *
+ * @return
+ *	- Buffer index.
+ *	- XASU_MAX_BUFFERS, if all buffers are in use.
+ *
+ *************************************************************************************************/
+static u32 XAsufwHost_GetFreeIndex(XAsufwHost_Lane *Lane)
+{
+	u32 Idx = XASU_MAX_BUFFERS;
+	u32 Count;
+	u32 BufIdx;
+	const XAsu_ChannelQueueBuf *Buf;
+
+	for (Count = 0U; Count < XASU_MAX_BUFFERS; ++Count) {
+		BufIdx = (Lane->NextIdx + Count) % XASU_MAX_BUFFERS;
+		Buf = &Lane->Queue->ChannelQueueBufs[BufIdx];
+		if ((__atomic_load_n(&Buf->ReqBufStatus, __ATOMIC_ACQUIRE) == 0U) &&
+		    (__atomic_load_n(&Buf->RespBufStatus, __ATOMIC_ACQUIRE) == 0U)) {
+			Idx = BufIdx;
+			Lane->NextIdx = (BufIdx + 1U) % XASU_MAX_BUFFERS;
+			break;
+		}
+	}
+
+	return Idx;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function writes the next command of the operation in progress to a buffer.
+ *
+ * @param	Lane	Pointer to the client state of the queue.
+ * @param	Buf	Pointer to the queue buffer.
+ *
+ * @return
+ *	- Header of the command.
+ *
+ *************************************************************************************************/
+static u32 XAsufwHost_WriteCommand(XAsufwHost_Lane *Lane, XAsu_ChannelQueueBuf *Buf)
+{
+	const XAsufwHost_MixEntry *Op = Lane->Op;
+	XAsufwHost_Payload *Payload = Lane->Payload;
+	u32 IsFirst = (Lane->ChunkIdx == 0U) ? XASU_TRUE : XASU_FALSE;
+	u32 IsLast = (Lane->ChunksLeft == 1U) ? XASU_TRUE : XASU_FALSE;
+	u32 ChunkBytes = Op->Bytes / Op->Chunks;
+	XAsu_ShaOperationCmd ShaCmd;
+	Asu_AesParams AesParams;
+	u32 Len;
+
+	if (IsLast == XASU_TRUE) {
+		ChunkBytes = Op->Bytes - (ChunkBytes * (Op->Chunks - 1U));
+	}
+
+	if (Op->ModuleId == XASU_MODULE_AES_ID) {
+		(void)memset(&AesParams, 0, sizeof(AesParams));
+		AesParams.InputDataAddr = (u64)(UINTPTR)Payload->Data;
+		AesParams.OutputDataAddr = (u64)(UINTPTR)Payload->Out;
+		AesParams.KeyObjectAddr = (u64)(UINTPTR)&Payload->KeyObject;
+		AesParams.IvAddr = (u64)(UINTPTR)Payload->Iv;
+		AesParams.TagAddr = (IsLast == XASU_TRUE) ? (u64)(UINTPTR)Payload->Tag : 0U;
+		AesParams.DataLen = ChunkBytes;
+		AesParams.IvLen = XASU_AES_IV_SIZE_96BIT_IN_BYTES;
+		AesParams.TagLen = (IsLast == XASU_TRUE) ? XASUFWHOST_AES_TAG_LEN : 0U;
+		AesParams.EngineMode = XASU_AES_GCM_MODE;
+		AesParams.OperationFlags = XASU_AES_UPDATE;
+		if (IsFirst == XASU_TRUE) {
+			AesParams.OperationFlags |= XASU_AES_INIT;
+		}
+		if (IsLast == XASU_TRUE) {
+			AesParams.OperationFlags |= XASU_AES_FINAL;
+		}
+		AesParams.IsLast = (u8)IsLast;
+		AesParams.OperationType = XASU_AES_ENCRYPT_OPERATION;
+		Len = XASUFWHOST_AES_ARG_LEN;
+		(void)memcpy(Buf->ReqBuf.Arg, &AesParams, Len);
+	} else {
+		(void)memset(&ShaCmd, 0, sizeof(ShaCmd));
+		ShaCmd.DataAddr = (u64)(UINTPTR)Payload->Data;
+		ShaCmd.HashAddr = (u64)(UINTPTR)Payload->Hash;
+		ShaCmd.DataSize = ChunkBytes;
+		ShaCmd.HashBufSize = XASUFWHOST_SHA_HASH_LEN;
+		ShaCmd.ShaMode = XASU_SHA_MODE_SHA256;
+		ShaCmd.IsLast = (u8)IsLast;
+		ShaCmd.OperationFlags = XASU_SHA_UPDATE;
+		if (IsFirst == XASU_TRUE) {
+			ShaCmd.OperationFlags |= XASU_SHA_START;
+		}
+		if (IsLast == XASU_TRUE) {
+			ShaCmd.OperationFlags |= XASU_SHA_FINISH;
+		}
+		Len = sizeof(ShaCmd);
+		(void)memcpy(Buf->ReqBuf.Arg, &ShaCmd, Len);
+	}
+
+	/* Header as created by XAsu_CreateHeader */
+	Buf->ReqBuf.Header = (XASU_SHA_OPERATION_CMD_ID & XASU_COMMAND_ID_MASK) |
+			     (Lane->UniqueId << XASU_UNIQUE_REQ_ID_SHIFT) |
+			     (Op->ModuleId << XASU_MODULE_ID_SHIFT) |
+			     (((Len + 3U) / 4U) << XASU_COMMAND_LENGTH_SHIFT);
+	Lane->UniqueId = (Lane->UniqueId + 1U) % XASU_UNIQUE_ID_MAX;
+
+	return Buf->ReqBuf.Header;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function sends requests on a queue until the configured number is outstanding.
+ * 		After the stop, the operation in progress is completed and no new one is started.
+ *
+ * @param	Lane		Pointer to the client state of the queue.
+ * @param	IpiMask		IPI mask of the channel.
+ * @param	Seed		Pointer to the random seed of the client.
+ * @param	IsStopped	Clients are stopped.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_FillQueue(XAsufwHost_Lane *Lane, u32 IpiMask, u32 *Seed, u32 IsStopped)
+{
+	XAsu_ChannelQueueBuf *Buf;
+	u32 Idx;
+
+	while (Lane->Outstanding < Lane->Depth) {
+		if (Lane->ChunksLeft == 0U) {
+			if (IsStopped == XASU_TRUE) {
+				break;
+			}
+			Lane->Op = &Config.Mix[(u32)rand_r(Seed) % Config.MixCnt];
+			Lane->ChunksLeft = Lane->Op->Chunks;
+			Lane->ChunkIdx = 0U;
+		}
+
+		Idx = XAsufwHost_GetFreeIndex(Lane);
+		if (Idx == XASU_MAX_BUFFERS) {
+			break;
+		}
+		Buf = &Lane->Queue->ChannelQueueBufs[Idx];
+		Lane->Header[Idx] = XAsufwHost_WriteCommand(Lane, Buf);
+		Lane->Bytes[Idx] = (Lane->ChunksLeft == 1U) ?
+				   (Lane->Op->Bytes - ((Lane->Op->Bytes / Lane->Op->Chunks) *
+						       (Lane->Op->Chunks - 1U))) :
+				   (Lane->Op->Bytes / Lane->Op->Chunks);
+		Lane->IsLast[Idx] = (Lane->ChunksLeft == 1U) ? XASU_TRUE : XASU_FALSE;
+		Lane->SubmitNs[Idx] = XAsufwHost_TimeNs();
+		Lane->PendingMask |= (u32)1U << Idx;
+		++Lane->Outstanding;
+		--Lane->ChunksLeft;
+		++Lane->ChunkIdx;
+
+		/* Same order as XAsu_UpdateQueueBufferNSendIpi */
+		__atomic_store_n(&Buf->ReqBufStatus, XASU_COMMAND_IS_PRESENT, __ATOMIC_RELEASE);
+		__atomic_store_n(&Lane->Queue->IsCmdPresent, XASU_TRUE, __ATOMIC_RELEASE);
+		XAsufwHost_SendIpi(IpiMask);
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function collects the responses of a queue and records their latency.
+ *
+ * @param	Lane	Pointer to the client state of the queue.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_CollectQueue(XAsufwHost_Lane *Lane)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	XAsufwHost_QueueStats *Stats = Lane->Stats;
+	XAsu_ChannelQueueBuf *Buf;
+	u64 Now;
+	u64 Latency;
+	u64 MeasureEnd;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XASU_MAX_BUFFERS; ++Idx) {
+		Buf = &Lane->Queue->ChannelQueueBufs[Idx];
+		if (((Lane->PendingMask & ((u32)1U << Idx)) == 0U) ||
+		    (__atomic_load_n(&Buf->RespBufStatus, __ATOMIC_ACQUIRE) !=
+		     XASU_RESPONSE_IS_PRESENT)) {
+			continue;
+		}
+
+		Now = XAsufwHost_TimeNs();
+		Latency = Now - Lane->SubmitNs[Idx];
+		MeasureEnd = __atomic_load_n(&Transport->MeasureEndNs, __ATOMIC_ACQUIRE);
+		if (Buf->RespBuf.Header != Lane->Header[Idx]) {
+			fprintf(stderr, "Response header 0x%x of buffer %u, expected 0x%x\n",
+				Buf->RespBuf.Header, Idx, Lane->Header[Idx]);
+			__atomic_store_n(&Transport->Failed, XASU_TRUE, __ATOMIC_RELEASE);
+		}
+		if ((Lane->SubmitNs[Idx] >= Transport->MeasureStartNs) &&
+		    ((MeasureEnd == 0U) || (Now <= MeasureEnd))) {
+			++Stats->Cmds;
+			Stats->Bytes += Lane->Bytes[Idx];
+			Stats->Hist[XAsufwHost_HistBucket(Latency)]++;
+			if (Latency > Stats->MaxNs) {
+				Stats->MaxNs = Latency;
+			}
+			if (Lane->IsLast[Idx] == XASU_TRUE) {
+				++Stats->Ops;
+			}
+			if (Buf->RespBuf.Arg[XASU_RESPONSE_STATUS_INDEX] != 0U) {
+				++Stats->Errors;
+			}
+		}
+		__atomic_add_fetch(&Stats->Completed, 1U, __ATOMIC_RELAXED);
+
+		/* The buffer is free again, as after the callback of XAsu_DoorBellToClient */
+		(void)memset(Buf, 0, sizeof(*Buf));
+		Lane->PendingMask &= ~((u32)1U << Idx);
+		--Lane->Outstanding;
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the client of a channel. It keeps requests outstanding on both
+ * 		queues until the stop and then waits for all of them to complete.
+ *
+ * @param	ChannelIdx	Channel index.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_RunClient(u32 ChannelIdx)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	XAsu_ChannelMemory *ChannelMemory = XAsufwHost_GetChannelMemory(ChannelIdx);
+	u32 IpiMask = XAsufwHost_GetIpiMask(ChannelIdx);
+	u32 Seed = (ChannelIdx * 7919U) + 1U;
+	XAsufwHost_Lane Lanes[XASUFWHOST_QUEUES];
+	XAsufwHost_Payload *Payload;
+	struct timespec Deadline;
+	u32 IsStopped;
+	u32 PxQueue;
+	u64 Wake;
+
+	(void)memset(Lanes, 0, sizeof(Lanes));
+	for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+		Lanes[PxQueue].Queue = (PxQueue == 0U) ? &ChannelMemory->P0ChannelQueue :
+				       &ChannelMemory->P1ChannelQueue;
+		Lanes[PxQueue].Stats = &Transport->Stats[ChannelIdx][PxQueue];
+		Lanes[PxQueue].Depth = Config.Depth[PxQueue];
+		Payload = &Transport->Payload[ChannelIdx][PxQueue];
+		(void)memset(Payload->Data, (int)(ChannelIdx + 1U), sizeof(Payload->Data));
+		(void)memset(Payload->Key, 0x5A, sizeof(Payload->Key));
+		Payload->KeyObject.KeyAddress = (u64)(UINTPTR)Payload->Key;
+		Payload->KeyObject.KeySize = XASU_AES_KEY_SIZE_256_BITS;
+		Payload->KeyObject.KeySrc = XASU_AES_USER_KEY_0;
+		Lanes[PxQueue].Payload = Payload;
+	}
+
+	for (;;) {
+		IsStopped = __atomic_load_n(&Transport->Stop, __ATOMIC_ACQUIRE);
+		for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+			XAsufwHost_FillQueue(&Lanes[PxQueue], IpiMask, &Seed, IsStopped);
+		}
+		if ((IsStopped == XASU_TRUE) && (Lanes[0U].Outstanding == 0U) &&
+		    (Lanes[1U].Outstanding == 0U) && (Lanes[0U].ChunksLeft == 0U) &&
+		    (Lanes[1U].ChunksLeft == 0U)) {
+			break;
+		}
+
+		Wake = XAsufwHost_TimeNs() + XASUFWHOST_POLL_NS;
+		(void)clock_gettime(CLOCK_REALTIME, &Deadline);
+		Deadline.tv_nsec += (long)XASUFWHOST_POLL_NS;
+		if (Deadline.tv_nsec >= 1000000000L) {
+			Deadline.tv_sec++;
+			Deadline.tv_nsec -= 1000000000L;
+		}
+		while ((sem_timedwait(&Transport->Doorbell[ChannelIdx], &Deadline) != 0) &&
+		       (errno == EINTR) && (XAsufwHost_TimeNs() < Wake)) {
+			/* Interrupted, wait again */
+		}
+
+		for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+			XAsufwHost_CollectQueue(&Lanes[PxQueue]);
+		}
+	}
+
+	__atomic_add_fetch(&Transport->ClientsDone, 1U, __ATOMIC_RELEASE);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the thread of a client.
+ *
+ * @param	Arg	Channel index.
+ *
+ * @return
+ *	- NULL always.
+ *
+ *************************************************************************************************/
+static void *XAsufwHost_ClientThread(void *Arg)
+{
+	XAsufwHost_RunClient((u32)(UINTPTR)Arg);
+
+	return NULL;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the commands completed by all clients.
+ *
+ * @return
+ *	- Completed commands.
+ *
+ *************************************************************************************************/
+static u64 XAsufwHost_Progress(void)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	u64 Completed = 0U;
+	u32 Idx;
+	u32 PxQueue;
+
+	for (Idx = 0U; Idx < Config.Channels; ++Idx) {
+		for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+			Completed += __atomic_load_n(&Transport->Stats[Idx][PxQueue].Completed,
+						     __ATOMIC_RELAXED);
+		}
+	}
+
+	return Completed;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function sleeps until the given time, or until all clients are done if
+ * 		WaitClients is set. It returns early when no request completes for 2s.
+ *
+ * @param	Until		Time to sleep until, 0 for no limit.
+ * @param	WaitClients	Return when all clients are done.
+ *
+ * @return
+ *	- XASU_TRUE, if the requests are stalled.
+ *	- XASU_FALSE, otherwise.
+ *
+ *************************************************************************************************/
+static u32 XAsufwHost_Watch(u64 Until, u32 WaitClients)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	struct timespec Period = { 0, (long)XASUFWHOST_POLL_NS };
+	u64 Completed = XAsufwHost_Progress();
+	u64 LastProgress = XAsufwHost_TimeNs();
+	u64 Now;
+	u32 IsStalled = XASU_FALSE;
+
+	for (;;) {
+		Now = XAsufwHost_TimeNs();
+		if ((Until != 0U) && (Now >= Until)) {
+			break;
+		}
+		if ((WaitClients == XASU_TRUE) &&
+		    (__atomic_load_n(&Transport->ClientsDone, __ATOMIC_ACQUIRE) ==
+		     Config.Channels)) {
+			break;
+		}
+		if (XAsufwHost_Progress() != Completed) {
+			Completed = XAsufwHost_Progress();
+			LastProgress = Now;
+		} else if ((Now - LastProgress) > XASUFWHOST_STALL_NS) {
+			IsStalled = XASU_TRUE;
+			break;
+		}
+		(void)nanosleep(&Period, NULL);
+	}
+
+	return IsStalled;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function prints a result row.
+ *
+ * @param	Name	Row name.
+ * @param	Stats	Pointer to the results.
+ * @param	Seconds	Measured time in s.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_PrintRow(const char *Name, const XAsufwHost_QueueStats *Stats,
+				double Seconds)
+{
+	if (Config.Csv == XASU_TRUE) {
+		printf("%u,%u,%u,%u,%u,\"%s\",%s,%llu,%.0f,%.0f,%.1f,%.1f,%.1f,%.1f,%.1f,%llu\n",
+		       Config.Channels, Config.Depth[0U], Config.Depth[1U], Config.Priority[0U],
+		       Config.Priority[1U], Config.MixText, Name, (unsigned long long)Stats->Cmds,
+		       (double)Stats->Cmds / Seconds, (double)Stats->Ops / Seconds,
+		       ((double)Stats->Bytes / Seconds) / 1e6,
+		       (double)XAsufwHost_Percentile(Stats, 50.0) / 1e3,
+		       (double)XAsufwHost_Percentile(Stats, 99.0) / 1e3,
+		       (double)XAsufwHost_Percentile(Stats, 99.9) / 1e3,
+		       (double)Stats->MaxNs / 1e3, (unsigned long long)Stats->Errors);
+	} else {
+		printf("%-8s %10llu %10.0f %9.0f %8.1f %9.1f %9.1f %9.1f %9.1f %7llu\n", Name,
+		       (unsigned long long)Stats->Cmds, (double)Stats->Cmds / Seconds,
+		       (double)Stats->Ops / Seconds, ((double)Stats->Bytes / Seconds) / 1e6,
+		       (double)XAsufwHost_Percentile(Stats, 50.0) / 1e3,
+		       (double)XAsufwHost_Percentile(Stats, 99.0) / 1e3,
+		       (double)XAsufwHost_Percentile(Stats, 99.9) / 1e3,
+		       (double)Stats->MaxNs / 1e3, (unsigned long long)Stats->Errors);
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function adds results to a sum.
+ *
+ * @param	Sum	Pointer to the sum.
+ * @param	Stats	Pointer to the results.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_AddStats(XAsufwHost_QueueStats *Sum, const XAsufwHost_QueueStats *Stats)
+{
+	u32 Bucket;
+
+	Sum->Cmds += Stats->Cmds;
+	Sum->Ops += Stats->Ops;
+	Sum->Errors += Stats->Errors;
+	Sum->Bytes += Stats->Bytes;
+	if (Stats->MaxNs > Sum->MaxNs) {
+		Sum->MaxNs = Stats->MaxNs;
+	}
+	for (Bucket = 0U; Bucket < XASUFWHOST_HIST_BUCKETS; ++Bucket) {
+		Sum->Hist[Bucket] += Stats->Hist[Bucket];
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function prints the results of all queues, the sums of the P0 and P1 queues
+ * 		and of all queues, and the IPI and engine counters.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_Report(void)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	static XAsufwHost_QueueStats Sum[XASUFWHOST_QUEUES + 1U];
+	static const char *EngineNames[XASUFWHOST_ENGINES] = { "SHA2", "SHA3", "AES" };
+	double Seconds = (double)(Transport->MeasureEndNs - Transport->MeasureStartNs) / 1e9;
+	u64 Doorbells = 0U;
+	char Name[16U];
+	u32 Idx;
+	u32 PxQueue;
+
+	if (Config.Csv != XASU_TRUE) {
+		printf("ASUFW host load: %u channels, %s, depth P0 %u P1 %u, priority P0 %u P1 %u, "
+		       "%.2f s\n", Config.Channels, (Config.UseProcesses == XASU_TRUE) ?
+		       "processes" : "threads", Config.Depth[0U], Config.Depth[1U],
+		       Config.Priority[0U], Config.Priority[1U], Seconds);
+		printf("Mix: %s\n\n", Config.MixText);
+		printf("%-8s %10s %10s %9s %8s %9s %9s %9s %9s %7s\n", "Queue", "Cmds", "Cmds/s",
+		       "Ops/s", "MB/s", "p50 us", "p99 us", "p99.9 us", "max us", "Errors");
+	}
+
+	for (Idx = 0U; Idx < Config.Channels; ++Idx) {
+		for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+			if (Config.Depth[PxQueue] == 0U) {
+				continue;
+			}
+			(void)snprintf(Name, sizeof(Name), "ch%u.P%u", Idx, PxQueue);
+			XAsufwHost_PrintRow(Name, &Transport->Stats[Idx][PxQueue], Seconds);
+			XAsufwHost_AddStats(&Sum[PxQueue], &Transport->Stats[Idx][PxQueue]);
+			XAsufwHost_AddStats(&Sum[XASUFWHOST_QUEUES],
+					    &Transport->Stats[Idx][PxQueue]);
+		}
+		Doorbells += Transport->RespDoorbells[Idx];
+	}
+	for (PxQueue = 0U; PxQueue < XASUFWHOST_QUEUES; ++PxQueue) {
+		if (Config.Depth[PxQueue] != 0U) {
+			(void)snprintf(Name, sizeof(Name), "all.P%u", PxQueue);
+			XAsufwHost_PrintRow(Name, &Sum[PxQueue], Seconds);
+		}
+	}
+	XAsufwHost_PrintRow("total", &Sum[XASUFWHOST_QUEUES], Seconds);
+
+	if (Config.Csv != XASU_TRUE) {
+		printf("\nIPI interrupts %llu, response IPIs %llu, %.2f commands per response "
+		       "IPI\n", (unsigned long long)Transport->IpiInterrupts,
+		       (unsigned long long)Doorbells, (Doorbells != 0U) ?
+		       ((double)XAsufwHost_Progress() / (double)Doorbells) : 0.0);
+		for (Idx = 0U; Idx < XASUFWHOST_ENGINES; ++Idx) {
+			printf("%-4s engine: %llu steps, %.1f MB, busy %.1f%%\n", EngineNames[Idx],
+			       (unsigned long long)Transport->EngineCmds[Idx],
+			       (double)Transport->EngineBytes[Idx] / 1e6,
+			       (100.0 * (double)Transport->EngineBusyNs[Idx]) /
+			       ((double)(XAsufwHost_TimeNs() - Transport->MeasureStartNs +
+					 ((u64)Config.WarmupMs * 1000000U))));
+		}
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the controller thread. It starts the clients once ASUFW is ready,
+ * 		stops them after the configured time, waits for the outstanding requests and prints
+ * 		the results. It ends the program.
+ *
+ * @param	Arg	Not used.
+ *
+ * @return
+ *	- Does not return.
+ *
+ *************************************************************************************************/
+static void *XAsufwHost_Controller(void *Arg)
+{
+	XAsufwHost_Transport *Transport = XAsufwHost_GetTransport();
+	pthread_t Threads[XASU_MAX_IPI_CHANNELS];
+	pid_t Pids[XASU_MAX_IPI_CHANNELS];
+	struct timespec Period = { 0, 1000000L };
+	u32 IsStalled;
+	u64 Start;
+	u32 Idx;
+
+	(void)Arg;
+	while (__atomic_load_n(&Transport->IsReady, __ATOMIC_ACQUIRE) != XASU_TRUE) {
+		(void)nanosleep(&Period, NULL);
+	}
+
+	Start = XAsufwHost_TimeNs();
+	Transport->MeasureStartNs = Start + ((u64)Config.WarmupMs * 1000000U);
+	for (Idx = 0U; Idx < Config.Channels; ++Idx) {
+		if (Config.UseProcesses == XASU_TRUE) {
+			Pids[Idx] = fork();
+			if (Pids[Idx] == 0) {
+				XAsufwHost_RunClient(Idx);
+				_exit(0);
+			}
+			if (Pids[Idx] < 0) {
+				perror("fork");
+				exit(1);
+			}
+		} else if (pthread_create(&Threads[Idx], NULL, XAsufwHost_ClientThread,
+					  (void *)(UINTPTR)Idx) != 0) {
+			perror("pthread_create");
+			exit(1);
+		}
+	}
+
+	IsStalled = XAsufwHost_Watch(Transport->MeasureStartNs +
+				     ((u64)Config.Seconds * 1000000000ULL), XASU_FALSE);
+	__atomic_store_n(&Transport->MeasureEndNs, XAsufwHost_TimeNs(), __ATOMIC_RELEASE);
+	__atomic_store_n(&Transport->Stop, XASU_TRUE, __ATOMIC_RELEASE);
+	if (IsStalled == XASU_FALSE) {
+		IsStalled = XAsufwHost_Watch(0U, XASU_TRUE);
+	}
+	if (IsStalled == XASU_TRUE) {
+		fprintf(stderr, "No request completed for %llu ms\n",
+			(unsigned long long)(XASUFWHOST_STALL_NS / 1000000U));
+		XAsufwHost_DumpQueues();
+		exit(2);
+	}
+
+	for (Idx = 0U; Idx < Config.Channels; ++Idx) {
+		if (Config.UseProcesses == XASU_TRUE) {
+			(void)waitpid(Pids[Idx], NULL, 0);
+		} else {
+			(void)pthread_join(Threads[Idx], NULL);
+		}
+	}
+
+	XAsufwHost_Report();
+	fflush(stdout);
+	exit((Transport->Failed == XASU_TRUE) ? 1 : 0);
+
+	return NULL;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function parses the request mix, entries of type:bytes[:chunks] separated by
+ * 		commas.
+ *
+ * @param	Text	Request mix.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the mix is valid.
+ *	- XASUFW_FAILURE, otherwise.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_ParseMix(const char *Text)
+{
+	s32 Status = XASUFW_FAILURE;
+	char Buf[sizeof(Config.MixText)];
+	char *Save = NULL;
+	char *Entry;
+	char Type[8U];
+	u32 Bytes;
+	u32 Chunks;
+	int Fields;
+	XAsufwHost_MixEntry *Mix;
+
+	(void)snprintf(Config.MixText, sizeof(Config.MixText), "%s", Text);
+	(void)snprintf(Buf, sizeof(Buf), "%s", Text);
+	Config.MixCnt = 0U;
+	for (Entry = strtok_r(Buf, ",", &Save); Entry != NULL; Entry = strtok_r(NULL, ",", &Save)) {
+		if (Config.MixCnt == XASUFWHOST_MAX_MIX) {
+			goto END;
+		}
+		Chunks = 1U;
+		Fields = sscanf(Entry, "%7[a-z0-9]:%u:%u", Type, &Bytes, &Chunks);
+		if ((Fields < 2) || (Chunks == 0U) || (Bytes < Chunks) ||
+		    (((Bytes + Chunks - 1U) / Chunks) > XASUFWHOST_MAX_PAYLOAD)) {
+			goto END;
+		}
+		Mix = &Config.Mix[Config.MixCnt];
+		if (strcmp(Type, "sha2") == 0) {
+			Mix->Name = "sha2";
+			Mix->ModuleId = XASU_MODULE_SHA2_ID;
+		} else if (strcmp(Type, "sha3") == 0) {
+			Mix->Name = "sha3";
+			Mix->ModuleId = XASU_MODULE_SHA3_ID;
+		} else if (strcmp(Type, "aes") == 0) {
+			Mix->Name = "aes";
+			Mix->ModuleId = XASU_MODULE_AES_ID;
+		} else {
+			goto END;
+		}
+		Mix->Bytes = Bytes;
+		Mix->Chunks = Chunks;
+		++Config.MixCnt;
+	}
+	if (Config.MixCnt != 0U) {
+		Status = XASUFW_SUCCESS;
+	}
+
+END:
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function parses an engine model, name=setup_ns,MBps,finish_ns.
+ *
+ * @param	Text	Engine model.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the engine model is valid.
+ *	- XASUFW_FAILURE, otherwise.
+ *
+ *************************************************************************************************/
+static s32 XAsufwHost_ParseModel(const char *Text)
+{
+	s32 Status = XASUFW_FAILURE;
+	XAsufwHost_EngineModel Model;
+	char Name[8U];
+	u32 Engine;
+
+	if (sscanf(Text, "%7[a-z0-9]=%u,%u,%u", Name, &Model.SetupNs, &Model.MBps,
+		   &Model.FinishNs) != 4) {
+		goto END;
+	}
+	if (strcmp(Name, "sha2") == 0) {
+		Engine = XASUFWHOST_ENGINE_SHA2;
+	} else if (strcmp(Name, "sha3") == 0) {
+		Engine = XASUFWHOST_ENGINE_SHA3;
+	} else if (strcmp(Name, "aes") == 0) {
+		Engine = XASUFWHOST_ENGINE_AES;
+	} else {
+		goto END;
+	}
+	if (Model.MBps == 0U) {
+		goto END;
+	}
+	XAsufwHost_SetEngineModel(Engine, &Model);
+	Status = XASUFW_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function prints the usage.
+ *
+ * @param	Prog	Program name.
+ *
+ *************************************************************************************************/
+static void XAsufwHost_Usage(const char *Prog)
+{
+	const XAsufwHost_EngineModel *Sha2 = XAsufwHost_GetEngineModel(XASUFWHOST_ENGINE_SHA2);
+	const XAsufwHost_EngineModel *Sha3 = XAsufwHost_GetEngineModel(XASUFWHOST_ENGINE_SHA3);
+	const XAsufwHost_EngineModel *Aes = XAsufwHost_GetEngineModel(XASUFWHOST_ENGINE_AES);
+
+	printf("Usage: %s [options]\n\n"
+	       "Options:\n"
+	       "\t-c <n>\t\tChannels, 1 to 8, 4 by default\n"
+	       "\t-d <p0>[,<p1>]\tOutstanding requests per P0 and P1 queue, 0 to 8, 4,4 by "
+	       "default\n"
+	       "\t-p <p0>,<p1>\tTask priorities of the P0 and P1 queues, 0 to 15, 0,1 by default\n"
+	       "\t-w <mix>\tRequest mix, type:bytes[:chunks],..., type sha2, sha3 or aes,\n"
+	       "\t\t\tsha2:4096,aes:4096 by default\n"
+	       "\t-m <model>\tEngine model, name=setup_ns,MBps,finish_ns, by default\n"
+	       "\t\t\tsha2=%u,%u,%u sha3=%u,%u,%u aes=%u,%u,%u\n"
+	       "\t-t <s>\t\tMeasured time, 5 s by default\n"
+	       "\t-u <ms>\t\tWarm up time, 200 ms by default\n"
+	       "\t-P\t\tRun every client in its own process\n"
+	       "\t-k\t\tPrint the results as CSV\n"
+	       "\t-v\t\tPrint the ASUFW prints\n"
+	       "\t-h\t\tHelp\n", Prog, Sha2->SetupNs, Sha2->MBps, Sha2->FinishNs, Sha3->SetupNs,
+	       Sha3->MBps, Sha3->FinishNs, Aes->SetupNs, Aes->MBps, Aes->FinishNs);
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function is the main function of the load generator.
+ *
+ * @param	argc	Argument count.
+ * @param	argv	Arguments.
+ *
+ * @return
+ *	- Does not return on success, 1 on invalid arguments or setup failure.
+ *
+ *************************************************************************************************/
+int main(int argc, char *argv[])
+{
+	pthread_t Controller;
+	unsigned int P0;
+	unsigned int P1;
+	int Fields;
+	int Opt;
+
+	(void)XAsufwHost_ParseMix("sha2:4096,aes:4096");
+	while ((Opt = getopt(argc, argv, "c:d:p:w:m:t:u:Pkvh")) != -1) {
+		switch (Opt) {
+			case 'c':
+				Config.Channels = (u32)strtoul(optarg, NULL, 0);
+				break;
+			case 'd':
+				P1 = Config.Depth[1U];
+				Fields = sscanf(optarg, "%u,%u", &P0, &P1);
+				if ((Fields < 1) || (P0 > XASU_MAX_BUFFERS) ||
+				    (P1 > XASU_MAX_BUFFERS)) {
+					fprintf(stderr, "Invalid depth %s\n", optarg);
+					return 1;
+				}
+				Config.Depth[0U] = P0;
+				Config.Depth[1U] = P1;
+				break;
+			case 'p':
+				if ((sscanf(optarg, "%u,%u", &P0, &P1) != 2) || (P0 > 15U) ||
+				    (P1 > 15U)) {
+					fprintf(stderr, "Invalid priorities %s\n", optarg);
+					return 1;
+				}
+				Config.Priority[0U] = (u8)P0;
+				Config.Priority[1U] = (u8)P1;
+				break;
+			case 'w':
+				if (XAsufwHost_ParseMix(optarg) != XASUFW_SUCCESS) {
+					fprintf(stderr, "Invalid mix %s\n", optarg);
+					return 1;
+				}
+				break;
+			case 'm':
+				if (XAsufwHost_ParseModel(optarg) != XASUFW_SUCCESS) {
+					fprintf(stderr, "Invalid engine model %s\n", optarg);
+					return 1;
+				}
+				break;
+			case 't':
+				Config.Seconds = (u32)strtoul(optarg, NULL, 0);
+				break;
+			case 'u':
+				Config.WarmupMs = (u32)strtoul(optarg, NULL, 0);
+				break;
+			case 'P':
+				Config.UseProcesses = XASU_TRUE;
+				break;
+			case 'k':
+				Config.Csv = XASU_TRUE;
+				break;
+			case 'v':
+				XAsufwHost_SetVerbose(XASU_TRUE);
+				break;
+			default:
+				XAsufwHost_Usage(argv[0]);
+				return (Opt == 'h') ? 0 : 1;
+		}
+	}
+	if ((Config.Channels == 0U) || (Config.Channels > XASU_MAX_IPI_CHANNELS) ||
+	    (Config.Seconds == 0U) || ((Config.Depth[0U] + Config.Depth[1U]) == 0U)) {
+		XAsufwHost_Usage(argv[0]);
+		return 1;
+	}
+
+	if (XAsufwHost_Init(Config.Channels, Config.Priority[0U], Config.Priority[1U]) !=
+	    XASUFW_SUCCESS) {
+		return 1;
+	}
+
+	/* Interrupts go to this thread only, which runs ASUFW */
+	XAsufwHost_BlockInterrupts();
+	if (pthread_create(&Controller, NULL, XAsufwHost_Controller, NULL) != 0) {
+		perror("pthread_create");
+		return 1;
+	}
+	XAsufwHost_RunFirmware();
+
+	return 0;
+}
@@ -22,6 +22,7 @@
  *       ma   04/30/24 Included dependent header file
  *       ma   07/08/24 Add task based approach at queue level
  *       yog  09/26/24 Added doxygen groupings and fixed doxygen comments.
+ *       sb   10/16/26 Update task queues in dispatch loop with interrupts disabled
  *
  * </pre>
  *
@@ -34,6 +35,7 @@
 #include "xtask.h"
 #include "xasufw_status.h"
 #include "xil_printf.h"
+#include "xil_exception.h"
 
 /************************************ Constant Definitions ***************************************/
 
@@ -318,6 +320,12 @@ void XTask_DispatchLoop(void)
 
 		/* TODO: Dispatch if any pending interrupts are present */
 
+		/**
+		 * Interrupt handlers trigger tasks, so the task queues are updated with interrupts
+		 * disabled until the next task is removed from its queue.
+		 */
+		Xil_ExceptionDisable();
+
 		/* Check delayed tasks to be triggered */
 		if ((NextDispatchTime != 0U) && (DeltaTime != 0U)) {
 			NextDispatchTime = 0U;
@@ -364,6 +372,7 @@ void XTask_DispatchLoop(void)
 		/* Remove the task from the task queue and call the handler */
 		if (Task != NULL) {
 			XLinkList_RemoveItem(&Task->TaskNode);
+			Xil_ExceptionEnable();
 			Status = Task->TaskHandler(Task->PrivData);
 			if (XASUFW_SUCCESS != Status) {
 				xil_printf("Task execution failed with error: 0x%x\r\n", Status);
@@ -371,6 +380,8 @@ void XTask_DispatchLoop(void)
 			continue;
 		}
 
+		Xil_ExceptionEnable();
+
 		/* Nothing to do */
 		/* TODO: Wait for interrupts */
 	}
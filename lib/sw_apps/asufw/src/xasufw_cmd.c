@@ -21,6 +21,9 @@
  *       ma   05/18/24 Added API to check resources availability before executing a command
  *       ma   07/08/24 Add task based approach at queue level
  *       ss   09/26/24 Fixed doxygen comments
+ *       sb   10/16/26 Moved the IPI trigger to the queue scheduler to notify once per run
+ *       sb   10/16/26 Pass the command header read once by the queue scheduler and check the
+ *                     command ID before calling the command handler
  *
  * </pre>
  *
@@ -64,24 +67,29 @@ static inline u32 XAsufw_GetModuleId(u32 Header)
 
 /*************************************************************************************************/
 /**
- * @brief	This function calls the registered command handler based on the QueueInfo.
+ * @brief	This function calls the registered command handler based on the QueueInfo. The
+ * 		requesting channel is notified by the queue scheduler once the run of commands
+ * 		which includes this command is complete.
  *
  * @param	QueueBuf	Pointer to the XAsu_ChannelQueueBuf structure.
+ * @param	Header		Command header read from the request buffer by the caller. The
+ * 				header in the request buffer is not read again, as the client can
+ * 				change it.
  * @param	QueueId		Queue Unique ID.
  *
  * @return
  * 	- XASUFW_SUCCESS, On successful execution of command.
  * 	- XASUFW_VALIDATE_CMD_MODULE_NOT_REGISTERED, when module is not registered.
+ * 	- XASUFW_VALIDATE_CMD_INVALID_COMMAND_RECEIVED, when invalid command ID is received.
  * 	- XASUFW_FAILURE, if there is any failure.
  *
  *************************************************************************************************/
-s32 XAsufw_CommandQueueHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 QueueId)
+s32 XAsufw_CommandQueueHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 Header, u32 QueueId)
 {
 	s32 Status = XASUFW_FAILURE;
-	u32 CmdId = QueueBuf->ReqBuf.Header & XASU_COMMAND_ID_MASK;
-	u32 ModuleId = (QueueBuf->ReqBuf.Header & XASU_MODULE_ID_MASK) >> XASU_MODULE_ID_SHIFT;
+	u32 CmdId = Header & XASU_COMMAND_ID_MASK;
+	u32 ModuleId = XAsufw_GetModuleId(Header);
 	const XAsufw_Module *Module = NULL;
-	u32 IpiMask = QueueId >> XASUFW_IPI_MASK_SHIFT;
 
 	/** Get module ID. */
 	Module = XAsufw_GetModule(ModuleId);
@@ -90,18 +98,20 @@ s32 XAsufw_CommandQueueHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 QueueId)
 		goto END;
 	}
 
+	/** Check if Cmd ID is greater than the max supported commands */
+	if (CmdId >= Module->CmdCnt) {
+		Status = XASUFW_VALIDATE_CMD_INVALID_COMMAND_RECEIVED;
+		goto END;
+	}
+
 	QueueBuf->ReqBufStatus = XASU_COMMAND_IN_PROGRESS;
 	Status = Module->Cmds[CmdId].CmdHandler(&QueueBuf->ReqBuf, QueueId);
 
-	/**
-	 * Update command status in the request queue, the response in response queue and trigger an
-	 * interrupt to the requested channel.
-	 */
+END:
+	/** Update command status in the request queue and the response in response queue. */
 	QueueBuf->ReqBufStatus = XASU_COMMAND_EXECUTION_COMPLETE;
-	XAsufw_CommandResponseHandler(QueueBuf, Status);
-	XAsufw_WriteReg(IPI_ASU_TRIG, IpiMask);
+	XAsufw_CommandResponseHandler(QueueBuf, Header, Status);
 
-END:
 	return Status;
 }
 
@@ -110,13 +120,14 @@ END:
  * @brief	This function writes the given response to the corresponding response buffer.
  *
  * @param	QueueBuf	Pointer	to the XAsu_ChannelQueueBuf structure.
+ * @param	Header		Command header read from the request buffer by the caller.
  * @param	Response	Status of the executed command.
  *
  *************************************************************************************************/
-void XAsufw_CommandResponseHandler(XAsu_ChannelQueueBuf *QueueBuf, s32 Response)
+void XAsufw_CommandResponseHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 Header, s32 Response)
 {
 	/** Update response to the response buffer. */
-	QueueBuf->RespBuf.Header = QueueBuf->ReqBuf.Header;
+	QueueBuf->RespBuf.Header = Header;
 	QueueBuf->RespBuf.Arg[XASU_RESPONSE_STATUS_INDEX] = (u32)Response;
 	QueueBuf->RespBufStatus = XASU_RESPONSE_IS_PRESENT;
 	XAsufw_Printf(DEBUG_GENERAL, "Command response: 0x%x\r\n", Response);
@@ -127,7 +138,7 @@ void XAsufw_CommandResponseHandler(XAsu_ChannelQueueBuf *QueueBuf, s32 Response)
  * @brief	This function checks if the received command is valid and has required access
  * 		permissions or not and returns status accordingly.
  *
- * @param	ReqBuf	Pointer to the request buffer.
+ * @param	Header	Command header read from the request buffer by the caller.
  *
  * @return
  *	- XASUFW_SUCCESS, if the command validation is successful.
@@ -136,11 +147,11 @@ void XAsufw_CommandResponseHandler(XAsu_ChannelQueueBuf *QueueBuf, s32 Response)
  *	- XASUFW_FAILURE, if there is any failure.
  *
  *************************************************************************************************/
-s32 XAsufw_ValidateCommand(const XAsu_ReqBuf *ReqBuf)
+s32 XAsufw_ValidateCommand(u32 Header)
 {
 	s32 Status = XASUFW_FAILURE;
-	u32 CmdId = ReqBuf->Header & XASU_COMMAND_ID_MASK;
-	u32 ModuleId = XAsufw_GetModuleId(ReqBuf->Header);
+	u32 CmdId = Header & XASU_COMMAND_ID_MASK;
+	u32 ModuleId = XAsufw_GetModuleId(Header);
 	const XAsufw_Module *Module = NULL;
 
 	/** Get module ID. */
@@ -167,20 +178,21 @@ END:
 /**
  * @brief	This function checks if the required resources are available for the command or not.
  *
- * @param	ReqBuf	Pointer to the request buffer.
+ * @param	Header	Command header read from the request buffer by the caller.
  * @param	QueueId	Queue Unique ID
  *
  * @return
  *	- XASUFW_SUCCESS, if the required resources are available.
  *	- XASUFW_VALIDATE_CMD_MODULE_NOT_REGISTERED, when module is not registered.
+ *	- XASUFW_VALIDATE_CMD_INVALID_COMMAND_RECEIVED, when invalid command ID is received.
  *	- XASUFW_FAILURE, if there is any failure.
  *
  *************************************************************************************************/
-s32 XAsufw_CheckResources(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
+s32 XAsufw_CheckResources(u32 Header, u32 QueueId)
 {
 	s32 Status = XASUFW_FAILURE;
-	u32 CmdId = ReqBuf->Header & XASU_COMMAND_ID_MASK;
-	u32 ModuleId = XAsufw_GetModuleId(ReqBuf->Header);
+	u32 CmdId = Header & XASU_COMMAND_ID_MASK;
+	u32 ModuleId = XAsufw_GetModuleId(Header);
 	const XAsufw_Module *Module = NULL;
 	u16 ReqResources;
 
@@ -191,6 +203,12 @@ s32 XAsufw_CheckResources(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
 		goto END;
 	}
 
+	/** Check if Cmd ID is greater than the max supported commands */
+	if (CmdId >= Module->CmdCnt) {
+		Status = XASUFW_VALIDATE_CMD_INVALID_COMMAND_RECEIVED;
+		goto END;
+	}
+
 	/**
 	 * If resources required array is registered with module, check if required resources are
 	 * available.
@@ -20,6 +20,7 @@
  *       ma   05/18/24 Added API to check resources availability before executing a command
  *       ma   07/08/24 Add task based approach at queue level
  *       yog  09/26/24 Added doxygen groupings and fixed doxygen comments.
+ *       sb   10/16/26 Pass the command header to the command handling APIs
  *
  * </pre>
  *
@@ -46,10 +47,10 @@ extern "C" {
 /*************************** Macros (Inline Functions) Definitions *******************************/
 
 /************************************ Function Prototypes ****************************************/
-s32 XAsufw_CommandQueueHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 QueueId);
-void XAsufw_CommandResponseHandler(XAsu_ChannelQueueBuf *QueueBuf, s32 Response);
-s32 XAsufw_ValidateCommand(const XAsu_ReqBuf *ReqBuf);
-s32 XAsufw_CheckResources(const XAsu_ReqBuf *ReqBuf, u32 QueueId);
+s32 XAsufw_CommandQueueHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 Header, u32 QueueId);
+void XAsufw_CommandResponseHandler(XAsu_ChannelQueueBuf *QueueBuf, u32 Header, s32 Response);
+s32 XAsufw_ValidateCommand(u32 Header);
+s32 XAsufw_CheckResources(u32 Header, u32 QueueId);
 
 /************************************ Variable Definitions ***************************************/
 
@@ -18,6 +18,7 @@
  * 1.0   ma   01/02/24 Initial release
  *       ma   03/16/24 Added error codes at required places
  *       ma   07/08/24 Add task based approach at queue level
+ *       sb   10/16/26 Clear the IPI interrupt before triggering the queue tasks
  *
  * </pre>
  *
@@ -114,8 +115,12 @@ void XAsufw_IpiHandler(const void *Data)
 	while (IpiIsr != 0U) {
 		IpiMask = IpiIsr & (0x1U << Count);
 		if (IpiMask != 0U) {
-			XAsufw_TriggerQueueTask(IpiMask);
+			/**
+			 * Clear the interrupt before the queues are read, so that a request
+			 * written after the read raises the interrupt again.
+			 */
 			XAsufw_WriteReg(IPI_ASU_ISR, IpiMask);
+			XAsufw_TriggerQueueTask(IpiMask);
 		}
 		IpiIsr = IpiIsr & (~IpiMask);
 		++Count;
@@ -24,6 +24,12 @@
  *       ma   07/23/24 Updated communication channel info address with RTCA address
  *       ss   09/26/24 Fixed doxygen comments
  *       ma   09/26/24 Removed static IPI configurations from code
+ *       sb   10/16/26 Added ready buffer mask, deadline based selection across queues and
+ *                     coalescing of consecutive SHA/AES commands
+ *       sb   10/16/26 Update ready mask and task queues with interrupts disabled, and do not
+ *                     report a queue waiting for resources as a task failure
+ *       sb   10/16/26 Read the command header before the response is written
+ *       sb   10/16/26 Read the command header once per command and validate coalesced commands
  *
  * </pre>
  *
@@ -39,7 +45,9 @@
 #include "xasufw_debug.h"
 #include "xasufw_status.h"
 #include "xasufw_util.h"
+#include "xasu_def.h"
 #include "xil_util.h"
+#include "xil_exception.h"
 
 /************************************ Constant Definitions ***************************************/
 #define XASUFW_SHARED_MEMORY_ADDRESS	0xEBE41000U /**< Reserved address in ASU DATA RAM  for
@@ -55,11 +63,31 @@
 #define XASUFW_QUEUEINDEX_MASK		0xF0U /**< P0/P1 Queue index mask in Queue UniqueID */
 #define XASUFW_QUEUEINDEX_SHIFT		4U /**< Queue index shift in Queue UniqueID */
 
+#define XASUFW_ALL_BUFFERS_MASK		((1U << XASU_MAX_BUFFERS) - 1U) /**< Mask of all buffers
+										in a queue */
+#define XASUFW_MAX_CMDS_PER_RUN		4U /**< Maximum commands executed in one run of a queue
+						task before other queues are served */
+#define XASUFW_QUEUE_DEADLINE		20U /**< Time in ms after which the oldest pending command
+						of a queue is served ahead of task priorities */
+#define XASUFW_QUEUE_RETRY_DELAY	10U /**< Time in ms after which a command waiting for
+						resources is retried */
+#define XASUFW_CMD_KEY_MASK		(XASU_MODULE_ID_MASK | XASU_COMMAND_ID_MASK) /**< Header
+										fields of the coalescing key */
+#define XASUFW_INVALID_QUEUE		0xFFFFFFFFU /**< No queue selected */
+
 /************************************** Type Definitions *****************************************/
 
 /*************************** Macros (Inline Functions) Definitions *******************************/
 
 /************************************ Function Prototypes ****************************************/
+static XAsu_ChannelQueue *XAsufw_GetChannelQueue(u32 ChannelIndex, u32 PxQueue);
+static void XAsufw_UpdateReadyMask(XAsufw_QueueTask *Queue, const XAsu_ChannelQueue *ChannelQueue);
+static u32 XAsufw_GetNextReadyBuffer(const XAsufw_QueueTask *Queue);
+static u32 XAsufw_IsCmdCoalescible(u32 Header);
+static s32 XAsufw_ExecuteCommand(XAsu_ChannelQueueBuf *QueueBuf, u32 Header, u32 QueueId,
+				 u32 IsCoalesced);
+static s32 XAsufw_RunQueue(u32 ChannelIndex, u32 PxQueue);
+static u32 XAsufw_GetExpiredQueue(void);
 
 /************************************ Variable Definitions ***************************************/
 /* All channel's shared memory where the commands are received */
@@ -73,76 +101,358 @@ static XAsu_CommChannelInfo *CommChannelInfo = (XAsu_CommChannelInfo *)(UINTPTR)
 /* All channel's task related information */
 static XAsufw_ChannelTasks CommChannelTasks = { 0U };
 
+/* Queue tasks waiting for resources held by other queues */
+static XTask_TaskEvent ResourceWaitEvent = { 0U };
+
 /*************************************************************************************************/
 /**
- * @brief	This function is the task handler for the channel queues.
+ * @brief	This function returns the P0 or P1 queue of the given channel shared memory.
  *
- * @param	Arg	Task private data.
+ * @param	ChannelIndex	Channel index.
+ * @param	PxQueue		P0/P1 queue.
  *
  * @return
- *	- XASUFW_SUCCESS, if the IPI commands are executed successfully.
- *	- XASUFW_FAILURE, if there is any failure.
+ *	- Pointer to the channel queue.
  *
  *************************************************************************************************/
-s32 XAsufw_QueueTaskHandler(void *Arg)
+static XAsu_ChannelQueue *XAsufw_GetChannelQueue(u32 ChannelIndex, u32 PxQueue)
+{
+	XAsu_ChannelQueue *ChannelQueue = &SharedMemory->ChannelMemory[ChannelIndex].P0ChannelQueue;
+
+	if (PxQueue == XASUFW_P1_QUEUE) {
+		ChannelQueue = &SharedMemory->ChannelMemory[ChannelIndex].P1ChannelQueue;
+	}
+
+	return ChannelQueue;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function adds the buffers with new commands to the ready mask of the queue and
+ * 		records the time at which the commands are seen.
+ *
+ * @param	Queue		Pointer to the queue task information.
+ * @param	ChannelQueue	Pointer to the channel queue in shared memory.
+ *
+ *************************************************************************************************/
+static void XAsufw_UpdateReadyMask(XAsufw_QueueTask *Queue, const XAsu_ChannelQueue *ChannelQueue)
 {
-	s32 Status = XASUFW_FAILURE;
-	u32 ChannelIndex = (u32)Arg & XASUFW_CHANNELINDEX_MASK;
-	u32 PxQueue = ((u32)Arg & XASUFW_QUEUEINDEX_MASK) >> XASUFW_QUEUEINDEX_SHIFT;
 	u32 BufferIdx;
-	XAsu_ChannelQueue *ChannelQueue;
+	u32 BufferMask;
+
+	for (BufferIdx = 0U; BufferIdx < XASU_MAX_BUFFERS; ++BufferIdx) {
+		BufferMask = (u32)1U << BufferIdx;
+		if (((Queue->ReadyMask & BufferMask) == 0U) &&
+		    (ChannelQueue->ChannelQueueBufs[BufferIdx].ReqBufStatus ==
+		     XASU_COMMAND_IS_PRESENT)) {
+			Queue->ReadyMask |= BufferMask;
+			Queue->ArrivalTime[BufferIdx] = TaskTimeNow;
+		}
+	}
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the next buffer to be executed from the ready mask, starting
+ * 		from the buffer after the last executed one. Clients fill the buffers in the same
+ * 		circular order, so this keeps the commands of a queue in submission order.
+ *
+ * @param	Queue	Pointer to the queue task information.
+ *
+ * @return
+ *	- Index of the next ready buffer.
+ *	- XASU_MAX_BUFFERS, if no buffer is ready.
+ *
+ *************************************************************************************************/
+static u32 XAsufw_GetNextReadyBuffer(const XAsufw_QueueTask *Queue)
+{
+	u32 BufferIdx = XASU_MAX_BUFFERS;
+	u32 Rotated;
+	u32 Offset = 0U;
+
+	/** Rotate the ready mask so that bit 0 corresponds to the next buffer index. */
+	Rotated = ((Queue->ReadyMask >> Queue->NextBufIdx) |
+		   (Queue->ReadyMask << (XASU_MAX_BUFFERS - Queue->NextBufIdx))) &
+		  XASUFW_ALL_BUFFERS_MASK;
+
+	if (Rotated != 0U) {
+		while ((Rotated & 0x1U) == 0U) {
+			Rotated >>= 1U;
+			++Offset;
+		}
+		BufferIdx = (Queue->NextBufIdx + Offset) % XASU_MAX_BUFFERS;
+	}
+
+	return BufferIdx;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function checks whether consecutive commands with the given header can be
+ * 		executed in one run without repeating the resource checks. Only SHA and AES
+ * 		commands are coalesced, their resource requirement is fixed per command and is not
+ * 		consumed by the command.
+ *
+ * @param	Header	Command header.
+ *
+ * @return
+ *	- XASU_TRUE, if the command can be coalesced.
+ *	- XASU_FALSE, otherwise.
+ *
+ *************************************************************************************************/
+static u32 XAsufw_IsCmdCoalescible(u32 Header)
+{
+	u32 IsCoalescible = XASU_FALSE;
+	u32 ModuleId = (Header & XASU_MODULE_ID_MASK) >> XASU_MODULE_ID_SHIFT;
+
+	if ((ModuleId == XASU_MODULE_SHA2_ID) || (ModuleId == XASU_MODULE_SHA3_ID) ||
+	    (ModuleId == XASU_MODULE_AES_ID)) {
+		IsCoalescible = XASU_TRUE;
+	}
+
+	return IsCoalescible;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function validates the command, checks the required resources and executes
+ * 		the command. If the resources are not available, the command is marked as waiting
+ * 		for resources and is not executed.
+ *
+ * @param	QueueBuf	Pointer to the XAsu_ChannelQueueBuf structure.
+ * @param	Header		Command header read once from the request buffer. The client
+ * 				can change the request buffer, so the header is not read again.
+ * @param	QueueId		Queue Unique ID.
+ * @param	IsCoalesced	XASU_TRUE, if the previous command of the run had the same module
+ * 				and command ID and passed the resource checks.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the command is executed successfully.
+ *	- Error code, if the command validation, resource check or execution fails.
+ *
+ *************************************************************************************************/
+static s32 XAsufw_ExecuteCommand(XAsu_ChannelQueueBuf *QueueBuf, u32 Header, u32 QueueId,
+				 u32 IsCoalesced)
+{
+	s32 Status = XASUFW_FAILURE;
+
+	Status = XAsufw_ValidateCommand(Header);
+	if (XASUFW_SUCCESS != Status) {
+		XAsufw_Printf(DEBUG_GENERAL, "Validate command failed\r\n");
+		/*
+		 * TODO: Need to enhance this code to write the response only when
+		 * invalid command is received or the access permissions fail.
+		 * Currently, XAsufw_ValidateCommand only checks for invalid command
+		*/
+		/** Update command status in the request queue and the resopnse in
+			response queue. */
+		QueueBuf->ReqBufStatus = XASU_COMMAND_EXECUTION_COMPLETE;
+		XAsufw_CommandResponseHandler(QueueBuf, Header, Status);
+		goto END;
+	}
+	XAsufw_Printf(DEBUG_GENERAL, "Validate command successful\r\n");
+
+	/**
+	 * A command coalesced with the previous one in the same run skips the resource checks. The
+	 * previous command of the same module was run by the same requester and left the resources
+	 * either free or idle with this requester, so the checks cannot fail.
+	 */
+	if (IsCoalesced != XASU_TRUE) {
+		Status = XAsufw_CheckResources(Header, QueueId);
+		if (XASUFW_SUCCESS != Status) {
+			QueueBuf->ReqBufStatus = XASU_COMMAND_WAITING_FOR_RESOURCE;
+			goto END;
+		}
+	}
+
+	Status = XAsufw_CommandQueueHandler(QueueBuf, Header, QueueId);
+
+END:
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function executes the next run of commands from the given queue. A run is the
+ * 		next ready command followed by up to XASUFW_MAX_CMDS_PER_RUN - 1 consecutive
+ * 		commands with the same module and command ID, if the command can be coalesced.
+ * 		The requesting channel is notified once at the end of the run. If commands are
+ * 		left in the queue, the queue task is triggered again so that queue tasks of higher
+ * 		or equal priority are executed in between.
+ *
+ * @param	ChannelIndex	Channel index.
+ * @param	PxQueue		P0/P1 queue.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the commands are executed successfully, no command is pending or
+ *	  the next command is waiting for resources.
+ *	- Error code of the last executed command, if there is any failure.
+ *
+ *************************************************************************************************/
+static s32 XAsufw_RunQueue(u32 ChannelIndex, u32 PxQueue)
+{
+	s32 Status = XASUFW_SUCCESS;
+	XAsufw_QueueTask *Queue = &CommChannelTasks.Channel[ChannelIndex].Queue[PxQueue];
+	XAsu_ChannelQueue *ChannelQueue = XAsufw_GetChannelQueue(ChannelIndex, PxQueue);
 	XAsu_ChannelQueueBuf *QueueBuf;
+	u32 BufferIdx;
+	u32 CmdCount = 0U;
+	u32 CmdKey = 0U;
+	u32 Header;
+	u32 IsCoalescible = XASU_FALSE;
+	u32 IsWaiting = XASU_FALSE;
 
-	/** Check which queue has task whether P0/P1 queue. */
-	if (PxQueue == XASUFW_P0_QUEUE) {
-		XAsufw_Printf(DEBUG_GENERAL, "Running P0 task of channel %d\r\n", ChannelIndex);
-		ChannelQueue = &SharedMemory->ChannelMemory[ChannelIndex].P0ChannelQueue;
-		BufferIdx = CommChannelTasks.Channel[ChannelIndex].P0QueueBufIdx;
+	while (CmdCount < XASUFW_MAX_CMDS_PER_RUN) {
+		BufferIdx = XAsufw_GetNextReadyBuffer(Queue);
+		if (BufferIdx == XASU_MAX_BUFFERS) {
+			break;
+		}
+
+		QueueBuf = &ChannelQueue->ChannelQueueBufs[BufferIdx];
+		/**
+		 * Read the header once. The client can change the request buffer at any time and
+		 * may reuse it once the response is written, so the same header value is used for
+		 * coalescing, validation, dispatch and the response.
+		 */
+		Header = QueueBuf->ReqBuf.Header;
+		/** Only the commands with the same module and command ID join the run. */
+		if ((CmdCount != 0U) && ((IsCoalescible != XASU_TRUE) ||
+					 ((Header & XASUFW_CMD_KEY_MASK) != CmdKey))) {
+			break;
+		}
+
+		XAsufw_Printf(DEBUG_GENERAL, "Command is present. Channel: %d, Priority Queue: %d, "
+			      "BufferIdx: %d\r\n", ChannelIndex, PxQueue, BufferIdx);
+		Status = XAsufw_ExecuteCommand(QueueBuf, Header, Queue->QueueId,
+					       (CmdCount != 0U) ? XASU_TRUE : XASU_FALSE);
+		if (QueueBuf->ReqBufStatus == XASU_COMMAND_WAITING_FOR_RESOURCE) {
+			/**
+			 * Keep the command and the commands after it in the queue, so that the
+			 * commands of a queue are not reordered. Retry the queue when another
+			 * queue completes a run or after the retry delay.
+			 */
+			IsWaiting = XASU_TRUE;
+			break;
+		}
+
+		/* The IPI handler also updates the ready mask, clear it with interrupts disabled */
+		Xil_ExceptionDisable();
+		Queue->ReadyMask &= ~((u32)1U << BufferIdx);
+		Xil_ExceptionEnable();
+		Queue->NextBufIdx = (BufferIdx + 1U) % XASU_MAX_BUFFERS;
+		++CmdCount;
+
+		if (Status != XASUFW_SUCCESS) {
+			break;
+		}
+		CmdKey = Header & XASUFW_CMD_KEY_MASK;
+		IsCoalescible = XAsufw_IsCmdCoalescible(Header);
+	}
+
+	if (CmdCount != 0U) {
+		/** Notify the requesting channel. */
+		XAsufw_WriteReg(IPI_ASU_TRIG, Queue->QueueId >> XASUFW_IPI_MASK_SHIFT);
+	}
+
+	/** The IPI handler also triggers tasks, update the task queues with interrupts disabled. */
+	Xil_ExceptionDisable();
+	if (CmdCount != 0U) {
+		/** Retry the queues waiting for resources. */
+		XTask_EventNotify(&ResourceWaitEvent);
+	}
+
+	if (IsWaiting == XASU_TRUE) {
+		/* Waiting for resources is not a failure of the queue task */
+		Status = XASUFW_SUCCESS;
+		(void)XTask_TriggerOnEvent(Queue->Task, &ResourceWaitEvent);
+		(void)XTask_TriggerAfterDelay(Queue->Task, XASUFW_QUEUE_RETRY_DELAY);
+	} else if (Queue->ReadyMask != 0U) {
+		XTask_TriggerNow(Queue->Task);
 	} else {
-		XAsufw_Printf(DEBUG_GENERAL, "Running P1 task of channel %d\r\n", ChannelIndex);
-		ChannelQueue = &SharedMemory->ChannelMemory[ChannelIndex].P1ChannelQueue;
-		BufferIdx = CommChannelTasks.Channel[ChannelIndex].P1QueueBufIdx;
+		/* No pending commands in the queue */
 	}
+	Xil_ExceptionEnable();
+
+	return Status;
+}
 
-	/** Check all buffers for any command is present and validate and allocate resource if valid
-		and update response after command is executed. */
-	for (; BufferIdx < XASU_MAX_BUFFERS; ++BufferIdx) {
-		if (ChannelQueue->ChannelQueueBufs[BufferIdx].ReqBufStatus == XASU_COMMAND_IS_PRESENT) {
-			XAsufw_Printf(DEBUG_GENERAL, "Command is present. Channel: %d, Priority Queue: %d, "
-				      "BufferIdx: %d\r\n", ChannelIndex, PxQueue, BufferIdx);
-			QueueBuf = &ChannelQueue->ChannelQueueBufs[BufferIdx];
-			Status = XAsufw_ValidateCommand(&QueueBuf->ReqBuf);
-			if (XASUFW_SUCCESS == Status) {
-				XAsufw_Printf(DEBUG_GENERAL, "Validate command successful\r\n");
-				Status = XAsufw_CheckResources(&QueueBuf->ReqBuf, (u32)Arg);
-				if (XASUFW_SUCCESS == Status) {
-					Status = XAsufw_CommandQueueHandler(QueueBuf, (u32)Arg);
-				}
-			} else {
-				XAsufw_Printf(DEBUG_GENERAL, "Validate command failed\r\n");
-				/*
-				 * TODO: Need to enhance this code to write the response only when
-				 * invalid command is received or the access permissions fail.
-				 * Currently, XAsufw_ValidateCommand only checks for invalid command
-				*/
-				/** Update command status in the request queue and the resopnse in
-					response queue. */
-				QueueBuf->ReqBufStatus = XASU_COMMAND_EXECUTION_COMPLETE;
-				XAsufw_CommandResponseHandler(QueueBuf, Status);
+/*************************************************************************************************/
+/**
+ * @brief	This function returns the queue whose oldest pending command has been waiting for
+ * 		more than XASUFW_QUEUE_DEADLINE. If there are more such queues, the queue with the
+ * 		oldest command is returned. Queues waiting for resources are not considered.
+ *
+ * @return
+ *	- Queue index of the expired queue as ChannelIndex | (PxQueue << XASUFW_QUEUEINDEX_SHIFT).
+ *	- XASUFW_INVALID_QUEUE, if no queue has crossed the deadline.
+ *
+ *************************************************************************************************/
+static u32 XAsufw_GetExpiredQueue(void)
+{
+	u32 ExpiredQueue = XASUFW_INVALID_QUEUE;
+	u32 MaxWaitTime = XASUFW_QUEUE_DEADLINE;
+	const XAsufw_QueueTask *Queue;
+	const XAsu_ChannelQueue *ChannelQueue;
+	u32 ChannelIndex;
+	u32 PxQueue;
+	u32 BufferIdx;
+	u32 WaitTime;
+
+	for (ChannelIndex = 0U; ChannelIndex < CommChannelInfo->NumOfIpiChannels; ++ChannelIndex) {
+		for (PxQueue = XASUFW_P0_QUEUE; PxQueue < XASUFW_MAX_QUEUES_PER_CHANNEL; ++PxQueue) {
+			Queue = &CommChannelTasks.Channel[ChannelIndex].Queue[PxQueue];
+			BufferIdx = XAsufw_GetNextReadyBuffer(Queue);
+			if (BufferIdx == XASU_MAX_BUFFERS) {
+				continue;
+			}
+			ChannelQueue = XAsufw_GetChannelQueue(ChannelIndex, PxQueue);
+			if (ChannelQueue->ChannelQueueBufs[BufferIdx].ReqBufStatus ==
+			    XASU_COMMAND_WAITING_FOR_RESOURCE) {
+				continue;
+			}
+			WaitTime = TaskTimeNow - Queue->ArrivalTime[BufferIdx];
+			if (WaitTime >= MaxWaitTime) {
+				MaxWaitTime = WaitTime;
+				ExpiredQueue = ChannelIndex | (PxQueue << XASUFW_QUEUEINDEX_SHIFT);
 			}
 		}
 	}
 
-	/** Zeroize buffer index if max buffer index reached. */
-	if (BufferIdx == XASU_MAX_BUFFERS) {
-		BufferIdx = 0U;
-	}
+	return ExpiredQueue;
+}
 
-	/** Update buffer index for P0/P1 Queue. */
-	if (PxQueue == XASUFW_P0_QUEUE) {
-		CommChannelTasks.Channel[ChannelIndex].P0QueueBufIdx = BufferIdx;
-	} else {
-		CommChannelTasks.Channel[ChannelIndex].P1QueueBufIdx = BufferIdx;
+/*************************************************************************************************/
+/**
+ * @brief	This function is the task handler for the channel queues. It executes the next run
+ * 		of commands from its queue and then one run from the queue whose oldest command has
+ * 		crossed the deadline, so that low priority queues are not starved under load.
+ *
+ * @param	Arg	Task private data.
+ *
+ * @return
+ *	- XASUFW_SUCCESS, if the IPI commands are executed successfully.
+ *	- XASUFW_FAILURE, if there is any failure.
+ *
+ *************************************************************************************************/
+s32 XAsufw_QueueTaskHandler(void *Arg)
+{
+	s32 Status = XASUFW_FAILURE;
+	u32 ChannelIndex = (u32)Arg & XASUFW_CHANNELINDEX_MASK;
+	u32 PxQueue = ((u32)Arg & XASUFW_QUEUEINDEX_MASK) >> XASUFW_QUEUEINDEX_SHIFT;
+	u32 ExpiredQueue;
+
+	XAsufw_Printf(DEBUG_GENERAL, "Running P%d task of channel %d\r\n", PxQueue, ChannelIndex);
+
+	/** Execute the next run of commands from the queue of this task. */
+	Status = XAsufw_RunQueue(ChannelIndex, PxQueue);
+
+	/** Execute one run from the queue which has crossed the deadline, if any. */
+	ExpiredQueue = XAsufw_GetExpiredQueue();
+	if ((ExpiredQueue != XASUFW_INVALID_QUEUE) &&
+	    (ExpiredQueue != ((u32)Arg & (XASUFW_CHANNELINDEX_MASK | XASUFW_QUEUEINDEX_MASK)))) {
+		XAsufw_Printf(DEBUG_GENERAL, "Queue 0x%x crossed the deadline\r\n", ExpiredQueue);
+		(void)XAsufw_RunQueue(ExpiredQueue & XASUFW_CHANNELINDEX_MASK,
+				      (ExpiredQueue & XASUFW_QUEUEINDEX_MASK) >> XASUFW_QUEUEINDEX_SHIFT);
 	}
 
 	return Status;
@@ -150,8 +460,9 @@ s32 XAsufw_QueueTaskHandler(void *Arg)
 
 /*************************************************************************************************/
 /**
- * @brief	This function checks if P0 or P1 queue of the given IPI mask has the new commands
- * 		and triggers the corresponding Queue Task accordingly.
+ * @brief	This function checks if P0 or P1 queue of the given IPI mask has the new commands,
+ * 		adds them to the ready mask of the queue and triggers the corresponding Queue Task
+ * 		accordingly.
  *
  * @param   IpiMask	IPI mask on which the interrupt is received.
  *
@@ -159,6 +470,9 @@ s32 XAsufw_QueueTaskHandler(void *Arg)
 void XAsufw_TriggerQueueTask(u32 IpiMask)
 {
 	u32 ChannelIdx;
+	u32 PxQueue;
+	XAsu_ChannelQueue *ChannelQueue;
+	XAsufw_QueueTask *Queue;
 
 	/** Get channel memory index from the IPI mask. */
 	for (ChannelIdx = 0U; ChannelIdx < CommChannelInfo->NumOfIpiChannels; ++ChannelIdx) {
@@ -169,19 +483,18 @@ void XAsufw_TriggerQueueTask(u32 IpiMask)
 
 	/**
 	 * Check which queue of the corresponding channel memory has new commands and trigger the
-	 * task
+	 * task. IsCmdPresent is cleared before the buffers are read, so a command written after
+	 * the read sets it again and is picked on the next IPI.
 	 */
 	if (ChannelIdx != CommChannelInfo->NumOfIpiChannels) {
-		if ((SharedMemory->ChannelMemory[ChannelIdx].P0ChannelQueue.IsCmdPresent == XASU_TRUE) &&
-			(CommChannelTasks.Channel[ChannelIdx].P0QueueTask != NULL)) {
-			XTask_TriggerNow(CommChannelTasks.Channel[ChannelIdx].P0QueueTask);
-			SharedMemory->ChannelMemory[ChannelIdx].P0ChannelQueue.IsCmdPresent = XASU_FALSE;
-		}
-
-		if ((SharedMemory->ChannelMemory[ChannelIdx].P1ChannelQueue.IsCmdPresent == XASU_TRUE) &&
-			(CommChannelTasks.Channel[ChannelIdx].P1QueueTask != NULL)) {
-			XTask_TriggerNow(CommChannelTasks.Channel[ChannelIdx].P1QueueTask);
-			SharedMemory->ChannelMemory[ChannelIdx].P1ChannelQueue.IsCmdPresent = XASU_FALSE;
+		for (PxQueue = XASUFW_P0_QUEUE; PxQueue < XASUFW_MAX_QUEUES_PER_CHANNEL; ++PxQueue) {
+			ChannelQueue = XAsufw_GetChannelQueue(ChannelIdx, PxQueue);
+			Queue = &CommChannelTasks.Channel[ChannelIdx].Queue[PxQueue];
+			if ((ChannelQueue->IsCmdPresent == XASU_TRUE) && (Queue->Task != NULL)) {
+				ChannelQueue->IsCmdPresent = XASU_FALSE;
+				XAsufw_UpdateReadyMask(Queue, ChannelQueue);
+				XTask_TriggerNow(Queue->Task);
+			}
 		}
 	}
 }
@@ -196,7 +509,10 @@ void XAsufw_TriggerQueueTask(u32 IpiMask)
 void XAsufw_ChannelConfigInit(void)
 {
 	u32 ChannelIndex;
+	u32 PxQueue;
+	u32 Priority;
 	u32 PrivData;
+	XAsufw_QueueTask *Queue;
 
 	/* Validate IPI channel information */
 	for (ChannelIndex = 0U; ChannelIndex < CommChannelInfo->NumOfIpiChannels; ++ChannelIndex) {
@@ -214,23 +530,23 @@ void XAsufw_ChannelConfigInit(void)
 				      CommChannelInfo->Channel[ChannelIndex].P1QueuePriority);
 			break;
 		}
-		/** Create P0 Queue Task of the channel corresponding to ChannelIndex. */
-		PrivData = ChannelIndex | (XASUFW_P0_QUEUE << XASUFW_QUEUEINDEX_SHIFT) |
-			   (CommChannelInfo->Channel[ChannelIndex]. IpiBitMask << XASUFW_IPI_MASK_SHIFT);
-		CommChannelTasks.Channel[ChannelIndex].P0QueueTask = XTask_Create(
-					CommChannelInfo->Channel[ChannelIndex].P0QueuePriority, XAsufw_QueueTaskHandler,
-					(void *)PrivData, 0x0U);
-		SharedMemory->ChannelMemory[ChannelIndex].P0ChannelQueue.IsCmdPresent = XASU_FALSE;
-		CommChannelTasks.Channel[ChannelIndex].P0QueueBufIdx = 0U;
-
-		/** Create P1 Queue Task of the channel corresponding to ChannelIndex. */
-		PrivData = ChannelIndex | (XASUFW_P1_QUEUE << XASUFW_QUEUEINDEX_SHIFT) |
-			   (CommChannelInfo->Channel[ChannelIndex]. IpiBitMask << XASUFW_IPI_MASK_SHIFT);
-		CommChannelTasks.Channel[ChannelIndex].P1QueueTask = XTask_Create(
-					CommChannelInfo->Channel[ChannelIndex].P1QueuePriority, XAsufw_QueueTaskHandler,
-					(void *)PrivData, 0x0U);
-		SharedMemory->ChannelMemory[ChannelIndex].P1ChannelQueue.IsCmdPresent = XASU_FALSE;
-		CommChannelTasks.Channel[ChannelIndex].P1QueueBufIdx = 0U;
+
+		/** Create P0 and P1 Queue Tasks of the channel corresponding to ChannelIndex. */
+		for (PxQueue = XASUFW_P0_QUEUE; PxQueue < XASUFW_MAX_QUEUES_PER_CHANNEL; ++PxQueue) {
+			Queue = &CommChannelTasks.Channel[ChannelIndex].Queue[PxQueue];
+			Priority = (PxQueue == XASUFW_P0_QUEUE) ?
+				   CommChannelInfo->Channel[ChannelIndex].P0QueuePriority :
+				   CommChannelInfo->Channel[ChannelIndex].P1QueuePriority;
+			PrivData = ChannelIndex | (PxQueue << XASUFW_QUEUEINDEX_SHIFT) |
+				   ((u32)CommChannelInfo->Channel[ChannelIndex].IpiBitMask <<
+				    XASUFW_IPI_MASK_SHIFT);
+			Queue->Task = XTask_Create(Priority, XAsufw_QueueTaskHandler, (void *)PrivData,
+						   0x0U);
+			Queue->QueueId = PrivData;
+			Queue->NextBufIdx = 0U;
+			Queue->ReadyMask = 0U;
+			XAsufw_GetChannelQueue(ChannelIndex, PxQueue)->IsCmdPresent = XASU_FALSE;
+		}
 
 		/* Enable IPI interrupt from the channel */
 		XAsufw_EnableIpiInterrupt(CommChannelInfo->Channel[ChannelIndex].IpiBitMask);
@@ -19,6 +19,7 @@
  *       ma   04/18/24 Moved command handling related functions to xasufw_cmd.c
  *       ma   07/08/24 Add task based approach at queue level
  *       ss   09/26/24 Fixed doxygen comments
+ *       sb   10/16/26 Added ready buffer mask and command arrival time to queue task info
  *
  * </pre>
  *
@@ -45,6 +46,7 @@ extern "C" {
 #define XASUFW_IPI_MASK_SHIFT		(16U) /**< IPI mask shift in Queue UniqueID */
 
 #define XASUFW_MAX_CHANNELS_SUPPORTED	(8U) /**< Maximum channels supported */
+#define XASUFW_MAX_QUEUES_PER_CHANNEL	(2U) /**< P0 and P1 queues in each channel */
 
 /************************************** Type Definitions *****************************************/
 /**
@@ -54,14 +56,22 @@ typedef struct {
 	XAsu_ChannelMemory ChannelMemory[XASUFW_MAX_CHANNELS_SUPPORTED]; /**< Channel memories */
 } XAsufw_SharedMemory;
 
+/**
+ * @brief This structure contains the queue task and the state of the queue buffers.
+ */
+typedef struct {
+	XTask_TaskNode *Task; /**< Queue task pointer */
+	u32 QueueId; /**< Queue Unique ID */
+	u32 NextBufIdx; /**< Buffer index from which the next command is picked */
+	u32 ReadyMask; /**< Bit mask of buffers with commands yet to be executed */
+	u32 ArrivalTime[XASU_MAX_BUFFERS]; /**< Task time at which each pending command was seen */
+} XAsufw_QueueTask;
+
 /**
  * @brief This structure contains P0 and P1 queue tasks and queue task handler required info.
  */
 typedef struct {
-	XTask_TaskNode *P0QueueTask; /**< P0 queue task pointer */
-	u32 P0QueueBufIdx; /**< P0 queue previous buffer index */
-	XTask_TaskNode *P1QueueTask; /**< P1 queue task pointer */
-	u32 P1QueueBufIdx; /**< P1 queue previous buffer index */
+	XAsufw_QueueTask Queue[XASUFW_MAX_QUEUES_PER_CHANNEL]; /**< P0 and P1 queue task info */
 } XAsufw_QueueTasks;
 
 /**
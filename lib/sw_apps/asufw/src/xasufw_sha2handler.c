@@ -21,6 +21,7 @@
  *                     for every update
  *       ma   07/08/24 Add task based approach at queue level
  *       yog  09/26/24 Added doxygen groupings and fixed doxygen comments.
+ *       sb   10/16/26 Release DMA after every update
  *
  * </pre>
  *
@@ -128,6 +129,7 @@ static s32 XAsufw_Sha2Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
 	XSha *XAsufw_Sha2 = XSha_GetInstance(XASU_XSHA_0_DEVICE_ID);
 	const XAsu_ShaOperationCmd *Cmd = (const XAsu_ShaOperationCmd *)ReqBuf->Arg;
 	XAsufw_Dma *AsuDmaPtr = NULL;
+	XAsufw_Resource Resource;
 
 	if ((Cmd->OperationFlags & XASU_SHA_START) == XASU_SHA_START) {
 		/**
@@ -157,6 +159,14 @@ static s32 XAsufw_Sha2Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
 			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_SHA2_UPDATE_FAILED);
 			goto END;
 		}
+
+		/** Release the DMA resource, it is allocated again for the next update. */
+		Resource = (AsuDmaPtr->AsuDma.Config.DmaType == XPAR_ASU_DMA0_DMA_TYPE) ?
+			   XASUFW_DMA0 : XASUFW_DMA1;
+		if (XAsufw_ReleaseResource(Resource, QueueId) != XASUFW_SUCCESS) {
+			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_RESOURCE_RELEASE_NOT_ALLOWED);
+			goto END;
+		}
 	}
 
 	if ((Cmd->OperationFlags & XASU_SHA_FINISH) == XASU_SHA_FINISH) {
@@ -22,6 +22,8 @@
  *                     for every update
  *       ma   07/08/24 Add task based approach at queue level
  *       yog  09/26/24 Added doxygen groupings and fixed doxygen comments.
+ *       sb   10/16/26 Release DMA after every update and SHA3 after finish of all modes
+ *                     other than SHAKE256 with next XOF
  *
  * </pre>
  *
@@ -129,6 +131,7 @@ static s32 XAsufw_Sha3Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
 	XSha *XAsufw_Sha3 = XSha_GetInstance(XASU_XSHA_1_DEVICE_ID);
 	const XAsu_ShaOperationCmd *Cmd = (const XAsu_ShaOperationCmd *)ReqBuf->Arg;
 	XAsufw_Dma *AsuDmaPtr = NULL;
+	XAsufw_Resource Resource;
 
 	if ((Cmd->OperationFlags & XASU_SHA_START) == XASU_SHA_START) {
 		/**
@@ -158,6 +161,14 @@ static s32 XAsufw_Sha3Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
 			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_SHA3_UPDATE_FAILED);
 			goto END;
 		}
+
+		/** Release the DMA resource, it is allocated again for the next update. */
+		Resource = (AsuDmaPtr->AsuDma.Config.DmaType == XPAR_ASU_DMA0_DMA_TYPE) ?
+			   XASUFW_DMA0 : XASUFW_DMA1;
+		if (XAsufw_ReleaseResource(Resource, QueueId) != XASUFW_SUCCESS) {
+			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_RESOURCE_RELEASE_NOT_ALLOWED);
+			goto END;
+		}
 	}
 
 	if ((Cmd->OperationFlags & XASU_SHA_FINISH) == XASU_SHA_FINISH) {
@@ -167,7 +178,8 @@ static s32 XAsufw_Sha3Operation(const XAsu_ReqBuf *ReqBuf, u32 QueueId)
 			Status = XAsufw_UpdateErrorStatus(Status, XASUFW_SHA3_FINISH_FAILED);
 			goto END;
 		}
-		if ((Cmd->ShaMode == XASU_SHA_MODE_SHAKE256) &&
+		/** Keep SHA3 allocated only if more SHAKE256 output is to be generated. */
+		if ((Cmd->ShaMode != XASU_SHA_MODE_SHAKE256) ||
 		    (Cmd->ShakeReserved != XASU_SHA_NEXT_XOF_ENABLE_MASK)) {
 			if (XAsufw_ReleaseResource(XASUFW_SHA3, QueueId) != XASUFW_SUCCESS) {
 				Status = XAsufw_UpdateErrorStatus(Status, XASUFW_RESOURCE_RELEASE_NOT_ALLOWED);
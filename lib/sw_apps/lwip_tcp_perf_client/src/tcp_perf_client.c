@@ -179,11 +179,14 @@ static err_t tcp_send_perf_traffic(void)
 	apiflags = 0;
 #endif
 
+	/* Hand all the segments of this round to the MAC as one TX batch */
+	xemac_tx_batch_begin(netif_default);
 	while (tcp_sndbuf(c_pcb) > TCP_SEND_BUFSIZE) {
 		err = tcp_write(c_pcb, send_buf, TCP_SEND_BUFSIZE, apiflags);
 		if (err != ERR_OK) {
 			xil_printf("TCP client: Error on tcp_write: %d\r\n",
 					err);
+			xemac_tx_batch_end(netif_default);
 			return err;
 		}
 
@@ -191,11 +194,13 @@ static err_t tcp_send_perf_traffic(void)
 		if (err != ERR_OK) {
 			xil_printf("TCP client: Error on tcp_output: %d\r\n",
 					err);
+			xemac_tx_batch_end(netif_default);
 			return err;
 		}
 		client.total_bytes += TCP_SEND_BUFSIZE;
 		client.i_report.total_bytes += TCP_SEND_BUFSIZE;
 	}
+	xemac_tx_batch_end(netif_default);
 
 	if (client.end_time || client.i_report.report_interval_time) {
 		u64_t now = get_time_ms();
@@ -39,6 +39,7 @@ extern "C" {
 #include "lwip/err.h"
 #include "lwip/tcp.h"
 #include "lwip/inet.h"
+#include "netif/xadapter.h"
 #include "xil_printf.h"
 #include "platform.h"
 
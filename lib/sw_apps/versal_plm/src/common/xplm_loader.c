@@ -59,6 +59,7 @@
 *                       XilSEM use case.
 *       bm   02/23/2024 Ack In-Place PLM Update request after complete restore
 * 1.11  ng   04/30/2024 Fixed doxygen grouping
+*       sb   10/16/2026 Print the boot profile after boot PDI load
 *
 * </pre>
 *
@@ -79,6 +80,7 @@
 #include "xplmi_plat.h"
 #include "xplm_plat.h"
 #include "xloader_secure.h"
+#include "xloader_boot_prof.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -163,6 +165,7 @@ int XPlm_LoadBootPdi(void *Arg)
 	/* Print ROM time and PLM time stamp */
 	XPlmi_PrintRomTime();
 	XPlmi_Printf(DEBUG_PRINT_ALWAYS, "Total PLM Boot Time \n\r");
+	XLoader_BootProfPrint(DEBUG_PRINT_PERF);
 
 END:
 	/* This is used to identify PLM has completed boot PDI */
@@ -11,6 +11,10 @@
 # 2.0   hk    12/13/13 Modified to use new TCL API's
 # 4.1   hk    11/21/18 Use additional LFN options
 # 5.2   ap    12/11/23 Added support for microblaze risc-v
+# 5.3   sb    10/16/26 Add sector cache options
+#       sb    10/16/26 Add fast seek options
+#       sb    10/16/26 Add expand/streaming write option
+#       sb    10/16/26 Add sector cache line size option
 #
 ##############################################################################
 
@@ -96,6 +100,15 @@ proc xgen_opts_file {libhandle} {
 	set set_fs_rpath [common::get_property CONFIG.set_fs_rpath $libhandle]
 	set word_access [common::get_property CONFIG.word_access $libhandle]
 	set use_chmod [common::get_property CONFIG.use_chmod $libhandle]
+	set use_cache [common::get_property CONFIG.use_cache $libhandle]
+	set cache_sets [common::get_property CONFIG.cache_sets $libhandle]
+	set cache_ways [common::get_property CONFIG.cache_ways $libhandle]
+	set cache_line_size [common::get_property CONFIG.cache_line_size $libhandle]
+	set use_async [common::get_property CONFIG.use_async $libhandle]
+	set async_depth [common::get_property CONFIG.async_depth $libhandle]
+	set use_fastseek [common::get_property CONFIG.use_fastseek $libhandle]
+	set fastseek_frags [common::get_property CONFIG.fastseek_frags $libhandle]
+	set use_expand [common::get_property CONFIG.use_expand $libhandle]
 
 	# do processor specific checks
 	set proc  [hsi::get_sw_processor];
@@ -166,6 +179,53 @@ proc xgen_opts_file {libhandle} {
 		if {$use_trim == true} {
 			puts $file_handle "\#define FILE_SYSTEM_USE_TRIM"
 		}
+		if {$use_cache == true} {
+			if {$cache_sets < 1 || ($cache_sets & ($cache_sets - 1)) != 0} {
+				puts "WARNING : Cache sets must be a power of 2, \
+						setting back to 16\n"
+				set cache_sets 16
+			}
+			if {$cache_ways < 1} {
+				puts "WARNING : Invalid cache ways, setting back to 4\n"
+				set cache_ways 4
+			}
+			puts $file_handle "\#define FILE_SYSTEM_USE_CACHE"
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_SETS $cache_sets"
+			puts $file_handle "\#define FILE_SYSTEM_CACHE_WAYS $cache_ways"
+			if {$cache_line_size != 0} {
+				if {$cache_line_size < 512 || $cache_line_size > 4096 || \
+				    ($cache_line_size & ($cache_line_size - 1)) != 0} {
+					puts "WARNING : Invalid cache line size, setting back to \
+							the maximum sector size\n"
+				} else {
+					puts $file_handle "\#define FILE_SYSTEM_CACHE_LINE_SIZE $cache_line_size"
+				}
+			}
+		}
+		if {$use_async == true} {
+			if {$async_depth < 1 || $async_depth > 32} {
+				puts "WARNING : Invalid async depth, setting back to 8\n"
+				set async_depth 8
+			}
+			puts $file_handle "\#define FILE_SYSTEM_USE_ASYNC"
+			puts $file_handle "\#define FILE_SYSTEM_ASYNC_DEPTH $async_depth"
+		}
+		if {$use_fastseek == true} {
+			if {$fastseek_frags < 0} {
+				puts "WARNING : Invalid fast seek fragments, setting back to 16\n"
+				set fastseek_frags 16
+			}
+			puts $file_handle "\#define FILE_SYSTEM_USE_FASTSEEK"
+			puts $file_handle "\#define FILE_SYSTEM_FASTSEEK_FRAGS $fastseek_frags"
+		}
+		if {$use_expand == true} {
+			if {$read_only == false} {
+				puts $file_handle "\#define FILE_SYSTEM_USE_EXPAND"
+			} else {
+				puts "WARNING : Cannot Enable EXPAND in \
+						Read Only Mode"
+			}
+		}
 		if {$num_logical_vol > 10} {
 			puts "WARNING : File System supports only up to 10 logical drives\
 					Setting back the num of vol to 10\n"
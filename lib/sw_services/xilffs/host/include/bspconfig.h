@@ -0,0 +1,26 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* Host replacement of the generated BSP configuration.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#endif /* BSPCONFIG_H */
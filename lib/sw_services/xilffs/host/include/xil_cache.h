@@ -0,0 +1,29 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_cache.h
+*
+* Host replacement of xil_cache.h. The host needs no cache maintenance.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XIL_CACHE_H
+#define XIL_CACHE_H
+
+#define Xil_DCacheFlushRange(Addr, Len)		((void)(Addr), (void)(Len))
+#define Xil_DCacheInvalidateRange(Addr, Len)	((void)(Addr), (void)(Len))
+
+#endif /* XIL_CACHE_H */
@@ -0,0 +1,40 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xilffs_config.h
+*
+* Host replacement of the generated xilffs configuration. The RAM interface
+* is used with the RAM disk of the host test. The cache, fast seek and expand
+* options are set by the Makefile for each program.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XILFFS_CONFIG_H
+#define XILFFS_CONFIG_H
+
+#define FILE_SYSTEM_INTERFACE_RAM
+#define RAMFS_SIZE		(64U * 1024U * 1024U)
+#define RAMFS_START_ADDR	XFfsHost_RamDisk
+#define FILE_SYSTEM_FS_EXFAT
+#define FILE_SYSTEM_USE_LFN	1
+#define FILE_SYSTEM_USE_MKFS
+#define FILE_SYSTEM_USE_TRIM
+#define FILE_SYSTEM_NUM_LOGIC_VOL	1
+#define FILE_SYSTEM_WORD_ACCESS
+
+extern char XFfsHost_RamDisk[];
+
+#endif /* XILFFS_CONFIG_H */
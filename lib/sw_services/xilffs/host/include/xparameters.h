@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Host replacement of the generated hardware parameters. No SD or UFS
+* controller is present.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#endif /* XPARAMETERS_H */
@@ -0,0 +1,473 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xffs_cache_test.c
+*
+* This file contains the host test of the sector cache in diskcache.c. It
+* runs on the RAM interface of diskio.c, built unchanged.
+*
+* The sector test issues random single and multi-sector reads and writes,
+* CTRL_SYNC, CTRL_TRIM and disk_initialize calls through diskio.c and checks
+* every read against a model of the disk. After every CTRL_SYNC the RAM
+* disk itself must match the model. The file test formats the disk as FAT32
+* and exFAT, does random writes, reads, syncs and truncates on several open
+* files, then remounts and checks every file.
+*
+* Built without the cache, the same test gives the media accesses to compare
+* with.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ff.h"
+#include "diskio.h"
+#include "xffs_host.h"
+
+/************************** Constant Definitions *****************************/
+#define XFFSHOST_TEST_SECTORS	(8192U)	/**< Sectors used by the sector test */
+#define XFFSHOST_HOT_SECTORS	(48U)	/**< Sectors of the hot window */
+#define XFFSHOST_MAX_MULTI	(32U)	/**< Largest multi-sector transfer */
+#define XFFSHOST_FILES		(8U)	/**< Files of the file test */
+#define XFFSHOST_FILE_MAX	(1024U * 1024U)	/**< Largest file of the file test */
+#define XFFSHOST_MAX_IO		(16384U)	/**< Largest file read or write */
+
+/************************** Variable Definitions *****************************/
+static BYTE Model[XFFSHOST_TEST_SECTORS][XFFSHOST_SECTOR_SIZE];
+static BYTE IsDefined[XFFSHOST_TEST_SECTORS];
+static BYTE IoBuf[XFFSHOST_MAX_MULTI * XFFSHOST_SECTOR_SIZE];
+static BYTE FileModel[XFFSHOST_FILES][XFFSHOST_FILE_MAX];
+static UINT FileSize[XFFSHOST_FILES];
+static BYTE FileBuf[XFFSHOST_MAX_IO];
+static BYTE MkfsWork[FF_MAX_SS * 8U];
+static FATFS FatFs;
+static FIL Files[XFFSHOST_FILES];
+
+/*****************************************************************************/
+/**
+*
+* Fills a buffer with pseudo random bytes.
+*
+* @param	Buf - Buffer
+* @param	Len - Length in bytes
+* @param	Seed - Pointer to the random state
+*
+******************************************************************************/
+static void XFfsHost_Fill(BYTE *Buf, UINT Len, u32 *Seed)
+{
+	UINT Idx;
+	u32 Value = XFfsHost_Random(Seed);
+
+	for (Idx = 0U; Idx < Len; Idx++) {
+		if ((Idx & 3U) == 0U) {
+			Value = XFfsHost_Random(Seed);
+		}
+		Buf[Idx] = (BYTE)(Value >> ((Idx & 3U) * 8U));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns a sector of the sector test. Most accesses go to a hot window that
+* moves slowly, so that the cache sees reuse as well as evictions.
+*
+* @param	Seed - Pointer to the random state
+* @param	Count - Sectors of the transfer
+*
+* @return	First sector
+*
+******************************************************************************/
+static LBA_t XFfsHost_PickSector(u32 *Seed, UINT Count)
+{
+	static UINT HotBase;
+	UINT Sector;
+
+	if ((XFfsHost_Random(Seed) % 64U) == 0U) {
+		HotBase = XFfsHost_Random(Seed) % (XFFSHOST_TEST_SECTORS - XFFSHOST_HOT_SECTORS);
+	}
+	if ((XFfsHost_Random(Seed) % 5U) != 0U) {
+		Sector = HotBase + (XFfsHost_Random(Seed) % XFFSHOST_HOT_SECTORS);
+	} else {
+		Sector = XFfsHost_Random(Seed) % XFFSHOST_TEST_SECTORS;
+	}
+	if ((Sector + Count) > XFFSHOST_TEST_SECTORS) {
+		Sector = XFFSHOST_TEST_SECTORS - Count;
+	}
+
+	return (LBA_t)Sector;
+}
+
+/*****************************************************************************/
+/**
+*
+* Compares sectors read back with the model. Trimmed sectors that were not
+* written since are not compared.
+*
+* @param	Buf - Data read
+* @param	Sector - First sector
+* @param	Count - Sector count
+* @param	What - Name of the access for the error message
+*
+* @return	0 if the data matches, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_CheckSectors(const BYTE *Buf, LBA_t Sector, UINT Count,
+				 const char *What)
+{
+	UINT Idx;
+
+	for (Idx = 0U; Idx < Count; Idx++) {
+		if ((IsDefined[Sector + Idx] != 0U) &&
+		    (memcmp(Buf + (Idx * XFFSHOST_SECTOR_SIZE), Model[Sector + Idx],
+			    XFFSHOST_SECTOR_SIZE) != 0)) {
+			fprintf(stderr, "%s: sector %u differs\n", What,
+				(unsigned int)(Sector + Idx));
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Runs the sector test on physical drive 0.
+*
+* @param	Ops - Number of operations
+*
+* @return	0 if all checks pass, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_SectorTest(UINT Ops)
+{
+	u32 Seed = 0x2545F491U;
+	const XFfsHost_MediaStats *Stats = XFfsHost_GetStats();
+	LBA_t Sector;
+	LBA_t Range[2];
+	UINT Count;
+	UINT Op;
+	UINT Idx;
+	UINT Choice;
+	u64 Start;
+
+	if (disk_initialize(0U) != 0U) {
+		fprintf(stderr, "disk_initialize failed\n");
+		return -1;
+	}
+	(void)memcpy(Model, XFfsHost_RamDisk, sizeof(Model));
+	(void)memset(IsDefined, 1, sizeof(IsDefined));
+	XFfsHost_ResetStats();
+	Start = XFfsHost_TimeNs();
+
+	for (Op = 0U; Op < Ops; Op++) {
+		Choice = XFfsHost_Random(&Seed) % 100U;
+		if (Choice < 35U) {
+			Sector = XFfsHost_PickSector(&Seed, 1U);
+			XFfsHost_Fill(Model[Sector], XFFSHOST_SECTOR_SIZE, &Seed);
+			IsDefined[Sector] = 1U;
+			if (disk_write(0U, Model[Sector], Sector, 1U) != RES_OK) {
+				fprintf(stderr, "disk_write failed\n");
+				return -1;
+			}
+		} else if (Choice < 45U) {
+			Count = 2U + (XFfsHost_Random(&Seed) % (XFFSHOST_MAX_MULTI - 1U));
+			Sector = XFfsHost_PickSector(&Seed, Count);
+			XFfsHost_Fill(IoBuf, Count * XFFSHOST_SECTOR_SIZE, &Seed);
+			for (Idx = 0U; Idx < Count; Idx++) {
+				(void)memcpy(Model[Sector + Idx], IoBuf + (Idx * XFFSHOST_SECTOR_SIZE),
+					     XFFSHOST_SECTOR_SIZE);
+				IsDefined[Sector + Idx] = 1U;
+			}
+			if (disk_write(0U, IoBuf, Sector, Count) != RES_OK) {
+				fprintf(stderr, "disk_write failed\n");
+				return -1;
+			}
+		} else if (Choice < 80U) {
+			Sector = XFfsHost_PickSector(&Seed, 1U);
+			if ((disk_read(0U, IoBuf, Sector, 1U) != RES_OK) ||
+			    (XFfsHost_CheckSectors(IoBuf, Sector, 1U, "single read") != 0)) {
+				return -1;
+			}
+		} else if (Choice < 92U) {
+			Count = 2U + (XFfsHost_Random(&Seed) % (XFFSHOST_MAX_MULTI - 1U));
+			Sector = XFfsHost_PickSector(&Seed, Count);
+			if ((disk_read(0U, IoBuf, Sector, Count) != RES_OK) ||
+			    (XFfsHost_CheckSectors(IoBuf, Sector, Count, "multi read") != 0)) {
+				return -1;
+			}
+		} else if (Choice < 96U) {
+			/* After a sync the medium itself must hold the data */
+			if (disk_ioctl(0U, CTRL_SYNC, NULL) != RES_OK) {
+				fprintf(stderr, "CTRL_SYNC failed\n");
+				return -1;
+			}
+			for (Idx = 0U; Idx < XFFSHOST_TEST_SECTORS; Idx++) {
+				if (XFfsHost_CheckSectors((const BYTE *)XFfsHost_RamDisk +
+							  (Idx * XFFSHOST_SECTOR_SIZE),
+							  Idx, 1U, "medium after sync") != 0) {
+					return -1;
+				}
+			}
+		} else if (Choice < 99U) {
+			Count = 1U + (XFfsHost_Random(&Seed) % 8U);
+			Range[0] = XFfsHost_PickSector(&Seed, Count);
+			Range[1] = Range[0] + Count - 1U;
+			(void)disk_ioctl(0U, CTRL_TRIM, Range);
+			for (Idx = 0U; Idx < Count; Idx++) {
+				IsDefined[Range[0] + Idx] = 0U;
+			}
+		} else {
+			/* FatFs syncs before it initializes a drive again */
+			if ((disk_ioctl(0U, CTRL_SYNC, NULL) != RES_OK) ||
+			    (disk_initialize(0U) != 0U)) {
+				fprintf(stderr, "re-initialization failed\n");
+				return -1;
+			}
+		}
+	}
+
+	printf("sector test: %u operations passed in %.1f ms, media reads %llu "
+	       "(%llu sectors), writes %llu (%llu sectors)\n", Ops,
+	       (double)(XFfsHost_TimeNs() - Start) / 1e6,
+	       (unsigned long long)Stats->Reads, (unsigned long long)Stats->ReadSectors,
+	       (unsigned long long)Stats->Writes, (unsigned long long)Stats->WriteSectors);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks a whole file against its model.
+*
+* @param	Fp - Open file
+* @param	File - File index
+*
+* @return	0 if the file matches, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_CheckFile(FIL *Fp, UINT File)
+{
+	UINT Offset;
+	UINT Len;
+	UINT Done;
+
+	if (f_size(Fp) != FileSize[File]) {
+		fprintf(stderr, "file %u: size %lu, expected %u\n", File,
+			(unsigned long)f_size(Fp), FileSize[File]);
+		return -1;
+	}
+	if (f_lseek(Fp, 0U) != FR_OK) {
+		return -1;
+	}
+	for (Offset = 0U; Offset < FileSize[File]; Offset += Len) {
+		Len = FileSize[File] - Offset;
+		if (Len > XFFSHOST_MAX_IO) {
+			Len = XFFSHOST_MAX_IO;
+		}
+		if ((f_read(Fp, FileBuf, Len, &Done) != FR_OK) || (Done != Len) ||
+		    (memcmp(FileBuf, &FileModel[File][Offset], Len) != 0)) {
+			fprintf(stderr, "file %u: data differs at %u\n", File, Offset);
+			return -1;
+		}
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Runs the file test on a freshly formatted volume.
+*
+* @param	Fmt - FM_FAT32 or FM_EXFAT
+* @param	Ops - Number of operations
+*
+* @return	0 if all checks pass, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_FileTest(BYTE Fmt, UINT Ops)
+{
+	const XFfsHost_MediaStats *Stats = XFfsHost_GetStats();
+	MKFS_PARM Opt = { Fmt, 0U, 0U, 0U, 0U };
+	u32 Seed = 0x9E3779B9U;
+	char Name[16];
+	UINT File;
+	UINT Op;
+	UINT Choice;
+	UINT Offset;
+	UINT Len;
+	UINT Done;
+	u64 Start;
+
+	if (f_mkfs("", &Opt, MkfsWork, sizeof(MkfsWork)) != FR_OK) {
+		fprintf(stderr, "f_mkfs failed\n");
+		return -1;
+	}
+	if (f_mount(&FatFs, "", 1U) != FR_OK) {
+		fprintf(stderr, "f_mount failed\n");
+		return -1;
+	}
+	for (File = 0U; File < XFFSHOST_FILES; File++) {
+		(void)snprintf(Name, sizeof(Name), "file%u.bin", File);
+		if (f_open(&Files[File], Name, FA_CREATE_ALWAYS | FA_READ | FA_WRITE) != FR_OK) {
+			fprintf(stderr, "f_open failed\n");
+			return -1;
+		}
+		FileSize[File] = 0U;
+	}
+
+	XFfsHost_ResetStats();
+	Start = XFfsHost_TimeNs();
+	for (Op = 0U; Op < Ops; Op++) {
+		File = XFfsHost_Random(&Seed) % XFFSHOST_FILES;
+		Choice = XFfsHost_Random(&Seed) % 100U;
+		if (Choice < 50U) {
+			/* Write at a random offset, at most at the end of file */
+			Len = 1U + (XFfsHost_Random(&Seed) % XFFSHOST_MAX_IO);
+			Offset = XFfsHost_Random(&Seed) % (FileSize[File] + 1U);
+			if ((Offset + Len) > XFFSHOST_FILE_MAX) {
+				Offset = XFFSHOST_FILE_MAX - Len;
+				if (Offset > FileSize[File]) {
+					Offset = FileSize[File];
+					Len = XFFSHOST_FILE_MAX - Offset;
+				}
+			}
+			XFfsHost_Fill(&FileModel[File][Offset], Len, &Seed);
+			if ((f_lseek(&Files[File], Offset) != FR_OK) ||
+			    (f_write(&Files[File], &FileModel[File][Offset], Len, &Done) != FR_OK) ||
+			    (Done != Len)) {
+				fprintf(stderr, "file %u: write failed\n", File);
+				return -1;
+			}
+			if ((Offset + Len) > FileSize[File]) {
+				FileSize[File] = Offset + Len;
+			}
+		} else if (Choice < 90U) {
+			if (FileSize[File] == 0U) {
+				continue;
+			}
+			Offset = XFfsHost_Random(&Seed) % FileSize[File];
+			Len = 1U + (XFfsHost_Random(&Seed) % XFFSHOST_MAX_IO);
+			if ((Offset + Len) > FileSize[File]) {
+				Len = FileSize[File] - Offset;
+			}
+			if ((f_lseek(&Files[File], Offset) != FR_OK) ||
+			    (f_read(&Files[File], FileBuf, Len, &Done) != FR_OK) || (Done != Len) ||
+			    (memcmp(FileBuf, &FileModel[File][Offset], Len) != 0)) {
+				fprintf(stderr, "file %u: read at %u differs\n", File, Offset);
+				return -1;
+			}
+		} else if (Choice < 97U) {
+			if (f_sync(&Files[File]) != FR_OK) {
+				fprintf(stderr, "file %u: sync failed\n", File);
+				return -1;
+			}
+		} else {
+			Offset = (FileSize[File] == 0U) ? 0U :
+				 (XFfsHost_Random(&Seed) % FileSize[File]);
+			if ((f_lseek(&Files[File], Offset) != FR_OK) ||
+			    (f_truncate(&Files[File]) != FR_OK)) {
+				fprintf(stderr, "file %u: truncate failed\n", File);
+				return -1;
+			}
+			FileSize[File] = Offset;
+		}
+	}
+
+	for (File = 0U; File < XFFSHOST_FILES; File++) {
+		if (f_close(&Files[File]) != FR_OK) {
+			fprintf(stderr, "f_close failed\n");
+			return -1;
+		}
+	}
+	printf("%s file test: %u operations passed in %.1f ms, media reads %llu "
+	       "(%llu sectors), writes %llu (%llu sectors)\n",
+	       (Fmt == FM_EXFAT) ? "exFAT" : "FAT32", Ops,
+	       (double)(XFfsHost_TimeNs() - Start) / 1e6,
+	       (unsigned long long)Stats->Reads, (unsigned long long)Stats->ReadSectors,
+	       (unsigned long long)Stats->Writes, (unsigned long long)Stats->WriteSectors);
+
+	/* Everything must be on the medium after the files are closed */
+	(void)f_mount(NULL, "", 0U);
+	if ((disk_initialize(0U) != 0U) || (f_mount(&FatFs, "", 1U) != FR_OK)) {
+		fprintf(stderr, "remount failed\n");
+		return -1;
+	}
+	for (File = 0U; File < XFFSHOST_FILES; File++) {
+		(void)snprintf(Name, sizeof(Name), "file%u.bin", File);
+		if ((f_open(&Files[File], Name, FA_READ) != FR_OK) ||
+		    (XFfsHost_CheckFile(&Files[File], File) != 0) ||
+		    (f_close(&Files[File]) != FR_OK)) {
+			fprintf(stderr, "file %u: check after remount failed\n", File);
+			return -1;
+		}
+	}
+	(void)f_mount(NULL, "", 0U);
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Main function of the cache test.
+*
+* @param	argc - Argument count
+* @param	argv - Arguments
+*
+* @return	0 if all tests pass, 1 otherwise
+*
+******************************************************************************/
+int main(int argc, char *argv[])
+{
+	UINT SectorOps = 200000U;
+	UINT FileOps = 20000U;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "s:f:h")) != -1) {
+		switch (Opt) {
+			case 's':
+				SectorOps = (UINT)strtoul(optarg, NULL, 0);
+				break;
+			case 'f':
+				FileOps = (UINT)strtoul(optarg, NULL, 0);
+				break;
+			default:
+				printf("Usage: %s [-s sector_ops] [-f file_ops]\n", argv[0]);
+				return (Opt == 'h') ? 0 : 1;
+		}
+	}
+
+	printf("%s, %u sets x %u ways of %u bytes\n",
+	       (FF_USE_DISK_CACHE != 0) ? "sector cache" : "no sector cache",
+	       (UINT)FF_DISK_CACHE_SETS, (UINT)FF_DISK_CACHE_WAYS, (UINT)FF_DISK_CACHE_SS);
+	if ((XFfsHost_SectorTest(SectorOps) != 0) ||
+	    (XFfsHost_FileTest(FM_FAT32, FileOps) != 0) ||
+	    (XFfsHost_FileTest(FM_EXFAT, FileOps) != 0)) {
+		printf("FAILED\n");
+		return 1;
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
@@ -0,0 +1,140 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xffs_host.c
+*
+* This file contains the host RAM disk of the xilffs host tests. The
+* programs are linked with --wrap=Xil_SMemCpy, so the copies of the RAM
+* interface in diskio.c are counted as media reads and writes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <time.h>
+#include "xffs_host.h"
+
+/************************** Function Prototypes ******************************/
+s32 __real_Xil_SMemCpy(void *Dest, const u32 DestPtrLen, const void *Src,
+		       const u32 SrcPtrLen, const u32 CpyLen);
+s32 __wrap_Xil_SMemCpy(void *Dest, const u32 DestPtrLen, const void *Src,
+		       const u32 SrcPtrLen, const u32 CpyLen);
+
+/************************** Variable Definitions *****************************/
+/** Sectors of the RAM interface of diskio.c */
+char XFfsHost_RamDisk[RAMFS_SIZE] __attribute__ ((aligned(64)));
+
+static XFfsHost_MediaStats MediaStats;
+
+/*****************************************************************************/
+/**
+*
+* Counts a copy to or from the RAM disk as a media access and copies.
+*
+* @param	Dest - Destination buffer
+* @param	DestPtrLen - Size of the destination buffer
+* @param	Src - Source buffer
+* @param	SrcPtrLen - Size of the source buffer
+* @param	CpyLen - Bytes to copy
+*
+* @return	Status of Xil_SMemCpy
+*
+******************************************************************************/
+s32 __wrap_Xil_SMemCpy(void *Dest, const u32 DestPtrLen, const void *Src,
+		       const u32 SrcPtrLen, const u32 CpyLen)
+{
+	const char *Disk = XFfsHost_RamDisk;
+
+	if (((const char *)Src >= Disk) && ((const char *)Src < (Disk + RAMFS_SIZE))) {
+		MediaStats.Reads++;
+		MediaStats.ReadSectors += CpyLen / XFFSHOST_SECTOR_SIZE;
+	} else if (((const char *)Dest >= Disk) &&
+		   ((const char *)Dest < (Disk + RAMFS_SIZE))) {
+		MediaStats.Writes++;
+		MediaStats.WriteSectors += CpyLen / XFFSHOST_SECTOR_SIZE;
+	} else {
+		/* Not a media access */
+	}
+
+	return __real_Xil_SMemCpy(Dest, DestPtrLen, Src, SrcPtrLen, CpyLen);
+}
+
+/*****************************************************************************/
+/**
+*
+* Clears the media access counters.
+*
+******************************************************************************/
+void XFfsHost_ResetStats(void)
+{
+	MediaStats.Reads = 0U;
+	MediaStats.Writes = 0U;
+	MediaStats.ReadSectors = 0U;
+	MediaStats.WriteSectors = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the media access counters.
+*
+* @return	Pointer to the counters
+*
+******************************************************************************/
+const XFfsHost_MediaStats *XFfsHost_GetStats(void)
+{
+	return &MediaStats;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the monotonic time.
+*
+* @return	Time in ns
+*
+******************************************************************************/
+u64 XFfsHost_TimeNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000ULL) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+*
+* Returns the next value of a xorshift32 sequence, so that every run of a
+* test does the same operations.
+*
+* @param	Seed - Pointer to the state, not 0
+*
+* @return	Pseudo random value
+*
+******************************************************************************/
+u32 XFfsHost_Random(u32 *Seed)
+{
+	u32 X = *Seed;
+
+	X ^= X << 13U;
+	X ^= X >> 17U;
+	X ^= X << 5U;
+	*Seed = X;
+
+	return X;
+}
@@ -0,0 +1,61 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xffs_host.h
+*
+* This file contains declarations of the host RAM disk on which the xilffs
+* host tests run. The disk is the RAM interface of diskio.c, whose sectors
+* live in XFfsHost_RamDisk. Every media access of the RAM interface is one
+* Xil_SMemCpy, which the host counts.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XFFS_HOST_H
+#define XFFS_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xilffs_config.h"
+
+/************************** Constant Definitions *****************************/
+#define XFFSHOST_SECTOR_SIZE	(512U)	/**< Sector size of the RAM interface */
+#define XFFSHOST_SECTOR_COUNT	(RAMFS_SIZE / XFFSHOST_SECTOR_SIZE) /**< Sectors
+						of the RAM disk */
+
+/**************************** Type Definitions *******************************/
+/** Media accesses of the RAM disk */
+typedef struct {
+	u64 Reads;	/**< Media read calls */
+	u64 Writes;	/**< Media write calls */
+	u64 ReadSectors;	/**< Sectors read from the media */
+	u64 WriteSectors;	/**< Sectors written to the media */
+} XFfsHost_MediaStats;
+
+/************************** Function Prototypes ******************************/
+void XFfsHost_ResetStats(void);
+const XFfsHost_MediaStats *XFfsHost_GetStats(void);
+u64 XFfsHost_TimeNs(void);
+u32 XFfsHost_Random(u32 *Seed);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XFFS_HOST_H */
@@ -0,0 +1,363 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xffs_seek_bench.c
+*
+* This file contains the host benchmark of fast seek and f_stream() on the
+* RAM interface of diskio.c.
+*
+* The seek benchmark writes a file in fragments interleaved with a second
+* file, then times random f_lseek() and f_read() pairs on it and counts the
+* media reads. Built with and without FF_USE_FASTSEEK it compares the
+* automatic cluster link map with the walk of the FAT chain.
+*
+* The streaming benchmark writes a file in large chunks with f_write(),
+* first after f_stream() and then without, and counts the media writes.
+* Both files are read back, and the free space has to be the same before
+* and after each run.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "ff.h"
+#include "diskio.h"
+#include "xffs_host.h"
+
+/************************** Constant Definitions *****************************/
+#define XFFSHOST_FRAGS		(8U)	/**< Fragments of the seek file */
+#define XFFSHOST_FRAG_SIZE	(3U * 1024U * 1024U)	/**< Bytes per fragment */
+#define XFFSHOST_GAP_SIZE	(4096U)	/**< Bytes of the other file between fragments */
+#define XFFSHOST_READ_SIZE	(512U)	/**< Bytes read after every seek */
+#define XFFSHOST_CHUNK_SIZE	(64U * 1024U)	/**< Bytes per f_write() call */
+
+/************************** Variable Definitions *****************************/
+static BYTE Chunk[XFFSHOST_CHUNK_SIZE];
+static BYTE MkfsWork[FF_MAX_SS * 8U];
+static FATFS FatFs;
+static FIL File;
+static FIL Gap;
+
+/*****************************************************************************/
+/**
+*
+* Fills a buffer with the content of a file at the given offset. Every word
+* holds its own file offset, so any misplaced data is detected.
+*
+* @param	Buf - Buffer
+* @param	Offset - File offset of the buffer, multiple of 4
+* @param	Len - Length in bytes, multiple of 4
+*
+******************************************************************************/
+static void XFfsHost_Pattern(BYTE *Buf, UINT Offset, UINT Len)
+{
+	UINT Idx;
+	u32 Word;
+
+	for (Idx = 0U; Idx < Len; Idx += 4U) {
+		Word = (Offset + Idx) ^ 0xA5A5A5A5U;
+		(void)memcpy(&Buf[Idx], &Word, sizeof(Word));
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes a chunk of pattern data to a file.
+*
+* @param	Fp - Open file
+* @param	Offset - File offset of the chunk
+* @param	Len - Length in bytes
+*
+* @return	0 on success, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_WriteChunk(FIL *Fp, UINT Offset, UINT Len)
+{
+	UINT Done;
+
+	XFfsHost_Pattern(Chunk, Offset, Len);
+	if ((f_write(Fp, Chunk, Len, &Done) != FR_OK) || (Done != Len)) {
+		fprintf(stderr, "f_write at %u failed\n", Offset);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads a whole file back and checks its pattern.
+*
+* @param	Name - File name
+* @param	Size - Expected file size
+*
+* @return	0 if the file matches, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_VerifyFile(const char *Name, UINT Size)
+{
+	static BYTE Expected[XFFSHOST_CHUNK_SIZE];
+	UINT Offset;
+	UINT Done;
+	int Status = -1;
+
+	if (f_open(&File, Name, FA_READ) != FR_OK) {
+		fprintf(stderr, "%s: f_open failed\n", Name);
+		return -1;
+	}
+	if (f_size(&File) != Size) {
+		fprintf(stderr, "%s: size %lu, expected %u\n", Name,
+			(unsigned long)f_size(&File), Size);
+		goto END;
+	}
+	for (Offset = 0U; Offset < Size; Offset += XFFSHOST_CHUNK_SIZE) {
+		XFfsHost_Pattern(Expected, Offset, XFFSHOST_CHUNK_SIZE);
+		if ((f_read(&File, Chunk, XFFSHOST_CHUNK_SIZE, &Done) != FR_OK) ||
+		    (Done != XFFSHOST_CHUNK_SIZE) ||
+		    (memcmp(Chunk, Expected, XFFSHOST_CHUNK_SIZE) != 0)) {
+			fprintf(stderr, "%s: data differs at %u\n", Name, Offset);
+			goto END;
+		}
+	}
+	Status = 0;
+
+END:
+	(void)f_close(&File);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+*
+* Runs the seek benchmark.
+*
+* @param	Seeks - Number of seek and read pairs
+*
+* @return	0 on success, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_SeekBench(UINT Seeks)
+{
+	const XFfsHost_MediaStats *Stats = XFfsHost_GetStats();
+	UINT Size = XFFSHOST_FRAGS * XFFSHOST_FRAG_SIZE;
+	BYTE Expected[XFFSHOST_READ_SIZE];
+	u32 Seed = 0x1234567U;
+	UINT Frag;
+	UINT Offset;
+	UINT Done;
+	UINT Idx;
+	u64 Start;
+	u64 Time;
+
+	/* Interleave the clusters of a second file to fragment the first one */
+	if ((f_open(&File, "seek.bin", FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) ||
+	    (f_open(&Gap, "gap.bin", FA_CREATE_ALWAYS | FA_WRITE) != FR_OK)) {
+		fprintf(stderr, "f_open failed\n");
+		return -1;
+	}
+	for (Frag = 0U; Frag < XFFSHOST_FRAGS; Frag++) {
+		for (Offset = 0U; Offset < XFFSHOST_FRAG_SIZE; Offset += XFFSHOST_CHUNK_SIZE) {
+			if (XFfsHost_WriteChunk(&File, (Frag * XFFSHOST_FRAG_SIZE) + Offset,
+						XFFSHOST_CHUNK_SIZE) != 0) {
+				return -1;
+			}
+		}
+		if ((f_sync(&File) != FR_OK) ||
+		    (XFfsHost_WriteChunk(&Gap, Frag * XFFSHOST_GAP_SIZE,
+					 XFFSHOST_GAP_SIZE) != 0) ||
+		    (f_sync(&Gap) != FR_OK)) {
+			return -1;
+		}
+	}
+	if ((f_close(&File) != FR_OK) || (f_close(&Gap) != FR_OK)) {
+		fprintf(stderr, "f_close failed\n");
+		return -1;
+	}
+
+	if (f_open(&File, "seek.bin", FA_READ) != FR_OK) {
+		fprintf(stderr, "f_open failed\n");
+		return -1;
+	}
+	XFfsHost_ResetStats();
+	Start = XFfsHost_TimeNs();
+	for (Idx = 0U; Idx < Seeks; Idx++) {
+		Offset = (XFfsHost_Random(&Seed) % (Size / XFFSHOST_READ_SIZE)) *
+			 XFFSHOST_READ_SIZE;
+		if ((f_lseek(&File, Offset) != FR_OK) ||
+		    (f_read(&File, Chunk, XFFSHOST_READ_SIZE, &Done) != FR_OK) ||
+		    (Done != XFFSHOST_READ_SIZE)) {
+			fprintf(stderr, "seek and read at %u failed\n", Offset);
+			return -1;
+		}
+		XFfsHost_Pattern(Expected, Offset, XFFSHOST_READ_SIZE);
+		if (memcmp(Chunk, Expected, XFFSHOST_READ_SIZE) != 0) {
+			fprintf(stderr, "data at %u differs\n", Offset);
+			return -1;
+		}
+	}
+	Time = XFfsHost_TimeNs() - Start;
+	(void)f_close(&File);
+
+	printf("seek: %u seek and read pairs on a %u MB file of %u fragments in "
+	       "%.1f ms, %.2f us each, media reads %llu (%.1f per seek)\n",
+	       Seeks, Size >> 20U, XFFSHOST_FRAGS, (double)Time / 1e6,
+	       (double)Time / 1e3 / Seeks, (unsigned long long)Stats->Reads,
+	       (double)Stats->Reads / Seeks);
+
+	if ((f_unlink("seek.bin") != FR_OK) || (f_unlink("gap.bin") != FR_OK)) {
+		fprintf(stderr, "f_unlink failed\n");
+		return -1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes a file in chunks, with or without f_stream(), and reports the media
+* writes.
+*
+* @param	Size - File size, multiple of the chunk size
+* @param	UseStream - Non-zero to call f_stream() first
+*
+* @return	0 on success, -1 otherwise
+*
+******************************************************************************/
+static int XFfsHost_StreamRun(UINT Size, int UseStream)
+{
+	const XFfsHost_MediaStats *Stats = XFfsHost_GetStats();
+	const char *Name = (UseStream != 0) ? "stream.bin" : "plain.bin";
+	DWORD FreeBefore;
+	DWORD FreeAfter;
+	FATFS *Fs;
+	UINT Offset;
+	u64 Start;
+	u64 Time;
+
+	if (f_getfree("", &FreeBefore, &Fs) != FR_OK) {
+		return -1;
+	}
+	if (f_open(&File, Name, FA_CREATE_ALWAYS | FA_WRITE) != FR_OK) {
+		fprintf(stderr, "f_open failed\n");
+		return -1;
+	}
+
+	XFfsHost_ResetStats();
+	Start = XFfsHost_TimeNs();
+#if FF_USE_EXPAND
+	if ((UseStream != 0) && (f_stream(&File, Size) != FR_OK)) {
+		fprintf(stderr, "f_stream failed\n");
+		return -1;
+	}
+#endif
+	for (Offset = 0U; Offset < Size; Offset += XFFSHOST_CHUNK_SIZE) {
+		if (XFfsHost_WriteChunk(&File, Offset, XFFSHOST_CHUNK_SIZE) != 0) {
+			return -1;
+		}
+	}
+	if (f_close(&File) != FR_OK) {
+		fprintf(stderr, "f_close failed\n");
+		return -1;
+	}
+	Time = XFfsHost_TimeNs() - Start;
+
+	printf("stream: %u MB in %u KB chunks %s f_stream() in %.1f ms, media "
+	       "writes %llu (%llu sectors)\n", Size >> 20U, XFFSHOST_CHUNK_SIZE >> 10U,
+	       (UseStream != 0) ? "with" : "without", (double)Time / 1e6,
+	       (unsigned long long)Stats->Writes, (unsigned long long)Stats->WriteSectors);
+
+	if ((XFfsHost_VerifyFile(Name, Size) != 0) || (f_unlink(Name) != FR_OK) ||
+	    (f_getfree("", &FreeAfter, &Fs) != FR_OK)) {
+		return -1;
+	}
+	if (FreeAfter != FreeBefore) {
+		fprintf(stderr, "%s: %lu free clusters after, %lu before\n", Name,
+			(unsigned long)FreeAfter, (unsigned long)FreeBefore);
+		return -1;
+	}
+
+	return 0;
+}
+
+/*****************************************************************************/
+/**
+*
+* Main function of the seek and streaming benchmark.
+*
+* @param	argc - Argument count
+* @param	argv - Arguments
+*
+* @return	0 if all runs pass, 1 otherwise
+*
+******************************************************************************/
+int main(int argc, char *argv[])
+{
+	static const BYTE Fmts[] = { FM_FAT32, FM_EXFAT };
+	UINT Seeks = 20000U;
+	UINT StreamSize = 32U * 1024U * 1024U;
+	MKFS_PARM MkfsOpt = { 0U, 0U, 0U, 0U, 0U };
+	UINT Idx;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "n:m:h")) != -1) {
+		switch (Opt) {
+			case 'n':
+				Seeks = (UINT)strtoul(optarg, NULL, 0);
+				break;
+			case 'm':
+				StreamSize = (UINT)strtoul(optarg, NULL, 0) * 1024U * 1024U;
+				break;
+			default:
+				printf("Usage: %s [-n seeks] [-m stream_mb]\n", argv[0]);
+				return (Opt == 'h') ? 0 : 1;
+		}
+	}
+
+#if FF_USE_FASTSEEK
+	printf("fast seek enabled, link map of %u fragments, ", (UINT)FF_FASTSEEK_AUTO_FRAGS);
+#else
+	printf("fast seek disabled, ");
+#endif
+	printf("f_stream %s\n", (FF_USE_EXPAND != 0) ? "enabled" : "disabled");
+	for (Idx = 0U; Idx < sizeof(Fmts); Idx++) {
+		MkfsOpt.fmt = Fmts[Idx];
+		if ((f_mkfs("", &MkfsOpt, MkfsWork, sizeof(MkfsWork)) != FR_OK) ||
+		    (f_mount(&FatFs, "", 1U) != FR_OK)) {
+			fprintf(stderr, "f_mkfs or f_mount failed\n");
+			printf("FAILED\n");
+			return 1;
+		}
+		printf("%s, %u byte clusters\n", (Fmts[Idx] == FM_EXFAT) ? "exFAT" : "FAT32",
+		       (UINT)FatFs.csize * XFFSHOST_SECTOR_SIZE);
+		if ((XFfsHost_SeekBench(Seeks) != 0) ||
+		    ((FF_USE_EXPAND != 0) && (XFfsHost_StreamRun(StreamSize, 1) != 0)) ||
+		    (XFfsHost_StreamRun(StreamSize, 0) != 0)) {
+			printf("FAILED\n");
+			return 1;
+		}
+		(void)f_mount(NULL, "", 0U);
+	}
+	printf("PASSED\n");
+
+	return 0;
+}
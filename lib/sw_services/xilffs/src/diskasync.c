@@ -0,0 +1,381 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file diskasync.c
+*		This file implements the asynchronous disk interface on top of
+*		the media backends in diskio.c.
+*
+*		Description:
+*		disk_read_async() and disk_write_async() queue a request and
+*		return. Each drive holds up to FF_DISK_ASYNC_DEPTH requests
+*		that are served in submission order. When the drive is idle,
+*		the oldest request is started together with the following
+*		ones of the same direction that continue it sector-wise; on
+*		SD they are chained in one ADMA2 descriptor table and moved
+*		by a single command while the CPU keeps running.
+*
+*		Nothing happens in the background without disk_async_poll():
+*		it checks the transfer in flight, calls the completion
+*		callbacks of the finished requests and starts the next chain.
+*		Callbacks run in the context of the caller of
+*		disk_async_poll() and may queue new requests. The result of
+*		a request submitted without callback is passed to the next
+*		callback called and to disk_async_drain().
+*
+*		The synchronous media functions drain the queue of the drive
+*		before they access it, so the two interfaces can be mixed and
+*		requests are never reordered against FatFs accesses. Data
+*		moved by asynchronous requests is kept coherent with the
+*		sector cache in the same way as multi-sector transfers.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+#include "diskasync.h"
+#include "diskcache.h"
+
+#if FF_USE_DISK_ASYNC
+
+#if (FF_DISK_ASYNC_DEPTH < 1) || (FF_DISK_ASYNC_DEPTH > 32)
+#error "FF_DISK_ASYNC_DEPTH must be 1 to 32"
+#endif
+
+/************************** Constant Definitions *****************************/
+#define DA_READ		0U	/**< Request reads from the media */
+#define DA_WRITE	1U	/**< Request writes to the media */
+
+/**************************** Type Definitions *******************************/
+/** Queued request */
+typedef struct {
+	BYTE *Buff;		/**< Data buffer */
+	LBA_t Sector;		/**< Start sector */
+	UINT Count;		/**< Number of sectors */
+	disk_async_cb Cb;	/**< Disk level completion callback */
+	FF_ASYNC_CB FCb;	/**< File level completion callback */
+	void *Arg;		/**< Argument of the callback */
+	BYTE Write;		/**< DA_READ or DA_WRITE */
+} DiskAsyncReq;
+
+/** Request queue of a drive */
+typedef struct {
+	DiskAsyncReq Req[FF_DISK_ASYNC_DEPTH];	/**< Ring of requests */
+	UINT Head;	/**< Index of the oldest request */
+	UINT Cnt;	/**< Number of queued requests, in flight ones included */
+	UINT Active;	/**< Number of requests in flight, 0 when idle */
+	DRESULT Err;	/**< First error not reported to a callback yet */
+} DiskAsyncQueue;
+
+/************************** Variable Definitions *****************************/
+static DiskAsyncQueue AsyncQueue[FF_VOLUMES];
+
+/*****************************************************************************/
+/**
+*
+* Retires the oldest requests of the queue and calls their callbacks.
+* The requests leave the queue before any callback runs, which lets the
+* callbacks submit new requests.
+*
+* @param	pdrv - Drive number
+* @param	q - Queue of the drive
+* @param	n - Number of requests to retire
+* @param	res - Result of the transfer
+*
+******************************************************************************/
+static void da_complete (BYTE pdrv, DiskAsyncQueue *q, UINT n, DRESULT res)
+{
+	DiskAsyncReq done[FF_DISK_ASYNC_DEPTH];
+	DRESULT r;
+	UINT i;
+
+	for (i = 0U; i < n; i++) {
+		done[i] = q->Req[(q->Head + i) % FF_DISK_ASYNC_DEPTH];
+#if FF_USE_DISK_CACHE
+		if ((res == RES_OK) && (done[i].Write == DA_READ)) {
+			disk_cache_merge(pdrv, done[i].Buff, done[i].Sector, done[i].Count);
+		}
+#endif
+	}
+	q->Head = (q->Head + n) % FF_DISK_ASYNC_DEPTH;
+	q->Cnt -= n;
+	q->Active = 0U;
+
+	for (i = 0U; i < n; i++) {
+		r = res;
+		if ((done[i].Cb == NULL) && (done[i].FCb == NULL)) {
+			if ((r != RES_OK) && (q->Err == RES_OK)) {
+				q->Err = r;
+			}
+			continue;
+		}
+		if (r == RES_OK) {
+			r = q->Err;
+		}
+		q->Err = RES_OK;
+
+		if (done[i].Cb != NULL) {
+			done[i].Cb(pdrv, r, done[i].Arg);
+		} else {
+			done[i].FCb((r == RES_OK) ? FR_OK : FR_DISK_ERR, done[i].Arg);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Starts the oldest requests of an idle queue. Requests continuing the
+* previous one in the same direction are passed to the media as one chain;
+* the media takes as much of the chain as it can move in one transfer.
+*
+* @param	pdrv - Drive number
+* @param	q - Queue of the drive
+*
+******************************************************************************/
+static void da_start (BYTE pdrv, DiskAsyncQueue *q)
+{
+	DiskAsyncSeg seg[FF_DISK_ASYNC_DEPTH];
+	const DiskAsyncReq *head;
+	const DiskAsyncReq *r;
+	LBA_t next;
+	UINT n;
+	DRESULT res;
+
+	while ((q->Active == 0U) && (q->Cnt != 0U)) {
+		head = &q->Req[q->Head];
+		seg[0].Buff = head->Buff;
+		seg[0].Count = head->Count;
+		next = head->Sector + head->Count;
+
+		for (n = 1U; n < q->Cnt; n++) {
+			r = &q->Req[(q->Head + n) % FF_DISK_ASYNC_DEPTH];
+			if ((r->Write != head->Write) || (r->Sector != next)) {
+				break;
+			}
+			seg[n].Buff = r->Buff;
+			seg[n].Count = r->Count;
+			next += r->Count;
+		}
+
+		res = disk_media_start(pdrv, head->Write, head->Sector, seg, &n);
+		if (res == RES_OK) {
+			q->Active = n;
+		} else {
+			/* Fail the head alone, the rest may still succeed */
+			da_complete(pdrv, q, 1U, res);
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues a request. Waits for a free slot if the queue of the drive is full.
+*
+* @param	pdrv - Drive number
+* @param	write - 0 to read from the media, 1 to write to it
+* @param	buff - Pointer to the data buffer
+* @param	sector - Start sector number
+* @param	count - Sector count
+* @param	cb - Disk level callback, can be NULL
+* @param	fcb - File level callback, used if cb is NULL, can be NULL
+* @param	arg - Argument of the callback
+*
+* @return
+*		RES_OK		Request queued
+*		RES_PARERR	Invalid parameter
+*		RES_NOTRDY	Drive not initialized
+*		RES_WRPRT	Drive is write protected
+*
+******************************************************************************/
+DRESULT disk_async_submit (BYTE pdrv, BYTE write, BYTE *buff, LBA_t sector,
+			   UINT count, disk_async_cb cb, FF_ASYNC_CB fcb, void *arg)
+{
+	DiskAsyncQueue *q;
+	DiskAsyncReq *r;
+	DSTATUS s;
+
+	if ((pdrv >= (BYTE)FF_VOLUMES) || (buff == NULL) || (count == 0U)) {
+		return RES_PARERR;
+	}
+
+	s = disk_status(pdrv);
+	if ((s & STA_NOINIT) != 0U) {
+		return RES_NOTRDY;
+	}
+	if ((write != DA_READ) && ((s & STA_PROTECT) != 0U)) {
+		return RES_WRPRT;
+	}
+
+	q = &AsyncQueue[pdrv];
+	while (q->Cnt == (UINT)FF_DISK_ASYNC_DEPTH) {
+		(void)disk_async_poll(pdrv);
+	}
+
+#if FF_USE_DISK_CACHE && (FF_FS_READONLY == 0)
+	if (write != DA_READ) {
+		disk_cache_update(pdrv, buff, sector, count);
+	}
+#endif
+
+	r = &q->Req[(q->Head + q->Cnt) % FF_DISK_ASYNC_DEPTH];
+	r->Buff = buff;
+	r->Sector = sector;
+	r->Count = count;
+	r->Cb = cb;
+	r->FCb = fcb;
+	r->Arg = arg;
+	r->Write = write;
+	q->Cnt++;
+
+	da_start(pdrv, q);
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Queues a read of sector(s) from the drive and returns. The buffer must
+* stay untouched until the request completes.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+* @param	cb - Completion callback, can be NULL
+* @param	arg - Argument of the callback
+*
+* @return
+*		RES_OK		Request queued
+*		RES_PARERR	Invalid parameter
+*		RES_NOTRDY	Drive not initialized
+*
+******************************************************************************/
+DRESULT disk_read_async (BYTE pdrv, BYTE *buff, LBA_t sector, UINT count,
+			 disk_async_cb cb, void *arg)
+{
+	return disk_async_submit(pdrv, DA_READ, buff, sector, count, cb, NULL, arg);
+}
+
+#if FF_FS_READONLY == 0
+/*****************************************************************************/
+/**
+*
+* Queues a write of sector(s) to the drive and returns. The buffer must
+* stay untouched until the request completes.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data to be written
+* @param	sector - Start sector number
+* @param	count - Sector count
+* @param	cb - Completion callback, can be NULL
+* @param	arg - Argument of the callback
+*
+* @return
+*		RES_OK		Request queued
+*		RES_PARERR	Invalid parameter
+*		RES_NOTRDY	Drive not initialized
+*		RES_WRPRT	Drive is write protected
+*
+******************************************************************************/
+DRESULT disk_write_async (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count,
+			  disk_async_cb cb, void *arg)
+{
+	return disk_async_submit(pdrv, DA_WRITE, (BYTE *)buff, sector, count,
+				 cb, NULL, arg);
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Advances the queue of the drive: completes the transfer in flight if it
+* has finished and starts the next one. Meant to be called from the main
+* loop or a task while the CPU does other work.
+*
+* @param	pdrv - Drive number
+*
+* @return	Number of requests still queued or in flight
+*
+******************************************************************************/
+UINT disk_async_poll (BYTE pdrv)
+{
+	DiskAsyncQueue *q;
+	DRESULT res;
+
+	if (pdrv >= (BYTE)FF_VOLUMES) {
+		return 0U;
+	}
+
+	q = &AsyncQueue[pdrv];
+	if (q->Active != 0U) {
+		res = disk_media_check(pdrv);
+		if (res == RES_NOTRDY) {
+			return q->Cnt;
+		}
+		da_complete(pdrv, q, q->Active, res);
+	}
+	da_start(pdrv, q);
+
+	return q->Cnt;
+}
+
+/*****************************************************************************/
+/**
+*
+* Waits until all requests of the drive are complete.
+*
+* @param	pdrv - Drive number
+*
+* @return	RES_OK or the first error of the requests submitted without
+*		callback that was not reported to a callback yet
+*
+******************************************************************************/
+DRESULT disk_async_drain (BYTE pdrv)
+{
+	DRESULT res;
+
+	if (pdrv >= (BYTE)FF_VOLUMES) {
+		return RES_PARERR;
+	}
+
+	disk_async_quiesce(pdrv);
+	res = AsyncQueue[pdrv].Err;
+	AsyncQueue[pdrv].Err = RES_OK;
+
+	return res;
+}
+
+/*****************************************************************************/
+/**
+*
+* Waits until all requests of the drive are complete without consuming the
+* pending error. Called by the synchronous media functions.
+*
+* @param	pdrv - Drive number
+*
+******************************************************************************/
+void disk_async_quiesce (BYTE pdrv)
+{
+	if (pdrv < (BYTE)FF_VOLUMES) {
+		while (disk_async_poll(pdrv) != 0U) {
+			/* Wait for the transfers in flight */
+		}
+	}
+}
+
+#endif /* FF_USE_DISK_ASYNC */
@@ -0,0 +1,601 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file diskcache.c
+*		This file implements a set-associative, write-back sector cache
+*		between the FatFs core and the media backends in diskio.c.
+*
+*		Description:
+*		The cache holds FF_DISK_CACHE_SETS x FF_DISK_CACHE_WAYS sectors
+*		of up to FF_DISK_CACHE_SS bytes shared by all physical drives.
+*		Drives with larger sectors bypass the cache. A sector maps to set
+*		(sector % FF_DISK_CACHE_SETS) and is tagged with its drive
+*		number, so consecutive sectors occupy consecutive sets. Line
+*		storage is laid out per way, which makes a run of consecutive
+*		sectors held in the same way contiguous in memory; dirty runs
+*		are then written back with a single multi-block disk_write.
+*
+*		Single sector transfers (FAT, directory and the file sector
+*		buffer) go through the cache. Multi-sector transfers issued by
+*		FatFs for aligned file data bypass it and are kept coherent
+*		with any cached copy. Dirty lines are written back on eviction,
+*		on CTRL_SYNC and therefore on f_sync()/f_close().
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.3   sb   10/16/26 First release
+*       sb   10/16/26 Size lines by FF_DISK_CACHE_SS
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+#include "diskcache.h"
+#include "xil_mem.h"
+
+#if FF_USE_DISK_CACHE
+
+#if (FF_DISK_CACHE_SETS == 0) || \
+	((FF_DISK_CACHE_SETS & (FF_DISK_CACHE_SETS - 1)) != 0)
+#error "FF_DISK_CACHE_SETS must be a power of 2"
+#endif
+
+#if FF_DISK_CACHE_WAYS == 0
+#error "FF_DISK_CACHE_WAYS must be at least 1"
+#endif
+
+#if (FF_DISK_CACHE_SS < FF_MIN_SS) || \
+	((FF_DISK_CACHE_SS & (FF_DISK_CACHE_SS - 1)) != 0)
+#error "FF_DISK_CACHE_SS must be a power of 2 of at least FF_MIN_SS"
+#endif
+
+/************************** Constant Definitions *****************************/
+#define DC_LINE_VALID	0x01U	/**< Line holds a sector */
+#define DC_LINE_DIRTY	0x02U	/**< Line is newer than the media */
+
+#define DC_SET_MASK	((LBA_t)FF_DISK_CACHE_SETS - 1U)	/**< Set index mask */
+#define DC_NO_WAY	((UINT)FF_DISK_CACHE_WAYS)		/**< Lookup miss */
+
+/** Line size, no sector is larger than FF_MAX_SS */
+#if FF_DISK_CACHE_SS > FF_MAX_SS
+#define DC_LINE_SS	FF_MAX_SS
+#else
+#define DC_LINE_SS	FF_DISK_CACHE_SS
+#endif
+
+/**************************** Type Definitions *******************************/
+/** Tag of a cache line */
+typedef struct {
+	LBA_t Sector;	/**< Sector number held by the line */
+	DWORD Stamp;	/**< Access stamp used for LRU selection */
+	BYTE Pdrv;	/**< Physical drive owning the line */
+	BYTE Flags;	/**< DC_LINE_VALID / DC_LINE_DIRTY */
+} DiskCacheTag;
+
+/************************** Variable Definitions *****************************/
+static DiskCacheTag CacheTag[FF_DISK_CACHE_WAYS][FF_DISK_CACHE_SETS];
+static BYTE CacheData[FF_DISK_CACHE_WAYS][FF_DISK_CACHE_SETS][DC_LINE_SS]
+	__attribute__ ((aligned(64)));
+static DWORD CacheClock;
+#if FF_MAX_SS != FF_MIN_SS
+static WORD CacheSecSize[256];
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Returns the sector size of the physical drive.
+*
+* @param	pdrv - Drive number
+*
+* @return	Sector size in bytes, 0 if it could not be read
+*
+******************************************************************************/
+static UINT dc_sector_size (BYTE pdrv)
+{
+#if FF_MAX_SS == FF_MIN_SS
+	(void)pdrv;
+	return FF_MAX_SS;
+#else
+	DWORD ss = 0U;
+
+	if (CacheSecSize[pdrv] == 0U) {
+		if (disk_media_ioctl(pdrv, GET_SECTOR_SIZE, &ss) == RES_OK) {
+			CacheSecSize[pdrv] = (WORD)ss;
+		}
+	}
+
+	return CacheSecSize[pdrv];
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Looks up a sector in its set.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number
+*
+* @return	Way holding the sector, DC_NO_WAY on a miss
+*
+******************************************************************************/
+static UINT dc_find (BYTE pdrv, LBA_t sector)
+{
+	UINT set = (UINT)(sector & DC_SET_MASK);
+	UINT way;
+
+	for (way = 0U; way < DC_NO_WAY; way++) {
+		const DiskCacheTag *tag = &CacheTag[way][set];
+
+		if (((tag->Flags & DC_LINE_VALID) != 0U) &&
+		    (tag->Sector == sector) && (tag->Pdrv == pdrv)) {
+			break;
+		}
+	}
+
+	return way;
+}
+
+/*****************************************************************************/
+/**
+*
+* Marks a line as most recently used.
+*
+******************************************************************************/
+static void dc_touch (UINT way, UINT set)
+{
+	CacheClock++;
+	CacheTag[way][set].Stamp = CacheClock;
+}
+
+#if FF_FS_READONLY == 0
+/*****************************************************************************/
+/**
+*
+* Returns non-zero if the sector is cached and dirty.
+*
+******************************************************************************/
+static int dc_is_dirty (BYTE pdrv, LBA_t sector, UINT *way)
+{
+	*way = dc_find(pdrv, sector);
+
+	return (*way != DC_NO_WAY) &&
+	       ((CacheTag[*way][sector & DC_SET_MASK].Flags & DC_LINE_DIRTY) != 0U);
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes back the run of consecutive dirty sectors containing the given
+* sector. Parts of the run that are contiguous in cache memory are written
+* with a single multi-block transfer.
+*
+* @param	pdrv - Drive number
+* @param	sector - A dirty sector of the run
+*
+* @return	RES_OK on success, error code of the media otherwise
+*
+******************************************************************************/
+static DRESULT dc_flush_run (BYTE pdrv, LBA_t sector)
+{
+	UINT ss = dc_sector_size(pdrv);
+	LBA_t sect = sector;
+	UINT way;
+	UINT n;
+	UINT i;
+	DRESULT res;
+
+	/* Rewind to the first dirty sector of the run */
+	while ((sect > 0U) && (dc_is_dirty(pdrv, sect - 1U, &way) != 0)) {
+		sect--;
+	}
+
+	while (dc_is_dirty(pdrv, sect, &way) != 0) {
+		UINT way0 = way;
+		UINT set0 = (UINT)(sect & DC_SET_MASK);
+
+		/* Extend the segment while the next sector follows in memory */
+		n = 1U;
+		while ((ss == DC_LINE_SS) && ((set0 + n) < FF_DISK_CACHE_SETS) &&
+		       (dc_is_dirty(pdrv, sect + n, &way) != 0) && (way == way0)) {
+			n++;
+		}
+
+		res = disk_media_write(pdrv, CacheData[way0][set0], sect, n);
+		if (res != RES_OK) {
+			return res;
+		}
+
+		for (i = 0U; i < n; i++) {
+			CacheTag[way0][set0 + i].Flags &= (BYTE)~DC_LINE_DIRTY;
+		}
+		sect += n;
+	}
+
+	return RES_OK;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Selects a line for a sector that missed in the cache and writes back its
+* previous content if needed. An empty line in the way of the preceding
+* sector is preferred so that sequential writes stay contiguous.
+*
+* @param	pdrv - Drive number
+* @param	sector - Sector number to be cached
+* @param	way - Pointer to return the selected way
+*
+* @return	RES_OK on success, error code of the media otherwise
+*
+******************************************************************************/
+static DRESULT dc_alloc (BYTE pdrv, LBA_t sector, UINT *way)
+{
+	UINT set = (UINT)(sector & DC_SET_MASK);
+	UINT prev = DC_NO_WAY;
+	UINT victim = DC_NO_WAY;
+	DWORD age = 0U;
+	UINT w;
+	DiskCacheTag *tag;
+
+	if (sector > 0U) {
+		prev = dc_find(pdrv, sector - 1U);
+	}
+
+	if ((prev != DC_NO_WAY) &&
+	    ((CacheTag[prev][set].Flags & DC_LINE_VALID) == 0U)) {
+		victim = prev;
+	} else {
+		for (w = 0U; w < DC_NO_WAY; w++) {
+			tag = &CacheTag[w][set];
+			if ((tag->Flags & DC_LINE_VALID) == 0U) {
+				victim = w;
+				break;
+			}
+			/* Age is wrap safe as long as it is computed as a difference */
+			if ((victim == DC_NO_WAY) || ((CacheClock - tag->Stamp) > age)) {
+				victim = w;
+				age = CacheClock - tag->Stamp;
+			}
+		}
+	}
+
+	tag = &CacheTag[victim][set];
+#if FF_FS_READONLY == 0
+	if ((tag->Flags & DC_LINE_DIRTY) != 0U) {
+		DRESULT res = dc_flush_run(tag->Pdrv, tag->Sector);
+
+		if (res != RES_OK) {
+			return res;
+		}
+	}
+#endif
+
+	tag->Flags = 0U;
+	tag->Pdrv = pdrv;
+	tag->Sector = sector;
+	*way = victim;
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Calls the handler for every cached line of the drive whose sector lies in
+* [sector, sector + count). Short ranges are looked up sector by sector,
+* long ranges by walking all lines.
+*
+******************************************************************************/
+static void dc_for_range (BYTE pdrv, LBA_t sector, LBA_t count,
+			  void (*handler)(UINT way, UINT set, UINT offset, void *arg),
+			  void *arg)
+{
+	UINT way;
+	UINT set;
+	UINT i;
+
+	if (count <= (LBA_t)FF_DISK_CACHE_SETS) {
+		for (i = 0U; i < (UINT)count; i++) {
+			way = dc_find(pdrv, sector + i);
+			if (way != DC_NO_WAY) {
+				handler(way, (UINT)((sector + i) & DC_SET_MASK), i, arg);
+			}
+		}
+	} else {
+		for (way = 0U; way < DC_NO_WAY; way++) {
+			for (set = 0U; set < FF_DISK_CACHE_SETS; set++) {
+				const DiskCacheTag *tag = &CacheTag[way][set];
+
+				if (((tag->Flags & DC_LINE_VALID) != 0U) && (tag->Pdrv == pdrv) &&
+				    (tag->Sector >= sector) && ((tag->Sector - sector) < count)) {
+					handler(way, set, (UINT)(tag->Sector - sector), arg);
+				}
+			}
+		}
+	}
+}
+
+/** Context of the range handlers */
+typedef struct {
+	BYTE *Buff;	/**< Caller buffer of the bypassed transfer */
+	UINT Ss;	/**< Sector size */
+} DiskCacheXfer;
+
+/*****************************************************************************/
+/**
+*
+* Overlays a dirty line on data read directly from the media.
+*
+******************************************************************************/
+static void dc_overlay_dirty (UINT way, UINT set, UINT offset, void *arg)
+{
+	DiskCacheXfer *xfer = (DiskCacheXfer *)arg;
+
+	if ((CacheTag[way][set].Flags & DC_LINE_DIRTY) != 0U) {
+		Xil_MemCpy(xfer->Buff + (offset * xfer->Ss), CacheData[way][set], xfer->Ss);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Makes data read from the media, bypassing the cache, coherent with it by
+* overlaying the dirty cached sectors of the range.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data read from the media
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+******************************************************************************/
+void disk_cache_merge (BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	DiskCacheXfer xfer;
+
+	xfer.Buff = buff;
+	xfer.Ss = dc_sector_size(pdrv);
+	if ((xfer.Ss != 0U) && (xfer.Ss <= DC_LINE_SS)) {
+		dc_for_range(pdrv, sector, count, dc_overlay_dirty, &xfer);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Reads sector(s) through the cache.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK on success, error code of the media otherwise
+*
+******************************************************************************/
+DRESULT disk_cache_read (BYTE pdrv, BYTE *buff, LBA_t sector, UINT count)
+{
+	UINT ss = dc_sector_size(pdrv);
+	UINT set = (UINT)(sector & DC_SET_MASK);
+	UINT way;
+	DRESULT res;
+
+	if ((count == 0U) || (ss == 0U) || (ss > DC_LINE_SS)) {
+		return disk_media_read(pdrv, buff, sector, count);
+	}
+
+	if (count > 1U) {
+		res = disk_media_read(pdrv, buff, sector, count);
+		if (res == RES_OK) {
+			disk_cache_merge(pdrv, buff, sector, count);
+		}
+		return res;
+	}
+
+	way = dc_find(pdrv, sector);
+	if (way == DC_NO_WAY) {
+		res = dc_alloc(pdrv, sector, &way);
+		if (res != RES_OK) {
+			return res;
+		}
+		res = disk_media_read(pdrv, CacheData[way][set], sector, 1U);
+		if (res != RES_OK) {
+			return res;
+		}
+		CacheTag[way][set].Flags = DC_LINE_VALID;
+	}
+
+	dc_touch(way, set);
+	Xil_MemCpy(buff, CacheData[way][set], ss);
+
+	return RES_OK;
+}
+
+#if FF_FS_READONLY == 0
+/*****************************************************************************/
+/**
+*
+* Refreshes a line with data written directly to the media.
+*
+******************************************************************************/
+static void dc_update_clean (UINT way, UINT set, UINT offset, void *arg)
+{
+	const DiskCacheXfer *xfer = (const DiskCacheXfer *)arg;
+
+	Xil_MemCpy(CacheData[way][set], xfer->Buff + (offset * xfer->Ss), xfer->Ss);
+	CacheTag[way][set].Flags = DC_LINE_VALID;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops a line without writing it back.
+*
+******************************************************************************/
+static void dc_drop (UINT way, UINT set, UINT offset, void *arg)
+{
+	(void)offset;
+	(void)arg;
+	CacheTag[way][set].Flags = 0U;
+}
+
+/*****************************************************************************/
+/**
+*
+* Refreshes the cached sectors of a range written to the media, bypassing
+* the cache, and marks them clean.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data written to the media
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+******************************************************************************/
+void disk_cache_update (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	DiskCacheXfer xfer;
+
+	xfer.Buff = (BYTE *)buff;
+	xfer.Ss = dc_sector_size(pdrv);
+	if ((xfer.Ss != 0U) && (xfer.Ss <= DC_LINE_SS)) {
+		dc_for_range(pdrv, sector, count, dc_update_clean, &xfer);
+	}
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes sector(s) through the cache. Single sectors are held dirty in the
+* cache until they are evicted or synced.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data to be written
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return	RES_OK on success, error code of the media otherwise
+*
+******************************************************************************/
+DRESULT disk_cache_write (BYTE pdrv, const BYTE *buff, LBA_t sector, UINT count)
+{
+	UINT ss = dc_sector_size(pdrv);
+	UINT set = (UINT)(sector & DC_SET_MASK);
+	UINT way;
+	DRESULT res;
+
+	if ((count == 0U) || (ss == 0U) || (ss > DC_LINE_SS)) {
+		return disk_media_write(pdrv, buff, sector, count);
+	}
+
+	if (count > 1U) {
+		res = disk_media_write(pdrv, buff, sector, count);
+		if (res == RES_OK) {
+			disk_cache_update(pdrv, buff, sector, count);
+		}
+		return res;
+	}
+
+	way = dc_find(pdrv, sector);
+	if (way == DC_NO_WAY) {
+		res = dc_alloc(pdrv, sector, &way);
+		if (res != RES_OK) {
+			return res;
+		}
+	}
+
+	Xil_MemCpy(CacheData[way][set], buff, ss);
+	CacheTag[way][set].Flags = DC_LINE_VALID | DC_LINE_DIRTY;
+	dc_touch(way, set);
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes back all dirty lines of the drive.
+*
+* @param	pdrv - Drive number
+*
+* @return	RES_OK on success, error code of the media otherwise
+*
+******************************************************************************/
+DRESULT disk_cache_sync (BYTE pdrv)
+{
+	UINT way;
+	UINT set;
+	DRESULT res;
+
+	for (set = 0U; set < FF_DISK_CACHE_SETS; set++) {
+		for (way = 0U; way < DC_NO_WAY; way++) {
+			const DiskCacheTag *tag = &CacheTag[way][set];
+
+			if (((tag->Flags & DC_LINE_DIRTY) != 0U) && (tag->Pdrv == pdrv)) {
+				res = dc_flush_run(pdrv, tag->Sector);
+				if (res != RES_OK) {
+					return res;
+				}
+			}
+		}
+	}
+
+	return RES_OK;
+}
+
+/*****************************************************************************/
+/**
+*
+* Drops the cached sectors [start, end] of the drive without writing them
+* back. Used when the sectors are trimmed.
+*
+* @param	pdrv - Drive number
+* @param	start - First sector
+* @param	end - Last sector
+*
+******************************************************************************/
+void disk_cache_discard (BYTE pdrv, LBA_t start, LBA_t end)
+{
+	if (end >= start) {
+		dc_for_range(pdrv, start, end - start + 1U, dc_drop, NULL);
+	}
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Invalidates all lines of the drive without writing them back. Called when
+* the drive is (re)initialized.
+*
+* @param	pdrv - Drive number
+*
+******************************************************************************/
+void disk_cache_invalidate (BYTE pdrv)
+{
+	UINT way;
+	UINT set;
+
+	for (way = 0U; way < DC_NO_WAY; way++) {
+		for (set = 0U; set < FF_DISK_CACHE_SETS; set++) {
+			if (CacheTag[way][set].Pdrv == pdrv) {
+				CacheTag[way][set].Flags = 0U;
+			}
+		}
+	}
+#if FF_MAX_SS != FF_MIN_SS
+	CacheSecSize[pdrv] = 0U;
+#endif
+}
+
+#endif /* FF_USE_DISK_CACHE */
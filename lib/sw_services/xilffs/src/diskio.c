@@ -71,6 +71,10 @@
 * 5.2   ap   12/05/23 Add SDT check to fix bug in disk_initialize.
 *       ap   01/11/24 Fix Doxygen warnings.
 *       sk   07/11/24 Add UFS interface support.
+* 5.3   sb   10/16/26 Route disk_read/disk_write/disk_ioctl through the
+*                     optional sector cache in diskcache.c.
+*       sb   10/16/26 Add media backends of the asynchronous interface that
+*                     chain queued SD requests in one ADMA2 transfer.
 *
 * </pre>
 *
@@ -78,6 +82,8 @@
 *
 ******************************************************************************/
 #include "diskio.h"
+#include "diskasync.h"
+#include "diskcache.h"
 #include "ff.h"
 #include "xil_types.h"
 #include "xstatus.h"
@@ -145,6 +151,12 @@ static u32 SlotType[XSDPS_NUM_INSTANCES];
 static u8 HostCntrlrVer[XSDPS_NUM_INSTANCES];
 #endif
 
+#if FF_USE_DISK_ASYNC && defined(XPAR_XSDPS_NUM_INSTANCES)
+static XSdPs_SgEntry AsyncSg[XSDPS_NUM_INSTANCES][FF_DISK_ASYNC_DEPTH];
+static UINT AsyncSgCnt[XSDPS_NUM_INSTANCES];
+static BYTE AsyncWrite[XSDPS_NUM_INSTANCES];
+#endif
+
 #ifdef XPAR_XUFSPSXC_NUM_INSTANCES
 #define XUFS_BLUN_PDRV	2U
 
@@ -319,6 +331,11 @@ DSTATUS disk_initialize (
 		return s;
 	}
 
+#if FF_USE_DISK_CACHE
+	/* Medium may have changed, drop whatever is cached for it */
+	disk_cache_invalidate(pdrv);
+#endif
+
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	if (pdrv < XSDPS_NUM_INSTANCES) {
 #ifdef XPAR_XSDPS_NUM_INSTANCES
@@ -441,7 +458,7 @@ DSTATUS disk_initialize (
 * @note
 *
 ******************************************************************************/
-DRESULT disk_read (
+DRESULT disk_media_read (
 	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
 	BYTE *buff,		/* Data buffer to store read data */
 	LBA_t sector,	/* Start sector in LBA */
@@ -466,6 +483,11 @@ DRESULT disk_read (
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	if (pdrv < XSDPS_NUM_INSTANCES) {
 #ifdef XPAR_XSDPS_NUM_INSTANCES
+#if FF_USE_DISK_ASYNC
+		/* Queued requests go first */
+		disk_async_quiesce(pdrv);
+#endif
+
 		/* Convert LBA to byte address if needed */
 		if ((SdInstance[pdrv].HCS) == 0U) {
 			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
@@ -529,7 +551,7 @@ DRESULT disk_read (
 * @note
 *
 ******************************************************************************/
-DRESULT disk_ioctl (
+DRESULT disk_media_ioctl (
 	BYTE pdrv,				/* Physical drive number (0) */
 	BYTE cmd,				/* Control code */
 	void *buff				/* Buffer to send/receive control data */
@@ -548,6 +570,13 @@ DRESULT disk_ioctl (
 		return RES_NOTRDY;
 	}
 
+#if FF_USE_DISK_ASYNC && defined(XPAR_XSDPS_NUM_INSTANCES)
+	if (pdrv < XSDPS_NUM_INSTANCES) {
+		/* Queued requests go first */
+		disk_async_quiesce(pdrv);
+	}
+#endif
+
 	switch (cmd) {
 		case (BYTE)CTRL_SYNC :	/* Make sure that no pending write process */
 			res = RES_OK;
@@ -726,7 +755,7 @@ DWORD get_fattime (void)
 *
 ******************************************************************************/
 #if FF_FS_READONLY == 0
-DRESULT disk_write (
+DRESULT disk_media_write (
 	BYTE pdrv,			/* Physical drive nmuber (0..) */
 	const BYTE *buff,	/* Data to be written */
 	LBA_t sector,		/* Sector address (LBA) */
@@ -750,6 +779,11 @@ DRESULT disk_write (
 #ifdef FILE_SYSTEM_INTERFACE_SD
 	if (pdrv < XSDPS_NUM_INSTANCES) {
 #ifdef XPAR_XSDPS_NUM_INSTANCES
+#if FF_USE_DISK_ASYNC
+		/* Queued requests go first */
+		disk_async_quiesce(pdrv);
+#endif
+
 		/* Convert LBA to byte address if needed */
 		if ((SdInstance[pdrv].HCS) == 0U) {
 			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
@@ -792,3 +826,269 @@ DRESULT disk_write (
 	return RES_OK;
 }
 #endif
+
+#if FF_USE_DISK_ASYNC
+/*****************************************************************************/
+/**
+*
+* Starts the transfer of a chain of queued requests.
+* In case of SD, the buffers that fit in the ADMA2 descriptor table are
+* chained and moved by one non-blocking multi-block command. Other
+* interfaces move the first buffer synchronously.
+*
+* @param	pdrv - Drive number
+* @param	write - 0 to read from the drive, 1 to write to it
+* @param	sector - Start sector number of the chain
+* @param	seg - Buffers of the chain
+* @param	nseg - Number of buffers in the chain, returns the number of
+*		buffers taken by the transfer
+*
+* @return
+*		RES_OK		Transfer started
+*		RES_NOTRDY	Drive not initialized
+*		RES_PARERR	First buffer is too large for one transfer
+*		RES_ERROR	Transfer could not be started
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_media_start (
+	BYTE pdrv,				/* Physical drive number (0..) */
+	BYTE write,				/* Direction of the transfer */
+	LBA_t sector,			/* Start sector in LBA */
+	const DiskAsyncSeg *seg,	/* Buffers of the chain */
+	UINT *nseg				/* Number of buffers, in and out */
+)
+{
+	DRESULT res;
+#if defined(FILE_SYSTEM_INTERFACE_SD) && defined(XPAR_XSDPS_NUM_INSTANCES)
+	s32 Status;
+	DWORD LocSector = sector;
+	u32 DescCnt = 0U;
+	u32 Len;
+	UINT i;
+#endif
+
+	if ((disk_status(pdrv) & STA_NOINIT) != 0U) {
+		return RES_NOTRDY;
+	}
+
+#if defined(FILE_SYSTEM_INTERFACE_SD) && defined(XPAR_XSDPS_NUM_INSTANCES)
+	if (pdrv < XSDPS_NUM_INSTANCES) {
+		/* Take the buffers that fit in the descriptor table */
+		for (i = 0U; i < *nseg; i++) {
+			Len = (u32)seg[i].Count * SdInstance[pdrv].BlkSize;
+			DescCnt += (Len + XSDPS_DESC_MAX_LENGTH - 1U) / XSDPS_DESC_MAX_LENGTH;
+			if (DescCnt > 32U) {
+				break;
+			}
+			AsyncSg[pdrv][i].Buff = seg[i].Buff;
+			AsyncSg[pdrv][i].BlkCnt = (u32)seg[i].Count;
+		}
+		if (i == 0U) {
+			return RES_PARERR;
+		}
+
+		/* Convert LBA to byte address if needed */
+		if ((SdInstance[pdrv].HCS) == 0U) {
+			LocSector *= (DWORD)XSDPS_BLK_SIZE_512_MASK;
+		}
+
+		if (write != 0U) {
+			Status = XSdPs_StartWriteTransferSg(&SdInstance[pdrv], (u32)LocSector,
+							    AsyncSg[pdrv], (u32)i);
+		} else {
+			Status = XSdPs_StartReadTransferSg(&SdInstance[pdrv], (u32)LocSector,
+							   AsyncSg[pdrv], (u32)i);
+		}
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+
+		AsyncSgCnt[pdrv] = i;
+		AsyncWrite[pdrv] = write;
+		*nseg = i;
+		return RES_OK;
+	}
+#endif
+
+	*nseg = 1U;
+	if (write != 0U) {
+#if FF_FS_READONLY == 0
+		res = disk_media_write(pdrv, seg[0].Buff, sector, seg[0].Count);
+#else
+		res = RES_WRPRT;
+#endif
+	} else {
+		res = disk_media_read(pdrv, seg[0].Buff, sector, seg[0].Count);
+	}
+
+	return res;
+}
+
+/*****************************************************************************/
+/**
+*
+* Checks the transfer started by disk_media_start.
+*
+* @param	pdrv - Drive number
+*
+* @return
+*		RES_OK		Transfer complete
+*		RES_NOTRDY	Transfer still in progress
+*		RES_ERROR	Transfer failed
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_media_check (
+	BYTE pdrv				/* Physical drive number (0..) */
+)
+{
+#if defined(FILE_SYSTEM_INTERFACE_SD) && defined(XPAR_XSDPS_NUM_INSTANCES)
+	s32 Status;
+	UINT i;
+
+	if (pdrv < XSDPS_NUM_INSTANCES) {
+		if (AsyncWrite[pdrv] != 0U) {
+			Status = XSdPs_CheckWriteTransfer(&SdInstance[pdrv]);
+		} else {
+			Status = XSdPs_CheckReadTransfer(&SdInstance[pdrv]);
+		}
+		if (Status == XST_DEVICE_BUSY) {
+			return RES_NOTRDY;
+		}
+		if (Status != XST_SUCCESS) {
+			return RES_ERROR;
+		}
+
+		/* Drop lines fetched speculatively during the transfer */
+		if ((AsyncWrite[pdrv] == 0U) &&
+		    (SdInstance[pdrv].Config.IsCacheCoherent == 0U)) {
+			for (i = 0U; i < AsyncSgCnt[pdrv]; i++) {
+				Xil_DCacheInvalidateRange((INTPTR)AsyncSg[pdrv][i].Buff,
+							  (INTPTR)AsyncSg[pdrv][i].BlkCnt *
+							  (INTPTR)SdInstance[pdrv].BlkSize);
+			}
+		}
+	}
+#endif
+
+	(void)pdrv;
+
+	return RES_OK;
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* Reads sector(s) from the drive, through the sector cache when it is
+* enabled.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data buffer to store read data
+* @param	sector - Start sector number
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Read successful
+*		RES_NOTRDY	Drive not initialized
+*		RES_ERROR	Read not successful
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_read (
+	BYTE pdrv,		/* Physical drive nmuber to identify the drive */
+	BYTE *buff,		/* Data buffer to store read data */
+	LBA_t sector,	/* Start sector in LBA */
+	UINT count		/* Number of sectors to read */
+)
+{
+#if FF_USE_DISK_CACHE
+	return disk_cache_read(pdrv, buff, sector, count);
+#else
+	return disk_media_read(pdrv, buff, sector, count);
+#endif
+}
+
+/*****************************************************************************/
+/**
+*
+* Writes sector(s) to the drive, through the sector cache when it is
+* enabled. Cached sectors reach the medium on eviction or CTRL_SYNC.
+*
+* @param	pdrv - Drive number
+* @param	buff - Pointer to the data to be written
+* @param	sector - Sector address
+* @param	count - Sector count
+*
+* @return
+*		RES_OK		Write successful
+*		RES_NOTRDY	Drive not initialized
+*		RES_ERROR	Write not successful
+*
+* @note
+*
+******************************************************************************/
+#if FF_FS_READONLY == 0
+DRESULT disk_write (
+	BYTE pdrv,			/* Physical drive nmuber (0..) */
+	const BYTE *buff,	/* Data to be written */
+	LBA_t sector,		/* Sector address (LBA) */
+	UINT count			/* Number of sectors to write (1..128) */
+)
+{
+#if FF_USE_DISK_CACHE
+	return disk_cache_write(pdrv, buff, sector, count);
+#else
+	return disk_media_write(pdrv, buff, sector, count);
+#endif
+}
+#endif
+
+/*****************************************************************************/
+/**
+*
+* List specific features and do miscellaneous functions on device.
+* When the sector cache is enabled, CTRL_SYNC writes back the dirty
+* sectors of the drive and CTRL_TRIM drops the trimmed ones before the
+* command is passed to the medium.
+*
+* @param	pdrv - Drive number
+* @param	cmd - Command code
+* @param	buff - Pointer to the parameter depends on the command code.
+*
+* @return
+*		RES_OK		Command successful
+*		RES_PARERR	Command is invalid
+*		RES_NOTRDY	Drive not initialized
+*		RES_ERROR	Error occured
+*
+* @note
+*
+******************************************************************************/
+DRESULT disk_ioctl (
+	BYTE pdrv,				/* Physical drive number (0) */
+	BYTE cmd,				/* Control code */
+	void *buff				/* Buffer to send/receive control data */
+)
+{
+#if FF_USE_DISK_CACHE && (FF_FS_READONLY == 0)
+	DRESULT res;
+
+	if (cmd == (BYTE)CTRL_SYNC) {
+		res = disk_cache_sync(pdrv);
+		if (res != RES_OK) {
+			return res;
+		}
+	} else if (cmd == (BYTE)CTRL_TRIM) {
+		disk_cache_discard(pdrv, ((LBA_t *)buff)[0], ((LBA_t *)buff)[1]);
+	} else {
+		/* Other commands do not touch cached sectors */
+	}
+#endif
+
+	return disk_media_ioctl(pdrv, cmd, buff);
+}
@@ -35,6 +35,11 @@
 * 5.2   sk   07/11/24 Add f_ioctl interface to perform UFS specific configs.
 *       sk   07/11/24 Update drive number calculation logic to support multiple
 *                     digit drive numbers.
+* 5.3   sb   10/16/26 Build the cluster link map of a file automatically on
+*                     f_lseek() when FF_FASTSEEK_AUTO_FRAGS is non-zero.
+*       sb   10/16/26 Add f_stream() streaming write into a contiguous block.
+*       sb   10/16/26 Add f_read_async() queuing whole sectors on the
+*                     asynchronous disk interface.
 ******************************************************************************/
 #include "xparameters.h"
 #include "xstatus.h"
@@ -46,6 +51,7 @@
 #if (defined FILE_SYSTEM_INTERFACE_SD) || (defined FILE_SYSTEM_INTERFACE_RAM)
 #include "ff.h"			/* Declarations of FatFs API */
 #include "diskio.h"		/* Declarations of device I/O functions */
+#include "diskasync.h"
 #include "xil_printf.h"
 #include "xil_cache.h"
 #ifdef XPAR_XUFSPSXC_NUM_INSTANCES
@@ -2120,10 +2126,160 @@ static DWORD clmt_clust (	/* <2:Error, >=2:Cluster number */
 	return cl + *tbl;	/* Return the cluster number */
 }
 
+
+#if FF_FASTSEEK_AUTO_FRAGS
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Automatic link map of the file                         */
+/*-----------------------------------------------------------------------*/
+/* The map is kept in the file object as pairs of {end, top}, where end is
+/  the cluster order following the fragment and top is its first cluster.
+/  It is built on demand by following the FAT from the last mapped cluster,
+/  so appended clusters are picked up without invalidating it. */
+
+static void clmt_auto_reset (
+	FIL *fp			/* Pointer to the file object */
+)
+{
+	fp->clmt_nfrag = 0;
+}
+
+
+static DWORD clmt_auto_clust (	/* 0:Out of chain, 1:Internal error, 0xFFFFFFFF:Disk error, >=2:Cluster number */
+	FIL *fp,		/* Pointer to the file object */
+	DWORD cl		/* Cluster order from top of the file */
+)
+{
+	DWORD *map = fp->clmt_map;
+	DWORD end, top, last, ncl;
+	UINT lo, hi, mid;
+	BYTE store;
+	FATFS *fs = fp->obj.fs;
+
+
+	if (fp->obj.sclust == 0) {
+		return 0;
+	}
+	if (fp->clmt_nfrag == 0) {	/* Start the map at the top of the chain */
+		map[0] = 1;
+		map[1] = fp->obj.sclust;
+		fp->clmt_nfrag = 1;
+	}
+
+	end = map[(fp->clmt_nfrag - 1) * 2];
+	if (cl < end) {				/* Mapped: find the fragment by binary search */
+		lo = 0;
+		hi = fp->clmt_nfrag - 1;
+		while (lo < hi) {
+			mid = (lo + hi) / 2;
+			if (cl < map[mid * 2]) {
+				hi = mid;
+			}
+			else {
+				lo = mid + 1;
+			}
+		}
+		return map[lo * 2 + 1] + cl - (lo ? map[lo * 2 - 2] : 0);
+	}
+
+	/* Not mapped yet: grow the map along the chain */
+	top = map[(fp->clmt_nfrag - 1) * 2 + 1];
+	last = top + end - 1 - (fp->clmt_nfrag > 1 ? map[(fp->clmt_nfrag - 2) * 2] : 0);
+	store = 1;
+	while (end <= cl) {
+		ncl = get_fat(&fp->obj, last);
+		if (ncl < 2 || ncl == 0xFFFFFFFF) {
+			return ncl;				/* Error */
+		}
+		if (ncl >= fs->n_fatent) {
+			return 0;				/* End of chain */
+		}
+		if (store && ncl != last + 1) {	/* New fragment */
+			if (fp->clmt_nfrag < FF_FASTSEEK_AUTO_FRAGS) {
+				fp->clmt_nfrag++;
+				map[(fp->clmt_nfrag - 1) * 2 + 1] = ncl;
+			}
+			else {
+				store = 0;			/* Map is full, follow the chain without storing */
+			}
+		}
+		end++;
+		if (store) {
+			map[(fp->clmt_nfrag - 1) * 2] = end;
+		}
+		last = ncl;
+	}
+	return last;
+}
+
+#endif	/* FF_FASTSEEK_AUTO_FRAGS */
 #endif	/* FF_USE_FASTSEEK */
 
 
 
+#if FF_USE_EXPAND && !FF_FS_READONLY
+/*-----------------------------------------------------------------------*/
+/* FAT handling - Streaming block of the file                            */
+/*-----------------------------------------------------------------------*/
+
+static DWORD stream_clust (	/* 0:Not in the streaming block, >=2:Cluster number */
+	FIL *fp,		/* Pointer to the file object */
+	FSIZE_t ofs		/* File offset to be converted to cluster# */
+)
+{
+	FATFS *fs = fp->obj.fs;
+	DWORD cl = (DWORD)(ofs / SS(fs) / fs->csize);	/* Cluster order from top of the file */
+
+
+	return (cl < fp->strm_ncl) ? fp->strm_scl + cl : 0;
+}
+
+
+static FRESULT stream_release (	/* FR_OK(0):succeeded, !=0:error */
+	FIL *fp			/* Pointer to the file object */
+)
+{
+	FRESULT res = FR_OK;
+	FATFS *fs = fp->obj.fs;
+	DWORD used;
+
+
+	if (fp->strm_ncl == 0) {
+		return FR_OK;		/* Not streaming */
+	}
+	used = (fp->obj.objsize == 0) ? 0 : (DWORD)((fp->obj.objsize - 1) / SS(fs) / fs->csize) + 1;	/* Clusters holding data */
+	if (used < fp->strm_ncl) {	/* Release the clusters not written */
+#if FF_FS_EXFAT
+		if (fs->fs_type == FS_EXFAT) {	/* Contiguous chain has no FAT, free it on the bitmap */
+			res = change_bitmap(fs, fp->strm_scl + used, fp->strm_ncl - used, 0);
+			if (res == FR_OK && fs->free_clst <= fs->n_fatent - 2) {	/* Update FSINFO */
+				fs->free_clst += fp->strm_ncl - used;
+				fs->fsi_flag |= 1;
+			}
+			if (used == 0) {
+				fp->obj.stat = 0;
+			}
+		}
+		else
+#endif
+		{
+			res = remove_chain(&fp->obj, fp->strm_scl + used, used ? fp->strm_scl + used - 1 : 0);
+		}
+		if (used == 0) {
+			fp->obj.sclust = 0;
+		}
+		fp->flag |= FA_MODIFIED;
+#if FF_USE_FASTSEEK && FF_FASTSEEK_AUTO_FRAGS
+		clmt_auto_reset(fp);
+#endif
+	}
+	fp->strm_ncl = 0;		/* End of streaming mode */
+	return res;
+}
+
+#endif	/* FF_USE_EXPAND && !FF_FS_READONLY */
+
+
+
 
 /*-----------------------------------------------------------------------*/
 /* Directory handling - Fill a cluster with zeros                        */
@@ -4862,6 +5018,12 @@ FRESULT f_open (
 			}
 #if FF_USE_FASTSEEK
 			fp->cltbl = 0;		/* Disable fast seek mode */
+#if FF_FASTSEEK_AUTO_FRAGS
+			clmt_auto_reset(fp);	/* Link map is built on demand */
+#endif
+#endif
+#if FF_USE_EXPAND && !FF_FS_READONLY
+			fp->strm_ncl = 0;	/* Not in streaming mode */
 #endif
 			fp->obj.fs = fs;	/* Validate the file object */
 			fp->obj.id = fs->id;
@@ -5053,6 +5215,158 @@ FRESULT f_read (
 
 
 
+#if FF_USE_DISK_ASYNC
+/*-----------------------------------------------------------------------*/
+/* Read File in Background                                               */
+/*-----------------------------------------------------------------------*/
+/* Whole sectors are queued on the asynchronous disk interface and the
+/  cluster chain is followed while they are transferred; partial sectors
+/  at the head and the tail are copied before the function returns. cb is
+/  called once all data is in the buffer, which must not be touched until
+/  then. Completion needs disk_async_poll() or disk_async_drain() on the
+/  drive; any synchronous access to the drive also completes it. */
+
+FRESULT f_read_async (
+	FIL *fp, 	/* Open file to be read */
+	void *buff,	/* Data buffer to store the read data */
+	UINT btr,	/* Number of bytes to read */
+	UINT *br,	/* Number of bytes read or queued */
+	FF_ASYNC_CB cb,	/* Completion callback (can be NULL) */
+	void *arg	/* Argument of the callback */
+)
+{
+	FRESULT res = FR_DISK_ERR;
+	FATFS *fs;
+	DWORD clst;
+	LBA_t sect;
+	FSIZE_t remain;
+	UINT rcnt, cc, csect;
+	BYTE *rbuff = (BYTE *)buff;
+	BYTE *qbuff = 0;	/* Pending request, submitted once the next one is known */
+	LBA_t qsect = 0;
+	UINT qcnt = 0;
+
+
+	*br = 0;	/* Clear read byte counter */
+	res = validate(&fp->obj, &fs);				/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) {
+		LEAVE_FF(fs, res);        /* Check validity */
+	}
+	if (!(fp->flag & FA_READ)) {
+		LEAVE_FF(fs, FR_DENIED);        /* Check access mode */
+	}
+	remain = fp->obj.objsize - fp->fptr;
+	if (btr > remain) {
+		btr = (UINT)remain;        /* Truncate btr by remaining bytes */
+	}
+
+	for ( ; btr > 0; btr -= rcnt, *br += rcnt, rbuff += rcnt, fp->fptr += rcnt) {	/* Repeat until btr bytes read */
+		if (fp->fptr % SS(fs) == 0) {			/* On the sector boundary? */
+			csect = (UINT)(fp->fptr / SS(fs) & (fs->csize - 1));	/* Sector offset in the cluster */
+			if (csect == 0) {					/* On the cluster boundary? */
+				if (fp->fptr == 0) {			/* On the top of the file? */
+					clst = fp->obj.sclust;		/* Follow cluster chain from the origin */
+				}
+				else {						/* Middle or end of the file */
+#if FF_USE_FASTSEEK
+					if (fp->cltbl) {
+						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
+					}
+					else
+#endif
+					{
+						clst = get_fat(&fp->obj, fp->clust);	/* Follow cluster chain on the FAT */
+					}
+				}
+				if (clst < 2) {
+					ABORT(fs, FR_INT_ERR);
+				}
+				if (clst == 0xFFFFFFFF) {
+					ABORT(fs, FR_DISK_ERR);
+				}
+				fp->clust = clst;				/* Update current cluster */
+			}
+			sect = clst2sect(fs, fp->clust);	/* Get current sector */
+			if (sect == 0) {
+				ABORT(fs, FR_INT_ERR);
+			}
+			sect += csect;
+			cc = btr / SS(fs);					/* When remaining bytes >= sector size, */
+			if (cc > 0) {						/* Queue maximum contiguous sectors */
+				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
+					cc = fs->csize - csect;
+				}
+#if !FF_FS_READONLY					/* Write back a dirty sector buffer in the range first */
+#if FF_FS_TINY
+				if (fs->wflag && fs->winsect - sect < cc) {
+					if (sync_window(fs) != FR_OK) {
+						ABORT(fs, FR_DISK_ERR);
+					}
+				}
+#else
+				if ((fp->flag & FA_DIRTY) && fp->sect - sect < cc) {
+					if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
+						ABORT(fs, FR_DISK_ERR);
+					}
+					fp->flag &= (BYTE)~FA_DIRTY;
+				}
+#endif
+#endif
+				if (qcnt > 0 && disk_async_submit(fs->pdrv, 0, qbuff, qsect, qcnt, 0, 0, 0) != RES_OK) {
+					ABORT(fs, FR_DISK_ERR);
+				}
+				qbuff = rbuff;
+				qsect = sect;
+				qcnt = cc;
+				rcnt = SS(fs) * cc;				/* Number of bytes queued */
+				continue;
+			}
+#if !FF_FS_TINY
+			if (fp->sect != sect) {			/* Load data sector if not in cache */
+#if !FF_FS_READONLY
+				if (fp->flag & FA_DIRTY) {		/* Write-back dirty sector cache */
+					if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
+						ABORT(fs, FR_DISK_ERR);
+					}
+					fp->flag &= (BYTE)~FA_DIRTY;
+				}
+#endif
+				if (disk_read(fs->pdrv, fp->buf, sect, 1) != RES_OK) {
+					ABORT(fs, FR_DISK_ERR);        /* Fill sector cache */
+				}
+			}
+#endif
+			fp->sect = sect;
+		}
+		rcnt = SS(fs) - (UINT)fp->fptr % SS(fs);	/* Number of bytes remains in the sector */
+		if (rcnt > btr) {
+			rcnt = btr;        /* Clip it by btr if needed */
+		}
+#if FF_FS_TINY
+		if (move_window(fs, fp->sect) != FR_OK) {
+			ABORT(fs, FR_DISK_ERR);        /* Move sector window */
+		}
+		mem_cpy(rbuff, fs->win + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
+#else
+		mem_cpy(rbuff, fp->buf + fp->fptr % SS(fs), rcnt);	/* Extract partial sector */
+#endif
+		Xil_DCacheFlushRange((INTPTR)rbuff, rcnt);	/* See f_read() */
+	}
+
+	if (qcnt > 0) {		/* The last request reports the completion */
+		if (disk_async_submit(fs->pdrv, 0, qbuff, qsect, qcnt, 0, cb, arg) != RES_OK) {
+			ABORT(fs, FR_DISK_ERR);
+		}
+	} else if (cb) {	/* Nothing queued, data is already in place */
+		cb(FR_OK, arg);
+	}
+
+	LEAVE_FF(fs, FR_OK);
+}
+#endif
+
+
+
 
 #if !FF_FS_READONLY
 /*-----------------------------------------------------------------------*/
@@ -5101,6 +5415,12 @@ FRESULT f_write (
 					}
 				}
 				else {					/* On the middle or end of the file */
+#if FF_USE_EXPAND
+					if (fp->strm_ncl && (clst = stream_clust(fp, fp->fptr)) != 0) {
+						/* Next cluster of the streaming block */
+					}
+					else
+#endif
 #if FF_USE_FASTSEEK
 					if (fp->cltbl) {
 						clst = clmt_clust(fp, fp->fptr);	/* Get cluster# from the CLMT */
@@ -5123,6 +5443,9 @@ FRESULT f_write (
 				fp->clust = clst;			/* Update current cluster */
 				if (fp->obj.sclust == 0) {
 					fp->obj.sclust = clst;        /* Set start cluster if the first write */
+#if FF_USE_FASTSEEK && FF_FASTSEEK_AUTO_FRAGS
+					clmt_auto_reset(fp);
+#endif
 				}
 			}
 #if FF_FS_TINY
@@ -5144,12 +5467,26 @@ FRESULT f_write (
 			sect += csect;
 			cc = btw / SS(fs);				/* When remaining bytes >= sector size, */
 			if (cc > 0) {					/* Write maximum contiguous sectors directly */
+#if FF_USE_EXPAND
+				if (fp->strm_ncl && stream_clust(fp, fp->fptr) != 0) {	/* Clip at end of the streaming block */
+					clst = fp->strm_ncl - (DWORD)(fp->fptr / SS(fs) / fs->csize);	/* Clusters left in the block */
+					if (cc > clst * fs->csize - csect) {
+						cc = clst * fs->csize - csect;
+					}
+				}
+				else
+#endif
 				if (csect + cc > fs->csize) {	/* Clip at cluster boundary */
 					cc = fs->csize - csect;
 				}
 				if (disk_write(fs->pdrv, wbuff, sect, cc) != RES_OK) {
 					ABORT(fs, FR_DISK_ERR);
 				}
+#if FF_USE_EXPAND
+				if (csect + cc > fs->csize) {	/* Crossed clusters of the streaming block */
+					fp->clust = stream_clust(fp, fp->fptr + (FSIZE_t)SS(fs) * cc - 1);
+				}
+#endif
 #if FF_FS_MINIMIZE <= 2
 #if FF_FS_TINY
 				if (fs->winsect - sect < cc) {	/* Refill sector cache if it gets invalidated by the direct write */
@@ -5301,6 +5638,17 @@ FRESULT f_close (
 	FRESULT res = FR_DISK_ERR;
 	FATFS *fs;
 
+#if FF_USE_EXPAND && !FF_FS_READONLY
+	if (validate(&fp->obj, &fs) == FR_OK) {
+		res = stream_release(fp);		/* Release the unwritten part of the streaming block */
+		if (res != FR_OK) {
+			fp->err = (BYTE)res;
+		}
+#if FF_FS_REENTRANT
+		unlock_volume(fs, res);
+#endif
+	}
+#endif
 #if !FF_FS_READONLY
 	res = f_sync(fp);					/* Flush cached data */
 	if (res == FR_OK)
@@ -5661,6 +6009,14 @@ FRESULT f_lseek (
 					      || !(fp->flag & FA_WRITE))) {	/* In read-only mode, clip offset with the file size */
 			ofs = fp->obj.objsize;
 		}
+#if FF_USE_EXPAND && !FF_FS_READONLY
+		if (ofs > fp->obj.objsize) {	/* File is to be extended by seek, end streaming mode */
+			res = stream_release(fp);
+			if (res != FR_OK) {
+				ABORT(fs, res);
+			}
+		}
+#endif
 		ifptr = fp->fptr;
 		fp->fptr = nsect = 0;
 		if (ofs > 0) {
@@ -5683,10 +6039,28 @@ FRESULT f_lseek (
 						ABORT(fs, FR_DISK_ERR);
 					}
 					fp->obj.sclust = clst;
+#if FF_USE_FASTSEEK && FF_FASTSEEK_AUTO_FRAGS
+					clmt_auto_reset(fp);
+#endif
 				}
 #endif
 				fp->clust = clst;
 			}
+#if FF_USE_FASTSEEK && FF_FASTSEEK_AUTO_FRAGS
+			if (clst != 0 && ofs > bcs && fp->fptr + ofs <= fp->obj.objsize) {	/* Target is in the allocated chain, */
+				ofs += fp->fptr;											/* take its cluster from the link map */
+				fp->fptr = (ofs - 1) & ~(FSIZE_t)(bcs - 1);
+				clst = clmt_auto_clust(fp, (DWORD)(fp->fptr / bcs));
+				if (clst == 0xFFFFFFFF) {
+					ABORT(fs, FR_DISK_ERR);
+				}
+				if (clst <= 1) {
+					ABORT(fs, FR_INT_ERR);
+				}
+				fp->clust = clst;
+				ofs -= fp->fptr;
+			}
+#endif
 			if (clst != 0) {
 				while (ofs > bcs) {						/* Cluster following loop */
 					ofs -= bcs;
@@ -6138,6 +6512,12 @@ FRESULT f_truncate (
 	if (!(fp->flag & FA_WRITE)) {
 		LEAVE_FF(fs, FR_DENIED);        /* Check access mode */
 	}
+#if FF_USE_EXPAND
+	res = stream_release(fp);		/* Release the unwritten part of the streaming block */
+	if (res != FR_OK) {
+		ABORT(fs, res);
+	}
+#endif
 
 	if (fp->fptr < fp->obj.objsize) {	/* Process when fptr is not on the eof */
 		if (fp->fptr == 0) {	/* When set file size to zero, remove entire cluster chain */
@@ -6159,6 +6539,9 @@ FRESULT f_truncate (
 		}
 		fp->obj.objsize = fp->fptr;	/* Set file size to current read/write point */
 		fp->flag |= FA_MODIFIED;
+#if FF_USE_FASTSEEK && FF_FASTSEEK_AUTO_FRAGS
+		clmt_auto_reset(fp);		/* Removed clusters may be in the link map */
+#endif
 #if !FF_FS_TINY
 		if (res == FR_OK && (fp->flag & FA_DIRTY)) {
 			if (disk_write(fs->pdrv, fp->buf, fp->sect, 1) != RES_OK) {
@@ -6866,27 +7249,23 @@ FRESULT f_setlabel (
 /* Allocate a Contiguous Blocks to the File                              */
 /*-----------------------------------------------------------------------*/
 
-FRESULT f_expand (
-	FIL *fp,		/* Pointer to the file object */
+static FRESULT expand_contig (	/* FR_OK(0):succeeded, !=0:error */
+	FIL *fp,		/* Pointer to the validated file object */
 	FSIZE_t fsz,	/* File size to be expanded to */
 	BYTE opt		/* Operation mode 0:Find and prepare or 1:Find and allocate */
 )
 {
-	FRESULT res = FR_DISK_ERR;
-	FATFS *fs;
+	FRESULT res = FR_OK;
+	FATFS *fs = fp->obj.fs;
 	DWORD n, clst, stcl, scl, ncl, tcl, lclst;
 
 
-	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
-	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) {
-		LEAVE_FF(fs, res);
-	}
-	if (fsz == 0 || fp->obj.objsize != 0 || !(fp->flag & FA_WRITE)) {
-		LEAVE_FF(fs, FR_DENIED);
+	if (fsz == 0 || fp->obj.objsize != 0 || !(fp->flag & FA_WRITE) || fp->strm_ncl != 0) {
+		return FR_DENIED;
 	}
 #if FF_FS_EXFAT
 	if (fs->fs_type != FS_EXFAT && fsz >= 0x100000000) {
-		LEAVE_FF(fs, FR_DENIED);        /* Check if in size limit */
+		return FR_DENIED;        /* Check if in size limit */
 	}
 #endif
 	n = (DWORD)fs->csize * SS(fs);	/* Cluster size */
@@ -6968,6 +7347,9 @@ FRESULT f_expand (
 		fs->last_clst = lclst;		/* Set suggested start cluster to start next */
 		if (opt) {	/* Is it allocated now? */
 			fp->obj.sclust = scl;		/* Update object allocation information */
+#if FF_USE_FASTSEEK && FF_FASTSEEK_AUTO_FRAGS
+			clmt_auto_reset(fp);
+#endif
 			fp->obj.objsize = fsz;
 			if (FF_FS_EXFAT) {
 				fp->obj.stat = 2;        /* Set status 'contiguous chain' */
@@ -6980,6 +7362,62 @@ FRESULT f_expand (
 		}
 	}
 
+	return res;
+}
+
+
+FRESULT f_expand (
+	FIL *fp,		/* Pointer to the file object */
+	FSIZE_t fsz,	/* File size to be expanded to */
+	BYTE opt		/* Operation mode 0:Find and prepare or 1:Find and allocate */
+)
+{
+	FRESULT res = FR_DISK_ERR;
+	FATFS *fs;
+
+
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) {
+		LEAVE_FF(fs, res);
+	}
+	res = expand_contig(fp, fsz, opt);
+
+	LEAVE_FF(fs, res);
+}
+
+
+
+/*-----------------------------------------------------------------------*/
+/* Start Streaming Write into a Contiguous Block                         */
+/*-----------------------------------------------------------------------*/
+/* A contiguous block of fsz bytes is allocated to the empty file like
+/  f_expand(fp, fsz, 1), but the file size is left at zero and grows with
+/  f_write(). While the file pointer is in the block, f_write() takes the
+/  clusters from the block without FAT access and transfers whole sectors
+/  straight from the caller's buffer, across cluster boundaries, in a
+/  single disk_write(). The part of the block that was not written is
+/  released by f_close(), f_truncate() or a seek beyond the file size. */
+
+FRESULT f_stream (
+	FIL *fp,		/* Pointer to the file object */
+	FSIZE_t fsz		/* Size of the block to be allocated */
+)
+{
+	FRESULT res = FR_DISK_ERR;
+	FATFS *fs;
+
+
+	res = validate(&fp->obj, &fs);		/* Check validity of the file object */
+	if (res != FR_OK || (res = (FRESULT)fp->err) != FR_OK) {
+		LEAVE_FF(fs, res);
+	}
+	res = expand_contig(fp, fsz, 1);
+	if (res == FR_OK) {
+		fp->strm_scl = fp->obj.sclust;
+		fp->strm_ncl = fp->obj.sclust ? (DWORD)((fsz - 1) / SS(fs) / fs->csize) + 1 : 0;
+		fp->obj.objsize = 0;	/* File size grows with the written data */
+	}
+
 	LEAVE_FF(fs, res);
 }
 
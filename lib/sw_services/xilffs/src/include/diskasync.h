@@ -0,0 +1,66 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file diskasync.h
+ * @addtogroup xilffs Overview
+ * @{
+ * @details
+ *
+ * This file contains declarations shared by the asynchronous request queue
+ * in diskasync.c, the media backends of diskio.c and the FatFs core.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 5.3   sb   10/16/26    First release
+ *
+ *</pre>
+ *
+ *@note
+ *****************************************************************************/
+#ifndef DISKASYNC_H
+#define DISKASYNC_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "diskio.h"
+
+#if FF_USE_DISK_ASYNC
+
+/**************************** Type Definitions *******************************/
+/** Buffer of a chained transfer */
+typedef struct {
+	BYTE *Buff;	/**< Data buffer */
+	UINT Count;	/**< Number of sectors held by the buffer */
+} DiskAsyncSeg;
+
+/************************** Function Prototypes ******************************/
+/* Media backends implemented in diskio.c */
+DRESULT disk_media_start (BYTE pdrv, BYTE write, LBA_t sector,
+			  const DiskAsyncSeg* seg, UINT* nseg);
+DRESULT disk_media_check (BYTE pdrv);
+
+/* Queue implemented in diskasync.c */
+DRESULT disk_async_submit (BYTE pdrv, BYTE write, BYTE* buff, LBA_t sector,
+			   UINT count, disk_async_cb cb, FF_ASYNC_CB fcb, void* arg);
+void disk_async_quiesce (BYTE pdrv);
+
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISKASYNC_H */
@@ -0,0 +1,62 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+ *
+ * @file diskcache.h
+ * @addtogroup xilffs Overview
+ * @{
+ * @details
+ *
+ * This file contains declarations of the sector cache that sits between
+ * the FatFs core and the media backends of diskio.c.
+ *
+ * <pre>
+ * MODIFICATION HISTORY:
+ *
+ * Ver   Who  Date        Changes
+ * ----- ---- -------- -------------------------------------------------------
+ * 5.3   sb   10/16/26    First release
+ *
+ *</pre>
+ *
+ *@note
+ *****************************************************************************/
+#ifndef DISKCACHE_H
+#define DISKCACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "diskio.h"
+
+/************************** Function Prototypes ******************************/
+/* Media backends implemented in diskio.c */
+DRESULT disk_media_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
+DRESULT disk_media_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
+DRESULT disk_media_ioctl (BYTE pdrv, BYTE cmd, void* buff);
+
+#if FF_USE_DISK_CACHE
+DRESULT disk_cache_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
+void disk_cache_merge (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
+#if FF_FS_READONLY == 0
+DRESULT disk_cache_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
+void disk_cache_update (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
+DRESULT disk_cache_sync (BYTE pdrv);
+void disk_cache_discard (BYTE pdrv, LBA_t start, LBA_t end);
+#endif
+void disk_cache_invalidate (BYTE pdrv);
+#endif
+
+/** @} */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISKCACHE_H */
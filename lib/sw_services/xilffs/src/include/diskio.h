@@ -38,6 +38,18 @@ DRESULT disk_read (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_write (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count);
 DRESULT disk_ioctl (BYTE pdrv, BYTE cmd, void* buff);
 
+#if FF_USE_DISK_ASYNC
+/* Completion callback of an asynchronous request, called from disk_async_poll() */
+typedef void (*disk_async_cb)(BYTE pdrv, DRESULT res, void* arg);
+
+DRESULT disk_read_async (BYTE pdrv, BYTE* buff, LBA_t sector, UINT count, disk_async_cb cb, void* arg);
+#if FF_FS_READONLY == 0
+DRESULT disk_write_async (BYTE pdrv, const BYTE* buff, LBA_t sector, UINT count, disk_async_cb cb, void* arg);
+#endif
+UINT disk_async_poll (BYTE pdrv);
+DRESULT disk_async_drain (BYTE pdrv);
+#endif
+
 
 /* Disk Status Bits (DSTATUS) */
 
@@ -223,6 +223,14 @@ typedef struct {
 #endif
 #if FF_USE_FASTSEEK
 	DWORD*	cltbl;			/* Pointer to the cluster link map table (nulled on open, set by application) */
+#if FF_FASTSEEK_AUTO_FRAGS
+	UINT	clmt_nfrag;		/* Number of fragments in the automatic link map (zeroed on open) */
+	DWORD	clmt_map[FF_FASTSEEK_AUTO_FRAGS * 2];	/* Automatic link map {end, top} per fragment, built on f_lseek() */
+#endif
+#endif
+#if FF_USE_EXPAND && !FF_FS_READONLY
+	DWORD	strm_scl;		/* Top cluster of the streaming block (valid when strm_ncl != 0) */
+	DWORD	strm_ncl;		/* Number of clusters in the streaming block (0:not streaming, zeroed on open) */
 #endif
 #if !FF_FS_TINY
 #ifdef __ICCARM__
@@ -314,6 +322,13 @@ typedef enum {
 } FRESULT;
 
 
+#if FF_USE_DISK_ASYNC
+/* Completion callback of f_read_async() */
+
+typedef void (*FF_ASYNC_CB)(FRESULT res, void* arg);
+#endif
+
+
 
 
 /*--------------------------------------------------------------*/
@@ -323,6 +338,9 @@ typedef enum {
 FRESULT f_open (FIL* fp, const TCHAR* path, BYTE mode);				/* Open or create a file */
 FRESULT f_close (FIL* fp);											/* Close an open file object */
 FRESULT f_read (FIL* fp, void* buff, UINT btr, UINT* br);			/* Read data from the file */
+#if FF_USE_DISK_ASYNC
+FRESULT f_read_async (FIL* fp, void* buff, UINT btr, UINT* br, FF_ASYNC_CB cb, void* arg);	/* Read data from the file in background */
+#endif
 FRESULT f_write (FIL* fp, const void* buff, UINT btw, UINT* bw);	/* Write data to the file */
 FRESULT f_lseek (FIL* fp, FSIZE_t ofs);								/* Move file pointer of the file object */
 FRESULT f_truncate (FIL* fp);										/* Truncate the file */
@@ -346,6 +364,7 @@ FRESULT f_getlabel (const TCHAR* path, TCHAR* label, DWORD* vsn);	/* Get volume
 FRESULT f_setlabel (const TCHAR* label);							/* Set volume label */
 FRESULT f_forward (FIL* fp, UINT(*func)(const BYTE*,UINT), UINT btf, UINT* bf);	/* Forward data to the stream */
 FRESULT f_expand (FIL* fp, FSIZE_t fsz, BYTE opt);					/* Allocate a contiguous block to the file */
+FRESULT f_stream (FIL* fp, FSIZE_t fsz);							/* Allocate a contiguous block and stream writes into it */
 FRESULT f_mount (FATFS* fs, const TCHAR* path, BYTE opt);			/* Mount/Unmount a logical drive */
 FRESULT f_mkfs (const TCHAR* path, const MKFS_PARM* opt, void* work, UINT len);	/* Create a FAT volume */
 FRESULT f_fdisk (BYTE pdrv, const LBA_t ptbl[], void* work);		/* Divide a physical drive into some partitions */
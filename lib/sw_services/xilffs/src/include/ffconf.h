@@ -68,12 +68,31 @@ extern "C" {
 /* This option switches f_mkfs() function. (0:Disable or 1:Enable) */
 
 
-#define FF_USE_FASTSEEK	0
+#ifdef FILE_SYSTEM_USE_FASTSEEK
+#define FF_USE_FASTSEEK	1	/* 1:Enable */
+#else
+#define FF_USE_FASTSEEK	0	/* 0:Disable */
+#endif
 /* This option switches fast seek function. (0:Disable or 1:Enable) */
 
+#ifdef FILE_SYSTEM_FASTSEEK_FRAGS
+#define FF_FASTSEEK_AUTO_FRAGS	FILE_SYSTEM_FASTSEEK_FRAGS
+#else
+#define FF_FASTSEEK_AUTO_FRAGS	16
+#endif
+/* When fast seek is enabled, f_lseek() builds the cluster link map of each file
+/  object automatically and grows it as far as the seek target, so no CLMT has to
+/  be supplied by the application. This option defines the number of fragments the
+/  map keeps in the FIL (8 bytes each); seeks beyond a full map follow the FAT from
+/  its last cluster. Set 0 to keep only the application supplied CLMT (FIL.cltbl). */
 
-#define FF_USE_EXPAND	0
-/* This option switches f_expand function. (0:Disable or 1:Enable) */
+
+#ifdef FILE_SYSTEM_USE_EXPAND
+#define FF_USE_EXPAND	1	/* 1:Enable */
+#else
+#define FF_USE_EXPAND	0	/* 0:Disable */
+#endif
+/* This option switches f_expand() and f_stream() functions. (0:Disable or 1:Enable) */
 
 
 #ifdef FILE_SYSTEM_USE_CHMOD
@@ -94,6 +113,55 @@ extern "C" {
 /* This option switches f_forward() function. (0:Disable or 1:Enable) */
 
 
+#ifdef FILE_SYSTEM_USE_CACHE
+#define FF_USE_DISK_CACHE	1	/* 1:Enable */
+#else
+#define FF_USE_DISK_CACHE	0	/* 0:Disable */
+#endif
+#ifdef FILE_SYSTEM_CACHE_SETS
+#define FF_DISK_CACHE_SETS	FILE_SYSTEM_CACHE_SETS
+#else
+#define FF_DISK_CACHE_SETS	16
+#endif
+#ifdef FILE_SYSTEM_CACHE_WAYS
+#define FF_DISK_CACHE_WAYS	FILE_SYSTEM_CACHE_WAYS
+#else
+#define FF_DISK_CACHE_WAYS	4
+#endif
+#ifdef FILE_SYSTEM_CACHE_LINE_SIZE
+#define FF_DISK_CACHE_SS	FILE_SYSTEM_CACHE_LINE_SIZE
+#else
+#define FF_DISK_CACHE_SS	FF_MAX_SS
+#endif
+/* FF_USE_DISK_CACHE switches the write-back sector cache in diskcache.c between
+/  FatFs and the media drivers. (0:Disable or 1:Enable)
+/  The cache is FF_DISK_CACHE_WAYS-way set associative with FF_DISK_CACHE_SETS
+/  sets (power of 2) and occupies FF_DISK_CACHE_SETS * FF_DISK_CACHE_WAYS *
+/  FF_DISK_CACHE_SS bytes of BSS. A line holds one sector of up to FF_DISK_CACHE_SS
+/  bytes (FF_MAX_SS by default). When UFS raises FF_MAX_SS to 4096 but the cached
+/  drives use 512 byte sectors, set it to 512 so that the lines are not 7/8 unused;
+/  drives with larger sectors then bypass the cache. Dirty sectors are written back
+/  on eviction and on CTRL_SYNC, i.e. f_sync() or f_close() must be called before the
+/  medium is removed. */
+
+
+#ifdef FILE_SYSTEM_USE_ASYNC
+#define FF_USE_DISK_ASYNC	1	/* 1:Enable */
+#else
+#define FF_USE_DISK_ASYNC	0	/* 0:Disable */
+#endif
+#ifdef FILE_SYSTEM_ASYNC_DEPTH
+#define FF_DISK_ASYNC_DEPTH	FILE_SYSTEM_ASYNC_DEPTH
+#else
+#define FF_DISK_ASYNC_DEPTH	8
+#endif
+/* FF_USE_DISK_ASYNC switches the asynchronous disk interface, disk_read_async(),
+/  disk_write_async(), disk_async_poll(), disk_async_drain() and f_read_async().
+/  (0:Disable or 1:Enable) Up to FF_DISK_ASYNC_DEPTH (1 to 32) requests are queued
+/  per drive; requests for consecutive sectors are chained into one ADMA2 transfer
+/  on SD. Other interfaces complete the requests synchronously. */
+
+
 #define FF_PRINT_LLI	1
 #define FF_PRINT_FLOAT	1
 #define FF_STRF_ENCODE	3
@@ -18,6 +18,15 @@ SET(XILFFS_set_fs_rpath	 0 CACHE STRING "Configures relative path feature (valid
 SET_PROPERTY(CACHE XILFFS_set_fs_rpath PROPERTY STRINGS 0 1 2)
 option(XILFFS_word_access "Enables word access for misaligned memory access platform" ON)
 option(XILFFS_use_chmod "Enables use of CHMOD functionality for changing attributes (valid only with read_only set to false)" OFF)
+option(XILFFS_use_cache "Enables the write-back sector cache between the file system and the SD/RAM interface" OFF)
+SET(XILFFS_cache_sets 16 CACHE STRING "Number of sets of the sector cache (power of 2)")
+SET(XILFFS_cache_ways 4 CACHE STRING "Number of ways of the sector cache")
+SET(XILFFS_cache_line_size 0 CACHE STRING "Size of a sector cache line in bytes (512 to 4096, power of 2; 0: maximum sector size). Drives with larger sectors are not cached")
+option(XILFFS_use_async "Enables the asynchronous disk interface with chained ADMA2 transfers on SD" OFF)
+SET(XILFFS_async_depth 8 CACHE STRING "Number of asynchronous requests queued per drive (1 to 32)")
+option(XILFFS_use_fastseek "Enables fast seek with a cluster link map built automatically by f_lseek" OFF)
+SET(XILFFS_fastseek_frags 16 CACHE STRING "Number of file fragments held in the automatic cluster link map of each open file (0: application supplied map only)")
+option(XILFFS_use_expand "Enables f_expand and f_stream functions for contiguous preallocation and streaming writes (valid only with read_only set to false)" OFF)
 SET(XILFFS_max_sector_size 4096 CACHE STRING "Maximum Sector size(valid values are 4096, 8192, 16384, 32768)")
 
 SET(XILFFS_ramfs_size 3145728 CACHE STRING "RAM FS size")
@@ -57,6 +66,39 @@ if (${XILFFS_fs_interface})
 	if (${XILFFS_use_trim})
 		set(FILE_SYSTEM_USE_TRIM " ")
 	endif()
+	if (${XILFFS_use_cache})
+		set(FILE_SYSTEM_USE_CACHE " ")
+		set(FILE_SYSTEM_CACHE_SETS ${XILFFS_cache_sets})
+		set(FILE_SYSTEM_CACHE_WAYS ${XILFFS_cache_ways})
+		if (NOT ${XILFFS_cache_line_size} EQUAL 0)
+			set(FILE_SYSTEM_CACHE_LINE_SIZE ${XILFFS_cache_line_size})
+		endif()
+	endif()
+	if (${XILFFS_use_async})
+		set(FILE_SYSTEM_USE_ASYNC " ")
+		if ((${XILFFS_async_depth} LESS 1) OR (${XILFFS_async_depth} GREATER 32))
+			message("WARNING : Invalid async depth, setting back to 8\n")
+			set(FILE_SYSTEM_ASYNC_DEPTH 8)
+		else()
+			set(FILE_SYSTEM_ASYNC_DEPTH ${XILFFS_async_depth})
+		endif()
+	endif()
+	if (${XILFFS_use_fastseek})
+		set(FILE_SYSTEM_USE_FASTSEEK " ")
+		if (${XILFFS_fastseek_frags} EQUAL 0)
+			# Plain 0 would leave the #cmakedefine undefined
+			set(FILE_SYSTEM_FASTSEEK_FRAGS 0U)
+		else()
+			set(FILE_SYSTEM_FASTSEEK_FRAGS ${XILFFS_fastseek_frags})
+		endif()
+	endif()
+	if (${XILFFS_use_expand})
+		if (${XILFFS_read_only})
+			message("WARNING : Cannot Enable EXPAND in read only mode\n")
+		else()
+			set(FILE_SYSTEM_USE_EXPAND " ")
+		endif()
+	endif()
 	if (${XILFFS_use_chmod})
 		if (${XILFFS_read_only})
 			message("WARNING : Cannot Enable CHMOD in read only mode\n")
@@ -19,6 +19,7 @@
  *       har  03/05/24 Fixed doxygen warnings
  *       pre  08/22/24 Added XLoader_CfiSelectiveReadback, XLoader_InputSlrIndex functions
  *       pre  10/26/24 Removed XLoader_LoadReadBackPdi API
+ *       sb   10/16/26 Added XLoader_GetBootProfile
  *
  * </pre>
  *
@@ -467,6 +468,57 @@ END:
 	return Status;
 }
 
+/*************************************************************************************************/
+/**
+ * @brief	This function sends IPI request to get the boot time profile. The buffer is filled
+ *		with XLoader_BootProfEntry entries, one per loaded partition and image handoff.
+ *
+ * @param	InstancePtr Pointer to the client instance.
+ * @param	BuffAddr	Address to store the profile entries.
+ * @param	Size		Maximum number of bytes that can be stored in the buffer, 0 to only
+ *				print or clear the profile.
+ * @param	Flags		XLOADER_BOOT_PROF_FLAG_PRINT to also print the profile to the PLM
+ *				log, XLOADER_BOOT_PROF_FLAG_CLEAR to clear it afterwards.
+ * @param	NumEntries	To get the number of entries stored in the buffer.
+ *
+ * @return
+ *			 - XST_SUCCESS on success.
+ *			 - XST_FAILURE on failure.
+ *
+ **************************************************************************************************/
+int XLoader_GetBootProfile(XLoader_ClientInstance *InstancePtr, u64 BuffAddr, u32 Size,
+		u32 Flags, u32 *NumEntries)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Payload[XMAILBOX_PAYLOAD_LEN_5U];
+
+    /**
+	 * - Performs input parameters validation. Return error code if input parameters are invalid
+	 */
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) || (NumEntries == NULL)) {
+		goto END;
+	}
+
+	Payload[0U] = PACK_XLOADER_HEADER(XLOADER_HEADER_LEN_4,
+					(u32)XLOADER_CMD_ID_GET_BOOT_PROFILE);
+	Payload[1U] = (u32)(BuffAddr >> XLOADER_ADDR_HIGH_SHIFT);
+	Payload[2U] = (u32)(BuffAddr);
+	Payload[3U] = Size;
+	Payload[4U] = Flags;
+
+	/**
+	 * - Send an IPI request to the PLM by using the XLoader_GetBootProfile CDO command
+	 * Wait for IPI response from PLM with a timeout.
+	 * - If the timeout exceeds then error is returned otherwise it returns the status of the IPI
+	 * response.
+	 */
+	Status = XLoader_ProcessMailbox(InstancePtr, Payload, sizeof(Payload) / sizeof(u32));
+	*NumEntries = InstancePtr->Response[1];
+
+END:
+	return Status;
+}
+
 /*************************************************************************************************/
 /**
  * @brief	This function sends IPI request to read selective frames from configuration memory
@@ -19,6 +19,7 @@
  *       har  03/05/24 Fixed doxygen warnings
  *       pre  08/22/24 Added XLoader_CfiSelectiveReadback, XLoader_InputSlrIndex functions
  *       pre  10/26/24 Removed XLoader_LoadReadBackPdi API
+ *       sb   10/16/26 Added XLoader_GetBootProfile
  *
  * </pre>
  *
@@ -110,6 +111,8 @@ int XLoader_CfiSelectiveReadback(XLoader_ClientInstance *InstancePtr,
 int XLoader_InputSlrIndex(XLoader_ClientInstance *InstancePtr, u32 SlrIndex);
 int XLoader_GetOptionalData(XLoader_ClientInstance *InstancePtr,
 		const XLoader_OptionalDataInfo* OptionalDataInfo, u64 DestAddr, u32 *DestSize);
+int XLoader_GetBootProfile(XLoader_ClientInstance *InstancePtr, u64 BuffAddr, u32 Size,
+		u32 Flags, u32 *NumEntries);
 
 /************************************ Variable Definitions ***************************************/
 
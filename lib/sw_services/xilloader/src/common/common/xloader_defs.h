@@ -19,6 +19,7 @@
  *       har  03/05/24 Fixed doxygen warnings
  *       pre  08/22/24 Added XLOADER_CFI_SEL_READBACK_ID
  *       pre  10/26/24 Made XLOADER_CMD_ID_LOAD_READBACK_PDI command ID as reserved
+ *       sb   10/16/26 Added XLOADER_CMD_ID_GET_BOOT_PROFILE and boot profile entry
  *
  * </pre>
  *
@@ -63,6 +64,7 @@ extern "C" {
 #define XLOADER_CMD_ID_DATA_AUTH		        (17U) /**< API ID for Data authentication */
 #endif
 #define XLOADER_CFI_SEL_READBACK_ID             (18U) /**< command id for CFI selective readback */
+#define XLOADER_CMD_ID_GET_BOOT_PROFILE         (19U) /**< command id for get boot profile */
 
 #define XLOADER_HEADER_LEN_1			(1U) /**< Header length 1 */
 #define XLOADER_HEADER_LEN_2			(2U) /**< Header length 2 */
@@ -91,6 +93,26 @@ extern "C" {
 #define XLOADER_DATA_ID_SHIFT			(16U)
 	/**< Shift to get data ID from the payload of Extract metaheader command */
 
+/**
+ * @name Boot profile
+ * @{
+ */
+/**< Stages of a boot profile entry, in the order of its Time array */
+#define XLOADER_BOOT_PROF_STAGE_OTHER		(0U) /**< Time not in the other stages */
+#define XLOADER_BOOT_PROF_STAGE_DEV_READ	(1U) /**< Waiting for boot device reads */
+#define XLOADER_BOOT_PROF_STAGE_AUTH		(2U) /**< Authentication and hash checks */
+#define XLOADER_BOOT_PROF_STAGE_DECRYPT		(3U) /**< Decryption */
+#define XLOADER_BOOT_PROF_STAGE_CDO		(4U) /**< CDO processing */
+#define XLOADER_BOOT_PROF_STAGE_HANDOFF		(5U) /**< Image handoff */
+#define XLOADER_BOOT_PROF_STAGES		(6U) /**< Number of stages */
+#define XLOADER_BOOT_PROF_HANDOFF_PRTN_ID	(0xFFFFFFFFU)
+	/**< Partition ID of the entries that time the handoff of an image */
+#define XLOADER_BOOT_PROF_FLAG_PRINT		(0x1U)
+	/**< Flag to print the boot profile to the PLM log */
+#define XLOADER_BOOT_PROF_FLAG_CLEAR		(0x2U)
+	/**< Flag to clear the boot profile once it is read */
+/** @} */
+
 /************************************** Type Definitions *****************************************/
 
 typedef struct {
@@ -108,6 +130,13 @@ typedef struct {
 	u32 PdiId;		/**< PDI ID of the PDI in Image Store */
 } XLoader_OptionalDataInfo;
 
+typedef struct {
+	u32 ImgId; /**< Image ID */
+	u32 PrtnId; /**< Partition ID, XLOADER_BOOT_PROF_HANDOFF_PRTN_ID for a handoff */
+	u32 Size; /**< Partition size in bytes */
+	u32 TimeUs[XLOADER_BOOT_PROF_STAGES]; /**< Time spent in each stage in us */
+} XLoader_BootProfEntry; /**< Boot profile entry of a partition or an image handoff */
+
 /*************************** Macros (Inline Functions) Definitions *******************************/
 
 /************************************ Function Prototypes ****************************************/
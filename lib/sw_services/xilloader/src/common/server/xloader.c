@@ -177,6 +177,8 @@
 *       mb   08/10/2024 Added support for loading cdo after secure boot.
 *       pre  10/03/2024 Clearing GSW error after PDI loading
 *       obs  09/30/2024 Fixed Doxygen Warnings
+*       sb   10/16/2026 Added boot time profiling of device reads and
+*                       image handoff
 *
 * </pre>
 *
@@ -214,6 +216,7 @@
 #include "xplmi_wdt.h"
 #include "xloader_plat.h"
 #include "xplmi_err.h"
+#include "xloader_boot_prof.h"
 #ifdef VERSAL_NET
 #include "xocp_keymgmt.h"
 #endif
@@ -484,7 +487,8 @@ int XLoader_PdiInit(XilPdi* PdiPtr, PdiSrc_t PdiSource, u64 PdiAddr)
 	/**
 	 * - Get the device copy function for the given boot mode.
 	 */
-	PdiPtr->MetaHdr.DeviceCopy = DeviceOps[PdiPtr->PdiIndex].Copy;
+	PdiPtr->MetaHdr.DeviceCopy =
+		XLoader_BootProfWrapCopy(DeviceOps[PdiPtr->PdiIndex].Copy);
 
 	PdiPtr->MetaHdr.DmaCopy = XPlmi_MemCpy64;
 
@@ -988,7 +992,11 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 			continue;
 		}
 
+		XLoader_BootProfStart(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID,
+			XLOADER_BOOT_PROF_HANDOFF_PRTN_ID, 0U,
+			XLOADER_BOOT_PROF_STAGE_HANDOFF);
 		Status = XLoader_StartImage(PdiPtr);
+		XLoader_BootProfEnd();
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
@@ -1011,7 +1019,11 @@ static int XLoader_LoadAndStartSubSystemImages(XilPdi *PdiPtr)
 			PdiPtr->PrtnNum++;
 		}
 
+		XLoader_BootProfStart(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID,
+			XLOADER_BOOT_PROF_HANDOFF_PRTN_ID, 0U,
+			XLOADER_BOOT_PROF_STAGE_HANDOFF);
 		Status = XLoader_StartImage(PdiPtr);
+		XLoader_BootProfEnd();
 		if (Status != XST_SUCCESS) {
 			goto END;
 		}
@@ -1648,7 +1660,11 @@ int XLoader_RestartImage(u32 ImageId, u32 *FuncID)
 			goto END1;
 		}
 
+		XLoader_BootProfStart(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID,
+			XLOADER_BOOT_PROF_HANDOFF_PRTN_ID, 0U,
+			XLOADER_BOOT_PROF_STAGE_HANDOFF);
 		Status = XLoader_StartImage(PdiPtr);
+		XLoader_BootProfEnd();
 END1:
 		if (Status != XST_SUCCESS) {
 			if ((Status != (int)XLOADER_ERR_IMG_ID_NOT_FOUND) &&
@@ -1687,7 +1703,11 @@ END1:
 		goto END;
 	}
 
+	XLoader_BootProfStart(PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID,
+		XLOADER_BOOT_PROF_HANDOFF_PRTN_ID, 0U,
+		XLOADER_BOOT_PROF_STAGE_HANDOFF);
 	Status = XLoader_StartImage(PdiPtr);
+	XLoader_BootProfEnd();
 
 END:
 	SStatus = XLoader_ClearKeys(PdiPtr);
@@ -1754,7 +1774,8 @@ END:
 	}
 	PdiPtr->PdiSrc = PdiSrc;
 	PdiPtr->PdiIndex = PdiIndex;
-	PdiPtr->MetaHdr.DeviceCopy = DeviceOps[PdiPtr->PdiIndex].Copy;
+	PdiPtr->MetaHdr.DeviceCopy =
+		XLoader_BootProfWrapCopy(DeviceOps[PdiPtr->PdiIndex].Copy);
 	PdiPtr->PdiType = PdiType;
 #ifndef PLM_DEBUG_MODE
 	SStatus = XPlmi_MemSet(XPLMI_PMCRAM_CHUNK_MEMORY, XPLMI_DATA_INIT_PZM,
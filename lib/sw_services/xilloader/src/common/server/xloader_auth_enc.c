@@ -137,6 +137,10 @@
 *       kal  07/24/24 Code refactoring and updates for versal_aiepg2
 *       kal  09/18/24 Updated XLoader_PpkVerify to verify 384 bit ppk hash
 *                     for Versal_AiePg2
+*       sb   10/16/26 Keep the verified first block hash of CDO partitions
+*                     as the CDO cache key
+*       sb   10/16/26 Copy authenticated chunks to destination without blocking
+*       sb   10/16/26 Added decryption time to the boot profile
 *
 * </pre>
 *
@@ -168,6 +172,7 @@
 #include "xloader_plat_secure.h"
 #include "xloader_plat.h"
 #include "xplmi_config.h"
+#include "xloader_boot_prof.h"
 #ifdef VERSAL_AIEPG2
 #include "xsecure_lms_core.h"
 #include "xsecure_plat_kat.h"
@@ -3508,14 +3513,9 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 		if (((SecurePtr->IsEncrypted != (u8)TRUE) &&
 			(SecureTempParams->IsEncrypted != (u8)TRUE)) &&
 			(SecurePtr->IsCdo != (u8)TRUE)) {
-			/* Copy to destination address */
-			Status = XPlmi_DmaXfr((u64)SecurePtr->SecureData,
-					(u64)DestAddr,
-					SecurePtr->SecureDataLen >> XPLMI_WORD_LEN_SHIFT,
-					XPLMI_PMCDMA_0);
+			/* Copy to destination address, overlapping the next read */
+			Status = XLoader_SecureDestCopy(SecurePtr, DestAddr);
 			if (Status != XST_SUCCESS) {
-				Status = XPlmi_UpdateStatus(
-						XLOADER_ERR_DMA_TRANSFER, Status);
 				goto END;
 			}
 		}
@@ -3551,10 +3551,12 @@ int XLoader_ProcessAuthEncPrtn(XLoader_SecureParams *SecurePtr, u64 DestAddr,
 		else {
 			OutAddr = SecurePtr->SecureData;
 		}
+		XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_DECRYPT);
 		Status = XLoader_AesDecryption(SecurePtr,
 					SecurePtr->SecureData,
 					OutAddr,
 					SecurePtr->SecureDataLen);
+		XLoader_BootProfExit();
 		if (Status != XST_SUCCESS) {
 			Status = XPlmi_UpdateStatus(
 					XLOADER_ERR_PRTN_DECRYPT_FAIL, Status);
@@ -5650,6 +5652,21 @@ static int XLoader_VerifyAuthHashNUpdateNext(XLoader_SecureParams *SecurePtr, u3
 		}
 	}
 
+#ifdef PLM_CDO_CACHE
+	/**
+	 * The verified hash of the first block covers the whole chain of
+	 * blocks, keep it to look up the pre-decoded commands of the CDO
+	 */
+	if ((SecurePtr->BlockNum == 0x00U) && (SecurePtr->IsCdo == (u8)TRUE)) {
+		Status = Xil_SMemCpy(SecurePtr->CdoCacheKey, XLOADER_SHA3_LEN,
+				BlkHash.Hash, XLOADER_SHA3_LEN, XLOADER_SHA3_LEN);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		SecurePtr->IsCdoCacheKeyValid = (u8)TRUE;
+	}
+#endif
+
 	/** Update the next expected hash and data location */
 	if (Last != (u8)TRUE) {
 		Status = Xil_SMemCpy(ExpHash, XLOADER_SHA3_LEN,
@@ -62,6 +62,8 @@
 *       har  03/05/24 Fixed doxygen warnings
 *       kpt  03/15/24 Updated RSA KAT to use 2048-bit key
 *       obs  09/30/2024 Fixed Doxygen Warnings
+*       sb   10/16/2026 Added CDO cache key to XLoader_SecureParams
+*       sb   10/16/2026 Added IsDestCopyStarted to XLoader_SecureParams
 *
 * </pre>
 *
@@ -585,6 +587,7 @@ typedef struct {
 typedef struct XLoader_SecureParams {
 	volatile u8 SecureEn;	/**< Security enabled or disabled */
 	u8 IsNextChunkCopyStarted;	/**< Next chunk copy started or not */
+	u8 IsDestCopyStarted;	/**< Destination copy started or not */
 	u8 IsCheckSumEnabled;	/**< Checksum enabled or disabled */
 	u8 IsCdo; /**< CDO or Elf */
 	XilPdi *PdiPtr;		/**< PDI pointer */
@@ -618,6 +621,11 @@ typedef struct XLoader_SecureParams {
 	u8 IsEncrypted;		/**< Encryption enabled or disabled */
 	u8 IsAuthenticated;	/**< Authentication enabled or disabled */
 	u32 NoLoad;		/**< No Load */
+#ifdef PLM_CDO_CACHE
+	u32 CdoCacheKey[XLOADER_SHA3_LEN / 4U];	/**< Verified hash of the first
+						  block, keys the CDO cache */
+	u8 IsCdoCacheKeyValid;	/**< CDO cache key is set */
+#endif
 #endif
 	XSecure_ShaMode SignHashAlgo; /**< Hash algorithm used for signature */
 	u32 HashDigestLen; /**< Hash output size in bytes */
@@ -0,0 +1,331 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xloader_boot_prof.c
+*
+* This file contains the boot time profiling table of the xilloader. Each
+* loaded partition gets one entry which splits the time spent on it into
+* device read, authentication, decryption, CDO processing and other stages.
+* Stages nest (e.g. a device read issued while authenticating), so time is
+* always charged to the innermost active stage only and the stage times of
+* an entry add up to its total.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/2026 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include "xloader_boot_prof.h"
+
+#ifdef PLM_BOOT_PROFILE
+#include "xplmi_debug.h"
+#include "xplmi_dma.h"
+#include "xplmi_proc.h"
+
+/************************** Constant Definitions *****************************/
+
+/**************************** Type Definitions *******************************/
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+static void XLoader_BootProfCharge(void);
+static int XLoader_BootProfCopy(u64 SrcAddr, u64 DestAddr, u32 Length,
+	u32 Flags);
+
+/************************** Variable Definitions *****************************/
+static XLoader_BootProfEntry BootProfTbl[XLOADER_BOOT_PROF_MAX_ENTRIES];
+static u32 BootProfCnt; /**< Valid entries in BootProfTbl */
+static u32 BootProfDropped; /**< Entries lost after the table was full */
+static XLoader_BootProfEntry BootProfCur; /**< Entry being measured */
+static u64 BootProfCycles[XLOADER_BOOT_PROF_STAGES];
+static u32 BootProfStack[XLOADER_BOOT_PROF_MAX_DEPTH];
+static u32 BootProfDepth; /**< 0 when no entry is being measured */
+static u32 BootProfOverflow; /**< Stages entered beyond the maximum depth */
+static u64 BootProfLastTime;
+static XLoader_BootProfCopyFn BootProfDevCopy;
+
+/*****************************************************************************/
+/**
+ * @brief	This function charges the time elapsed since the last stage
+ *		change to the innermost active stage.
+ *
+ *****************************************************************************/
+static void XLoader_BootProfCharge(void)
+{
+	u64 Now = XPlmi_GetTimerValue();
+
+	/* PMC PIT counts down */
+	BootProfCycles[BootProfStack[BootProfDepth - 1U]] +=
+		BootProfLastTime - Now;
+	BootProfLastTime = Now;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts a new profile entry. An entry which is
+ *		still open is closed first.
+ *
+ * @param	ImgId is the image ID the entry belongs to
+ * @param	PrtnId is the partition ID or XLOADER_BOOT_PROF_HANDOFF_PRTN_ID
+ * @param	Size is the partition length in bytes
+ * @param	Stage is the stage which is charged when no other is active
+ *
+ *****************************************************************************/
+void XLoader_BootProfStart(u32 ImgId, u32 PrtnId, u32 Size, u32 Stage)
+{
+	u32 Index;
+
+	if (BootProfDepth != 0U) {
+		XLoader_BootProfEnd();
+	}
+
+	BootProfCur.ImgId = ImgId;
+	BootProfCur.PrtnId = PrtnId;
+	BootProfCur.Size = Size;
+	for (Index = 0U; Index < XLOADER_BOOT_PROF_STAGES; ++Index) {
+		BootProfCycles[Index] = 0U;
+	}
+	BootProfStack[0U] = Stage;
+	BootProfDepth = 1U;
+	BootProfOverflow = 0U;
+	BootProfLastTime = XPlmi_GetTimerValue();
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function closes the current profile entry and stores it
+ *		in the profile table.
+ *
+ *****************************************************************************/
+void XLoader_BootProfEnd(void)
+{
+	u32 Index;
+	u32 PmcIroFreqMHz = *XPlmi_GetPmcIroFreq() / XPLMI_MEGA;
+
+	if (BootProfDepth == 0U) {
+		goto END;
+	}
+
+	XLoader_BootProfCharge();
+	BootProfDepth = 0U;
+	if (BootProfCnt >= XLOADER_BOOT_PROF_MAX_ENTRIES) {
+		++BootProfDropped;
+		goto END;
+	}
+
+	for (Index = 0U; Index < XLOADER_BOOT_PROF_STAGES; ++Index) {
+		BootProfCur.TimeUs[Index] =
+			(u32)(BootProfCycles[Index] / PmcIroFreqMHz);
+	}
+	BootProfTbl[BootProfCnt] = BootProfCur;
+	++BootProfCnt;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function makes the given stage the active stage of the
+ *		current entry until the matching XLoader_BootProfExit.
+ *
+ * @param	Stage is the stage being entered
+ *
+ *****************************************************************************/
+void XLoader_BootProfEnter(u32 Stage)
+{
+	if (BootProfDepth == 0U) {
+		goto END;
+	}
+	if (BootProfDepth == XLOADER_BOOT_PROF_MAX_DEPTH) {
+		++BootProfOverflow;
+		goto END;
+	}
+
+	XLoader_BootProfCharge();
+	BootProfStack[BootProfDepth] = Stage;
+	++BootProfDepth;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function leaves the stage entered last and makes the
+ *		enclosing stage active again.
+ *
+ *****************************************************************************/
+void XLoader_BootProfExit(void)
+{
+	if (BootProfDepth <= 1U) {
+		goto END;
+	}
+	if (BootProfOverflow != 0U) {
+		--BootProfOverflow;
+		goto END;
+	}
+
+	XLoader_BootProfCharge();
+	--BootProfDepth;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is the device copy installed by
+ *		XLoader_BootProfWrapCopy. It charges the copy to device read.
+ *
+ * @param	SrcAddr is the source address in the boot device
+ * @param	DestAddr is the destination address
+ * @param	Length is the number of bytes to copy
+ * @param	Flags are the device copy flags
+ *
+ * @return
+ * 		- Status of the wrapped device copy
+ *
+ *****************************************************************************/
+static int XLoader_BootProfCopy(u64 SrcAddr, u64 DestAddr, u32 Length,
+	u32 Flags)
+{
+	int Status = XST_FAILURE;
+
+	XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_DEV_READ);
+	Status = BootProfDevCopy(SrcAddr, DestAddr, Length, Flags);
+	XLoader_BootProfExit();
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns a device copy function which charges the
+ *		time spent in CopyFn to the device read stage.
+ *		Every PDI load starts with XLoader_PdiInit which wraps the
+ *		device copy again, so the function wrapped last is always the
+ *		one of the PDI being loaded.
+ *
+ * @param	CopyFn is the boot device copy function
+ *
+ * @return
+ * 		- Device copy function to be used in place of CopyFn
+ *
+ *****************************************************************************/
+XLoader_BootProfCopyFn XLoader_BootProfWrapCopy(XLoader_BootProfCopyFn CopyFn)
+{
+	XLoader_BootProfCopyFn Copy = CopyFn;
+
+	if (CopyFn != NULL) {
+		BootProfDevCopy = CopyFn;
+		Copy = XLoader_BootProfCopy;
+	}
+
+	return Copy;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function copies the profile table to the given address.
+ *		Only as many entries as fit in MaxSize are copied.
+ *
+ * @param	DestAddr is the destination address
+ * @param	MaxSize is the size of the destination buffer in bytes
+ * @param	NumEntries is updated with the number of entries copied
+ *
+ * @return
+ * 		- XST_SUCCESS on success
+ * 		- Error code of XPlmi_MemCpy64 on failure
+ *
+ *****************************************************************************/
+int XLoader_BootProfGet(u64 DestAddr, u32 MaxSize, u32 *NumEntries)
+{
+	int Status = XST_FAILURE;
+	u32 Cnt = MaxSize / (u32)sizeof(XLoader_BootProfEntry);
+
+	if (Cnt > BootProfCnt) {
+		Cnt = BootProfCnt;
+	}
+	*NumEntries = 0U;
+	if (Cnt == 0U) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	Status = XPlmi_MemCpy64(DestAddr, (u64)(UINTPTR)BootProfTbl,
+		Cnt * (u32)sizeof(XLoader_BootProfEntry));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	*NumEntries = Cnt;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the profile table, one line per entry.
+ *		Lines start with "BootProf:" so that boot logs can be compared
+ *		with the boot_prof_diff host tool.
+ *
+ * @param	DebugType is the debug level the table is printed at
+ *
+ *****************************************************************************/
+void XLoader_BootProfPrint(u16 DebugType)
+{
+	u32 Index;
+	u32 Stage;
+	u32 Total;
+	const XLoader_BootProfEntry *Entry;
+
+	for (Index = 0U; Index < BootProfCnt; ++Index) {
+		Entry = &BootProfTbl[Index];
+		Total = 0U;
+		for (Stage = 0U; Stage < XLOADER_BOOT_PROF_STAGES; ++Stage) {
+			Total += Entry->TimeUs[Stage];
+		}
+		XPlmi_Printf(DebugType, "BootProf: Img 0x%08x Prtn 0x%08x "
+			"Size %u Total %u DevRead %u Auth %u Decrypt %u Cdo %u "
+			"Handoff %u Other %u\n\r", Entry->ImgId, Entry->PrtnId,
+			Entry->Size, Total,
+			Entry->TimeUs[XLOADER_BOOT_PROF_STAGE_DEV_READ],
+			Entry->TimeUs[XLOADER_BOOT_PROF_STAGE_AUTH],
+			Entry->TimeUs[XLOADER_BOOT_PROF_STAGE_DECRYPT],
+			Entry->TimeUs[XLOADER_BOOT_PROF_STAGE_CDO],
+			Entry->TimeUs[XLOADER_BOOT_PROF_STAGE_HANDOFF],
+			Entry->TimeUs[XLOADER_BOOT_PROF_STAGE_OTHER]);
+	}
+	if (BootProfDropped != 0U) {
+		XPlmi_Printf(DebugType, "BootProf: %u entries dropped\n\r",
+			BootProfDropped);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the profile table.
+ *
+ *****************************************************************************/
+void XLoader_BootProfClear(void)
+{
+	BootProfCnt = 0U;
+	BootProfDropped = 0U;
+}
+#endif /* PLM_BOOT_PROFILE */
@@ -0,0 +1,76 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xloader_boot_prof.h
+*
+* This is the header file which contains the boot time profiling
+* declarations for the xilloader.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/2026 Initial release
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+#ifndef XLOADER_BOOT_PROF_H
+#define XLOADER_BOOT_PROF_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+#include "xplmi_config.h"
+#include "xloader_defs.h"
+
+/************************** Constant Definitions *****************************/
+#define XLOADER_BOOT_PROF_MAX_ENTRIES	(32U) /**< Entries in profile table */
+#define XLOADER_BOOT_PROF_MAX_DEPTH	(4U) /**< Nested stage depth */
+
+/**************************** Type Definitions *******************************/
+/* Device copy function, same signature as XilPdi_MetaHdr DeviceCopy */
+typedef int (*XLoader_BootProfCopyFn)(u64 SrcAddr, u64 DestAddr, u32 Length,
+	u32 Flags);
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#ifndef PLM_BOOT_PROFILE
+#define XLoader_BootProfStart(ImgId, PrtnId, Size, Stage)
+#define XLoader_BootProfEnd()
+#define XLoader_BootProfEnter(Stage)
+#define XLoader_BootProfExit()
+#define XLoader_BootProfWrapCopy(CopyFn)	(CopyFn)
+#define XLoader_BootProfPrint(DebugType)
+#endif
+
+/************************** Function Prototypes ******************************/
+#ifdef PLM_BOOT_PROFILE
+void XLoader_BootProfStart(u32 ImgId, u32 PrtnId, u32 Size, u32 Stage);
+void XLoader_BootProfEnd(void);
+void XLoader_BootProfEnter(u32 Stage);
+void XLoader_BootProfExit(void);
+XLoader_BootProfCopyFn XLoader_BootProfWrapCopy(XLoader_BootProfCopyFn CopyFn);
+int XLoader_BootProfGet(u64 DestAddr, u32 MaxSize, u32 *NumEntries);
+void XLoader_BootProfPrint(u16 DebugType);
+void XLoader_BootProfClear(void);
+#endif
+
+/************************** Variable Definitions *****************************/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif  /* XLOADER_BOOT_PROF_H */
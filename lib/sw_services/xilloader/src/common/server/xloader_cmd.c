@@ -88,6 +88,7 @@
 *       sk   03/13/24 Fixed doxygen comments format
 *       pre  08/22/2024 Additions for XLoader_CfiSelectiveRead
 *       pre  10/26/2024 Removed XLoader_LoadReadBackPdi
+*       sb   10/16/2026 Added XLoader_GetBootProfile command
 *
 * </pre>
 *
@@ -116,6 +117,7 @@
 #include "xloader_defs.h"
 #include "xloader_auth_enc.h"
 #include "xloader_secure.h"
+#include "xloader_boot_prof.h"
 #if (!defined(VERSAL_NET) && !defined(VERSAL_AIEPG2))
 #include "xplmi_ssit.h"
 #endif
@@ -164,6 +166,11 @@ static XPlmi_Module XPlmi_Loader;
 #define XLOADER_RESP_CMD_GET_IMG_INFO_LIST_NUM_ENTRIES_INDEX	(1U)
 #define XLOADER_RESP_CMD_EXTRACT_METAHDR_SIZE_INDEX	(1U)
 #define XLOADER_RESP_CMD_GET_HANDOFF_PARAM_SIZE_INDEX	(1U)
+#define XLOADER_CMD_GET_BOOT_PROF_DESTADDR_HIGH_INDEX	(0U)
+#define XLOADER_CMD_GET_BOOT_PROF_DESTADDR_LOW_INDEX	(1U)
+#define XLOADER_CMD_GET_BOOT_PROF_MAXLEN_INDEX		(2U)
+#define XLOADER_CMD_GET_BOOT_PROF_FLAGS_INDEX		(3U)
+#define XLOADER_RESP_CMD_GET_BOOT_PROF_NUM_ENTRIES_INDEX	(1U)
 #define XLOADER_CMD_MULTIBOOT_PDISRC_MASK		(0xFF00U)
 #define XLOADER_CMD_MULTIBOOT_FLASHTYPE_MASK		(0xFU)
 #define XLOADER_CMD_MULTIBOOT_PDISRC_SHIFT		(8U)
@@ -1221,6 +1228,70 @@ END:
 }
 #endif
 
+#ifdef PLM_BOOT_PROFILE
+/*****************************************************************************/
+/**
+ * @brief	This function copies the boot profile table to the given
+ *		address, and prints or clears it as requested.
+ *
+ *  Command payload parameters are:
+ *	- Destination Buffer High Address
+ *	- Destination Buffer Low Address
+ *	- Destination Buffer Size, 0 to skip the copy
+ *	- Flags (XLOADER_BOOT_PROF_FLAG_PRINT, XLOADER_BOOT_PROF_FLAG_CLEAR)
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XLOADER_ERR_INVALID_BOOT_PROF_DEST on invalid destination
+ * 			address.
+ *
+ *****************************************************************************/
+static int XLoader_GetBootProfile(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	u64 DestAddr = ((u64)Cmd->Payload[XLOADER_CMD_GET_BOOT_PROF_DESTADDR_HIGH_INDEX]
+		<< 32U) | Cmd->Payload[XLOADER_CMD_GET_BOOT_PROF_DESTADDR_LOW_INDEX];
+	u32 MaxSize = Cmd->Payload[XLOADER_CMD_GET_BOOT_PROF_MAXLEN_INDEX];
+	u32 Flags = Cmd->Payload[XLOADER_CMD_GET_BOOT_PROF_FLAGS_INDEX];
+	u32 NumEntries = 0U;
+
+	XPLMI_EXPORT_CMD(XLOADER_CMD_ID_GET_BOOT_PROFILE, XPLMI_MODULE_LOADER_ID,
+		XPLMI_CMD_ARG_CNT_FOUR, XPLMI_CMD_ARG_CNT_FOUR);
+
+	if (MaxSize != 0U) {
+		/** Verify destination address and the size */
+		Status = XPlmi_VerifyAddrRange(DestAddr, (DestAddr + MaxSize - 1U));
+		if (Status != XST_SUCCESS) {
+			Status = XLOADER_ERR_INVALID_BOOT_PROF_DEST;
+			goto END;
+		}
+		Status = XLoader_BootProfGet(DestAddr, MaxSize, &NumEntries);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	if ((Flags & XLOADER_BOOT_PROF_FLAG_PRINT) != 0U) {
+		XLoader_BootProfPrint(DEBUG_PRINT_ALWAYS);
+	}
+	if ((Flags & XLOADER_BOOT_PROF_FLAG_CLEAR) != 0U) {
+		XLoader_BootProfClear();
+	}
+	Status = XST_SUCCESS;
+
+END:
+	Cmd->Response[XLOADER_RESP_CMD_EXEC_STATUS_INDEX] = (u32)Status;
+	Cmd->Response[XLOADER_RESP_CMD_GET_BOOT_PROF_NUM_ENTRIES_INDEX] =
+		NumEntries;
+
+	return Status;
+}
+#else
+#define XLoader_GetBootProfile NULL /**< Boot profiling is disabled */
+#endif
+
 /**
  * @{
  * @cond xloader_internal
@@ -1252,6 +1323,7 @@ static const XPlmi_ModuleCmd XLoader_Cmds[] =
     XPLMI_MODULE_COMMAND(XLoader_MbPmcI2cHandshake),
 	XPLMI_MODULE_COMMAND(XLoader_VerifyDataAuth),
 	XPLMI_MODULE_COMMAND(XLoader_CfiSelectiveRead),
+	XPLMI_MODULE_COMMAND(XLoader_GetBootProfile),
 };
 
 /*****************************************************************************/
@@ -1288,6 +1360,11 @@ static XPlmi_AccessPerm_t XLoader_AccessPermBuff[XPLMI_ARRAY_SIZE(XLoader_Cmds)]
 #endif
 	XPLMI_ALL_IPI_NO_ACCESS(XLOADER_CMD_ID_I2C_HANDSHAKE),
     XPLMI_ALL_IPI_FULL_ACCESS(XLOADER_CFI_SEL_READBACK_ID),
+#ifdef PLM_BOOT_PROFILE
+	XPLMI_ALL_IPI_FULL_ACCESS(XLOADER_CMD_ID_GET_BOOT_PROFILE),
+#else
+	XPLMI_ALL_IPI_NO_ACCESS(XLOADER_CMD_ID_GET_BOOT_PROFILE),
+#endif
 };
 
 #if (!defined(VERSAL_NET) && !defined(VERSAL_AIEPG2))
@@ -42,6 +42,9 @@
 *       sk   02/26/2024 Added support for Infineon OSPI flash part
 *       ng   03/05/2024 Added support for Macronix OSPI 2G flash part
 *       sk   03/16/2024 Added support for Spansion Die config
+*       sb   10/16/2026 Reuse tuned DLL taps across OSPI inits and added
+*                       sequential read prefetch
+*       sb   10/16/2026 Reuse DLL taps only with PLM_OSPI_DLL_CACHE
 *
 * </pre>
 *
@@ -65,12 +68,32 @@
 
 #ifdef XLOADER_OSPI
 #include "xospipsv.h"		/* OSPIPSV device driver */
+#include "xospipsv_control.h"
 #include "xpm_api.h"
 #include "xpm_nodeid.h"
 
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
+#ifdef PLM_OSPI_DLL_CACHE
+/** DLL taps found by the DDR PHY tuning of a flash */
+typedef struct {
+	u32 DeviceIdData;	/**< ID of the flash the taps were tuned on */
+	u32 PhyConfig;		/**< RX and TX DLL delay fields of PHY config */
+	u8 ExtraDummyCycle;	/**< Extra dummy cycle picked by the tuning */
+	u8 IsValid;		/**< TRUE once the taps are recorded */
+} XLoader_OspiDllTaps;
+#endif
+
+#ifdef PLM_OSPI_PREFETCH
+/** Read ahead of the flash data following the last blocking read */
+typedef struct {
+	u32 SrcAddr;	/**< Flash address of the data in the buffer */
+	u32 Len;	/**< Length of the data in the buffer */
+	u32 NextAddr;	/**< Flash address following the last blocking read */
+	u8 State;	/**< Idle, busy or valid */
+} XLoader_OspiPrefetch;
+#endif
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -78,12 +101,35 @@
 static int FlashReadID(XOspiPsv *OspiPsvPtr);
 static int XLoader_FlashEnterExit4BAddMode(XOspiPsv *OspiPsvPtr, u32 Enable);
 static int XLoader_FlashSetDDRMode(XOspiPsv *OspiPsvPtr);
+static int XLoader_OspiSetDdrPhyMode(XOspiPsv *OspiPsvPtr);
+#ifdef PLM_OSPI_DLL_CACHE
+static int XLoader_OspiRestoreDllTaps(XOspiPsv *OspiPsvPtr,
+	const XLoader_OspiDllTaps *DllTaps);
+#endif
 static int XLoader_SpansionSetEccMode(XOspiPsv *OspiPsvPtr);
+static int XLoader_OspiRead(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags);
+#ifdef PLM_OSPI_PREFETCH
+static void XLoader_OspiPrefetchWait(void);
+static void XLoader_OspiPrefetchStart(u32 SrcAddr);
+#endif
 
 /************************** Variable Definitions *****************************/
 static XOspiPsv OspiPsvInstance;
 static u8 OspiFlashMake;
 static u32 OspiFlashSize = 0U;
+#ifdef PLM_OSPI_DLL_CACHE
+/*
+ * Kept across OSPI inits, so that partial PDI loads and subsystem restarts
+ * from OSPI reuse the taps tuned during boot
+ */
+static XLoader_OspiDllTaps OspiDllTaps[XLOADER_OSPI_DLL_CACHE_ENTRIES];
+#endif
+#ifdef PLM_OSPI_PREFETCH
+static XLoader_OspiPrefetch OspiPrefetch = {0U, 0U,
+	XLOADER_OSPI_PREFETCH_NO_ADDR, XLOADER_OSPI_PREFETCH_IDLE};
+static u8 OspiPrefetchBuf[XLOADER_OSPI_PREFETCH_LEN]
+	__attribute__ ((aligned(XPLMI_WORD_LEN)));
+#endif
 
 #ifdef VERSAL_NET
 static FlashInfo FlashConfigTable[] = {
@@ -306,6 +352,15 @@ int XLoader_OspiInit(u32 DeviceFlags)
 	(void)DeviceFlags;
 	u32 CapSecureAccess = (u32)PM_CAP_ACCESS | (u32)PM_CAP_SECURE;
 
+#ifdef PLM_OSPI_PREFETCH
+	/**
+	 * - Drop the data read ahead for the previous PDI.
+	*/
+	XLoader_OspiPrefetchWait();
+	OspiPrefetch.State = XLOADER_OSPI_PREFETCH_IDLE;
+	OspiPrefetch.NextAddr = XLOADER_OSPI_PREFETCH_NO_ADDR;
+#endif
+
 	/**
 	 * - Request driver for OSPI device.
 	*/
@@ -528,6 +583,155 @@ END:
  * @brief	This function is used to copy the data from OSPI flash to
  * 			destination address.
  *
+ * 			With PLM_OSPI_PREFETCH, a blocking read that continues the
+ * 			previous one starts a non-blocking read of the data following
+ * 			it into a staging buffer. The next blocking read then takes
+ * 			its first bytes from the staging buffer, while the flash
+ * 			streams in the background between the two requests.
+ *
+ * @param	SrcAddr is the address of the OSPI flash where copy should start
+ *
+ * @param	DestAddr is the address of the destination where it should copy to
+ *
+ * @param	Length Length of the bytes to be copied
+ *
+ * @param	Flags Flags for the DMA
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- Errors from XLoader_OspiRead.
+ *
+ *****************************************************************************/
+int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
+{
+	int Status = XST_FAILURE;
+#ifdef PLM_OSPI_PREFETCH
+	u32 SrcAddrLow = (u32)SrcAddr;
+	u32 CopyState = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
+	u32 Len = Length;
+	u64 Dest = DestAddr;
+	u8 IsSequential;
+
+	/**
+	 * - The wait for a non-blocking copy is for the caller's own transfer.
+	 */
+	if (CopyState == XPLMI_DEVICE_COPY_STATE_WAIT_DONE) {
+		Status = XLoader_OspiRead(SrcAddr, DestAddr, Length, Flags);
+		goto END;
+	}
+
+	/**
+	 * - Otherwise the controller must be free, so complete any read ahead.
+	 */
+	XLoader_OspiPrefetchWait();
+	if (CopyState != XPLMI_DEVICE_COPY_STATE_BLK) {
+		OspiPrefetch.State = XLOADER_OSPI_PREFETCH_IDLE;
+		OspiPrefetch.NextAddr = XLOADER_OSPI_PREFETCH_NO_ADDR;
+		Status = XLoader_OspiRead(SrcAddr, DestAddr, Length, Flags);
+		goto END;
+	}
+
+	/**
+	 * - Serve the start of a blocking read from the read ahead data.
+	 */
+	IsSequential = (u8)(SrcAddrLow == OspiPrefetch.NextAddr);
+	if ((OspiPrefetch.State == XLOADER_OSPI_PREFETCH_VALID) &&
+		(OspiPrefetch.SrcAddr == SrcAddrLow)) {
+		if (Len > OspiPrefetch.Len) {
+			Len = OspiPrefetch.Len;
+		}
+		Status = XPlmi_MemCpy64(Dest, (u64)(UINTPTR)OspiPrefetchBuf, Len);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		SrcAddrLow += Len;
+		Dest += Len;
+		Len = Length - Len;
+	}
+	OspiPrefetch.State = XLOADER_OSPI_PREFETCH_IDLE;
+	OspiPrefetch.NextAddr = XLOADER_OSPI_PREFETCH_NO_ADDR;
+
+	if (Len != 0U) {
+		Status = XLoader_OspiRead(SrcAddrLow, Dest, Len, Flags);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Status = XST_SUCCESS;
+
+	/**
+	 * - Once reads are found to be sequential, read ahead the next bytes.
+	 */
+	OspiPrefetch.NextAddr = (u32)SrcAddr + Length;
+	if (IsSequential == (u8)TRUE) {
+		XLoader_OspiPrefetchStart(OspiPrefetch.NextAddr);
+	}
+
+END:
+#else
+	Status = XLoader_OspiRead(SrcAddr, DestAddr, Length, Flags);
+#endif
+	return Status;
+}
+
+#ifdef PLM_OSPI_PREFETCH
+/*****************************************************************************/
+/**
+ * @brief	This function starts a non-blocking read of the flash data at
+ * 			SrcAddr into the prefetch buffer. Stacked flashes and the end of
+ * 			the flash are not read ahead. A read ahead that cannot be started
+ * 			is skipped, as the next request reads the flash directly.
+ *
+ * @param	SrcAddr is the address of the OSPI flash to read ahead from
+ *
+ *****************************************************************************/
+static void XLoader_OspiPrefetchStart(u32 SrcAddr)
+{
+	u32 Len = XLOADER_OSPI_PREFETCH_LEN;
+
+	if ((OspiPsvInstance.Config.ConnectionMode ==
+		XOSPIPSV_CONNECTION_MODE_STACKED) || (SrcAddr >= OspiFlashSize)) {
+		goto END;
+	}
+	if ((OspiFlashSize - SrcAddr) < Len) {
+		Len = OspiFlashSize - SrcAddr;
+	}
+
+	if (XLoader_OspiRead(SrcAddr, (u64)(UINTPTR)OspiPrefetchBuf, Len,
+		XPLMI_DEVICE_COPY_STATE_INITIATE) == XST_SUCCESS) {
+		OspiPrefetch.SrcAddr = SrcAddr;
+		OspiPrefetch.Len = Len;
+		OspiPrefetch.State = XLOADER_OSPI_PREFETCH_BUSY;
+	}
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function waits for the read ahead in flight, if any, to
+ * 			complete.
+ *
+ *****************************************************************************/
+static void XLoader_OspiPrefetchWait(void)
+{
+	u32 Status;
+
+	if (OspiPrefetch.State == XLOADER_OSPI_PREFETCH_BUSY) {
+		do {
+			Status = XOspiPsv_CheckDmaDone(&OspiPsvInstance);
+		} while (Status != (u32)XST_SUCCESS);
+		OspiPrefetch.State = XLOADER_OSPI_PREFETCH_VALID;
+	}
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads the data from OSPI flash to destination
+ * 			address.
+ *
  * @param	SrcAddr is the address of the OSPI flash where copy should start
  *
  * @param	DestAddr is the address of the destination where it should copy to
@@ -547,7 +751,7 @@ END:
  * 			- XLOADER_ERR_OSPI_READ on OSPI driver read fail.
  *
  *****************************************************************************/
-int XLoader_OspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
+static int XLoader_OspiRead(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 {
 	int Status = XST_FAILURE;
 	u32 SrcAddrLow = (u32)SrcAddr;
@@ -1067,8 +1271,7 @@ static int XLoader_FlashSetDDRMode(XOspiPsv *OspiPsvPtr)
 		}
 	}
 
-	Status = (int)XOspiPsv_SetSdrDdrMode(OspiPsvPtr,
-		XOSPIPSV_EDGE_MODE_DDR_PHY);
+	Status = XLoader_OspiSetDdrPhyMode(OspiPsvPtr);
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
@@ -1125,6 +1328,192 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function switches the controller to DDR PHY mode. The DLL
+ * 			tuning sweeps all the RX taps with repeated READ ID commands.
+ * 			With PLM_OSPI_DLL_CACHE, the taps it finds are recorded per chip
+ * 			select. Later inits on the same flash restore them and only
+ * 			check that the flash ID reads back; the full tuning runs again
+ * 			if it does not.
+ *
+ * @param	OspiPsvPtr is a pointer to the OSPIPSV instance.
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_OspiSetDdrPhyMode(XOspiPsv *OspiPsvPtr)
+{
+	int Status = XST_FAILURE;
+#ifdef PLM_OSPI_DLL_CACHE
+	XLoader_OspiDllTaps *DllTaps;
+
+	if (OspiPsvPtr->ChipSelect >= XLOADER_OSPI_DLL_CACHE_ENTRIES) {
+		goto END;
+	}
+	DllTaps = &OspiDllTaps[OspiPsvPtr->ChipSelect];
+
+	/**
+	 * - Restore the taps recorded for this flash, if any.
+	 */
+	if ((DllTaps->IsValid == (u8)TRUE) &&
+		(DllTaps->DeviceIdData == OspiPsvPtr->DeviceIdData)) {
+		Status = XLoader_OspiRestoreDllTaps(OspiPsvPtr, DllTaps);
+		if (Status == XST_SUCCESS) {
+			XLoader_Printf(DEBUG_INFO, "OSPI DLL taps restored\n\r");
+			goto END;
+		}
+		XLoader_Printf(DEBUG_INFO, "OSPI DLL taps check failed, "
+			"tuning again\n\r");
+		DllTaps->IsValid = (u8)FALSE;
+		OspiPsvPtr->Extra_DummyCycle = 0U;
+	}
+#endif
+
+	/**
+	 * - Otherwise tune the DLL and record the taps found.
+	 */
+	Status = (int)XOspiPsv_SetSdrDdrMode(OspiPsvPtr,
+		XOSPIPSV_EDGE_MODE_DDR_PHY);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+#ifdef PLM_OSPI_DLL_CACHE
+	DllTaps->DeviceIdData = OspiPsvPtr->DeviceIdData;
+	DllTaps->PhyConfig = XOspiPsv_ReadReg(OspiPsvPtr->Config.BaseAddress,
+		XOSPIPSV_PHY_CONFIGURATION_REG) &
+		(XOSPIPSV_PHY_CONFIGURATION_REG_PHY_CONFIG_TX_DLL_DELAY_FLD_MASK |
+		XOSPIPSV_PHY_CONFIGURATION_REG_PHY_CONFIG_RX_DLL_DELAY_FLD_MASK);
+	DllTaps->ExtraDummyCycle = OspiPsvPtr->Extra_DummyCycle;
+	DllTaps->IsValid = (u8)TRUE;
+#endif
+
+END:
+	return Status;
+}
+
+#ifdef PLM_OSPI_DLL_CACHE
+/*****************************************************************************/
+/**
+ * @brief	This function sets the controller to DDR PHY mode with the DLL
+ * 			taps recorded by an earlier tuning, in place of
+ * 			XOspiPsv_SetSdrDdrMode. The flash ID is then read in DDR mode as
+ * 			many times as the tuning does to accept a tap.
+ *
+ * @param	OspiPsvPtr is a pointer to the OSPIPSV instance.
+ * @param	DllTaps is a pointer to the recorded taps
+ *
+ * @return
+ * 			- XST_SUCCESS if the flash ID reads back with the taps
+ * 			- XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+static int XLoader_OspiRestoreDllTaps(XOspiPsv *OspiPsvPtr,
+	const XLoader_OspiDllTaps *DllTaps)
+{
+	int Status = XST_FAILURE;
+	UINTPTR BaseAddr = OspiPsvPtr->Config.BaseAddress;
+	XOspiPsv_Msg FlashMsg = {0U};
+	u8 ReadBuffer[8U] __attribute__ ((aligned(4U))) = {0U};
+	const u32 *DeviceId = (const u32 *)(UINTPTR)ReadBuffer;
+	u32 ConfigReg;
+	u32 ReadReg;
+	u32 Index;
+
+	Status = (int)XOspiPsv_CheckOspiIdle(OspiPsvPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	/**
+	 * - Program the controller for DDR PHY mode as XOspiPsv_SetSdrDdrMode
+	 * does.
+	 */
+	OspiPsvPtr->SdrDdrMode = XOSPIPSV_EDGE_MODE_DDR_PHY;
+	XOspiPsv_Disable(OspiPsvPtr);
+	ConfigReg = XOspiPsv_ReadReg(BaseAddr, XOSPIPSV_CONFIG_REG);
+	ConfigReg |= (XOSPIPSV_CONFIG_REG_ENABLE_DTR_PROTOCOL_FLD_MASK |
+		XOSPIPSV_CONFIG_REG_PHY_MODE_ENABLE_FLD_MASK);
+	ReadReg = XOspiPsv_ReadReg(BaseAddr,
+		XOSPIPSV_WRITE_COMPLETION_CTRL_REG);
+	ReadReg &= ~XOSPIPSV_WRITE_COMPLETION_CTRL_REG_POLL_COUNT_FLD_MASK;
+	ReadReg |= ((u32)XOSPIPSV_POLL_CNT_FLD_PHY <<
+		XOSPIPSV_WRITE_COMPLETION_CTRL_REG_POLL_COUNT_FLD_SHIFT);
+	XOspiPsv_WriteReg(BaseAddr, XOSPIPSV_CONFIG_REG, ConfigReg);
+	XOspiPsv_WriteReg(BaseAddr, XOSPIPSV_WRITE_COMPLETION_CTRL_REG,
+		ReadReg);
+	ReadReg = XOspiPsv_ReadReg(BaseAddr, XOSPIPSV_RD_DATA_CAPTURE_REG);
+	ReadReg &= ~XOSPIPSV_RD_DATA_CAPTURE_REG_DELAY_FLD_MASK;
+	XOspiPsv_WriteReg(BaseAddr, XOSPIPSV_RD_DATA_CAPTURE_REG, ReadReg);
+	XOspiPsv_Enable(OspiPsvPtr);
+
+	/**
+	 * - Lock the master DLL and load the recorded taps.
+	 */
+	if (OspiPsvPtr->DllMode == XOSPIPSV_DLL_MASTER_MODE) {
+		XOspiPsv_WriteReg(BaseAddr, XOSPIPSV_PHY_CONFIGURATION_REG, 0x0U);
+		XOspiPsv_WriteReg(BaseAddr, XOSPIPSV_PHY_MASTER_CONTROL_REG,
+			XLOADER_OSPI_DLL_MASTER_CTRL_VAL);
+		XOspiPsv_WriteReg(BaseAddr, XOSPIPSV_PHY_CONFIGURATION_REG,
+			XOSPIPSV_PHY_CONFIGURATION_REG_PHY_CONFIG_RESET_FLD_MASK);
+		Status = (int)XOspiPsv_WaitForLock(OspiPsvPtr,
+			XOSPIPSV_DLL_OBSERVABLE_LOWER_LOOPBACK_LOCK_FLD_MASK);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	Status = (int)XOspiPsv_ConfigureTaps(OspiPsvPtr, DllTaps->PhyConfig &
+		XOSPIPSV_PHY_CONFIGURATION_REG_PHY_CONFIG_RX_DLL_DELAY_FLD_MASK,
+		DllTaps->PhyConfig &
+		XOSPIPSV_PHY_CONFIGURATION_REG_PHY_CONFIG_TX_DLL_DELAY_FLD_MASK);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	OspiPsvPtr->Extra_DummyCycle = DllTaps->ExtraDummyCycle;
+
+	/**
+	 * - Check the taps with the READ ID command the tuning uses.
+	 */
+	FlashMsg.Opcode = READ_ID;
+	FlashMsg.Addrsize = 0U;
+	FlashMsg.Addrvalid = FALSE;
+	FlashMsg.TxBfrPtr = NULL;
+	FlashMsg.RxBfrPtr = ReadBuffer;
+	FlashMsg.ByteCount = XLOADER_OSPI_READ_ID_BYTE_CNT;
+	FlashMsg.Flags = XOSPIPSV_MSG_FLAG_RX;
+	FlashMsg.Dummy = XLOADER_OSPI_READ_ID_DDR_DUMMY_CYCLES;
+	FlashMsg.Proto = XOSPIPSV_READ_8_0_8;
+	if (OspiPsvPtr->DualByteOpcodeEn != XOSPIPSV_DUAL_BYTE_OP_DISABLE) {
+		if (OspiPsvPtr->DualByteOpcodeEn == XOSPIPSV_DUAL_BYTE_OP_ENABLE) {
+			FlashMsg.ExtendedOpcode = (u8)(~FlashMsg.Opcode);
+		}
+		else {
+			FlashMsg.ExtendedOpcode = (u8)(FlashMsg.Opcode);
+		}
+		FlashMsg.Addrsize = XLOADER_OSPI_READ_ADDR_SIZE;
+		FlashMsg.Addrvalid = TRUE;
+		FlashMsg.Dummy = XLOADER_OSPI_READ_ID_DUAL_BYTE_DUMMY_CYCLES;
+		FlashMsg.Proto = XOSPIPSV_READ_8_8_8;
+	}
+	FlashMsg.Dummy += OspiPsvPtr->Extra_DummyCycle;
+
+	for (Index = 0U; Index < XLOADER_OSPI_DLL_VERIFY_CNT; ++Index) {
+		Status = (int)XOspiPsv_PollTransfer(OspiPsvPtr, &FlashMsg);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		if (*DeviceId != OspiPsvPtr->DeviceIdData) {
+			Status = XST_FAILURE;
+			goto END;
+		}
+	}
+
+END:
+	return Status;
+}
+#endif
+
 /*****************************************************************************/
 /**
  * @brief	This function releases control of OSPI.
@@ -1137,6 +1526,15 @@ int XLoader_OspiRelease(void)
 {
 	int Status = XST_FAILURE;
 
+#ifdef PLM_OSPI_PREFETCH
+	/**
+	 * - Let the read ahead finish before the device is released.
+	*/
+	XLoader_OspiPrefetchWait();
+	OspiPrefetch.State = XLOADER_OSPI_PREFETCH_IDLE;
+	OspiPrefetch.NextAddr = XLOADER_OSPI_PREFETCH_NO_ADDR;
+#endif
+
 	/**
 	 * - Request the OSPI driver to release the device.
 	*/
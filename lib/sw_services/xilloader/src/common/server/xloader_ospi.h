@@ -35,6 +35,7 @@
 *       sk   02/26/2024 Added defines for Spansion flash part
 *       ng   03/05/2024 Added support for Macronix OSPI 2G flash part
 *       sk   03/15/2024 Added structure for flash info
+*       sb   10/16/2026 Added macros for DLL tap cache and read prefetch
 *
 * </pre>
 *
@@ -145,6 +146,17 @@ extern "C" {
 #define XLOADER_SPANSION_WRITE_CFG_REG_VAL		(0x43U)
 #define XLOADER_OSPI_WRITE_DONE_MASK	(0x80U)
 #define XLOADER_WRITE_CFG_ECC_REG_VAL		(0xA0U)
+#define XLOADER_OSPI_DLL_CACHE_ENTRIES	(2U) /* One per chip select */
+#define XLOADER_OSPI_DLL_MASTER_CTRL_VAL	(0x4U)
+#define XLOADER_OSPI_DLL_VERIFY_CNT	(11U)
+#define XLOADER_OSPI_READ_ID_DDR_DUMMY_CYCLES	(8U)
+#define XLOADER_OSPI_READ_ID_DUAL_BYTE_DUMMY_CYCLES	(4U)
+#define XLOADER_OSPI_READ_ID_BYTE_CNT	(4U)
+#define XLOADER_OSPI_PREFETCH_LEN	(0x1000U)
+#define XLOADER_OSPI_PREFETCH_IDLE	(0U)
+#define XLOADER_OSPI_PREFETCH_BUSY	(1U)
+#define XLOADER_OSPI_PREFETCH_VALID	(2U)
+#define XLOADER_OSPI_PREFETCH_NO_ADDR	(0xFFFFFFFFU)
 
 #define SPANSION_JEDEC_ID		(0x345b1CU)
 #define SPANSION_TOTAL_SECTORS		(0x400U)
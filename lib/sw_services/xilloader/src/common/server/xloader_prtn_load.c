@@ -110,6 +110,11 @@
 *       		XLoader_ProcessAuthEncPrtn
 *       mss  04/05/2024 Added logic to disable device copy optimization
 *       bm   09/25/2024 Fix Boot Device Copy Optimization logic
+*       sb   10/16/2026 Use the pre-decoded CDO command cache for
+*                       authenticated CDO partitions
+*       sb   10/16/2026 Read measured raw partitions ahead of their
+*                       measurement
+*       sb   10/16/2026 Added boot time profiling of partitions
 * </pre>
 *
 * @note
@@ -140,6 +145,7 @@
 #include "xloader_plat.h"
 #include "xplmi_wdt.h"
 #include "xplmi_tamper.h"
+#include "xloader_boot_prof.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -148,12 +154,19 @@
 /***************** Macros (Inline Functions) Definitions *********************/
 #define XLOADER_SUCCESS_NOT_PRTN_OWNER			(0x100U) /**< Indicates that PLM is not the partition owner */
 #define XLOADER_BOOT_COPY_OPTIMIZATION_ENABLED		(0U) /**< Indicates Boot Device Copy Optimization is Enabled */
+#define XLOADER_READ_AHEAD_CHUNK_SIZE		(0x100000U) /**< Chunk size of
+						partitions measured while being read, 1MB */
 
 /************************** Function Prototypes ******************************/
 static int XLoader_PrtnHdrValidation(const XilPdi_PrtnHdr* PrtnHdr, u32 PrtnNum);
 static int XLoader_ProcessCdo (const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCopy,
 	XLoader_SecureParams* SecureParams);
 static int XLoader_ProcessPrtn(XilPdi* PdiPtr);
+#if defined(PLM_OCP) && !defined(VERSAL_AIEPG2)
+static int XLoader_PrtnReadAhead(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy,
+	XLoader_ImageMeasureInfo *ImageMeasureInfo);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -245,7 +258,15 @@ int XLoader_LoadImagePrtns(XilPdi* PdiPtr)
 		 * - Otherwise process the partition.
 		 */
 		PdiPtr->ImagePrtnId = PrtnIndex;
+		if (PdiPtr->DelayLoad == (u8)FALSE) {
+			XLoader_BootProfStart(
+				PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID,
+				PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].PrtnId,
+				PdiPtr->MetaHdr.PrtnHdr[PdiPtr->PrtnNum].TotalDataWordLen *
+				XPLMI_WORD_LEN, XLOADER_BOOT_PROF_STAGE_OTHER);
+		}
 		Status = XLoader_ProcessPrtn(PdiPtr);
+		XLoader_BootProfEnd();
 		if (XST_SUCCESS != Status) {
 			goto END;
 		}
@@ -379,6 +400,10 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 #endif
 	u32 PcrInfo = PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].PcrInfo;
 	XLoader_ImageMeasureInfo ImageMeasureInfo = {0U};
+#if defined(PLM_OCP) && !defined(VERSAL_AIEPG2)
+	u32 DevCopyOptimization = (u32)(XPlmi_In32(XPLMI_RTCFG_SECURE_CTRL_ADDR) &
+					XLOADER_DEVICE_COPY_OPTIMIZATION_MASK);
+#endif
 
 	/** Verify the destination address range before writing */
 	Status = XPlmi_VerifyAddrRange(DeviceCopy->DestAddr, DeviceCopy->DestAddr + (u64)DeviceCopy->Len - 1U);
@@ -394,13 +419,36 @@ int XLoader_PrtnCopy(const XilPdi* PdiPtr, const XLoader_DeviceCopy* DeviceCopy,
 	if ((SecureParams->SecureEn == (u8)FALSE) &&
 			(SecureTempParams->SecureEn == (u8)FALSE) &&
 			(SecureParams->IsCheckSumEnabled == (u8)FALSE)) {
+#if defined(PLM_OCP) && !defined(VERSAL_AIEPG2)
+		/**
+		 * - Measure large partitions chunk by chunk while the next chunk
+		 * is read, if non-blocking device copies are allowed.
+		 */
+		if ((DeviceCopy->Len > XLOADER_READ_AHEAD_CHUNK_SIZE) &&
+			(DevCopyOptimization == XLOADER_BOOT_COPY_OPTIMIZATION_ENABLED)) {
+			ImageMeasureInfo.DataSize = PrtnHdr->UnEncDataWordLen <<
+				XPLMI_WORD_LEN_SHIFT;
+			ImageMeasureInfo.PcrInfo = PcrInfo;
+			ImageMeasureInfo.SubsystemID =
+				PdiPtr->MetaHdr.ImgHdr[PdiPtr->ImageNum].ImgID;
+			ImageMeasureInfo.Flags = XLOADER_MEASURE_UPDATE;
+			Status = XLoader_PrtnReadAhead(PdiPtr, DeviceCopy,
+				&ImageMeasureInfo);
+			if (Status != XST_SUCCESS) {
+				XPlmi_Printf(DEBUG_GENERAL, "Device Copy Failed\n\r");
+			}
+			goto END;
+		}
+#endif
 		Status = PdiPtr->MetaHdr.DeviceCopy(DeviceCopy->SrcAddr,
 			DeviceCopy->DestAddr,DeviceCopy->Len, DeviceCopy->Flags);
 	}
 	else {
+		XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_AUTH);
 		XSECURE_TEMPORAL_IMPL(Status, StatusTmp, XLoader_SecureCopy,
 					SecureParams, DeviceCopy->DestAddr,
 					DeviceCopy->Len);
+		XLoader_BootProfExit();
 		if ((XST_SUCCESS != Status) || (XST_SUCCESS != StatusTmp)) {
 			Status |= StatusTmp;
 		}
@@ -427,6 +475,95 @@ END:
 	return Status;
 }
 
+#if defined(PLM_OCP) && !defined(VERSAL_AIEPG2)
+/*****************************************************************************/
+/**
+ * @brief	This function copies a partition in chunks and measures every
+ * 			chunk while the device reads the next one. Boot devices serve
+ * 			one read at a time, so a single chunk is kept in flight.
+ *
+ * @param	PdiPtr is pointer to XilPdi instance
+ * @param	DeviceCopy is pointer to the structure variable with parameters
+ *			required for copying
+ * @param	ImageMeasureInfo is pointer to the measurement parameters, with
+ *			DataSize set to the number of bytes to be measured
+ *
+ * @return
+ * 			- XST_SUCCESS on success and error code on failure
+ *
+ *****************************************************************************/
+static int XLoader_PrtnReadAhead(const XilPdi* PdiPtr,
+	const XLoader_DeviceCopy* DeviceCopy,
+	XLoader_ImageMeasureInfo *ImageMeasureInfo)
+{
+	int Status = XST_FAILURE;
+	u64 SrcAddr = DeviceCopy->SrcAddr;
+	u64 DestAddr = DeviceCopy->DestAddr;
+	u32 Len = DeviceCopy->Len;
+	u32 MeasureLen = ImageMeasureInfo->DataSize;
+	u32 ChunkLen = XLOADER_READ_AHEAD_CHUNK_SIZE;
+	u32 NextChunkLen = 0U;
+
+	/** - Start the read of the first chunk */
+	Status = PdiPtr->MetaHdr.DeviceCopy(SrcAddr, DestAddr, ChunkLen,
+		DeviceCopy->Flags | XPLMI_DEVICE_COPY_STATE_INITIATE);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	while (Len > 0U) {
+		/** - Wait for the chunk in flight */
+		Status = PdiPtr->MetaHdr.DeviceCopy(SrcAddr, DestAddr, ChunkLen,
+			DeviceCopy->Flags | XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		SrcAddr += ChunkLen;
+		Len -= ChunkLen;
+
+		/** - Start the read of the next chunk before measuring this one */
+		if (Len > 0U) {
+			NextChunkLen = XLOADER_READ_AHEAD_CHUNK_SIZE;
+			if (Len < NextChunkLen) {
+				NextChunkLen = Len;
+			}
+			Status = PdiPtr->MetaHdr.DeviceCopy(SrcAddr,
+				DestAddr + ChunkLen, NextChunkLen,
+				DeviceCopy->Flags | XPLMI_DEVICE_COPY_STATE_INITIATE);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+
+		if (MeasureLen > 0U) {
+			ImageMeasureInfo->DataAddr = DestAddr;
+			ImageMeasureInfo->DataSize = ChunkLen;
+			if (MeasureLen < ChunkLen) {
+				ImageMeasureInfo->DataSize = MeasureLen;
+			}
+			MeasureLen -= ImageMeasureInfo->DataSize;
+			/* Update the data for measurement, only VersalNet */
+			Status = XLoader_DataMeasurement(ImageMeasureInfo);
+			if (Status != XST_SUCCESS) {
+				if (Len > 0U) {
+					/* Do not leave the device copy running */
+					(void)PdiPtr->MetaHdr.DeviceCopy(SrcAddr,
+						DestAddr + ChunkLen, NextChunkLen,
+						DeviceCopy->Flags |
+						XPLMI_DEVICE_COPY_STATE_WAIT_DONE);
+				}
+				goto END;
+			}
+		}
+		DestAddr += ChunkLen;
+		ChunkLen = NextChunkLen;
+	}
+
+END:
+	return Status;
+}
+#endif
+
 /****************************************************************************/
 /**
  * @brief	This function is used to process the CDO partition. It copies and
@@ -556,12 +693,26 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 		else {
 			SecureParams->RemainingDataLen = DeviceCopy->Len;
 
+			XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_AUTH);
 			Status = SecureParams->ProcessPrtn(SecureParams,
 					SecureParams->SecureData, ChunkLen, LastChunk);
+			XLoader_BootProfExit();
 			if (Status != XST_SUCCESS) {
 				goto END;
 			}
 
+#if defined(PLM_CDO_CACHE) && !defined(PLM_SECURE_EXCLUDE)
+			/**
+			 * Open the CDO cache once the first block of an authenticated
+			 * CDO is verified, before any of its commands is executed
+			 */
+			if ((Cdo.Cache == NULL) && (Cdo.Cdo1stChunk == (u8)TRUE) &&
+				(SecureParams->IsCdoCacheKeyValid == (u8)TRUE) &&
+				(PdiPtr->PdiType != XLOADER_PDI_TYPE_IPU)) {
+				Cdo.Cache = XPlmi_CdoCacheOpen(
+					(const u8 *)SecureParams->CdoCacheKey);
+			}
+#endif
 			Cdo.NextChunkAddr = SecureParams->NextChunkAddr;
 			SecureParams->ChunkAddr = SecureParams->NextChunkAddr;
 			Cdo.BufPtr = (u32 *)SecureParams->SecureData;
@@ -575,7 +726,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 #endif
 		if (PdiPtr->PdiType != XLOADER_PDI_TYPE_IPU) {
 			/** Process the chunk */
+			XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_CDO);
 			Status = XPlmi_ProcessCdo(&Cdo);
+			XLoader_BootProfExit();
 			if (Status != XST_SUCCESS) {
 				goto END;
 			}
@@ -602,7 +755,9 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 				Cdo.Cmd.KeyHoleParams.SrcAddr = DeviceCopy->SrcAddr;
 				Cdo.Cmd.KeyHoleParams.IsNextChunkCopyStarted = (u8)FALSE;
 				if (PdiPtr->PdiType != XLOADER_PDI_TYPE_IPU) {
+					XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_CDO);
 					Status = XPlmi_ProcessCdo(&Cdo);
+					XLoader_BootProfExit();
 					if (Status != XST_SUCCESS) {
 						goto END;
 					}
@@ -648,6 +803,11 @@ static int XLoader_ProcessCdo(const XilPdi* PdiPtr, XLoader_DeviceCopy* DeviceCo
 	Status = XST_SUCCESS;
 
 END:
+#if defined(PLM_CDO_CACHE) && !defined(PLM_SECURE_EXCLUDE)
+	/** Keep the recorded commands only if the whole CDO was processed */
+	XPlmi_CdoCacheClose(Cdo.Cache, (Status == XST_SUCCESS) ? (u8)TRUE :
+		(u8)FALSE);
+#endif
 #ifdef PLM_PRINT_PERF_CDO_PROCESS
 	XPlmi_MeasurePerfTime((XPlmi_GetTimerValue() + CdoProcessTime),
 				&PerfTime);
@@ -724,7 +884,9 @@ static int XLoader_ProcessPrtn(XilPdi* PdiPtr)
 		 */
 	}
 
+	XLoader_BootProfEnter(XLOADER_BOOT_PROF_STAGE_AUTH);
 	Status = XLoader_SecureInit(&SecureParams, PdiPtr, PrtnNum);
+	XLoader_BootProfExit();
 	if (Status != XST_SUCCESS) {
 		goto END;
 	}
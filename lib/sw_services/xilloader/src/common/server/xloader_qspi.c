@@ -43,6 +43,8 @@
 *       ng   12/27/2023 Reduced log level for less frequent prints
 *       ng   02/14/2024 removed int typecast for errors
 *       pre  09/06/2024 Setting the pre-scaler for QSPI clock from CIPS
+*       sb   10/16/2026 Skip the bank select if the bank is already selected
+*                       and split stacked reads at the flash boundary
 *
 * </pre>
 *
@@ -86,6 +88,7 @@ static u32 ReadCommand = 0U;
 static u8 QspiMode;
 static PdiSrc_t QspiBootMode;
 static u8 QspiBusWidth;
+static u32 QspiBankSel[XLOADER_QSPI_BANK_SEL_ENTRIES];
 
 /*****************************************************************************/
 /**
@@ -257,6 +260,12 @@ int XLoader_QspiInit(u32 DeviceFlags)
 		goto END;
 	}
 	QspiBootMode = (PdiSrc_t)DeviceFlags;
+	/**
+	 * - Forget the selected banks, the flash may have been used by other
+	 * masters since the last init.
+	 */
+	QspiBankSel[XLOADER_QSPI_BANK_SEL_LOWER] = XLOADER_QSPI_BANK_SEL_INVALID;
+	QspiBankSel[XLOADER_QSPI_BANK_SEL_UPPER] = XLOADER_QSPI_BANK_SEL_INVALID;
 	Status = XPlmi_MemSetBytes(&QspiPsuInstance, sizeof(QspiPsuInstance),
 				0U, sizeof(QspiPsuInstance));
 	if (Status != XST_SUCCESS) {
@@ -749,6 +758,7 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 	u8 WriteBuffer[10U] __attribute__ ((aligned(32U))) = {0U};
 	u64 DestOffset = 0U;
 	u32 ParallelDmaFlags = Flags & XPLMI_DEVICE_COPY_STATE_MASK;
+	u32 BankSelIndex;
 
 #ifdef PLM_PRINT_PERF_DMA
 	u64 QspiCopyTime = XPlmi_GetTimerValue();
@@ -827,6 +837,16 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 			TransferBytes = RemainingBytes;
 		}
 
+		/**
+		 * - In stacked mode, end the transfer at the end of the lower
+		 * flash, as the rest is read from the upper flash.
+		 */
+		if ((QspiMode == XQSPIPSU_CONNECTION_MODE_STACKED) &&
+			(SrcAddrLow < (QspiFlashSize / 2U)) &&
+			((SrcAddrLow + TransferBytes) > (QspiFlashSize / 2U))) {
+			TransferBytes = (QspiFlashSize / 2U) - SrcAddrLow;
+		}
+
 		/**
 		 * - Translate address based on type of connection.
 		 * If stacked assert the slave select based on address.
@@ -859,13 +879,29 @@ int XLoader_QspiCopy(u64 SrcAddr, u64 DestAddr, u32 Length, u32 Flags)
 				else {
 					BankSel = QspiAddr / XLOADER_BANKSIZE;
 				}
-				Status = SendBankSelect(BankSel);
-				if (Status != XST_SUCCESS) {
-					Status = XPlmi_UpdateStatus(
-						XLOADER_ERR_QSPI_READ, Status);
-					XLoader_Printf(DEBUG_INFO,
-						"XLOADER_ERR_QSPI_READ\r\n");
-					goto END;
+				/**
+				 * - Send the bank select only if the flash is on
+				 * another bank.
+				 */
+				if (QspiPsuInstance.GenFifoCS ==
+					XQSPIPSU_SELECT_FLASH_CS_UPPER) {
+					BankSelIndex = XLOADER_QSPI_BANK_SEL_UPPER;
+				}
+				else {
+					BankSelIndex = XLOADER_QSPI_BANK_SEL_LOWER;
+				}
+				if (QspiBankSel[BankSelIndex] != BankSel) {
+					QspiBankSel[BankSelIndex] =
+						XLOADER_QSPI_BANK_SEL_INVALID;
+					Status = SendBankSelect(BankSel);
+					if (Status != XST_SUCCESS) {
+						Status = XPlmi_UpdateStatus(
+							XLOADER_ERR_QSPI_READ, Status);
+						XLoader_Printf(DEBUG_INFO,
+							"XLOADER_ERR_QSPI_READ\r\n");
+						goto END;
+					}
+					QspiBankSel[BankSelIndex] = BankSel;
 				}
 			}
 
@@ -32,6 +32,7 @@
 * 1.04  bsv  07/22/2021 Added support for Winbond flash part
 *       bsv  08/31/2021 Code clean up
 *       ng   08/09/2023 Removed redundant windbond flash size macro
+*       sb   10/16/2026 Added macros for the selected bank cache
 *
 * </pre>
 *
@@ -97,6 +98,14 @@ extern "C" {
 #define XLOADER_BANKMASK		(~(XLOADER_BANKSIZE - 1U))
 #define XLOADER_WINBOND_BANKMASK		(~(XLOADER_WINBOND_BANKSIZE - 1U))
 
+/*
+ * Bank selected in the lower and upper flash
+ */
+#define XLOADER_QSPI_BANK_SEL_ENTRIES		(2U)
+#define XLOADER_QSPI_BANK_SEL_LOWER		(0U)
+#define XLOADER_QSPI_BANK_SEL_UPPER		(1U)
+#define XLOADER_QSPI_BANK_SEL_INVALID		(0xFFFFFFFFU)
+
 /*
  * Identification of Flash
  * Micron:
@@ -52,6 +52,7 @@
 *       bm   02/12/2024 Updated logical partition comments for SD/eMMC bootmodes
 *       ng   02/14/2024 removed int typecast for errors
 *       bm   03/02/2024 Make SD drive number logic order independent
+*       sb   10/16/2026 Overlap SD reads with DMA to 64-bit destinations
 *
 * </pre>
 *
@@ -332,6 +333,8 @@ int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 	u32 TrfLen;
 	u64 DestOffset = 0U;
 	u32 Length = Len;
+	u32 StagingAddr = XPLMI_PMCRAM_BASEADDR;
+	u8 IsDmaStarted = (u8)FALSE;
 
 	if (Flags == XPLMI_DEVICE_COPY_STATE_INITIATE) {
 		Status = XST_SUCCESS;
@@ -365,37 +368,67 @@ int XLoader_SdCopy(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
 		}
 	}
 	else {
+		/**
+		 * - Read into the two halves of the PMC RAM staging buffer in turns
+		 *   so that the read of a chunk overlaps the DMA of the previous
+		 *   chunk to the destination.
+		 */
 		while(Length > 0U) {
-			if(Length > XLOADER_CHUNK_SIZE) {
-				TrfLen = XLOADER_CHUNK_SIZE;
+			if(Length > XLOADER_SD_STAGING_CHUNK_SIZE) {
+				TrfLen = XLOADER_SD_STAGING_CHUNK_SIZE;
 			}
 			else {
 				TrfLen = Length;
 			}
 
-			Rc = f_read(&FFil, (void*)(UINTPTR)XPLMI_PMCRAM_BASEADDR, TrfLen, &Br);
+			Rc = f_read(&FFil, (void*)(UINTPTR)StagingAddr, TrfLen, &Br);
 			if (Rc != FR_OK) {
 				XLoader_Printf(DEBUG_GENERAL, "SD: f_read returned %d\r\n", Rc);
 				Status = XPlmi_UpdateStatus(XLOADER_ERR_SD_F_READ, (int)Rc);
 				XLoader_Printf(DEBUG_INFO, "XLOADER_ERR_SD_F_READ\n\r");
 				goto END;
 			}
-			Status = XPlmi_DmaXfr((u64)XPLMI_PMCRAM_BASEADDR,
-					(DestAddr + DestOffset), (TrfLen / XPLMI_WORD_LEN),
-					XPLMI_PMCDMA_0);
-            if (Status != XST_SUCCESS) {
-		Status = XPlmi_UpdateStatus(XLOADER_ERR_DMA_XFER, Status);
-                 XLoader_Printf(DEBUG_INFO, "XLOADER_ERR_SD_F_READ\n\r");
-                 goto END;
-            }
+			if (IsDmaStarted == (u8)TRUE) {
+				IsDmaStarted = (u8)FALSE;
+				Status = XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_0);
+				if (Status != XST_SUCCESS) {
+					Status = XPlmi_UpdateStatus(XLOADER_ERR_DMA_XFER, Status);
+					goto END;
+				}
+			}
+			Status = XPlmi_DmaXfr((u64)StagingAddr, (DestAddr + DestOffset),
+					(TrfLen / XPLMI_WORD_LEN),
+					XPLMI_PMCDMA_0 | XPLMI_DMA_SRC_NONBLK);
+			if (Status != XST_SUCCESS) {
+				Status = XPlmi_UpdateStatus(XLOADER_ERR_DMA_XFER, Status);
+				XLoader_Printf(DEBUG_INFO, "XLOADER_ERR_DMA_XFER\n\r");
+				goto END;
+			}
+			IsDmaStarted = (u8)TRUE;
 
 			Length -= TrfLen;
 			DestOffset += TrfLen;
+			if (StagingAddr == XPLMI_PMCRAM_BASEADDR) {
+				StagingAddr += XLOADER_SD_STAGING_CHUNK_SIZE;
+			}
+			else {
+				StagingAddr = XPLMI_PMCRAM_BASEADDR;
+			}
+		}
+		IsDmaStarted = (u8)FALSE;
+		Status = XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_0);
+		if (Status != XST_SUCCESS) {
+			Status = XPlmi_UpdateStatus(XLOADER_ERR_DMA_XFER, Status);
+			goto END;
 		}
 	}
 	Status = XST_SUCCESS;
 
 END:
+	if (IsDmaStarted == (u8)TRUE) {
+		/* Do not leave the staging buffer DMA running */
+		(void)XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_0);
+	}
 	return Status;
 }
 
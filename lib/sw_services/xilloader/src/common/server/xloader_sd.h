@@ -36,6 +36,7 @@
 * 1.04  bm   12/15/2020 Removed XLOADER_SD_MAX_BOOT_FILES_LIMIT macro
 * 1.05  bsv  08/31/2021 Code clean up
 *       dd   09/11/2023 MISRA-C violation Rule 17.8 fixed
+*       sb   10/16/2026 Added XLOADER_SD_STAGING_CHUNK_SIZE macro
 *
 * </pre>
 *
@@ -71,6 +72,8 @@ extern "C" {
 #define XLOADER_SD_RAW_BLK_SIZE			(512U)
 #define XLOADER_SD_CHUNK_SIZE		(0x200000U)
 #define XLOADER_NUM_SECTORS		(0x1000U)
+#define XLOADER_SD_STAGING_CHUNK_SIZE	(XLOADER_CHUNK_SIZE / 2U) /**< Size of
+					each half of the PMC RAM staging buffer */
 
 /************************** Function Prototypes ******************************/
 int XLoader_SdInit(u32 DeviceFlagsVal);
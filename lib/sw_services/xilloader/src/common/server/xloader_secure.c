@@ -127,6 +127,8 @@
 *                     and trying to do secure boot
 * 2.1   kpt  12/13/23 Reset PMC TRNG when exception occurs
 *       ng   01/28/24 u8 variables optimization
+*       sb   10/16/26 Read the second chunk of checksum partitions ahead and
+*                     copy authenticated chunks to destination on PMC DMA1
 *
 * </pre>
 *
@@ -173,6 +175,7 @@ static int XLoader_ChecksumInit(XLoader_SecureParams *SecurePtr,
 	const XilPdi_PrtnHdr *PrtnHdr);
 static int XLoader_ProcessChecksumPrtn(XLoader_SecureParams *SecurePtr,
 	u64 DestAddr, u32 BlockSize, u8 Last);
+static u8 XLoader_IsDma1Free(const XilPdi *PdiPtr);
 
 /************************** Variable Definitions *****************************/
 
@@ -288,6 +291,7 @@ int XLoader_SecureCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr, u32 Size)
 {
 	int Status = XST_FAILURE;
 	int ClrStatus = XST_FAILURE;
+	int WaitStatus = XST_FAILURE;
 	u32 ChunkLen = XLOADER_SECURE_CHUNK_SIZE;
 	u32 Len = Size;
 	u64 LoadAddr = DestAddr;
@@ -316,6 +320,11 @@ int XLoader_SecureCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr, u32 Size)
 	}
 
 END:
+	/** - Wait for the copy of the last chunk to its destination */
+	WaitStatus = XLoader_SecureDestCopyWait(SecurePtr);
+	if (Status == XST_SUCCESS) {
+		Status = WaitStatus;
+	}
 	if (Status != XST_SUCCESS) {
 		/** - On failure clear data at destination address */
 		ClrStatus = XPlmi_InitNVerifyMem(DestAddr, Size);
@@ -763,6 +772,15 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 		goto END;
 	}
 
+	/**
+	 * - The previous chunk may still be on its way to the destination
+	 *   while this chunk was read, wait for it before its buffer is reused.
+	 */
+	Status = XLoader_SecureDestCopyWait(SecurePtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
 	/**
 	 * - The following initialization is crucial as the authentication
 	 *   certificate and PUF data are now stored in the PMC RAM instead of the
@@ -774,8 +792,11 @@ int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 	 *   when processing the first chunk, and only enabled from the second chunk
 	 *   onwards. The third chunk is loaded at 0xf2008120, and from then on, the
 	 *   chunks are loaded alternatively to the two 32KB chunks of the PMC RAM.
+	 *   Checksum partitions have neither of them, so their second chunk is
+	 *   read ahead as well.
 	 */
-	if ((Last != (u8)TRUE) && (SecurePtr->BlockNum != 0U) &&
+	if ((Last != (u8)TRUE) && ((SecurePtr->BlockNum != 0U) ||
+		(SecurePtr->IsCheckSumEnabled == (u8)TRUE)) &&
 	((SecurePtr->DmaFlags & XPLMI_PMCDMA_0) != XPLMI_PMCDMA_0)) {
 		Status = XLoader_StartNextChunkCopy(SecurePtr,
 					(SecurePtr->RemainingDataLen - TotalSize),
@@ -785,6 +806,103 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+* @brief	This function copies the verified data of the current chunk to its
+*			destination. When the boot device does not use PMC DMA1, the copy
+*			runs on PMC DMA1 without blocking, so that it overlaps the read of
+*			the next chunk. XLoader_SecureDestCopyWait must be called before
+*			the chunk buffer is reused.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+* @param	DestAddr is the address to which data is copied
+*
+* @return
+* 			- XST_SUCCESS on success.
+* 			- XLOADER_ERR_DMA_TRANSFER if DMA transfer fails to copy.
+*
+******************************************************************************/
+int XLoader_SecureDestCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr)
+{
+	int Status = XST_FAILURE;
+	u32 DmaFlags = XPLMI_PMCDMA_0;
+
+	if (XLoader_IsDma1Free(SecurePtr->PdiPtr) == (u8)TRUE) {
+		DmaFlags = XPLMI_PMCDMA_1 | XPLMI_DMA_SRC_NONBLK;
+	}
+
+	Status = XPlmi_DmaXfr((u64)SecurePtr->SecureData, DestAddr,
+			SecurePtr->SecureDataLen >> XPLMI_WORD_LEN_SHIFT, DmaFlags);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DMA_TRANSFER, Status);
+		goto END;
+	}
+	if ((DmaFlags & XPLMI_DMA_SRC_NONBLK) == XPLMI_DMA_SRC_NONBLK) {
+		SecurePtr->IsDestCopyStarted = (u8)TRUE;
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief	This function waits for the destination copy started by
+*			XLoader_SecureDestCopy, if any.
+*
+* @param	SecurePtr is pointer to the XLoader_SecureParams instance
+*
+* @return
+* 			- XST_SUCCESS on success.
+* 			- XLOADER_ERR_DMA_TRANSFER if DMA transfer fails to copy.
+*
+******************************************************************************/
+int XLoader_SecureDestCopyWait(XLoader_SecureParams *SecurePtr)
+{
+	int Status = XST_FAILURE;
+
+	if (SecurePtr->IsDestCopyStarted != (u8)TRUE) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	SecurePtr->IsDestCopyStarted = (u8)FALSE;
+	Status = XPlmi_WaitForNonBlkDma(XPLMI_PMCDMA_1);
+	if (Status != XST_SUCCESS) {
+		Status = XPlmi_UpdateStatus(XLOADER_ERR_DMA_TRANSFER, Status);
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+* @brief	This function checks if PMC DMA1 is free while partitions are read.
+*			QSPI and OSPI use their own DMA, SD uses its own ADMA and only
+*			PMC DMA0 when it stages data in PMC RAM. The other boot devices
+*			read through PMC DMA1.
+*
+* @param	PdiPtr is pointer to the XilPdi instance
+*
+* @return
+* 			- TRUE if PMC DMA1 is free, FALSE otherwise
+*
+******************************************************************************/
+static u8 XLoader_IsDma1Free(const XilPdi *PdiPtr)
+{
+	u8 IsFree = (u8)FALSE;
+
+	if ((PdiPtr->PdiIndex == XLOADER_QSPI_INDEX) ||
+		(PdiPtr->PdiIndex == XLOADER_OSPI_INDEX) ||
+		(PdiPtr->PdiIndex == XLOADER_SD_INDEX) ||
+		(PdiPtr->PdiIndex == XLOADER_SD_RAW_INDEX)) {
+		IsFree = (u8)TRUE;
+	}
+
+	return IsFree;
+}
+
 /*****************************************************************************/
 /**
 * @brief	This function checks if PPK is programmed.
@@ -60,6 +60,8 @@
 *       kpt  02/18/22 Removed Flags param from XLoader_SecureInit function prototype
 * 1.08  dc   07/12/22 Moved error codes related to buffer clear to xplmi_status.h
 *       obs  09/30/2024 Fixed Doxygen Warnings
+*       sb   10/16/2026 Added XLoader_SecureDestCopy and
+*                       XLoader_SecureDestCopyWait prototypes
 *
 * </pre>
 *
@@ -118,6 +120,8 @@ int XLoader_SecureCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr, u32 Size);
 int XLoader_SecureClear(void);
 int XLoader_SecureChunkCopy(XLoader_SecureParams *SecurePtr, u64 SrcAddr,
 			u8 Last, u32 BlockSize, u32 TotalSize);
+int XLoader_SecureDestCopy(XLoader_SecureParams *SecurePtr, u64 DestAddr);
+int XLoader_SecureDestCopyWait(XLoader_SecureParams *SecurePtr);
 int XLoader_CheckNonZeroPpk(void);
 u32 XLoader_GetAHWRoT(const u32* AHWRoTPtr);
 u32 XLoader_GetSHWRoT(const u32* SHWRoTPtr);
@@ -483,6 +483,57 @@ proc xgen_opts_file {libhandle} {
 		puts $file_handle "#define PLM_ENABLE_CFI_SELECTIVE_READ"
 	}
 
+	# Get plm_cdo_cache_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_cdo_cache_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Pre-decoded CDO command cache enable */"
+		puts $file_handle "#define PLM_CDO_CACHE"
+	}
+
+	# Get ipi_cmd_ring_baseaddr set by user, by default it is 0 (disabled)
+	set value [common::get_property CONFIG.ipi_cmd_ring_baseaddr $libhandle]
+	if {$value != 0} {
+		# Ring entries run with the rights of the IPI master owning the ring
+		set protected [common::get_property CONFIG.ipi_cmd_ring_protected $libhandle]
+		if {$protected != true} {
+			error "ERROR: ipi_cmd_ring_baseaddr requires ipi_cmd_ring_protected, \
+				the command ring of each IPI buffer index must be accessible to \
+				its master only"
+		}
+		puts $file_handle "\n/* IPI command ring enable */"
+		puts $file_handle "#define PLM_IPI_CMD_RING"
+		puts $file_handle "#define PLM_IPI_CMD_RING_PROTECTED"
+		puts $file_handle [format %s%X%s "#define XPAR_PLM_IPI_CMD_RING_BASEADDR (0x" [expr $value] "U)"]
+	}
+
+	# Get plm_binary_log_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_binary_log_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Binary debug log enable */"
+		puts $file_handle "#define PLM_BINARY_LOG"
+	}
+
+	# Get plm_boot_profile_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_boot_profile_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* Per partition boot time profile enable */"
+		puts $file_handle "#define PLM_BOOT_PROFILE"
+	}
+
+	# Get plm_ospi_prefetch_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_ospi_prefetch_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* OSPI sequential read prefetch enable */"
+		puts $file_handle "#define PLM_OSPI_PREFETCH"
+	}
+
+	# Get plm_ospi_dll_cache_en value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.plm_ospi_dll_cache_en $libhandle]
+	if {$value == true} {
+		puts $file_handle "\n/* OSPI DLL tap reuse enable */"
+		puts $file_handle "#define PLM_OSPI_DLL_CACHE"
+	}
+
 	# Get user_modules count set by user, by default it is 0
 	set value [common::get_property CONFIG.user_modules_count $libhandle]
 	puts $file_handle "\n/* Number of User Modules */"
@@ -0,0 +1,35 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file mb_interface.h
+*
+* Host replacement of mb_interface.h. The MicroBlaze extended address
+* loads and stores of xplmi_hw.h are routed to the mock register space of
+* xplmi_host.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef _MICROBLAZE_INTERFACE_H_
+#define _MICROBLAZE_INTERFACE_H_
+
+#include "xil_io.h"
+
+#define lwea(Addr)		XPlmiHost_In32((u64)(Addr))
+#define swea(Addr, Data)	XPlmiHost_Out32((u64)(Addr), (u32)(Data))
+#define lbuea(Addr)		Xil_In8((UINTPTR)(Addr))
+#define sbea(Addr, Data)	Xil_Out8((UINTPTR)(Addr), (u8)(Data))
+
+#endif /* _MICROBLAZE_INTERFACE_H_ */
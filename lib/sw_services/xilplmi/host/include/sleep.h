@@ -0,0 +1,34 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file sleep.h
+*
+* Host replacement of sleep.h. Delays requested by CDO commands are
+* recorded by the mock register space instead of being waited for.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef SLEEP_H
+#define SLEEP_H
+
+#include "xil_types.h"
+
+void XPlmiHost_Delay(u32 Useconds);
+
+#define usleep(Useconds)	(XPlmiHost_Delay((u32)(Useconds)), 0)
+#define sleep(Seconds)		(XPlmiHost_Delay((u32)(Seconds) * 1000000U), 0U)
+
+#endif /* SLEEP_H */
@@ -0,0 +1,94 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xil_io.h
+*
+* Host replacement of xil_io.h. Register accesses of the PLM sources are
+* routed to the mock register space of xplmi_host.c.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XIL_IO_H
+#define XIL_IO_H
+
+#include "xil_types.h"
+#include "xil_printf.h"
+#include "xstatus.h"
+
+#define INLINE		inline
+#define INST_SYNC
+#define DATA_SYNC
+#define SYNCHRONIZE_IO
+
+u32 XPlmiHost_In32(u64 Addr);
+void XPlmiHost_Out32(u64 Addr, u32 Value);
+
+static INLINE u8 Xil_In8(UINTPTR Addr)
+{
+	return (u8)(XPlmiHost_In32(Addr & ~(UINTPTR)3U) >> ((Addr & 3U) * 8U));
+}
+
+static INLINE void Xil_Out8(UINTPTR Addr, u8 Value)
+{
+	u32 Shift = (u32)(Addr & 3U) * 8U;
+	u32 Word = XPlmiHost_In32(Addr & ~(UINTPTR)3U);
+
+	Word = (Word & ~((u32)0xFFU << Shift)) | ((u32)Value << Shift);
+	XPlmiHost_Out32(Addr & ~(UINTPTR)3U, Word);
+}
+
+static INLINE u32 Xil_In32(UINTPTR Addr)
+{
+	return XPlmiHost_In32(Addr);
+}
+
+static INLINE u64 Xil_In64(UINTPTR Addr)
+{
+	return (u64)XPlmiHost_In32(Addr) | ((u64)XPlmiHost_In32(Addr + 4U) << 32U);
+}
+
+static INLINE void Xil_Out32(UINTPTR Addr, u32 Value)
+{
+	XPlmiHost_Out32(Addr, Value);
+}
+
+static INLINE void Xil_Out64(UINTPTR Addr, u64 Value)
+{
+	XPlmiHost_Out32(Addr, (u32)Value);
+	XPlmiHost_Out32(Addr + 4U, (u32)(Value >> 32U));
+}
+
+static INLINE int Xil_SecureOut32(UINTPTR Addr, u32 Value)
+{
+	Xil_Out32(Addr, Value);
+
+	return (Xil_In32(Addr) == Value) ? XST_SUCCESS : XST_FAILURE;
+}
+
+static INLINE u16 Xil_EndianSwap16(u16 Data)
+{
+	return (u16)((Data >> 8U) | (Data << 8U));
+}
+
+static INLINE u32 Xil_EndianSwap32(u32 Data)
+{
+	return __builtin_bswap32(Data);
+}
+
+/* Extended address accesses of xplmi_hw.h */
+#include "mb_interface.h"
+
+#endif /* XIL_IO_H */
@@ -0,0 +1,31 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xparameters.h
+*
+* Host replacement of the generated hardware parameters. Only the values
+* used by the CDO processing sources are provided.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XPARAMETERS_H
+#define XPARAMETERS_H
+
+#define XPAR_XCSUDMA_NUM_INSTANCES		2U
+#define XPAR_IOMODULE_INTC_MAX_INTR_SIZE	32U
+#define XPAR_IOMODULE_SINGLE_DEVICE_ID		0U
+
+#endif /* XPARAMETERS_H */
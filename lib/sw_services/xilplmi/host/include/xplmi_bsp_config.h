@@ -0,0 +1,33 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_bsp_config.h
+*
+* Host replacement of the generated xilplmi configuration.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*       sb   10/16/26 Enabled the pre-decoded CDO command cache
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XPLMI_BSP_CONFIG_H
+#define XPLMI_BSP_CONFIG_H
+
+#include "xparameters.h"
+
+#define XPAR_MAX_USER_MODULES		(0U)
+#define XPAR_PLM_VERSION_USER_DEFINED	(0U)
+#define PLM_CDO_CACHE
+
+#endif /* XPLMI_BSP_CONFIG_H */
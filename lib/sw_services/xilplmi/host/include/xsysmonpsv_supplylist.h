@@ -0,0 +1,30 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsysmonpsv_supplylist.h
+*
+* Host replacement of the generated SysMon supply list.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XSYSMONPSV_SUPPLYLIST_H
+#define XSYSMONPSV_SUPPLYLIST_H
+
+typedef enum {
+	XSYSMONPSV_HOST_SUPPLY,
+} XSysMonPsv_Supply;
+
+#endif /* XSYSMONPSV_SUPPLYLIST_H */
@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xtimer_config.h
+*
+* Host replacement of the generated xiltimer configuration, no timer
+* is used by the host build.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XTIMER_CONFIG_H
+#define XTIMER_CONFIG_H
+
+#endif /* XTIMER_CONFIG_H */
@@ -0,0 +1,329 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_boot_prof_diff.c
+*
+* This file contains a program which compares the boot profiles of two
+* boots. With PLM_BOOT_PROFILE enabled, the PLM prints one "BootProf:" line
+* per loaded partition and per image handoff at the end of the boot PDI
+* load. This program reads the lines from two boot logs, matches the
+* entries by image and partition ID and prints the change of the time
+* spent in each stage, per entry and for the whole boot.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xloader_defs.h"
+
+/************************** Constant Definitions *****************************/
+#define PROF_MAX_LINE_LEN	(1024U)	/**< Line of the boot log */
+#define PROF_MAX_ENTRIES	(1024U)	/**< Entries read from one log */
+#define PROF_TAG		"BootProf: Img "
+
+/**************************** Type Definitions *******************************/
+/** Boot profile read from one log */
+typedef struct {
+	XLoader_BootProfEntry Entry[PROF_MAX_ENTRIES];	/**< Entries */
+	u32 Total[PROF_MAX_ENTRIES];	/**< Total time of each entry */
+	u8 Matched[PROF_MAX_ENTRIES];	/**< Entry found in the other log */
+	u32 Cnt;			/**< Number of entries */
+} Prof_Log;
+
+/************************** Variable Definitions *****************************/
+/** Stage names in the order of the BootProf line */
+static const char *StageName[] = {
+	"DevRead", "Auth", "Decrypt", "Cdo", "Handoff", "Other",
+};
+
+/** Stage of each name in StageName */
+static const u32 StageId[] = {
+	XLOADER_BOOT_PROF_STAGE_DEV_READ, XLOADER_BOOT_PROF_STAGE_AUTH,
+	XLOADER_BOOT_PROF_STAGE_DECRYPT, XLOADER_BOOT_PROF_STAGE_CDO,
+	XLOADER_BOOT_PROF_STAGE_HANDOFF, XLOADER_BOOT_PROF_STAGE_OTHER,
+};
+
+static Prof_Log BaseLog;
+static Prof_Log NewLog;
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the usage of the program.
+ *
+ * @param	Name is the name of the program
+ *
+ *****************************************************************************/
+static void Prof_Usage(const char *Name)
+{
+	printf("Usage: %s [options] <base.log> <new.log>\n\n", Name);
+	printf("Options:\n");
+	printf("\t-t <us>\t\tOnly list entries whose total changed by more than us\n");
+	printf("\t-h\t\tHelp\n");
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function parses a "BootProf:" line of the boot log.
+ *
+ * @param	Line is the line starting at the "BootProf:" tag
+ * @param	Entry is updated with the entry on the line
+ * @param	Total is updated with the total time of the entry
+ *
+ * @return
+ * 		- XST_SUCCESS if the line is a complete entry
+ * 		- XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+static int Prof_ParseLine(const char *Line, XLoader_BootProfEntry *Entry,
+	u32 *Total)
+{
+	int Status = XST_FAILURE;
+	unsigned int Val[3U + XLOADER_BOOT_PROF_STAGES];
+	int Cnt;
+
+	Cnt = sscanf(Line, "BootProf: Img %x Prtn %x Size %u Total %u "
+		"DevRead %u Auth %u Decrypt %u Cdo %u Handoff %u Other %u",
+		&Val[0U], &Val[1U], &Val[2U], Total, &Val[3U], &Val[4U],
+		&Val[5U], &Val[6U], &Val[7U], &Val[8U]);
+	if (Cnt != (int)(4U + XLOADER_BOOT_PROF_STAGES)) {
+		goto END;
+	}
+
+	Entry->ImgId = Val[0U];
+	Entry->PrtnId = Val[1U];
+	Entry->Size = Val[2U];
+	for (u32 Index = 0U; Index < XLOADER_BOOT_PROF_STAGES; ++Index) {
+		Entry->TimeUs[StageId[Index]] = Val[3U + Index];
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads the boot profile entries of a boot log.
+ *		Lines may carry the time stamp the PLM prints in front of
+ *		them. If the log holds more than one profile, such as the
+ *		boot profile and one printed on request later, all entries
+ *		are read.
+ *
+ * @param	Name is the path of the log
+ * @param	Log is updated with the entries
+ *
+ * @return
+ * 		- XST_SUCCESS on success
+ * 		- XST_FAILURE if the log cannot be read or has no entries
+ *
+ *****************************************************************************/
+static int Prof_ReadLog(const char *Name, Prof_Log *Log)
+{
+	int Status = XST_FAILURE;
+	FILE *Fp = fopen(Name, "r");
+	char Line[PROF_MAX_LINE_LEN];
+	const char *Tag;
+
+	if (Fp == NULL) {
+		fprintf(stderr, "Cannot open %s\n", Name);
+		goto END;
+	}
+
+	while (fgets(Line, sizeof(Line), Fp) != NULL) {
+		Tag = strstr(Line, PROF_TAG);
+		if (Tag == NULL) {
+			continue;
+		}
+		if (Log->Cnt == PROF_MAX_ENTRIES) {
+			fprintf(stderr, "%s: only the first %u entries are "
+				"compared\n", Name, PROF_MAX_ENTRIES);
+			break;
+		}
+		if (Prof_ParseLine(Tag, &Log->Entry[Log->Cnt],
+			&Log->Total[Log->Cnt]) == XST_SUCCESS) {
+			++Log->Cnt;
+		}
+	}
+	fclose(Fp);
+
+	if (Log->Cnt == 0U) {
+		fprintf(stderr, "%s: no BootProf lines, was the PLM built with "
+			"PLM_BOOT_PROFILE?\n", Name);
+		goto END;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function finds the entry of the new log matching an
+ *		entry of the base log. Entries match on image and partition
+ *		ID; repeated IDs, such as an image loaded twice, match in the
+ *		order they were logged.
+ *
+ * @param	Entry is the entry of the base log
+ *
+ * @return
+ * 		- Index of the matching entry in NewLog
+ * 		- NewLog.Cnt if there is none
+ *
+ *****************************************************************************/
+static u32 Prof_FindMatch(const XLoader_BootProfEntry *Entry)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < NewLog.Cnt; ++Index) {
+		if ((NewLog.Matched[Index] == (u8)FALSE) &&
+			(NewLog.Entry[Index].ImgId == Entry->ImgId) &&
+			(NewLog.Entry[Index].PrtnId == Entry->PrtnId)) {
+			NewLog.Matched[Index] = (u8)TRUE;
+			break;
+		}
+	}
+
+	return Index;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the ID columns of an entry.
+ *
+ * @param	Entry is the entry
+ *
+ *****************************************************************************/
+static void Prof_PrintId(const XLoader_BootProfEntry *Entry)
+{
+	if (Entry->PrtnId == XLOADER_BOOT_PROF_HANDOFF_PRTN_ID) {
+		printf("0x%08x  handoff   ", Entry->ImgId);
+	}
+	else {
+		printf("0x%08x  0x%08x", Entry->ImgId, Entry->PrtnId);
+	}
+}
+
+int main(int Argc, char *Argv[])
+{
+	int Status = XST_FAILURE;
+	int Opt;
+	long Threshold = 0;
+	u32 Index;
+	u32 Match;
+	u32 Stage;
+	long Delta;
+	long long BaseSum[XLOADER_BOOT_PROF_STAGES] = {0};
+	long long NewSum[XLOADER_BOOT_PROF_STAGES] = {0};
+	long long BaseTotal = 0;
+	long long NewTotal = 0;
+
+	while ((Opt = getopt(Argc, Argv, "t:h")) != -1) {
+		switch (Opt) {
+		case 't':
+			Threshold = strtol(optarg, NULL, 0);
+			break;
+		case 'h':
+			Prof_Usage(Argv[0]);
+			Status = XST_SUCCESS;
+			goto END;
+		default:
+			Prof_Usage(Argv[0]);
+			goto END;
+		}
+	}
+	if ((Argc - optind) != 2) {
+		Prof_Usage(Argv[0]);
+		goto END;
+	}
+
+	Status = Prof_ReadLog(Argv[optind], &BaseLog);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = Prof_ReadLog(Argv[optind + 1], &NewLog);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	printf("Image       Partition      Base(us)    New(us)      Delta");
+	for (Stage = 0U; Stage < XLOADER_BOOT_PROF_STAGES; ++Stage) {
+		printf(" %9s", StageName[Stage]);
+	}
+	printf("\n");
+
+	for (Index = 0U; Index < BaseLog.Cnt; ++Index) {
+		const XLoader_BootProfEntry *Base = &BaseLog.Entry[Index];
+		const XLoader_BootProfEntry *New;
+
+		for (Stage = 0U; Stage < XLOADER_BOOT_PROF_STAGES; ++Stage) {
+			BaseSum[Stage] += Base->TimeUs[Stage];
+		}
+		BaseTotal += BaseLog.Total[Index];
+
+		Match = Prof_FindMatch(Base);
+		if (Match == NewLog.Cnt) {
+			Prof_PrintId(Base);
+			printf(" %10u          -  only in base\n",
+				BaseLog.Total[Index]);
+			continue;
+		}
+
+		New = &NewLog.Entry[Match];
+		Delta = (long)NewLog.Total[Match] - (long)BaseLog.Total[Index];
+		if (labs(Delta) < Threshold) {
+			continue;
+		}
+		Prof_PrintId(Base);
+		printf(" %10u %10u %+10ld", BaseLog.Total[Index],
+			NewLog.Total[Match], Delta);
+		for (Stage = 0U; Stage < XLOADER_BOOT_PROF_STAGES; ++Stage) {
+			printf(" %+9ld", (long)New->TimeUs[StageId[Stage]] -
+				(long)Base->TimeUs[StageId[Stage]]);
+		}
+		printf("\n");
+	}
+
+	for (Index = 0U; Index < NewLog.Cnt; ++Index) {
+		for (Stage = 0U; Stage < XLOADER_BOOT_PROF_STAGES; ++Stage) {
+			NewSum[Stage] += NewLog.Entry[Index].TimeUs[Stage];
+		}
+		NewTotal += NewLog.Total[Index];
+		if (NewLog.Matched[Index] == (u8)FALSE) {
+			Prof_PrintId(&NewLog.Entry[Index]);
+			printf("          - %10u  only in new\n",
+				NewLog.Total[Index]);
+		}
+	}
+
+	printf("\nStage         Base(us)    New(us)      Delta\n");
+	for (Stage = 0U; Stage < XLOADER_BOOT_PROF_STAGES; ++Stage) {
+		printf("%-9s %12lld %10lld %+10lld\n", StageName[Stage],
+			BaseSum[StageId[Stage]], NewSum[StageId[Stage]],
+			NewSum[StageId[Stage]] - BaseSum[StageId[Stage]]);
+	}
+	printf("%-9s %12lld %10lld %+10lld\n", "Total", BaseTotal, NewTotal,
+		NewTotal - BaseTotal);
+
+END:
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
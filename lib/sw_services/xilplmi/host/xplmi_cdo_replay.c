@@ -0,0 +1,816 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_cdo_replay.c
+*
+* This file contains the CDO replay benchmark. It runs the xilplmi CDO
+* parser and dispatcher on Linux against the mock register space of
+* xplmi_host.c and reports how fast the commands are processed.
+*
+* The CDOs are read from raw CDO files or extracted from the non-secure
+* CDO partitions of PDIs. Each pass feeds them to XPlmi_ProcessCdo in
+* chunks the way xilloader does, alternating between the two PMC RAM chunk
+* buffers, and a second set of passes feeds every CDO in one buffer; the
+* difference is the cost of the chunk boundaries. On request, a third set
+* of chunked passes dispatches the commands through the pre-decoded CDO
+* command cache. A last pass times every command handler to attribute the
+* processing time to modules and APIs.
+*
+* Commands of the generic module run their xilplmi handlers. Commands of
+* the other modules are accepted by a handler that only consumes their
+* payload, so their time shows the dispatch cost and not the work the
+* module does on silicon.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*       sb   10/16/26 Added passes through the pre-decoded command cache
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "xplmi_host.h"
+#include "xplmi_cdo.h"
+#include "xplmi_cmd.h"
+#include "xplmi_modules.h"
+#include "xplmi_generic.h"
+#include "xplmi_hw.h"
+#include "xilpdi.h"
+
+/************************** Constant Definitions *****************************/
+#define REPLAY_MAX_CDOS			(256U)	/**< CDO partitions replayed */
+#define REPLAY_MAX_APIS			(XPLMI_CMD_API_ID_MASK + 1U)
+#define REPLAY_DEFAULT_CHUNK_SIZE	(0x8000U)	/**< XLOADER_SECURE_CHUNK_SIZE */
+#define REPLAY_MAX_CHUNK_SIZE		(0x10000U)	/**< XLOADER_CHUNK_SIZE */
+#define REPLAY_MIN_CHUNK_SIZE		(XPLMI_CMD_LEN_TEMPBUF * XPLMI_WORD_LEN)
+#define REPLAY_DEFAULT_ITERATIONS	(10U)
+
+/**************************** Type Definitions *******************************/
+/** CDO to replay */
+typedef struct {
+	char Name[128U];	/**< File and partition it comes from */
+	const u32 *Words;	/**< CDO, header included */
+	u32 Len;		/**< Length in bytes */
+} Replay_Cdo;
+
+/** Chunk boundary events of one pass */
+typedef struct {
+	u64 Ns;			/**< Time in XPlmi_ProcessCdo */
+	u64 Chunks;		/**< Chunks processed */
+	u64 SplitCmds;		/**< Commands copied to the temporary buffer */
+	u64 ResumedCmds;	/**< Commands resumed in the next chunk */
+} Replay_Chunking;
+
+/** Handler statistics of one API */
+typedef struct {
+	u64 Cmds;		/**< Commands started */
+	u64 Calls;		/**< Handler calls, resumes included */
+	u64 Ns;			/**< Time in the handler, nested commands excluded */
+} Replay_ApiStats;
+
+/************************** Variable Definitions *****************************/
+static Replay_Cdo Cdos[REPLAY_MAX_CDOS];
+static u32 CdoCnt;
+static Replay_ApiStats ApiStats[XPLMI_MAX_MODULES][REPLAY_MAX_APIS];
+static const XPlmi_ModuleCmd *OrigCmds[XPLMI_MAX_MODULES];
+static XPlmi_ModuleCmd TimedCmds[XPLMI_MAX_MODULES][REPLAY_MAX_APIS];
+static XPlmi_ModuleCmd MockCmds[REPLAY_MAX_APIS];
+static XPlmi_Module MockModules[XPLMI_MAX_MODULES];
+static u64 NestedNs;
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns a monotonic time stamp.
+ *
+ * @return
+ * 			- Time in nanoseconds
+ *
+ *****************************************************************************/
+static u64 Replay_Now(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+
+	return ((u64)Ts.tv_sec * 1000000000ULL) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function is the handler of the modules that are not built
+ * 		for the host. The command payload is consumed and dropped.
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return
+ * 			- XST_SUCCESS always
+ *
+ *****************************************************************************/
+static int Replay_MockHandler(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function runs the original handler of a command and charges
+ * 		its time to the module and API of the command. The time of the
+ * 		commands it runs itself, procs for instance, is charged to them.
+ *
+ * @param	Cmd is pointer to the command structure
+ *
+ * @return
+ * 			- Status of the original handler
+ *
+ *****************************************************************************/
+static int Replay_TimedHandler(XPlmi_Cmd *Cmd)
+{
+	u32 ModuleId = (Cmd->CmdId & XPLMI_CMD_MODULE_ID_MASK) >>
+			XPLMI_CMD_MODULE_ID_SHIFT;
+	u32 ApiId = Cmd->CmdId & XPLMI_CMD_API_ID_MASK;
+	Replay_ApiStats *Api = &ApiStats[ModuleId][ApiId];
+	u64 OuterNs = NestedNs;
+	u64 Start;
+	u64 Elapsed;
+	int Status;
+
+	if (Cmd->ProcessedLen == 0U) {
+		Api->Cmds++;
+	}
+	Api->Calls++;
+	NestedNs = 0U;
+	Start = Replay_Now();
+	Status = OrigCmds[ModuleId][ApiId].Handler(Cmd);
+	Elapsed = Replay_Now() - Start;
+	Api->Ns += Elapsed - NestedNs;
+	NestedNs = OuterNs + Elapsed;
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function registers the generic module and a mock module for
+ * 		every other module ID.
+ *
+ *****************************************************************************/
+static void Replay_InitModules(void)
+{
+	u32 Index;
+
+	XPlmi_GenericInit();
+	for (Index = 0U; Index < REPLAY_MAX_APIS; Index++) {
+		MockCmds[Index].Handler = Replay_MockHandler;
+	}
+	for (Index = 0U; Index < XPLMI_MAX_MODULES; Index++) {
+		if (XPlmi_GetModule(Index) != NULL) {
+			continue;
+		}
+		MockModules[Index].Id = Index;
+		MockModules[Index].CmdAry = MockCmds;
+		MockModules[Index].CmdCnt = REPLAY_MAX_APIS;
+		XPlmi_ModuleRegister(&MockModules[Index]);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function routes every registered handler through
+ * 		Replay_TimedHandler.
+ *
+ *****************************************************************************/
+static void Replay_TimeHandlers(void)
+{
+	XPlmi_Module *Module;
+	u32 ModuleId;
+	u32 ApiId;
+
+	for (ModuleId = 0U; ModuleId < XPLMI_MAX_MODULES; ModuleId++) {
+		Module = XPlmi_GetModule(ModuleId);
+		if ((Module == NULL) || (Module->CmdCnt > REPLAY_MAX_APIS)) {
+			continue;
+		}
+		OrigCmds[ModuleId] = Module->CmdAry;
+		for (ApiId = 0U; ApiId < Module->CmdCnt; ApiId++) {
+			if (Module->CmdAry[ApiId].Handler != NULL) {
+				TimedCmds[ModuleId][ApiId].Handler = Replay_TimedHandler;
+			}
+		}
+		Module->CmdAry = TimedCmds[ModuleId];
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds a CDO to the replay list.
+ *
+ * @param	Name is the name of the CDO
+ * @param	Words is the CDO, header included
+ * @param	Len is the length of the CDO in bytes
+ *
+ * @return
+ * 			- XST_SUCCESS on success, XST_FAILURE if the list is full or
+ * 			the header is not a CDO header
+ *
+ *****************************************************************************/
+static int Replay_AddCdo(const char *Name, const u32 *Words, u32 Len)
+{
+	if ((CdoCnt == REPLAY_MAX_CDOS) ||
+		(Len < (XPLMI_CDO_HDR_LEN * XPLMI_WORD_LEN)) ||
+		(Words[1U] != XPLMI_CDO_HDR_IDN_WRD)) {
+		return XST_FAILURE;
+	}
+	(void)snprintf(Cdos[CdoCnt].Name, sizeof(Cdos[CdoCnt].Name), "%s", Name);
+	Cdos[CdoCnt].Words = Words;
+	/* Trailing padding of the partition is not part of the CDO */
+	if ((Words[3U] + XPLMI_CDO_HDR_LEN) < (Len / XPLMI_WORD_LEN)) {
+		Len = (Words[3U] + XPLMI_CDO_HDR_LEN) * XPLMI_WORD_LEN;
+	}
+	Cdos[CdoCnt].Len = Len;
+	CdoCnt++;
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function adds the CDO partitions of a PDI to the replay
+ * 		list. Encrypted, authenticated and checksummed partitions are
+ * 		skipped, as are PDIs whose meta header is encrypted.
+ *
+ * @param	Name is the file name
+ * @param	Pdi is the PDI
+ * @param	Len is the length of the PDI in bytes
+ *
+ * @return
+ * 			- XST_SUCCESS on success, XST_FAILURE if the PDI is malformed
+ *
+ *****************************************************************************/
+static int Replay_AddPdi(const char *Name, const u8 *Pdi, u32 Len)
+{
+	const XilPdi_ImgHdrTbl *Iht;
+	const XilPdi_PrtnHdr *Ph;
+	u32 IhtOfst = 0U;
+	u32 Ident;
+	u32 Index;
+	u32 Type;
+	u64 Start;
+	u64 End;
+	char PrtnName[128U];
+
+	(void)memcpy(&Ident, &Pdi[XIH_BH_IMAGE_IDENT_OFFSET], sizeof(Ident));
+	if (Ident == XIH_BH_IMAGE_IDENT) {
+		(void)memcpy(&IhtOfst, &Pdi[XIH_BH_META_HDR_OFFSET], sizeof(IhtOfst));
+	}
+	if (((u64)IhtOfst + XIH_IHT_LEN) > Len) {
+		return XST_FAILURE;
+	}
+	Iht = (const XilPdi_ImgHdrTbl *)(const void *)&Pdi[IhtOfst];
+	(void)memcpy(&Ident, &Pdi[IhtOfst + XIH_IHT_IDENT_STRING_OFFSET],
+			sizeof(Ident));
+	if ((Ident != XIH_IHT_FPDI_IDENT_VAL) && (Ident != XIH_IHT_PPDI_IDENT_VAL)) {
+		return XST_FAILURE;
+	}
+	if (Iht->EncKeySrc != 0U) {
+		fprintf(stderr, "%s: meta header is encrypted, skipped\n", Name);
+		return XST_SUCCESS;
+	}
+
+	for (Index = 0U; Index < Iht->NoOfPrtns; Index++) {
+		Start = ((u64)Iht->PrtnHdrAddr * XIH_PRTN_WORD_LEN) +
+			((u64)Index * XIH_PH_LEN);
+		if ((Start + XIH_PH_LEN) > Len) {
+			return XST_FAILURE;
+		}
+		Ph = (const XilPdi_PrtnHdr *)(const void *)&Pdi[Start];
+		Type = Ph->PrtnAttrb & XIH_PH_ATTRB_PRTN_TYPE_MASK;
+		if (Type != XIH_PH_ATTRB_PRTN_TYPE_CDO) {
+			continue;
+		}
+		if ((Ph->EncStatus != 0U) || (Ph->AuthCertificateOfst != 0U) ||
+			((Ph->PrtnAttrb & XIH_PH_ATTRB_CHECKSUM_MASK) != 0U)) {
+			fprintf(stderr, "%s: partition 0x%x is secure, skipped\n",
+				Name, Ph->PrtnId);
+			continue;
+		}
+		Start = (u64)Ph->DataWordOfst * XIH_PRTN_WORD_LEN;
+		End = Start + ((u64)Ph->UnEncDataWordLen * XIH_PRTN_WORD_LEN);
+		if (End > Len) {
+			return XST_FAILURE;
+		}
+		(void)snprintf(PrtnName, sizeof(PrtnName), "%s:0x%x", Name,
+				Ph->PrtnId);
+		if (Replay_AddCdo(PrtnName, (const u32 *)(const void *)&Pdi[Start],
+			(u32)(End - Start)) != XST_SUCCESS) {
+			fprintf(stderr, "%s: not a CDO, skipped\n", PrtnName);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a raw CDO or a PDI and adds its CDOs to the
+ * 		replay list.
+ *
+ * @param	Name is the file name
+ *
+ * @return
+ * 			- XST_SUCCESS on success, XST_FAILURE on error
+ *
+ *****************************************************************************/
+static int Replay_LoadFile(const char *Name)
+{
+	int Status = XST_FAILURE;
+	FILE *File;
+	u8 *Buf = NULL;
+	long Len;
+
+	File = fopen(Name, "rb");
+	if (File == NULL) {
+		perror(Name);
+		goto END;
+	}
+	if ((fseek(File, 0, SEEK_END) != 0) || ((Len = ftell(File)) < 0) ||
+		(Len > (long)0x7FFFFFFF) || (fseek(File, 0, SEEK_SET) != 0)) {
+		perror(Name);
+		goto END;
+	}
+	/* Word aligned and zero padded to a whole number of words */
+	Buf = calloc(((size_t)Len + 3U) & ~(size_t)3U, 1U);
+	if ((Buf == NULL) || (fread(Buf, 1U, (size_t)Len, File) != (size_t)Len)) {
+		perror(Name);
+		goto END;
+	}
+	if ((Len >= (long)(XPLMI_CDO_HDR_LEN * XPLMI_WORD_LEN)) &&
+		(((const u32 *)(void *)Buf)[1U] == XPLMI_CDO_HDR_IDN_WRD)) {
+		Status = Replay_AddCdo(Name, (const u32 *)(void *)Buf, (u32)Len);
+	} else if (Len >= (long)(XIH_BH_META_HDR_OFFSET + XPLMI_WORD_LEN)) {
+		Status = Replay_AddPdi(Name, Buf, (u32)Len);
+	}
+	if (Status != XST_SUCCESS) {
+		fprintf(stderr, "%s: neither a CDO nor a PDI\n", Name);
+	} else {
+		/* The CDOs point into the buffer */
+		Buf = NULL;
+	}
+
+END:
+	if (File != NULL) {
+		(void)fclose(File);
+	}
+	free(Buf);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes a CDO in chunks like XLoader_ProcessCdo
+ * 		does for non-secure partitions: each chunk is copied to one of
+ * 		the two PMC RAM chunk buffers and the other one is announced as
+ * 		the next chunk address.
+ *
+ * @param	Cdo is the CDO to process
+ * @param	ChunkSize is the chunk size in bytes
+ * @param	CacheKey is the key of the CDO in the command cache, 0 to
+ * 		process it without the cache
+ * @param	Chunking accumulates the chunk boundary events
+ *
+ * @return
+ * 			- XST_SUCCESS on success, error code of XPlmi_ProcessCdo on
+ * 			failure
+ *
+ *****************************************************************************/
+static int Replay_ProcessChunked(const Replay_Cdo *Cdo, u32 ChunkSize,
+	u32 CacheKey, Replay_Chunking *Chunking)
+{
+	int Status = XST_FAILURE;
+	XPlmiCdo CdoInst;
+	u32 Key[XPLMI_CDO_CACHE_KEY_LEN / XPLMI_WORD_LEN] = {0U};
+	u64 Start;
+	u32 ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+	u32 ChunkLen = ChunkSize;
+	u32 Offset = 0U;
+	u32 Remaining = Cdo->Len;
+
+	Status = XPlmi_InitCdo(&CdoInst);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	CdoInst.NextChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+	if (CacheKey != 0U) {
+		/* Stands for the verified partition hash xilloader uses */
+		Key[0U] = CacheKey;
+		CdoInst.Cache = XPlmi_CdoCacheOpen((const u8 *)Key);
+	}
+
+	while (Remaining > 0U) {
+		if (Remaining < ChunkLen) {
+			ChunkLen = Remaining;
+		}
+		(void)memcpy((void *)(UINTPTR)ChunkAddr,
+			(const u8 *)Cdo->Words + Offset, ChunkLen);
+		CdoInst.BufPtr = (u32 *)(UINTPTR)ChunkAddr;
+		CdoInst.BufLen = ChunkLen >> XPLMI_WORD_LEN_SHIFT;
+		Offset += ChunkLen;
+		Remaining -= ChunkLen;
+
+		if (Remaining > 0U) {
+			/* Same buffer selection as the loader */
+			ChunkAddr += ChunkLen;
+			if (ChunkAddr > XPLMI_PMCRAM_CHUNK_MEMORY_1) {
+				ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY;
+			} else {
+				ChunkAddr = XPLMI_PMCRAM_CHUNK_MEMORY_1;
+			}
+			CdoInst.NextChunkAddr = ChunkAddr;
+		}
+
+		Start = Replay_Now();
+		Status = XPlmi_ProcessCdo(&CdoInst);
+		Chunking->Ns += Replay_Now() - Start;
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Chunking->Chunks++;
+		if (CdoInst.CopiedCmdLen != 0U) {
+			Chunking->SplitCmds++;
+		}
+		if (CdoInst.CmdState == XPLMI_CMD_STATE_RESUME) {
+			Chunking->ResumedCmds++;
+		}
+	}
+	Status = XST_SUCCESS;
+
+END:
+	XPlmi_CdoCacheClose(CdoInst.Cache, (Status == XST_SUCCESS) ? (u8)TRUE :
+		(u8)FALSE);
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes a CDO from a single buffer holding all
+ * 		of it, without chunk boundaries.
+ *
+ * @param	Cdo is the CDO to process
+ * @param	Buf is a buffer below 4GB of at least the CDO length
+ * @param	Ns accumulates the time spent in XPlmi_ProcessCdo
+ *
+ * @return
+ * 			- XST_SUCCESS on success, error code of XPlmi_ProcessCdo on
+ * 			failure
+ *
+ *****************************************************************************/
+static int Replay_ProcessWhole(const Replay_Cdo *Cdo, u32 *Buf, u64 *Ns)
+{
+	int Status = XST_FAILURE;
+	XPlmiCdo CdoInst;
+	u64 Start;
+
+	Status = XPlmi_InitCdo(&CdoInst);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	(void)memcpy(Buf, Cdo->Words, Cdo->Len);
+	CdoInst.BufPtr = Buf;
+	CdoInst.BufLen = Cdo->Len >> XPLMI_WORD_LEN_SHIFT;
+	CdoInst.NextChunkAddr = (u32)(UINTPTR)Buf;
+	Start = Replay_Now();
+	Status = XPlmi_ProcessCdo(&CdoInst);
+	*Ns += Replay_Now() - Start;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function replays all CDOs once, starting from a clean
+ * 		register space.
+ *
+ * @param	ChunkSize is the chunk size in bytes, 0 to use WholeBuf
+ * @param	WholeBuf is the single buffer used when ChunkSize is 0
+ * @param	Cached is TRUE to use the command cache in chunked passes
+ * @param	Chunking accumulates the processing time and the chunk
+ * 		boundary events
+ *
+ * @return
+ * 			- XST_SUCCESS on success, error code on failure
+ *
+ *****************************************************************************/
+static int Replay_Pass(u32 ChunkSize, u32 *WholeBuf, u8 Cached,
+	Replay_Chunking *Chunking)
+{
+	int Status = XST_FAILURE;
+	u32 Index;
+
+	XPlmiHost_Reset();
+	for (Index = 0U; Index < CdoCnt; Index++) {
+		if (ChunkSize != 0U) {
+			Status = Replay_ProcessChunked(&Cdos[Index], ChunkSize,
+					(Cached == (u8)TRUE) ? (Index + 1U) : 0U, Chunking);
+		} else {
+			Status = Replay_ProcessWhole(&Cdos[Index], WholeBuf,
+					&Chunking->Ns);
+		}
+		if (Status != XST_SUCCESS) {
+			fprintf(stderr, "%s: CDO processing failed, 0x%08x\n",
+				Cdos[Index].Name, (u32)Status);
+			goto END;
+		}
+	}
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the handler time per module, and per API
+ * 		when requested.
+ *
+ * @param	Iterations is the number of timed passes
+ * @param	PerApi is TRUE to print every API
+ *
+ * @return
+ * 			- Number of commands of one pass
+ *
+ *****************************************************************************/
+static u64 Replay_PrintModules(u32 Iterations, u8 PerApi)
+{
+	Replay_ApiStats Total;
+	Replay_ApiStats Module;
+	u64 Cmds = 0U;
+	u64 Ns = 0U;
+	u32 ModuleId;
+	u32 ApiId;
+
+	for (ModuleId = 0U; ModuleId < XPLMI_MAX_MODULES; ModuleId++) {
+		for (ApiId = 0U; ApiId < REPLAY_MAX_APIS; ApiId++) {
+			Ns += ApiStats[ModuleId][ApiId].Ns;
+		}
+	}
+	if (Ns == 0U) {
+		Ns = 1U;
+	}
+
+	printf("\n%-10s %-6s %12s %12s %12s %8s %6s\n", "Module", "API",
+		"Cmds/pass", "Calls/pass", "ms/pass", "ns/cmd", "%");
+	memset(&Total, 0, sizeof(Total));
+	for (ModuleId = 0U; ModuleId < XPLMI_MAX_MODULES; ModuleId++) {
+		memset(&Module, 0, sizeof(Module));
+		for (ApiId = 0U; ApiId < REPLAY_MAX_APIS; ApiId++) {
+			const Replay_ApiStats *Api = &ApiStats[ModuleId][ApiId];
+
+			if (Api->Calls == 0U) {
+				continue;
+			}
+			Module.Cmds += Api->Cmds;
+			Module.Calls += Api->Calls;
+			Module.Ns += Api->Ns;
+			if (PerApi == (u8)TRUE) {
+				printf("%-10u %-6u %12.1f %12.1f %12.4f %8.0f %6.2f\n",
+					ModuleId, ApiId,
+					(double)Api->Cmds / Iterations,
+					(double)Api->Calls / Iterations,
+					(double)Api->Ns / Iterations / 1e6,
+					(double)Api->Ns / (double)(Api->Cmds ? Api->Cmds : 1U),
+					100.0 * (double)Api->Ns / (double)Ns);
+			}
+		}
+		if (Module.Calls == 0U) {
+			continue;
+		}
+		printf("%-10u %-6s %12.1f %12.1f %12.4f %8.0f %6.2f%s\n", ModuleId,
+			"all", (double)Module.Cmds / Iterations,
+			(double)Module.Calls / Iterations,
+			(double)Module.Ns / Iterations / 1e6,
+			(double)Module.Ns / (double)(Module.Cmds ? Module.Cmds : 1U),
+			100.0 * (double)Module.Ns / (double)Ns,
+			(ModuleId == XPLMI_MODULE_GENERIC_ID) ? "" : "  (mock)");
+		Cmds += Module.Cmds;
+	}
+
+	return Cmds / Iterations;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the command line help.
+ *
+ * @param	Prog is the program name
+ *
+ *****************************************************************************/
+static void Replay_Usage(const char *Prog)
+{
+	fprintf(stderr,
+		"Usage: %s [options] <file.pdi|file.cdo>...\n\n"
+		"Options:\n"
+		"\t-c <bytes>\tChunk size, 0x%x by default, 0x%x for SD boot\n"
+		"\t-n <count>\tTimed passes, %u by default\n"
+		"\t-t <file>\tWrite the register traffic of one pass to file\n"
+		"\t-a\t\tPrint the handler time of every API\n"
+		"\t-k\t\tAlso time chunked passes through the command cache\n"
+		"\t-h\t\tHelp\n", Prog, REPLAY_DEFAULT_CHUNK_SIZE,
+		REPLAY_MAX_CHUNK_SIZE, REPLAY_DEFAULT_ITERATIONS);
+}
+
+int main(int argc, char *argv[])
+{
+	int Status = XST_FAILURE;
+	u32 ChunkSize = REPLAY_DEFAULT_CHUNK_SIZE;
+	u32 Iterations = REPLAY_DEFAULT_ITERATIONS;
+	const char *TraceName = NULL;
+	FILE *Trace = NULL;
+	u8 PerApi = (u8)FALSE;
+	u8 Cached = (u8)FALSE;
+	Replay_Chunking Chunking;
+	Replay_Chunking Whole;
+	Replay_Chunking Cache;
+	XPlmiHost_Stats Traffic;
+	u32 *WholeBuf = NULL;
+	u32 MaxLen = 0U;
+	u64 Words = 0U;
+	u64 ChunkedNs;
+	u64 WholeNs;
+	u64 CachedNs = 0U;
+	u64 Cmds;
+	u32 Index;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "c:n:t:akh")) != -1) {
+		switch (Opt) {
+		case 'c':
+			ChunkSize = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'n':
+			Iterations = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 't':
+			TraceName = optarg;
+			break;
+		case 'a':
+			PerApi = (u8)TRUE;
+			break;
+		case 'k':
+			Cached = (u8)TRUE;
+			break;
+		default:
+			Replay_Usage(argv[0]);
+			goto END;
+		}
+	}
+	if ((optind == argc) || (Iterations == 0U) ||
+		(ChunkSize < REPLAY_MIN_CHUNK_SIZE) ||
+		(ChunkSize > REPLAY_MAX_CHUNK_SIZE) ||
+		((ChunkSize % XPLMI_WORD_LEN) != 0U)) {
+		Replay_Usage(argv[0]);
+		goto END;
+	}
+
+	for (Index = (u32)optind; Index < (u32)argc; Index++) {
+		if (Replay_LoadFile(argv[Index]) != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	if (CdoCnt == 0U) {
+		fprintf(stderr, "No CDO to replay\n");
+		goto END;
+	}
+	for (Index = 0U; Index < CdoCnt; Index++) {
+		Words += Cdos[Index].Len / XPLMI_WORD_LEN;
+		if (Cdos[Index].Len > MaxLen) {
+			MaxLen = Cdos[Index].Len;
+		}
+	}
+
+	if (XPlmiHost_Init() != XST_SUCCESS) {
+		fprintf(stderr, "PMC RAM and PSM RAM cannot be mapped at their "
+			"addresses\n");
+		goto END;
+	}
+	WholeBuf = XPlmiHost_AllocLow(MaxLen);
+	if (WholeBuf == NULL) {
+		fprintf(stderr, "No memory below 4GB for 0x%x bytes\n", MaxLen);
+		goto END;
+	}
+	Replay_InitModules();
+
+	/* Warm up, check that every CDO goes through and record its traffic */
+	if (TraceName != NULL) {
+		Trace = fopen(TraceName, "w");
+		if (Trace == NULL) {
+			perror(TraceName);
+			goto END;
+		}
+		XPlmiHost_SetTrace(Trace);
+	}
+	memset(&Chunking, 0, sizeof(Chunking));
+	Status = Replay_Pass(ChunkSize, NULL, (u8)FALSE, &Chunking);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Traffic = *XPlmiHost_GetStats();
+	if (Trace != NULL) {
+		(void)fclose(Trace);
+		Trace = NULL;
+		XPlmiHost_SetTrace(NULL);
+	}
+
+	/* Copies to the chunk buffers overlap processing on silicon, not timed */
+	memset(&Chunking, 0, sizeof(Chunking));
+	for (Index = 0U; Index < Iterations; Index++) {
+		Status = Replay_Pass(ChunkSize, NULL, (u8)FALSE, &Chunking);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	ChunkedNs = Chunking.Ns / Iterations;
+
+	memset(&Whole, 0, sizeof(Whole));
+	for (Index = 0U; Index < Iterations; Index++) {
+		Status = Replay_Pass(0U, WholeBuf, (u8)FALSE, &Whole);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+	WholeNs = Whole.Ns / Iterations;
+
+	/* The first pass records the commands, the timed ones replay them */
+	if (Cached == (u8)TRUE) {
+		memset(&Cache, 0, sizeof(Cache));
+		for (Index = 0U; Index <= Iterations; Index++) {
+			if (Index == 1U) {
+				memset(&Cache, 0, sizeof(Cache));
+			}
+			Status = Replay_Pass(ChunkSize, NULL, (u8)TRUE, &Cache);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		CachedNs = Cache.Ns / Iterations;
+	}
+
+	Replay_TimeHandlers();
+	for (Index = 0U; Index < Iterations; Index++) {
+		Status = Replay_Pass(ChunkSize, NULL, (u8)FALSE, &Whole);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	printf("%u CDO(s), %llu words, chunk size 0x%x, %u pass(es)\n", CdoCnt,
+		(unsigned long long)Words, ChunkSize, Iterations);
+	Cmds = Replay_PrintModules(Iterations, PerApi);
+	printf("\nCommands/pass         %12llu\n", (unsigned long long)Cmds);
+	printf("Chunked               %12.4f ms/pass %10.3f Mcmd/s\n",
+		(double)ChunkedNs / 1e6, (double)Cmds * 1e3 / (double)ChunkedNs);
+	printf("Single buffer         %12.4f ms/pass %10.3f Mcmd/s\n",
+		(double)WholeNs / 1e6, (double)Cmds * 1e3 / (double)WholeNs);
+	if (Cached == (u8)TRUE) {
+		printf("Chunked, cached       %12.4f ms/pass %10.3f Mcmd/s\n",
+			(double)CachedNs / 1e6, (double)Cmds * 1e3 / (double)CachedNs);
+	}
+	printf("Chunk overhead        %12.4f ms/pass %10.2f %%\n",
+		((double)ChunkedNs - (double)WholeNs) / 1e6,
+		100.0 * ((double)ChunkedNs - (double)WholeNs) / (double)ChunkedNs);
+	printf("Chunks/pass           %12llu\n",
+		(unsigned long long)(Chunking.Chunks / Iterations));
+	printf("Split commands/pass   %12llu\n",
+		(unsigned long long)(Chunking.SplitCmds / Iterations));
+	printf("Resumed commands/pass %12llu\n",
+		(unsigned long long)(Chunking.ResumedCmds / Iterations));
+	printf("\nRegister traffic/pass: %llu writes, %llu reads, %llu polls, "
+		"%llu registers\n", (unsigned long long)Traffic.Writes,
+		(unsigned long long)Traffic.Reads, (unsigned long long)Traffic.Polls,
+		(unsigned long long)Traffic.Regs);
+	printf("DMA/pass: %llu transfers, %llu bytes; delays not waited for: "
+		"%llu us\n", (unsigned long long)Traffic.DmaXfers,
+		(unsigned long long)Traffic.DmaBytes,
+		(unsigned long long)Traffic.DelayUs);
+
+END:
+	if (Trace != NULL) {
+		(void)fclose(Trace);
+	}
+	return (Status == XST_SUCCESS) ? EXIT_SUCCESS : EXIT_FAILURE;
+}
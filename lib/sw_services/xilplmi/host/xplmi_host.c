@@ -0,0 +1,701 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_host.c
+*
+* This file contains the host environment of the CDO replay benchmark.
+*
+* PMC RAM and PSM RAM are mapped at their Versal addresses, so the chunk
+* buffers, the temporary command buffer and the proc buffers live where
+* the PLM keeps them and the 32-bit address arithmetic of the CDO parser
+* holds on a 64-bit host. Every other address is a register of a sparse
+* mock register space: writes are stored and counted, reads return the
+* last written value, mask polls are counted and succeed at once, leaving
+* the expected value in the register, and delays are added up instead of
+* being waited for. When a trace file is given, every register access,
+* poll, DMA transfer and delay is written to it, one per line.
+*
+* The PLM services the CDO processing sources call into, DMA, SSIT
+* synchronization, event logging and similar, are replaced by minimal
+* versions built on the mock register space.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#define _GNU_SOURCE
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "xplmi_host.h"
+#include "xplmi.h"
+#include "xplmi_dma.h"
+#include "xplmi_util.h"
+#include "xplmi_generic.h"
+#include "xplmi_plat.h"
+#include "xplmi_ssit.h"
+#include "xplmi_event_logging.h"
+#include "xplmi_sysmon.h"
+#include "xplmi_tamper.h"
+#include "xplmi_wdt.h"
+#include "xplmi_err_common.h"
+#include "xil_sutil.h"
+#include "xcfupmc.h"
+
+/************************** Constant Definitions *****************************/
+#define XPLMI_HOST_REG_MIN_SLOTS	(1U << 12U)	/**< Initial size of the
+							register table */
+#define XPLMI_HOST_REG_EMPTY		(~(u64)0U)	/**< Unused slot */
+#define XPLMI_HOST_MAX_WINDOWS		(8U)	/**< Host memory windows */
+#define XPLMI_HOST_BOARD_PARAMS_ADDR	(XPLMI_PMCRAM_BASEADDR + \
+					XPLMI_PMCRAM_LEN - 0x100U)	/**< Board
+							parameters, unused PMC RAM */
+
+/**************************** Type Definitions *******************************/
+/** Slot of the mock register table */
+typedef struct {
+	u64 Addr;	/**< Register address */
+	u32 Value;	/**< Last written value */
+} XPlmiHost_Reg;
+
+/** Address range backed by host memory */
+typedef struct {
+	u64 Base;	/**< First address */
+	u64 Len;	/**< Length in bytes */
+} XPlmiHost_Window;
+
+/************************** Variable Definitions *****************************/
+static XPlmiHost_Reg *Regs;
+static u32 RegSlots;
+static XPlmiHost_Stats Stats;
+static XPlmiHost_Window Windows[XPLMI_HOST_MAX_WINDOWS];
+static u32 WindowCnt;
+static FILE *TraceFile;
+
+/*****************************************************************************/
+/**
+ * @brief	This function maps host memory at a fixed address below 4GB.
+ *
+ * @param	Addr is the address, 0 to let the kernel choose one
+ * @param	Len is the length in bytes
+ *
+ * @return
+ * 			- Pointer to the memory, NULL on failure
+ *
+ *****************************************************************************/
+static void *XPlmiHost_Map(u64 Addr, u64 Len)
+{
+	int Flags = MAP_PRIVATE | MAP_ANONYMOUS;
+	void *Ptr;
+
+	if (WindowCnt == XPLMI_HOST_MAX_WINDOWS) {
+		return NULL;
+	}
+	if (Addr != 0U) {
+		Flags |= MAP_FIXED_NOREPLACE;
+	} else {
+		Flags |= MAP_32BIT;
+	}
+	Ptr = mmap((void *)(UINTPTR)Addr, Len, PROT_READ | PROT_WRITE, Flags,
+			-1, 0);
+	if ((Ptr == MAP_FAILED) || ((Addr != 0U) && (Ptr != (void *)(UINTPTR)Addr)) ||
+		(((UINTPTR)Ptr + Len) > 0x100000000ULL)) {
+		return NULL;
+	}
+	Windows[WindowCnt].Base = (u64)(UINTPTR)Ptr;
+	Windows[WindowCnt].Len = Len;
+	WindowCnt++;
+
+	return Ptr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks whether an address is backed by host memory.
+ *
+ * @param	Addr is the address
+ *
+ * @return
+ * 			- TRUE if it is host memory, FALSE if it is a register
+ *
+ *****************************************************************************/
+static u8 XPlmiHost_IsMemory(u64 Addr)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < WindowCnt; Index++) {
+		if ((Addr - Windows[Index].Base) < Windows[Index].Len) {
+			return (u8)TRUE;
+		}
+	}
+
+	return (u8)FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the slot of a register, the empty slot
+ * 		the register would take if it was never written.
+ *
+ * @param	Addr is the register address
+ *
+ * @return
+ * 			- Pointer to the slot
+ *
+ *****************************************************************************/
+static XPlmiHost_Reg *XPlmiHost_FindReg(u64 Addr)
+{
+	u32 Mask = RegSlots - 1U;
+	u32 Index = (u32)(((Addr >> 2U) * 0x9E3779B97F4A7C15ULL) >> 32U) & Mask;
+
+	while ((Regs[Index].Addr != XPLMI_HOST_REG_EMPTY) &&
+		(Regs[Index].Addr != Addr)) {
+		Index = (Index + 1U) & Mask;
+	}
+
+	return &Regs[Index];
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function doubles the register table.
+ *
+ *****************************************************************************/
+static void XPlmiHost_GrowRegs(void)
+{
+	XPlmiHost_Reg *Old = Regs;
+	u32 OldSlots = RegSlots;
+	XPlmiHost_Reg *Slot;
+	u32 Index;
+
+	RegSlots = OldSlots * 2U;
+	Regs = malloc(sizeof(*Regs) * RegSlots);
+	if (Regs == NULL) {
+		perror("xplmi_host");
+		exit(EXIT_FAILURE);
+	}
+	memset(Regs, 0xFF, sizeof(*Regs) * RegSlots);
+	for (Index = 0U; Index < OldSlots; Index++) {
+		if (Old[Index].Addr != XPLMI_HOST_REG_EMPTY) {
+			Slot = XPlmiHost_FindReg(Old[Index].Addr);
+			*Slot = Old[Index];
+		}
+	}
+	free(Old);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a register value without recording it.
+ *
+ * @param	Addr is the register address
+ * @param	Value is the value
+ *
+ *****************************************************************************/
+static void XPlmiHost_SetReg(u64 Addr, u32 Value)
+{
+	XPlmiHost_Reg *Slot = XPlmiHost_FindReg(Addr);
+
+	if (Slot->Addr == XPLMI_HOST_REG_EMPTY) {
+		if (((Stats.Regs + 1U) * 2U) > RegSlots) {
+			XPlmiHost_GrowRegs();
+			Slot = XPlmiHost_FindReg(Addr);
+		}
+		Slot->Addr = Addr;
+		Stats.Regs++;
+	}
+	Slot->Value = Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function maps PMC RAM and PSM RAM and sets up the mock
+ * 		register space.
+ *
+ * @return
+ * 			- XST_SUCCESS on success, XST_FAILURE if the RAMs cannot
+ * 			be mapped at their addresses
+ *
+ *****************************************************************************/
+int XPlmiHost_Init(void)
+{
+	int Status = XST_FAILURE;
+
+	if ((XPlmiHost_Map(XPLMI_PMCRAM_BASEADDR, XPLMI_PMCRAM_LEN) == NULL) ||
+		(XPlmiHost_Map(XPLMI_PSM_RAM_BASE_ADDR, (u64)XPLMI_PSM_RAM_HIGH_ADDR -
+			XPLMI_PSM_RAM_BASE_ADDR + 1U) == NULL)) {
+		goto END;
+	}
+
+	RegSlots = XPLMI_HOST_REG_MIN_SLOTS;
+	Regs = malloc(sizeof(*Regs) * RegSlots);
+	if (Regs == NULL) {
+		goto END;
+	}
+	XPlmiHost_Reset();
+	*XPlmi_GetLpdInitialized() = LPD_INITIALIZED;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function sets the file receiving the register traffic.
+ *
+ * @param	Trace is the file, NULL to stop tracing
+ *
+ *****************************************************************************/
+void XPlmiHost_SetTrace(FILE *Trace)
+{
+	TraceFile = Trace;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function clears the mock register space and its statistics.
+ *
+ *****************************************************************************/
+void XPlmiHost_Reset(void)
+{
+	memset(Regs, 0xFF, sizeof(*Regs) * RegSlots);
+	memset(&Stats, 0, sizeof(Stats));
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the register traffic recorded since the
+ * 		last reset.
+ *
+ * @return
+ * 			- Pointer to the statistics
+ *
+ *****************************************************************************/
+const XPlmiHost_Stats *XPlmiHost_GetStats(void)
+{
+	return &Stats;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function allocates host memory below 4GB, which the 32-bit
+ * 		address fields of the CDO parser can hold.
+ *
+ * @param	Size is the size in bytes
+ *
+ * @return
+ * 			- Pointer to the memory, NULL on failure
+ *
+ *****************************************************************************/
+void *XPlmiHost_AllocLow(u32 Size)
+{
+	return XPlmiHost_Map(0U, Size);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a 32-bit word of memory or of a register.
+ *
+ * @param	Addr is the address
+ *
+ * @return
+ * 			- Value read
+ *
+ *****************************************************************************/
+u32 XPlmiHost_In32(u64 Addr)
+{
+	const XPlmiHost_Reg *Slot;
+	u32 Value;
+
+	if (XPlmiHost_IsMemory(Addr) == (u8)TRUE) {
+		return *(volatile u32 *)(UINTPTR)Addr;
+	}
+
+	Slot = XPlmiHost_FindReg(Addr);
+	Value = (Slot->Addr == XPLMI_HOST_REG_EMPTY) ? 0U : Slot->Value;
+	Stats.Reads++;
+	if (TraceFile != NULL) {
+		fprintf(TraceFile, "R 0x%08llx 0x%08x\n", (unsigned long long)Addr,
+			Value);
+	}
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function writes a 32-bit word of memory or of a register.
+ *
+ * @param	Addr is the address
+ * @param	Value is the value to write
+ *
+ *****************************************************************************/
+void XPlmiHost_Out32(u64 Addr, u32 Value)
+{
+	if (XPlmiHost_IsMemory(Addr) == (u8)TRUE) {
+		*(volatile u32 *)(UINTPTR)Addr = Value;
+		return;
+	}
+
+	XPlmiHost_SetReg(Addr, Value);
+	Stats.Writes++;
+	if (TraceFile != NULL) {
+		fprintf(TraceFile, "W 0x%08llx 0x%08x\n", (unsigned long long)Addr,
+			Value);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function records a delay requested by a command.
+ *
+ * @param	Useconds is the delay in microseconds
+ *
+ *****************************************************************************/
+void XPlmiHost_Delay(u32 Useconds)
+{
+	Stats.DelayUs += Useconds;
+	if (TraceFile != NULL) {
+		fprintf(TraceFile, "U %u\n", Useconds);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function records a mask poll and makes it succeed.
+ *
+ * @param	Addr is the register address
+ * @param	Mask is the mask of the polled bits
+ * @param	ExpectedValue is the expected value of the polled bits
+ *
+ *****************************************************************************/
+static void XPlmiHost_Poll(u64 Addr, u32 Mask, u32 ExpectedValue)
+{
+	XPlmiHost_Reg *Slot = XPlmiHost_FindReg(Addr);
+	u32 Value = 0U;
+
+	if (Slot->Addr != XPLMI_HOST_REG_EMPTY) {
+		Value = Slot->Value;
+	}
+	if (XPlmiHost_IsMemory(Addr) == (u8)FALSE) {
+		XPlmiHost_SetReg(Addr, (Value & ~Mask) | (ExpectedValue & Mask));
+	}
+	Stats.Polls++;
+	if (TraceFile != NULL) {
+		fprintf(TraceFile, "P 0x%08llx 0x%08x 0x%08x\n",
+			(unsigned long long)Addr, Mask, ExpectedValue);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function records a DMA transfer.
+ *
+ * @param	Src is the source address, 0 for a transfer to the SBI
+ * @param	Dest is the destination address, 0 for a transfer to the SBI
+ * @param	Len is the length in words
+ *
+ *****************************************************************************/
+static void XPlmiHost_RecordDma(u64 Src, u64 Dest, u32 Len)
+{
+	Stats.DmaXfers++;
+	Stats.DmaBytes += (u64)Len * XPLMI_WORD_LEN;
+	if (TraceFile != NULL) {
+		fprintf(TraceFile, "D 0x%08llx 0x%08llx 0x%x\n",
+			(unsigned long long)Src, (unsigned long long)Dest, Len);
+	}
+}
+
+/*****************************************************************************/
+/*
+ * PLM services used by the CDO processing sources
+ *****************************************************************************/
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a word for a DMA transfer.
+ *
+ * @param	Addr is the address
+ *
+ * @return
+ * 			- Word read, without recording a register read
+ *
+ *****************************************************************************/
+static u32 XPlmiHost_DmaRead(u64 Addr)
+{
+	const XPlmiHost_Reg *Slot;
+
+	if (XPlmiHost_IsMemory(Addr) == (u8)TRUE) {
+		return *(const u32 *)(UINTPTR)Addr;
+	}
+	Slot = XPlmiHost_FindReg(Addr);
+
+	return (Slot->Addr == XPLMI_HOST_REG_EMPTY) ? 0U : Slot->Value;
+}
+
+int XPlmi_DmaXfr(u64 SrcAddr, u64 DestAddr, u32 Len, u32 Flags)
+{
+	u64 Src = SrcAddr;
+	u64 Dest = DestAddr;
+	u32 Index;
+	u32 Value;
+
+	XPlmiHost_RecordDma(SrcAddr, DestAddr, Len);
+	for (Index = 0U; Index < Len; Index++) {
+		Value = XPlmiHost_DmaRead(Src);
+		if (XPlmiHost_IsMemory(Dest) == (u8)TRUE) {
+			*(u32 *)(UINTPTR)Dest = Value;
+		} else {
+			XPlmiHost_SetReg(Dest, Value);
+		}
+		if ((Flags & XPLMI_SRC_CH_AXI_FIXED) == 0U) {
+			Src += XPLMI_WORD_LEN;
+		}
+		if ((Flags & XPLMI_DST_CH_AXI_FIXED) == 0U) {
+			Dest += XPLMI_WORD_LEN;
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_DmaSbiXfer(u64 SrcAddr, u32 Len, u32 Flags)
+{
+	(void)Flags;
+	XPlmiHost_RecordDma(SrcAddr, 0U, Len);
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_WaitForNonBlkSrcDma(u32 DmaFlags)
+{
+	(void)DmaFlags;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_SetMaxOutCmds(u8 Val)
+{
+	(void)Val;
+}
+
+int XPlmi_MemSet(u64 DestAddress, u32 Val, u32 Len)
+{
+	u32 Index;
+
+	XPlmiHost_RecordDma(0U, DestAddress, Len);
+	for (Index = 0U; Index < Len; Index++) {
+		if (XPlmiHost_IsMemory(DestAddress) == (u8)TRUE) {
+			((u32 *)(UINTPTR)DestAddress)[Index] = Val;
+		} else {
+			XPlmiHost_SetReg(DestAddress + ((u64)Index * XPLMI_WORD_LEN), Val);
+		}
+	}
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_MemSetBytes(void *const DestPtr, u32 DestLen, u8 Val, u32 Length)
+{
+	if ((DestPtr == NULL) || (Length > DestLen)) {
+		return XST_FAILURE;
+	}
+	memset(DestPtr, Val, Length);
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_UtilPoll(u32 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs,
+		void (*ClearHandler)(void))
+{
+	(void)TimeOutInUs;
+	(void)ClearHandler;
+	XPlmiHost_Poll(RegAddr, Mask, ExpectedValue);
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_UtilPoll64(u64 RegAddr, u32 Mask, u32 ExpectedValue, u32 TimeOutInUs)
+{
+	(void)TimeOutInUs;
+	XPlmiHost_Poll(RegAddr, Mask, ExpectedValue);
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_UtilRMW(u32 RegAddr, u32 Mask, u32 Value)
+{
+	u32 Val = XPlmiHost_In32(RegAddr);
+
+	XPlmiHost_Out32(RegAddr, (Val & ~Mask) | (Value & Mask));
+}
+
+int XPlmi_VerifyAddrRange(u64 StartAddr, u64 EndAddr)
+{
+	return (EndAddr >= StartAddr) ? XST_SUCCESS : XST_FAILURE;
+}
+
+void XPlmi_GetReadbackSrcDest(u32 SlrType, u64 *SrcAddr, u64 *DestAddrRead)
+{
+	(void)SlrType;
+	*SrcAddr = (u64)CFU_FDRO_2_ADDR;
+	*DestAddrRead = (u64)CFU_STREAM_2_ADDR;
+}
+
+XPlmi_BufferList *XPlmi_GetBufferList(u32 BufferListType)
+{
+	static XPlmi_BufferList PsmBufferList = {0U};
+	static XPlmi_BufferData PsmBuffers[XPLMI_MAX_PSM_BUFFERS + 1U] = {0U};
+	static XPlmi_BufferList PmcBufferList = {0U};
+	static XPlmi_BufferData PmcBuffers[XPLMI_MAX_PMC_BUFFERS + 1U] = {0U};
+	XPlmi_BufferList *BufferList = &PsmBufferList;
+
+	PsmBufferList.Data = PsmBuffers;
+	PsmBufferList.MaxBufferCount = XPLMI_MAX_PSM_BUFFERS;
+	PmcBufferList.Data = PmcBuffers;
+	PmcBufferList.MaxBufferCount = XPLMI_MAX_PMC_BUFFERS;
+
+	if (BufferListType == XPLMI_PMC_BUFFER_LIST) {
+		BufferList = &PmcBufferList;
+		PmcBufferList.Data[0U].Addr = XPLMI_PMCRAM_BUFFER_MEMORY;
+		PmcBufferList.BufferMemSize = XPLMI_PMCRAM_BUFFER_MEMORY_LENGTH;
+		PmcBufferList.IsBufferMemAvailable = (u8)TRUE;
+	}
+
+	return BufferList;
+}
+
+u32 *XPlmi_GetLpdInitialized(void)
+{
+	static u32 LpdInitialized = 0U;
+
+	return &LpdInitialized;
+}
+
+XPlmi_BoardParams *XPlmi_GetBoardParams(void)
+{
+	/* Kept in PMC RAM, the board name is DMAed with a 32-bit address */
+	return (XPlmi_BoardParams *)(UINTPTR)XPLMI_HOST_BOARD_PARAMS_ADDR;
+}
+
+u32 XPlmi_SldState(void)
+{
+	return XPLMI_SLD_NOT_TRIGGERED;
+}
+
+void XPlmi_SetPlmLiveStatus(void)
+{
+}
+
+void XPlmi_LogPlmErr(int ErrStatusVal)
+{
+	fprintf(stderr, "PLM error 0x%08x\n", (u32)ErrStatusVal);
+}
+
+void XPlmi_PrintArray(u16 DebugType, const u64 BufAddr, u32 Len, const char *Str)
+{
+	(void)DebugType;
+	(void)BufAddr;
+	(void)Len;
+	(void)Str;
+}
+
+int XPlmi_EventLogging(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_EnableWdt(u32 NodeId, u32 Periodicity)
+{
+	(void)NodeId;
+	(void)Periodicity;
+
+	return XST_SUCCESS;
+}
+
+void XPlmi_SysMonOTDetect(u32 WaitInMSecVal)
+{
+	(void)WaitInMSecVal;
+}
+
+void XPlmi_TriggerTamperResponse(u32 Response, u32 Flag)
+{
+	(void)Response;
+	(void)Flag;
+}
+
+int XPlmi_SendIpiCmdToSlaveSlr(u32 *Payload, u32 *RespBuf)
+{
+	(void)Payload;
+	(void)RespBuf;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitCfgSecComm(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_GetSsitSecCommStatus(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitSyncMaster(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitSyncSlaves(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+int XPlmi_SsitWaitSlaves(XPlmi_Cmd *Cmd)
+{
+	(void)Cmd;
+
+	return XST_SUCCESS;
+}
+
+void xil_printf(const char8 *ctrl1, ...)
+{
+	va_list Args;
+
+	va_start(Args, ctrl1);
+	(void)vprintf(ctrl1, Args);
+	va_end(Args);
+}
@@ -0,0 +1,63 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_host.h
+*
+* This file contains declarations of the host environment used to run the
+* xilplmi CDO parser and dispatcher on Linux: a mock register space that
+* records the register traffic of the commands and the PLM services the
+* CDO processing sources depend on.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XPLMI_HOST_H
+#define XPLMI_HOST_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include "xil_types.h"
+
+/**************************** Type Definitions *******************************/
+/** Register traffic recorded by the mock register space */
+typedef struct {
+	u64 Reads;	/**< 32-bit register reads */
+	u64 Writes;	/**< 32-bit register writes */
+	u64 Polls;	/**< Mask polls, all of them succeed */
+	u64 DmaXfers;	/**< DMA transfers */
+	u64 DmaBytes;	/**< Bytes moved by DMA transfers */
+	u64 DelayUs;	/**< Delays requested by commands, not waited for */
+	u32 Regs;	/**< Distinct registers written */
+} XPlmiHost_Stats;
+
+/************************** Function Prototypes ******************************/
+int XPlmiHost_Init(void);
+void XPlmiHost_SetTrace(FILE *Trace);
+void XPlmiHost_Reset(void);
+const XPlmiHost_Stats *XPlmiHost_GetStats(void);
+void *XPlmiHost_AllocLow(u32 Size);
+u32 XPlmiHost_In32(u64 Addr);
+void XPlmiHost_Out32(u64 Addr, u32 Value);
+void XPlmiHost_Delay(u32 Useconds);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPLMI_HOST_H */
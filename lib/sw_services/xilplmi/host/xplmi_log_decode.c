@@ -0,0 +1,611 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_log_decode.c
+*
+* This file contains the decoder of the binary debug log of the PLM. With
+* PLM_BINARY_LOG enabled, XPlmi_Print stores the address of its format
+* string and its arguments to the debug log buffer instead of the formatted
+* text. This program reads a dump of the buffer, looks the format strings
+* up in the PLM elf and prints the log as the PLM would have printed it. It
+* can also write the records as a Chrome trace (chrome://tracing, Perfetto)
+* timeline.
+*
+* Records are found by their header, so a dump of a buffer that has wrapped
+* around, starting in the middle of a record, is decoded from the first
+* complete record.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xplmi_event_logging.h"
+
+/************************** Constant Definitions *****************************/
+#define LOG_MAX_LINE_LEN	(1024U)	/**< Formatted print */
+#define LOG_MAX_SPEC_LEN	(16U)	/**< Conversion specification */
+#define LOG_MAX_NAME_LEN	(64U)	/**< Event name in the Chrome trace */
+#define LOG_ELF_PT_LOAD		(1U)	/**< Loadable segment */
+
+/**************************** Type Definitions *******************************/
+/** Loadable segment of the PLM elf */
+typedef struct {
+	u64 Addr;		/**< Virtual address */
+	u64 Offset;		/**< Offset in the file */
+	u64 Size;		/**< Size in the file */
+} LogDecode_Segment;
+
+/** PLM elf with the format strings */
+typedef struct {
+	u8 *Data;		/**< Contents of the file */
+	u64 Len;		/**< Length of the file */
+	LogDecode_Segment *Segments;	/**< Loadable segments */
+	u32 SegmentCnt;		/**< Number of loadable segments */
+} LogDecode_Elf;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static LogDecode_Elf Elf;
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a whole file.
+ *
+ * @param	Name is the file name
+ * @param	Len is the length of the file in bytes
+ *
+ * @return
+ * 			- Contents of the file, zero padded to a whole number of words,
+ * 			NULL on error
+ *
+ *****************************************************************************/
+static u8 *LogDecode_ReadFile(const char *Name, u64 *Len)
+{
+	FILE *File;
+	u8 *Buf = NULL;
+	long FileLen;
+
+	File = fopen(Name, "rb");
+	if (File == NULL) {
+		perror(Name);
+		goto END;
+	}
+	if ((fseek(File, 0, SEEK_END) != 0) || ((FileLen = ftell(File)) < 0) ||
+		(fseek(File, 0, SEEK_SET) != 0)) {
+		perror(Name);
+		goto END;
+	}
+	Buf = calloc(((size_t)FileLen + 4U) & ~(size_t)3U, 1U);
+	if ((Buf == NULL) ||
+		(fread(Buf, 1U, (size_t)FileLen, File) != (size_t)FileLen)) {
+		perror(Name);
+		free(Buf);
+		Buf = NULL;
+		goto END;
+	}
+	*Len = (u64)FileLen;
+
+END:
+	if (File != NULL) {
+		(void)fclose(File);
+	}
+	return Buf;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function reads a little endian field of the elf.
+ *
+ * @param	Offset is the offset of the field in the file
+ * @param	Size is the size of the field in bytes
+ *
+ * @return
+ * 			- Value of the field, 0 if it is out of the file
+ *
+ *****************************************************************************/
+static u64 LogDecode_ElfField(u64 Offset, u32 Size)
+{
+	u64 Value = 0U;
+	u32 Index;
+
+	if ((Offset + Size) <= Elf.Len) {
+		for (Index = Size; Index > 0U; Index--) {
+			Value = (Value << 8U) | Elf.Data[Offset + Index - 1U];
+		}
+	}
+
+	return Value;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function loads the PLM elf and collects its loadable
+ * 		segments. 32 bit and 64 bit little endian elfs are supported.
+ *
+ * @param	Name is the file name of the elf
+ *
+ * @return
+ * 			- XST_SUCCESS on success, XST_FAILURE on error
+ *
+ *****************************************************************************/
+static int LogDecode_LoadElf(const char *Name)
+{
+	int Status = XST_FAILURE;
+	u8 Is64;
+	u64 PhOff;
+	u32 PhEntSize;
+	u32 PhNum;
+	u64 Ph;
+	u32 Index;
+
+	Elf.Data = LogDecode_ReadFile(Name, &Elf.Len);
+	if (Elf.Data == NULL) {
+		goto END;
+	}
+	if ((Elf.Len < 0x40U) || (memcmp(Elf.Data, "\177ELF", 4U) != 0) ||
+		(Elf.Data[5U] != 1U)) {
+		fprintf(stderr, "%s: not a little endian elf\n", Name);
+		goto END;
+	}
+	Is64 = (Elf.Data[4U] == 2U) ? (u8)TRUE : (u8)FALSE;
+	if (Is64 == (u8)TRUE) {
+		PhOff = LogDecode_ElfField(0x20U, 8U);
+		PhEntSize = (u32)LogDecode_ElfField(0x36U, 2U);
+		PhNum = (u32)LogDecode_ElfField(0x38U, 2U);
+	} else {
+		PhOff = LogDecode_ElfField(0x1CU, 4U);
+		PhEntSize = (u32)LogDecode_ElfField(0x2AU, 2U);
+		PhNum = (u32)LogDecode_ElfField(0x2CU, 2U);
+	}
+
+	Elf.Segments = calloc(PhNum + 1U, sizeof(LogDecode_Segment));
+	if (Elf.Segments == NULL) {
+		perror(Name);
+		goto END;
+	}
+	for (Index = 0U; Index < PhNum; Index++) {
+		Ph = PhOff + ((u64)Index * PhEntSize);
+		if (LogDecode_ElfField(Ph, 4U) != LOG_ELF_PT_LOAD) {
+			continue;
+		}
+		if (Is64 == (u8)TRUE) {
+			Elf.Segments[Elf.SegmentCnt].Offset = LogDecode_ElfField(Ph + 0x8U, 8U);
+			Elf.Segments[Elf.SegmentCnt].Addr = LogDecode_ElfField(Ph + 0x10U, 8U);
+			Elf.Segments[Elf.SegmentCnt].Size = LogDecode_ElfField(Ph + 0x20U, 8U);
+		} else {
+			Elf.Segments[Elf.SegmentCnt].Offset = LogDecode_ElfField(Ph + 0x4U, 4U);
+			Elf.Segments[Elf.SegmentCnt].Addr = LogDecode_ElfField(Ph + 0x8U, 4U);
+			Elf.Segments[Elf.SegmentCnt].Size = LogDecode_ElfField(Ph + 0x10U, 4U);
+		}
+		++Elf.SegmentCnt;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function looks a format string up in the PLM elf.
+ *
+ * @param	Addr is the address of the format string
+ *
+ * @return
+ * 			- Format string, NULL if it is not in the elf
+ *
+ *****************************************************************************/
+static const char *LogDecode_ElfString(u32 Addr)
+{
+	const char *Str = NULL;
+	const LogDecode_Segment *Seg;
+	u64 Offset;
+	u32 Index;
+
+	for (Index = 0U; Index < Elf.SegmentCnt; Index++) {
+		Seg = &Elf.Segments[Index];
+		if ((Addr < Seg->Addr) || (Addr >= (Seg->Addr + Seg->Size))) {
+			continue;
+		}
+		Offset = Seg->Offset + (Addr - Seg->Addr);
+		/* The buffer is zero padded, so the string is terminated */
+		if (Offset < Elf.Len) {
+			Str = (const char *)&Elf.Data[Offset];
+		}
+		break;
+	}
+
+	return Str;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function unpacks a string stored in a record as its length
+ * 		followed by its bytes, four bytes per word.
+ *
+ * @param	Words is the record payload
+ * @param	Index is the word at which the string is stored, updated to the
+ * 		word after it
+ * @param	WordCnt is the number of words in the payload
+ * @param	Str is the buffer to which the string is unpacked
+ * @param	StrLen is the length of Str in bytes
+ *
+ * @return
+ * 			- XST_SUCCESS on success, XST_FAILURE if the string is
+ * 			truncated
+ *
+ *****************************************************************************/
+static int LogDecode_UnpackStr(const u32 *Words, u32 *Index, u32 WordCnt,
+	char *Str, u32 StrLen)
+{
+	int Status = XST_FAILURE;
+	u32 Len;
+	u32 ByteIdx;
+
+	Str[0U] = '\0';
+	if (*Index >= WordCnt) {
+		goto END;
+	}
+	Len = Words[*Index];
+	if ((Len >= StrLen) ||
+		((*Index + 1U + ((Len + 3U) / 4U)) > WordCnt)) {
+		goto END;
+	}
+	for (ByteIdx = 0U; ByteIdx < Len; ByteIdx++) {
+		Str[ByteIdx] = (char)(Words[*Index + 1U + (ByteIdx / 4U)] >>
+			((ByteIdx % 4U) * 8U));
+	}
+	Str[Len] = '\0';
+	*Index += 1U + ((Len + 3U) / 4U);
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function formats a print record like xil_printf does.
+ * 		Missing arguments are shown as <?>.
+ *
+ * @param	Line is the buffer for the formatted print
+ * @param	Fmt is the format string
+ * @param	Args is the argument words of the record
+ * @param	ArgCnt is the number of argument words
+ *
+ *****************************************************************************/
+static void LogDecode_Format(char *Line, const char *Fmt, const u32 *Args,
+	u32 ArgCnt)
+{
+	char Spec[LOG_MAX_SPEC_LEN + 4U];
+	char Str[XPLMI_BIN_LOG_MAX_STR_LEN + 1U];
+	size_t Pos = 0U;
+	u32 SpecLen;
+	u32 LongCnt;
+	u32 Index = 0U;
+	char Conv;
+	u64 Value;
+
+	Line[0U] = '\0';
+	while ((*Fmt != '\0') && (Pos < (LOG_MAX_LINE_LEN - 1U))) {
+		if (*Fmt != '%') {
+			Line[Pos] = *Fmt;
+			++Pos;
+			++Fmt;
+			continue;
+		}
+		Spec[0U] = '%';
+		SpecLen = 1U;
+		++Fmt;
+		while ((((*Fmt >= '0') && (*Fmt <= '9')) || (*Fmt == '-') ||
+			(*Fmt == '.')) && (SpecLen < LOG_MAX_SPEC_LEN)) {
+			Spec[SpecLen] = *Fmt;
+			++SpecLen;
+			++Fmt;
+		}
+		LongCnt = 0U;
+		while (*Fmt == 'l') {
+			++LongCnt;
+			++Fmt;
+		}
+		Conv = *Fmt;
+		if (Conv == '\0') {
+			break;
+		}
+		++Fmt;
+		Line[Pos] = '\0';
+
+		if (Conv == '%') {
+			Line[Pos] = '%';
+			++Pos;
+			continue;
+		}
+		if (Conv == 's') {
+			Spec[SpecLen] = 's';
+			Spec[SpecLen + 1U] = '\0';
+			if (LogDecode_UnpackStr(Args, &Index, ArgCnt, Str,
+				(u32)sizeof(Str)) != XST_SUCCESS) {
+				(void)strcpy(Str, "<?>");
+				Index = ArgCnt;
+			}
+			Pos += (size_t)snprintf(&Line[Pos], LOG_MAX_LINE_LEN - Pos, Spec, Str);
+		} else if ((LongCnt > 1U) && ((Index + 1U) < ArgCnt)) {
+			Value = (u64)Args[Index] | ((u64)Args[Index + 1U] << 32U);
+			Index += 2U;
+			(void)strcpy(&Spec[SpecLen], "ll");
+			Spec[SpecLen + 2U] = Conv;
+			Spec[SpecLen + 3U] = '\0';
+			Pos += (size_t)snprintf(&Line[Pos], LOG_MAX_LINE_LEN - Pos, Spec,
+				(unsigned long long)Value);
+		} else if ((LongCnt <= 1U) && (Index < ArgCnt)) {
+			Spec[SpecLen] = (Conv == 'p') ? 'x' : Conv;
+			Spec[SpecLen + 1U] = '\0';
+			if ((Conv == 'd') || (Conv == 'i')) {
+				Pos += (size_t)snprintf(&Line[Pos], LOG_MAX_LINE_LEN - Pos,
+					Spec, (int)Args[Index]);
+			} else {
+				Pos += (size_t)snprintf(&Line[Pos], LOG_MAX_LINE_LEN - Pos,
+					Spec, Args[Index]);
+			}
+			++Index;
+		} else {
+			Pos += (size_t)snprintf(&Line[Pos], LOG_MAX_LINE_LEN - Pos, "<?>");
+		}
+		if (Pos >= LOG_MAX_LINE_LEN) {
+			Pos = LOG_MAX_LINE_LEN - 1U;
+		}
+	}
+	Line[Pos] = '\0';
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function writes a string to the Chrome trace as a JSON
+ * 		string. Line breaks are dropped and the string is shortened to
+ * 		LOG_MAX_NAME_LEN characters.
+ *
+ * @param	Trace is the Chrome trace file
+ * @param	Str is the string to write
+ *
+ *****************************************************************************/
+static void LogDecode_JsonStr(FILE *Trace, const char *Str)
+{
+	u32 Len = 0U;
+
+	fputc('"', Trace);
+	for (; (*Str != '\0') && (Len < LOG_MAX_NAME_LEN); Str++) {
+		if ((*Str == '\r') || (*Str == '\n')) {
+			continue;
+		}
+		if ((*Str == '"') || (*Str == '\\')) {
+			fputc('\\', Trace);
+			fputc(*Str, Trace);
+		} else if ((unsigned char)*Str < 0x20U) {
+			fprintf(Trace, "\\u%04x", (unsigned char)*Str);
+		} else {
+			fputc(*Str, Trace);
+		}
+		++Len;
+	}
+	fputc('"', Trace);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the thread of the events of a print in
+ * 		the Chrome trace, one thread per debug level.
+ *
+ * @param	DebugType is the debug type of the print
+ *
+ * @return
+ * 			- Thread id of the debug level
+ *
+ *****************************************************************************/
+static u32 LogDecode_Tid(u32 DebugType)
+{
+	u32 Tid = 0U;
+
+	while ((Tid < 4U) && ((DebugType & (1U << Tid)) == 0U)) {
+		++Tid;
+	}
+
+	return Tid + 1U;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function decodes the records of a debug log dump.
+ *
+ * @param	Words is the dump
+ * @param	WordCnt is the number of words in the dump
+ * @param	Trace is the Chrome trace file, NULL if it is not written
+ *
+ *****************************************************************************/
+static void LogDecode_Records(const u32 *Words, u32 WordCnt, FILE *Trace)
+{
+	char Line[LOG_MAX_LINE_LEN];
+	char Text[XPLMI_BIN_LOG_MAX_STR_LEN + 1U];
+	const char *Fmt;
+	const char *Out;
+	u32 Index = 0U;
+	u32 Header;
+	u32 Len;
+	u32 Type;
+	u32 ArgIdx;
+	u32 Records = 0U;
+	u32 Skipped = 0U;
+	u64 TimeUs;
+
+	while (Index < WordCnt) {
+		Header = Words[Index];
+		Len = (Header >> XPLMI_BIN_LOG_LEN_SHIFT) & XPLMI_BIN_LOG_LEN_MASK;
+		Type = (Header >> XPLMI_BIN_LOG_TYPE_SHIFT) & XPLMI_BIN_LOG_TYPE_MASK;
+		if (((Header >> XPLMI_BIN_LOG_MAGIC_SHIFT) != XPLMI_BIN_LOG_MAGIC) ||
+			(Len <= XPLMI_BIN_LOG_HDR_LEN) || (Len > XPLMI_BIN_LOG_MAX_LEN) ||
+			((Index + Len) > WordCnt) ||
+			((Type != XPLMI_BIN_LOG_TYPE_PRINT) &&
+			(Type != XPLMI_BIN_LOG_TYPE_TEXT))) {
+			/* Torn record at the wrap point or unused space */
+			++Skipped;
+			++Index;
+			continue;
+		}
+		TimeUs = (u64)Words[Index + 1U] | ((u64)Words[Index + 2U] << 32U);
+
+		if (Type == XPLMI_BIN_LOG_TYPE_PRINT) {
+			Fmt = (Elf.Data != NULL) ?
+				LogDecode_ElfString(Words[Index + 3U]) : NULL;
+			if (Fmt != NULL) {
+				LogDecode_Format(Line, Fmt, &Words[Index + 4U],
+					Len - 4U);
+			} else {
+				(void)snprintf(Line, sizeof(Line), "<fmt 0x%08x>",
+					Words[Index + 3U]);
+				for (ArgIdx = Index + 4U; ArgIdx < (Index + Len); ArgIdx++) {
+					(void)snprintf(&Line[strlen(Line)],
+						sizeof(Line) - strlen(Line), " 0x%x", Words[ArgIdx]);
+				}
+				(void)strncat(Line, "\n", sizeof(Line) - strlen(Line) - 1U);
+			}
+			Out = Line;
+		} else {
+			ArgIdx = Index + 3U;
+			if (LogDecode_UnpackStr(Words, &ArgIdx, Index + Len, Text,
+				(u32)sizeof(Text)) != XST_SUCCESS) {
+				++Skipped;
+				++Index;
+				continue;
+			}
+			Out = Text;
+		}
+
+		if (((Header >> XPLMI_BIN_LOG_TYPE_SHIFT) &
+			XPLMI_BIN_LOG_TYPE_TS_MASK) != 0U) {
+			printf("[%u.%03u]", (u32)(TimeUs / 1000U), (u32)(TimeUs % 1000U));
+		}
+		for (; *Out != '\0'; Out++) {
+			if (*Out != '\r') {
+				putchar(*Out);
+			}
+		}
+
+		if ((Trace != NULL) && (Type == XPLMI_BIN_LOG_TYPE_PRINT)) {
+			fprintf(Trace, ",\n{\"name\":");
+			LogDecode_JsonStr(Trace, Line);
+			fprintf(Trace, ",\"ph\":\"i\",\"s\":\"t\",\"ts\":%llu,"
+				"\"pid\":1,\"tid\":%u}", (unsigned long long)TimeUs,
+				LogDecode_Tid(Header & 0xFFU));
+		}
+		++Records;
+		Index += Len;
+	}
+
+	fprintf(stderr, "%u records decoded, %u words skipped\n", Records,
+		Skipped);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the usage of the program.
+ *
+ * @param	Prog is the program name
+ *
+ *****************************************************************************/
+static void LogDecode_Usage(const char *Prog)
+{
+	fprintf(stderr,
+		"Usage: %s [options] <log.bin>\n\n"
+		"Options:\n"
+		"\t-e <file>\tPLM elf with the format strings\n"
+		"\t-c <file>\tWrite the records as a Chrome trace to file\n"
+		"\t-h\t\tHelp\n", Prog);
+}
+
+int main(int argc, char *argv[])
+{
+	int Status = XST_FAILURE;
+	const char *ElfName = NULL;
+	const char *TraceName = NULL;
+	FILE *Trace = NULL;
+	u8 *Log = NULL;
+	u64 LogLen = 0U;
+	u32 Tid;
+	int Opt;
+
+	while ((Opt = getopt(argc, argv, "e:c:h")) != -1) {
+		switch (Opt) {
+		case 'e':
+			ElfName = optarg;
+			break;
+		case 'c':
+			TraceName = optarg;
+			break;
+		default:
+			LogDecode_Usage(argv[0]);
+			goto END;
+		}
+	}
+	if (optind != (argc - 1)) {
+		LogDecode_Usage(argv[0]);
+		goto END;
+	}
+
+	if ((ElfName != NULL) && (LogDecode_LoadElf(ElfName) != XST_SUCCESS)) {
+		goto END;
+	}
+	Log = LogDecode_ReadFile(argv[optind], &LogLen);
+	if (Log == NULL) {
+		goto END;
+	}
+	if (TraceName != NULL) {
+		Trace = fopen(TraceName, "w");
+		if (Trace == NULL) {
+			perror(TraceName);
+			goto END;
+		}
+		fprintf(Trace, "{\"traceEvents\":[");
+		for (Tid = 1U; Tid <= 4U; Tid++) {
+			fprintf(Trace, "%s\n{\"name\":\"thread_name\",\"ph\":\"M\","
+				"\"pid\":1,\"tid\":%u,\"args\":{\"name\":\"%s\"}}",
+				(Tid == 1U) ? "" : ",", Tid,
+				(Tid == 1U) ? "PRINT_ALWAYS" : (Tid == 2U) ? "GENERAL" :
+				(Tid == 3U) ? "INFO" : "DETAILED");
+		}
+	}
+
+	LogDecode_Records((const u32 *)(void *)Log, (u32)(LogLen / XPLMI_WORD_LEN),
+		Trace);
+	Status = XST_SUCCESS;
+
+END:
+	if (Trace != NULL) {
+		fprintf(Trace, "\n],\"displayTimeUnit\":\"ms\"}\n");
+		(void)fclose(Trace);
+	}
+	free(Log);
+	free(Elf.Data);
+	free(Elf.Segments);
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
@@ -20,6 +20,7 @@
  *                     SSIT support
  *       pre  09/30/24 Added XPlmi_GetSecureCommStatus API
  *       pre  10/19/24 Fixed compilation warning
+ *       sb   10/16/26 Added IPI command ring APIs
  *
  * </pre>
  *
@@ -33,6 +34,10 @@
 /*************************************** Include Files *******************************************/
 
 #include "xplmi_client.h"
+#include "xil_io.h"
+#ifndef XPLMI_CACHE_DISABLE
+#include "xil_cache.h"
+#endif
 
 /************************************ Constant Definitions ***************************************/
 #define XPLMI_ADDR_HIGH_SHIFT              (32U) /**< Shift value to get higher 32 bit address */
@@ -314,3 +319,168 @@ int XPlmi_InputSlrIndex(XPlmi_ClientInstance *InstancePtr, u32 SlrIndex)
 	}
 	return Status;
 }
+
+/*************************************************************************************************/
+/**
+ * @brief	This function posts a command in the IPI command ring of the client. The command is
+ *		processed by the PLM only after XPlmi_CmdRingProcess is called, so a batch of commands
+ *		can be posted before it. The ring is at XPLMI_CMD_RING_ADDR of the IPI buffer index of
+ *		the client in the region the PLM reserved for command rings.
+ *
+ * @param	Ring		Pointer to the command ring of the client
+ * @param	Payload		Command header and arguments
+ * @param	PayloadLen	Length of the payload in words
+ * @param	Seq		Sequence number of the posted command, used to get its response
+ *
+ * @return
+ *			 - XST_SUCCESS on success.
+ *			 - XST_DEVICE_BUSY if the ring is full.
+ *			 - XST_FAILURE on failure.
+ *
+ *************************************************************************************************/
+int XPlmi_CmdRingPost(XPlmi_CmdRing *Ring, const u32 *Payload, u32 PayloadLen, u32 *Seq)
+{
+	int Status = XST_FAILURE;
+	XPlmi_CmdRingEntry *Entry;
+	u32 Head;
+	u32 Index;
+
+	/**
+	 * - Performs input parameters validation. Return error code if input parameters are invalid
+	 */
+	if ((Ring == NULL) || (Payload == NULL) || (Seq == NULL) || (PayloadLen == 0U) ||
+		(PayloadLen > XPLMI_CMD_RING_PAYLOAD_LEN)) {
+		goto END;
+	}
+
+	/**
+	 * - Check that the PLM has processed enough commands to free an entry
+	 */
+#ifndef XPLMI_CACHE_DISABLE
+	Xil_DCacheInvalidateRange((UINTPTR)&Ring->Tail, sizeof(Ring->Tail));
+#endif
+	Head = Ring->Head;
+	if ((Head - Xil_In32((UINTPTR)&Ring->Tail)) >= XPLMI_CMD_RING_ENTRIES) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	/**
+	 * - Write the command to the entry and publish it by moving the Head past it
+	 */
+	Entry = &Ring->Entry[Head & (XPLMI_CMD_RING_ENTRIES - 1U)];
+	for (Index = 0U; Index < XPLMI_CMD_RING_PAYLOAD_LEN; Index++) {
+		if (Index < PayloadLen) {
+			Xil_Out32((UINTPTR)&Entry->Payload[Index], Payload[Index]);
+		}
+		else {
+			Xil_Out32((UINTPTR)&Entry->Payload[Index], 0U);
+		}
+	}
+#ifndef XPLMI_CACHE_DISABLE
+	Xil_DCacheFlushRange((UINTPTR)Entry, sizeof(XPlmi_CmdRingEntry));
+#endif
+	Xil_Out32((UINTPTR)&Ring->Head, Head + 1U);
+#ifndef XPLMI_CACHE_DISABLE
+	Xil_DCacheFlushRange((UINTPTR)&Ring->Head, sizeof(Ring->Head));
+#endif
+	*Seq = Head;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function sends IPI request to process the commands posted in the IPI command
+ *		ring of the client. At most one ring of commands is processed for each request.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	ProcessedCnt	Number of commands processed by the PLM
+ *
+ * @return
+ *			 - XST_SUCCESS on success.
+ *			 - XST_FAILURE on failure.
+ *
+ *************************************************************************************************/
+int XPlmi_CmdRingProcess(XPlmi_ClientInstance *InstancePtr, u32 *ProcessedCnt)
+{
+	volatile int Status = XST_FAILURE;
+	u32 Payload[XMAILBOX_PAYLOAD_LEN_1U];
+
+	/**
+	 * - Performs input parameters validation. Return error code if input parameters are invalid
+	 */
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) || (ProcessedCnt == NULL)) {
+		goto END;
+	}
+
+	Payload[0U] = PACK_XPLMI_HEADER(XPLMI_HEADER_LEN_0, (u32)XPLMI_IPI_CMD_RING_CMD_ID);
+
+	/**
+	 * - Send an IPI request to the PLM by using the XPlmi_IpiCmdRing CDO command
+	 * Wait for IPI response from PLM with a timeout.
+	 * - If the timeout exceeds then error is returned otherwise it returns the status of the IPI
+	 * response.
+	 */
+	Status = XPlmi_ProcessMailbox(InstancePtr, Payload, sizeof(Payload) / sizeof(u32));
+	*ProcessedCnt = InstancePtr->Response[1U];
+
+END:
+	return Status;
+}
+
+/*************************************************************************************************/
+/**
+ * @brief	This function reads the response of a command posted in the IPI command ring. The
+ *		response has to be read before XPLMI_CMD_RING_ENTRIES more commands are posted.
+ *
+ * @param	Ring		Pointer to the command ring of the client
+ * @param	Seq		Sequence number returned when the command was posted
+ * @param	Response	Buffer to which the response is copied, Response[0] is the status
+ * @param	ResponseLen	Length of the response buffer in words
+ *
+ * @return
+ *			 - XST_SUCCESS on success.
+ *			 - XST_DEVICE_BUSY if the command is not processed yet.
+ *			 - XST_FAILURE on failure.
+ *
+ *************************************************************************************************/
+int XPlmi_CmdRingGetResponse(XPlmi_CmdRing *Ring, u32 Seq, u32 *Response, u32 ResponseLen)
+{
+	int Status = XST_FAILURE;
+	const XPlmi_CmdRingEntry *Entry;
+	u32 Index;
+
+	/**
+	 * - Performs input parameters validation. Return error code if input parameters are invalid
+	 */
+	if ((Ring == NULL) || (Response == NULL) || (ResponseLen == 0U) ||
+		(ResponseLen > XPLMI_CMD_RING_RESP_LEN)) {
+		goto END;
+	}
+
+	/**
+	 * - The command is processed once the Tail has moved past it
+	 */
+#ifndef XPLMI_CACHE_DISABLE
+	Xil_DCacheInvalidateRange((UINTPTR)&Ring->Tail, sizeof(Ring->Tail));
+#endif
+	if ((Xil_In32((UINTPTR)&Ring->Tail) - Seq - 1U) >= XPLMI_CMD_RING_ENTRIES) {
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Entry = &Ring->Entry[Seq & (XPLMI_CMD_RING_ENTRIES - 1U)];
+#ifndef XPLMI_CACHE_DISABLE
+	Xil_DCacheInvalidateRange((UINTPTR)Entry->Response, sizeof(Entry->Response));
+#endif
+	for (Index = 0U; Index < ResponseLen; Index++) {
+		Response[Index] = Xil_In32((UINTPTR)&Entry->Response[Index]);
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
@@ -18,6 +18,7 @@
  * 1.00  dd   01/09/24 Initial release
  *       pre  07/10/24 Added support for configure secure communication command
  *       pre  09/30/24 Added XPlmi_GetSecureCommStatus API
+ *       sb   10/16/26 Added IPI command ring APIs
  *
  * </pre>
  *
@@ -65,6 +66,9 @@ int XPlmi_ConfigSecureComm(XPlmi_ClientInstance *InstancePtr,
                            XPlmi_SsitSecComm *SsitSecCommDataPtr);
 int XPlmi_GetSecureCommStatus(XPlmi_ClientInstance *InstancePtr, u32 SlrIndex, u32 *SecCommStatus);
 int XPlmi_InputSlrIndex(XPlmi_ClientInstance *InstancePtr, u32 SlrIndex);
+int XPlmi_CmdRingPost(XPlmi_CmdRing *Ring, const u32 *Payload, u32 PayloadLen, u32 *Seq);
+int XPlmi_CmdRingProcess(XPlmi_ClientInstance *InstancePtr, u32 *ProcessedCnt);
+int XPlmi_CmdRingGetResponse(XPlmi_CmdRing *Ring, u32 Seq, u32 *Response, u32 ResponseLen);
 
 /************************************ Variable Definitions ***************************************/
 
@@ -19,6 +19,8 @@
  *       pre  07/10/24 Added support for configure secure communication command
  *       pre  09/30/24 Added support for get secure communication status command
  *       pre  10/19/24 Added XPLMI_HEADER_LEN_5 and XPLMI_HEADER_LEN_6 macros
+ *       sb   10/16/26 Added IPI command ring command and layout
+ *       sb   10/16/26 Place each IPI command ring in its own 4KB granule
  *
  * </pre>
  *
@@ -84,6 +86,7 @@ extern "C" {
 #define XPLMI_LIST_MASK_POLL_CMD_ID	    (42U) /**< command id for list mask poll */
 #define XPLMI_CONFIG_SECCOMM_CMD_ID     (43U) /**< command id for secure communication configuration */
 #define XPLMI_GETSECCOMM_STATUS_CMD_ID  (45U) /**< command id to get secure communication status */
+#define XPLMI_IPI_CMD_RING_CMD_ID	    (46U) /**< command id to process the IPI command ring */
 #define XPLMI_CDO_END_CMD_ID		    (0xFFU) /**< command id for CDO end */
 
 #define XPLMI_HEADER_LEN_0			(0U) /**< Header Length 0 */
@@ -97,6 +100,17 @@ extern "C" {
 #define XPLMI_KEY_SIZE_WORDS (8U) /**< Key size in words */
 #define XPLMI_KEY_SIZE_BYTES (32U) /**< Key size in bytes */
 
+#define XPLMI_CMD_RING_ENTRIES		(16U) /**< Commands in an IPI command ring, power of 2 */
+#define XPLMI_CMD_RING_PAYLOAD_LEN	(8U) /**< Max words of a ring command, header included */
+#define XPLMI_CMD_RING_RESP_LEN		(8U) /**< Response words of a ring command */
+#define XPLMI_CMD_RING_INDEX_PAD	(15U) /**< Pads ring indexes to their own 64 byte line */
+#define XPLMI_CMD_RING_MAX_BUF_INDEX	(7U) /**< Max IPI buffer index having a ring */
+#define XPLMI_CMD_RING_STRIDE		(0x1000U) /**< Space of each ring, the XMPU/XPPU
+						region granule, so that every ring can be
+						protected for its own master */
+#define XPLMI_CMD_RING_REGION_LEN	((XPLMI_CMD_RING_MAX_BUF_INDEX + 1U) * \
+					XPLMI_CMD_RING_STRIDE) /**< Length of the ring region */
+
 /************************************** Type Definitions *****************************************/
 typedef struct {
 	u32 IVs[XPLMI_KEY_SIZE_WORDS]; /**< IV1 and IV2 */
@@ -108,7 +122,28 @@ typedef struct {
     XPlmi_IVsandKey IVsandKey; /**< Ivs and key */
 }XPlmi_SsitSecComm;
 
+typedef struct {
+	u32 Payload[XPLMI_CMD_RING_PAYLOAD_LEN]; /**< Command header and arguments */
+	u32 Response[XPLMI_CMD_RING_RESP_LEN]; /**< Status and response of the command */
+} XPlmi_CmdRingEntry;
+
+/**
+ * Command ring of an IPI channel. The client posts commands at Head and the
+ * PLM processes them from Tail, both are free running counters. Each side
+ * writes only its own counter, which is kept in its own cache line.
+ */
+typedef struct {
+	volatile u32 Head; /**< Commands posted by the client */
+	u32 HeadPad[XPLMI_CMD_RING_INDEX_PAD]; /**< Reserved */
+	volatile u32 Tail; /**< Commands processed by the PLM */
+	u32 TailPad[XPLMI_CMD_RING_INDEX_PAD]; /**< Reserved */
+	XPlmi_CmdRingEntry Entry[XPLMI_CMD_RING_ENTRIES]; /**< Ring entries */
+} XPlmi_CmdRing;
+
 /*************************** Macros (Inline Functions) Definitions *******************************/
+/**< Address of the command ring of an IPI buffer index in the reserved ring region */
+#define XPLMI_CMD_RING_ADDR(BaseAddr, BufferIndex) \
+	((u64)(BaseAddr) + ((u64)(BufferIndex) * (u64)XPLMI_CMD_RING_STRIDE))
 
 /************************************ Function Prototypes ****************************************/
 
@@ -65,6 +65,8 @@
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       bm   03/01/2024 Set LogCdoOffset by default in JTAG boot mode
 *       ng   03/20/2024 Added CDO debug prints
+* 2.1   sb   10/16/2026 Dispatch and record commands through the pre-decoded
+*                       command cache
 *
 * </pre>
 *
@@ -334,6 +336,8 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 {
 	int Status = XST_FAILURE;
 	XPlmi_Cmd *CmdPtr = &CdoPtr->Cmd;
+	const XPlmi_CdoCacheEntry *CacheEntry;
+	u32 CmdOffset = CdoPtr->ProcessedCdoLen;
 	u32 PrintLen;
 	u32 BufSize;
 
@@ -348,7 +352,17 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 		goto END;
 	}
 
-	*Size = XPlmi_CmdSize(BufPtr, BufLen);
+	/**
+	 * Take the size and handler of the command from the cache if it was
+	 * decoded when the same CDO was processed before
+	 */
+	CacheEntry = XPlmi_CdoCacheLookup(CdoPtr->Cache, CmdOffset, BufPtr,
+			BufLen);
+	if (CacheEntry != NULL) {
+		*Size = CacheEntry->Size;
+	} else {
+		*Size = XPlmi_CmdSize(BufPtr, BufLen);
+	}
 	CmdPtr->Len = *Size;
 	/**
 	 * Check if Cmd payload is less than buffer size, then copy to
@@ -399,7 +413,11 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 	CdoCounter++;
 	XPlmi_Printf(DEBUG_PRINT_ALWAYS, " %u.0x%x\r\n",CdoCounter, CmdPtr->CmdId);
 #endif
-	Status = XPlmi_CmdExecute(CmdPtr);
+	if (CacheEntry != NULL) {
+		Status = XPlmi_CmdExecuteHandler(CmdPtr, CacheEntry->Handler);
+	} else {
+		Status = XPlmi_CmdExecute(CmdPtr);
+	}
 	if (Status != XST_SUCCESS) {
 		XPlmi_Printf(DEBUG_PRINT_ALWAYS,
 			"CMD: 0x%08x execute failed, Processed Cdo Length 0x%0x\n\r",
@@ -413,6 +431,11 @@ static int XPlmi_CdoCmdExecute(XPlmiCdo *CdoPtr, u32 *BufPtr, u32 BufLen, u32 *S
 		goto END;
 	}
 
+	/** Record the commands executed in one go for the next load */
+	if ((CacheEntry == NULL) && (CdoPtr->CmdState == XPLMI_CMD_STATE_START)) {
+		XPlmi_CdoCacheRecord(CdoPtr->Cache, CmdOffset, CmdPtr, *Size);
+	}
+
 	CdoPtr->ProcessedCdoLen += *Size;
 	if(CmdPtr->Len == (CmdPtr->PayloadLen - 1U)) {
 		CdoPtr->ProcessedCdoLen +=  CdoPtr->Cmd.KeyHoleParams.ExtraWords;
@@ -36,6 +36,7 @@
 * 1.05  ma   01/31/2022 Fix DMA Keyhole command issue where the command
 *                       starts at the 32K boundary
 * 1.06  bm   05/22/2023 Update current CDO command offset in GSW Error Status
+* 2.1   sb   10/16/2026 Added pre-decoded command cache context
 *
 * </pre>
 *
@@ -53,6 +54,7 @@ extern "C" {
 #include "xplmi_cmd.h"
 #include "xplmi_debug.h"
 #include "xplmi_status.h"
+#include "xplmi_cdo_cache.h"
 
 /**@cond xplmi_internal
  * @{
@@ -106,6 +108,8 @@ typedef struct {
 				CDO header*/
 	u8 DeferredError;	/**< Defer the error for any command till the
 				  end of CDO processing */
+	XPlmi_CdoCache *Cache;	/**< Pre-decoded command cache, NULL if the
+				  CDO is not cached */
 } XPlmiCdo;
 /***************** Macros (Inline Functions) Definitions *********************/
 
@@ -0,0 +1,347 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_cdo_cache.c
+*
+* This file contains the pre-decoded CDO command cache.
+*
+* While an authenticated CDO is processed for the first time, the offset,
+* header word, length and resolved handler of every command executed in one
+* go are recorded in a cache region. When a CDO with the same key, the
+* verified SHA3-384 digest of the partition, is loaded again, those commands
+* are dispatched straight to the recorded handlers, skipping the command
+* size calculation, module lookup and handler validation.
+*
+* The payload is still loaded, verified and read from the chunk buffers;
+* only the decoding is cached. A recorded command is used only when its
+* offset and header word match the command at hand, so commands skipped
+* by break commands, split across chunks or resumed take the regular path.
+*
+* The slot table holding the keys lives in PLM data, the entries in the
+* cache region, which must be accessible to the PMC only. A recording is
+* committed only when the whole CDO executed without errors.
+*
+* Recorded handlers were resolved against the module table of the time, so
+* all recordings are dropped when a module is registered.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.1   sb   10/16/2026 Initial release
+*       sb   10/16/2026 Invalidate the recordings when a module registers
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+
+/**
+ * @addtogroup xilplmi_server_apis XilPlmi server APIs
+ * @{
+ */
+
+/***************************** Include Files *********************************/
+#include "xplmi_cdo_cache.h"
+#ifdef PLM_CDO_CACHE
+#include "xplmi_hw.h"
+#include "xplmi_debug.h"
+#include "xplmi_util.h"
+#include "xil_sutil.h"
+
+/************************** Constant Definitions *****************************/
+#define XPLMI_CDO_CACHE_MAX_SLOTS	(4U) /**< Number of cached CDOs */
+#define XPLMI_CDO_CACHE_MAX_ENTRIES	((u32)(XPLMI_CDO_CACHE_LEN / \
+					sizeof(XPlmi_CdoCacheEntry))) /**< Entries
+					fitting in the cache region */
+
+#define XPLMI_CDO_CACHE_MODE_REPLAY	(1U) /**< Dispatching recorded commands */
+#define XPLMI_CDO_CACHE_MODE_RECORD	(2U) /**< Recording the commands */
+#define XPLMI_CDO_CACHE_MODE_DROP	(3U) /**< Recording abandoned */
+
+/**************************** Type Definitions *******************************/
+/** Cached CDO */
+typedef struct {
+	u32 Key[XPLMI_CDO_CACHE_KEY_LEN / XPLMI_WORD_LEN]; /**< CDO digest */
+	u32 Start;	/**< First entry in the cache region */
+	u32 Count;	/**< Number of entries */
+	u32 LastUse;	/**< Use counter value when last opened */
+	u8 IsValid;	/**< Slot holds a committed recording */
+} XPlmi_CdoCacheSlot;
+
+struct XPlmi_CdoCache {
+	XPlmi_CdoCacheEntry *Entries;	/**< Cache region */
+	XPlmi_CdoCacheSlot *Slot;	/**< Slot being replayed */
+	u32 Key[XPLMI_CDO_CACHE_KEY_LEN / XPLMI_WORD_LEN]; /**< CDO digest */
+	u32 Start;	/**< First entry of the recording or replay */
+	u32 Index;	/**< Next entry */
+	u32 End;	/**< Entry after the last usable one */
+	u32 Hits;	/**< Commands dispatched from the cache */
+	u8 Mode;	/**< Replay, record or drop */
+	u8 IsOpen;	/**< A CDO is using the cache */
+};
+
+/***************** Macros (Inline Functions) Definitions *********************/
+
+/************************** Function Prototypes ******************************/
+
+/************************** Variable Definitions *****************************/
+static XPlmi_CdoCacheSlot CdoCacheSlots[XPLMI_CDO_CACHE_MAX_SLOTS];
+static XPlmi_CdoCache CdoCache;
+static u32 CdoCacheUseCnt;	/**< Incremented on every open */
+static u32 CdoCacheNextFree;	/**< Entry where the next recording starts */
+
+/*****************************************************************************/
+/**
+ * @brief	This function opens the cache for a CDO. If a recording of the CDO
+ * 			is cached, its commands are replayed, otherwise the commands
+ * 			executed are recorded.
+ *
+ * @param	Key is the verified SHA3-384 digest of the CDO partition
+ *
+ * @return
+ * 			- Pointer to the cache context, NULL if the cache is in use
+ *
+ *****************************************************************************/
+XPlmi_CdoCache *XPlmi_CdoCacheOpen(const u8 *Key)
+{
+	int Status = XST_FAILURE;
+	XPlmi_CdoCache *Cache = NULL;
+	XPlmi_CdoCacheSlot *Slot;
+	u32 Index;
+
+	if ((Key == NULL) || (CdoCache.IsOpen == (u8)TRUE)) {
+		goto END;
+	}
+
+	Status = Xil_SMemCpy(CdoCache.Key, XPLMI_CDO_CACHE_KEY_LEN, Key,
+			XPLMI_CDO_CACHE_KEY_LEN, XPLMI_CDO_CACHE_KEY_LEN);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	CdoCacheUseCnt++;
+	CdoCache.Entries = (XPlmi_CdoCacheEntry *)(UINTPTR)XPLMI_CDO_CACHE_ADDR;
+	CdoCache.Slot = NULL;
+	CdoCache.Hits = 0U;
+	for (Index = 0U; Index < XPLMI_CDO_CACHE_MAX_SLOTS; Index++) {
+		Slot = &CdoCacheSlots[Index];
+		if ((Slot->IsValid == (u8)TRUE) &&
+			(Xil_SMemCmp(Slot->Key, XPLMI_CDO_CACHE_KEY_LEN, CdoCache.Key,
+			XPLMI_CDO_CACHE_KEY_LEN, XPLMI_CDO_CACHE_KEY_LEN) == XST_SUCCESS)) {
+			CdoCache.Slot = Slot;
+			break;
+		}
+	}
+
+	if (CdoCache.Slot != NULL) {
+		CdoCache.Mode = (u8)XPLMI_CDO_CACHE_MODE_REPLAY;
+		CdoCache.Start = CdoCache.Slot->Start;
+		CdoCache.End = CdoCache.Slot->Start + CdoCache.Slot->Count;
+		CdoCache.Slot->LastUse = CdoCacheUseCnt;
+	} else {
+		/*
+		 * Record after the previous recording, or from the start of the
+		 * region if less than half of it is left
+		 */
+		CdoCache.Mode = (u8)XPLMI_CDO_CACHE_MODE_RECORD;
+		CdoCache.Start = CdoCacheNextFree;
+		if (CdoCache.Start > (XPLMI_CDO_CACHE_MAX_ENTRIES / 2U)) {
+			CdoCache.Start = 0U;
+		}
+		CdoCache.End = XPLMI_CDO_CACHE_MAX_ENTRIES;
+	}
+	CdoCache.Index = CdoCache.Start;
+	CdoCache.IsOpen = (u8)TRUE;
+	Cache = &CdoCache;
+
+END:
+	return Cache;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function closes the cache after the CDO is processed. The
+ * 			slots whose entries were overwritten by a recording are
+ * 			invalidated and the recording is committed if requested.
+ *
+ * @param	Cache is the cache context returned by XPlmi_CdoCacheOpen
+ * @param	Commit is TRUE if the whole CDO executed without errors
+ *
+ *****************************************************************************/
+void XPlmi_CdoCacheClose(XPlmi_CdoCache *Cache, u8 Commit)
+{
+	XPlmi_CdoCacheSlot *Slot;
+	XPlmi_CdoCacheSlot *Victim = NULL;
+	u32 Index;
+
+	if ((Cache == NULL) || (Cache->IsOpen != (u8)TRUE)) {
+		goto END;
+	}
+
+	if (Cache->Mode == (u8)XPLMI_CDO_CACHE_MODE_REPLAY) {
+		XPlmi_Printf(DEBUG_INFO, "CDO cache: %u commands replayed\n\r",
+			Cache->Hits);
+		goto CLEAR;
+	}
+
+	for (Index = 0U; Index < XPLMI_CDO_CACHE_MAX_SLOTS; Index++) {
+		Slot = &CdoCacheSlots[Index];
+		if ((Slot->IsValid == (u8)TRUE) && (Slot->Start < Cache->Index) &&
+			((Slot->Start + Slot->Count) > Cache->Start)) {
+			Slot->IsValid = (u8)FALSE;
+		}
+		/* Prefer free slots, then the least recently used one */
+		if ((Victim == NULL) || ((Victim->IsValid == (u8)TRUE) &&
+			((Slot->IsValid == (u8)FALSE) ||
+			(Slot->LastUse < Victim->LastUse)))) {
+			Victim = Slot;
+		}
+	}
+
+	if ((Commit != (u8)TRUE) ||
+		(Cache->Mode != (u8)XPLMI_CDO_CACHE_MODE_RECORD) ||
+		(Cache->Index == Cache->Start)) {
+		goto CLEAR;
+	}
+
+	/* Commit the recording to a free or to the least recently used slot */
+	if (Xil_SMemCpy(Victim->Key, XPLMI_CDO_CACHE_KEY_LEN, Cache->Key,
+		XPLMI_CDO_CACHE_KEY_LEN, XPLMI_CDO_CACHE_KEY_LEN) != XST_SUCCESS) {
+		Victim->IsValid = (u8)FALSE;
+		goto CLEAR;
+	}
+	Victim->Start = Cache->Start;
+	Victim->Count = Cache->Index - Cache->Start;
+	Victim->LastUse = CdoCacheUseCnt;
+	Victim->IsValid = (u8)TRUE;
+	CdoCacheNextFree = Cache->Index;
+	XPlmi_Printf(DEBUG_INFO, "CDO cache: %u commands recorded\n\r",
+		Victim->Count);
+
+CLEAR:
+	(void)XPlmi_MemSetBytes(Cache->Key, XPLMI_CDO_CACHE_KEY_LEN, 0U,
+		XPLMI_CDO_CACHE_KEY_LEN);
+	Cache->IsOpen = (u8)FALSE;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the recorded command at the given offset.
+ *
+ * @param	Cache is the cache context, NULL if the CDO is not cached
+ * @param	Offset is the offset of the command in the CDO in words
+ * @param	BufPtr is pointer to the command
+ * @param	BufLen is length of the buffer holding the command in words
+ *
+ * @return
+ * 			- Recorded command, NULL if the command is not recorded or
+ * 			not complete in the buffer
+ *
+ *****************************************************************************/
+const XPlmi_CdoCacheEntry *XPlmi_CdoCacheLookup(XPlmi_CdoCache *Cache,
+	u32 Offset, const u32 *BufPtr, u32 BufLen)
+{
+	const XPlmi_CdoCacheEntry *Entry = NULL;
+	u32 Index;
+
+	if ((Cache == NULL) || (Cache->Mode != (u8)XPLMI_CDO_CACHE_MODE_REPLAY)) {
+		goto END;
+	}
+
+	/* Skip the recorded commands this load did not execute */
+	Index = Cache->Index;
+	while ((Index < Cache->End) && (Cache->Entries[Index].Offset < Offset)) {
+		Index++;
+	}
+	Cache->Index = Index;
+	if (Index == Cache->End) {
+		goto END;
+	}
+
+	if ((Cache->Entries[Index].Offset == Offset) &&
+		(Cache->Entries[Index].CmdId == BufPtr[0U]) &&
+		(Cache->Entries[Index].Size <= BufLen) &&
+		(Cache->Entries[Index].Handler != NULL)) {
+		Entry = &Cache->Entries[Index];
+		Cache->Index = Index + 1U;
+		Cache->Hits++;
+	}
+
+END:
+	return Entry;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function records a command executed in one go.
+ *
+ * @param	Cache is the cache context, NULL if the CDO is not cached
+ * @param	Offset is the offset of the command in the CDO in words
+ * @param	CmdPtr is pointer to the executed command
+ * @param	Size is the command length including the header in words
+ *
+ *****************************************************************************/
+void XPlmi_CdoCacheRecord(XPlmi_CdoCache *Cache, u32 Offset,
+	const XPlmi_Cmd *CmdPtr, u32 Size)
+{
+	XPlmi_CdoCacheEntry *Entry;
+
+	if ((Cache == NULL) || (Cache->Mode != (u8)XPLMI_CDO_CACHE_MODE_RECORD)) {
+		goto END;
+	}
+
+	/* Drop recordings overflowing the region or going backwards */
+	if ((Cache->Index == Cache->End) || ((Cache->Index > Cache->Start) &&
+		(Cache->Entries[Cache->Index - 1U].Offset >= Offset))) {
+		Cache->Mode = (u8)XPLMI_CDO_CACHE_MODE_DROP;
+		goto END;
+	}
+
+	Entry = &Cache->Entries[Cache->Index];
+	Entry->Offset = Offset;
+	Entry->CmdId = CmdPtr->CmdId;
+	Entry->Size = Size;
+	Entry->Handler = CmdPtr->ResumeHandler;
+	Cache->Index++;
+
+END:
+	return;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function drops all recordings. It is called when a module
+ * 			is registered, as commands that went to another handler or
+ * 			were rejected before may now resolve differently. A CDO using
+ * 			the cache continues uncached and its recording is not
+ * 			committed.
+ *
+ *****************************************************************************/
+void XPlmi_CdoCacheInvalidate(void)
+{
+	u32 Index;
+
+	for (Index = 0U; Index < XPLMI_CDO_CACHE_MAX_SLOTS; Index++) {
+		CdoCacheSlots[Index].IsValid = (u8)FALSE;
+	}
+	CdoCacheNextFree = 0U;
+	if (CdoCache.IsOpen == (u8)TRUE) {
+		CdoCache.Mode = (u8)XPLMI_CDO_CACHE_MODE_DROP;
+	}
+}
+#endif /* PLM_CDO_CACHE */
+
+/**
+ * @}
+ */
@@ -0,0 +1,102 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xplmi_cdo_cache.h
+*
+* This file contains declarations of the pre-decoded CDO command cache.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date        Changes
+* ----- ---- -------- -------------------------------------------------------
+* 2.1   sb   10/16/2026 Initial release
+*       sb   10/16/2026 Added XPlmi_CdoCacheInvalidate
+*
+* </pre>
+*
+* @note
+*
+******************************************************************************/
+#ifndef XPLMI_CDO_CACHE_H
+#define XPLMI_CDO_CACHE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xplmi_cmd.h"
+#include "xplmi_config.h"
+
+/**@cond xplmi_internal
+ * @{
+ */
+
+/************************** Constant Definitions *****************************/
+#define XPLMI_CDO_CACHE_KEY_LEN		(48U) /**< Key length in bytes, SHA3-384
+						digest of the CDO */
+
+/**************************** Type Definitions *******************************/
+/** Pre-decoded CDO command */
+typedef struct {
+	u32 Offset;	/**< Offset of the command from the end of the CDO
+			  header, in words */
+	u32 CmdId;	/**< Command header word */
+	u32 Size;	/**< Command length including the header, in words */
+	int (*Handler)(XPlmi_Cmd *Cmd);	/**< Command handler */
+} XPlmi_CdoCacheEntry;
+
+/** Cache context of the CDO being processed */
+typedef struct XPlmi_CdoCache XPlmi_CdoCache;
+
+/************************** Function Prototypes ******************************/
+#ifdef PLM_CDO_CACHE
+XPlmi_CdoCache *XPlmi_CdoCacheOpen(const u8 *Key);
+void XPlmi_CdoCacheClose(XPlmi_CdoCache *Cache, u8 Commit);
+const XPlmi_CdoCacheEntry *XPlmi_CdoCacheLookup(XPlmi_CdoCache *Cache,
+	u32 Offset, const u32 *BufPtr, u32 BufLen);
+void XPlmi_CdoCacheRecord(XPlmi_CdoCache *Cache, u32 Offset,
+	const XPlmi_Cmd *CmdPtr, u32 Size);
+void XPlmi_CdoCacheInvalidate(void);
+#else
+static inline const XPlmi_CdoCacheEntry *XPlmi_CdoCacheLookup(
+	XPlmi_CdoCache *Cache, u32 Offset, const u32 *BufPtr, u32 BufLen)
+{
+	(void)Cache;
+	(void)Offset;
+	(void)BufPtr;
+	(void)BufLen;
+
+	return NULL;
+}
+
+static inline void XPlmi_CdoCacheRecord(XPlmi_CdoCache *Cache, u32 Offset,
+	const XPlmi_Cmd *CmdPtr, u32 Size)
+{
+	(void)Cache;
+	(void)Offset;
+	(void)CmdPtr;
+	(void)Size;
+}
+
+static inline void XPlmi_CdoCacheInvalidate(void)
+{
+}
+#endif
+
+/**
+ * @}
+ * @endcond
+ */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XPLMI_CDO_CACHE_H */
@@ -30,6 +30,8 @@
 * 2.0   ng   11/11/2023 Implemented user modules
 *       mss  03/13/2024 Fix MISRA-C violation 10.3
 *       bs   07/15/2024 Updated Cmd Resume to return errror in 0x2XXX format
+* 2.1   sb   10/16/2026 Added XPlmi_CmdExecuteHandler to dispatch commands
+*                       whose handler is already resolved
 * </pre>
 *
 * @note
@@ -129,7 +131,31 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 			CmdPtr->CmdId, CmdPtr->Len, CmdPtr->PayloadLen);
 
 	/** - Execute the API. */
-	Status = ModuleCmd->Handler(CmdPtr);
+	Status = XPlmi_CmdExecuteHandler(CmdPtr, ModuleCmd->Handler);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function will call an already resolved command handler.
+ * 			It is used by XPlmi_CmdExecute and to dispatch commands whose
+ * 			handler was resolved when the CDO was processed before.
+ *
+ * @param	CmdPtr is pointer to command structure
+ * @param	Handler is the command handler
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_CDO_CMD on invalid CDO command handler.
+ *
+ *****************************************************************************/
+int XPlmi_CmdExecuteHandler(XPlmi_Cmd *CmdPtr, int (*Handler)(XPlmi_Cmd *Cmd))
+{
+	int Status = XST_FAILURE;
+
+	Status = Handler(CmdPtr);
 	if (Status != XST_SUCCESS) {
 
 		Status = XPlmi_UpdateStatus((XPlmiStatus_t)XPlmi_GetCdoErr(CmdPtr->CmdId), Status);
@@ -148,7 +174,7 @@ int XPlmi_CmdExecute(XPlmi_Cmd *CmdPtr)
 	/** - Increment the processed length and it can be used during resume */
 	CmdPtr->ProcessedLen += CmdPtr->PayloadLen;
 	/** - Assign the same handler for Resume */
-	CmdPtr->ResumeHandler = ModuleCmd->Handler;
+	CmdPtr->ResumeHandler = Handler;
 
 END:
 	return Status;
@@ -47,6 +47,8 @@
 * 1.8   skg  10/04/2022 Added masks for SLR ID and Zeriozing the SLR ID
 * 1.9   bm   07/11/2023 Added XPlmi_ClearEndStack member to XPlmi_Cmd structure
 *       pre  09/18/2024 Added XPLMI_SLR_INDEX_SHIFT, SLR index macros
+* 2.1   sb   10/16/2026 Added XPlmi_CmdExecuteHandler prototype
+*       sb   10/16/2026 Added IsCmdRing member to XPlmi_Cmd structure
 *
 * </pre>
 *
@@ -122,12 +124,14 @@ struct XPlmi_Cmd {
 	u32 ProcessedCdoLen;
 	u8 DeferredError;
 	u8 AckInPLM;
+	u8 IsCmdRing;
 };
 
 /***************** Macros (Inline Functions) Definitions *********************/
 
 /************************** Function Prototypes ******************************/
 int XPlmi_CmdExecute(XPlmi_Cmd * CmdPtr);
+int XPlmi_CmdExecuteHandler(XPlmi_Cmd *CmdPtr, int (*Handler)(XPlmi_Cmd *Cmd));
 int XPlmi_CmdResume(XPlmi_Cmd * CmdPtr);
 
 
@@ -43,6 +43,8 @@
 *       ng   03/30/2023 Updated algorithm and return values in doxygen comments
 * 1.10  ng   07/06/2023 Added support for SDT flow
 *       pre  14/12/2023 Fixed compilation warnings
+*       sb   10/16/2026 Added binary debug log records
+*       sb   10/16/2026 Store binary records with interrupts disabled
 *
 * </pre>
 *
@@ -65,6 +67,9 @@
 #include "xplmi_status.h"
 #include "xplmi_hw.h"
 #include <stdarg.h>
+#ifdef PLM_BINARY_LOG
+#include "mb_interface.h"
+#endif
 
 #ifdef PLM_DEBUG_DETAILED
 #warning "Log Level set to Detailed,for JTAG_SBI Bootmode device program may timeout refer PLM wiki to change xsdb timeout"
@@ -92,9 +97,269 @@
 #define XPLMI_UART_SELECT_1		(2U) /**< Flag indicates UART1 is selected */
 #endif
 
+#ifdef PLM_BINARY_LOG
+#define XPLMI_MB_MSR_IE_MASK		(0x2U) /**< Interrupt enable bit of MSR */
+#endif
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
+#ifdef PLM_BINARY_LOG
+static u8 BinLogInPrint = (u8)FALSE; /**< Set while a print is formatted for UART */
+static char8 BinLogText[XPLMI_BIN_LOG_MAX_STR_LEN]; /**< Text not printed by XPlmi_Print */
+static u32 BinLogTextLen = 0U; /**< Number of bytes in BinLogText */
+
+/*****************************************************************************/
+/**
+ * @brief	This function disables interrupts so that the binary log state
+ * 		is not updated by a print from an interrupt handler.
+ *
+ * @return	MSR before the interrupts were disabled
+ *
+ *****************************************************************************/
+static u32 XPlmi_BinLogLock(void)
+{
+	u32 Msr = mfmsr();
+
+	microblaze_disable_interrupts();
+
+	return Msr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function enables interrupts again if they were enabled
+ * 		when XPlmi_BinLogLock was called.
+ *
+ * @param	Msr is the MSR returned by XPlmi_BinLogLock
+ *
+ *****************************************************************************/
+static void XPlmi_BinLogUnlock(u32 Msr)
+{
+	if ((Msr & XPLMI_MB_MSR_IE_MASK) != 0U) {
+		microblaze_enable_interrupts();
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a binary record to the debug log buffer. The
+ * 		space for the record is reserved with interrupts disabled before
+ * 		it is written, so that a print from an interrupt handler gets a
+ * 		separate record.
+ *
+ * @param	Record is the record with its payload filled from word 3
+ * @param	Type is the record type
+ * @param	DebugType is the debug type of the print
+ * @param	Len is the number of words in the record
+ *
+ *****************************************************************************/
+static void XPlmi_StoreBinaryRecord(u32 *Record, u32 Type, u16 DebugType,
+		u32 Len)
+{
+	XPlmi_PerfTime PerfTime;
+	u64 TimeUs;
+	u32 Offset;
+	u32 NextOffset;
+	u32 Index;
+	u32 Msr;
+
+	/* Get time stamp of PLM */
+	XPlmi_MeasurePerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
+		XPLMI_PIT2_CYCLE_VALUE, &PerfTime);
+	TimeUs = (PerfTime.TPerfMs * (u64)XPLMI_KILO) + PerfTime.TPerfMsFrac;
+
+	Record[0U] = (XPLMI_BIN_LOG_MAGIC << XPLMI_BIN_LOG_MAGIC_SHIFT) |
+		(Len << XPLMI_BIN_LOG_LEN_SHIFT) |
+		(Type << XPLMI_BIN_LOG_TYPE_SHIFT) | ((u32)DebugType & 0xFFU);
+	if ((DebugType & XPLMI_DEBUG_PRINT_TIMESTAMP_MASK) != 0U) {
+		Record[0U] |= XPLMI_BIN_LOG_TYPE_TS_MASK << XPLMI_BIN_LOG_TYPE_SHIFT;
+	}
+	Record[1U] = (u32)TimeUs;
+	Record[2U] = (u32)(TimeUs >> 32U);
+
+	/* Reserve the space for the record */
+	Msr = XPlmi_BinLogLock();
+	Offset = DebugLog->LogBuffer.Offset;
+	if (Offset >= DebugLog->LogBuffer.Len) {
+		Offset = 0U;
+		DebugLog->LogBuffer.IsBufferFull = (u32)TRUE;
+	}
+	NextOffset = Offset + (Len * XPLMI_WORD_LEN);
+	if (NextOffset >= DebugLog->LogBuffer.Len) {
+		NextOffset -= DebugLog->LogBuffer.Len;
+		DebugLog->LogBuffer.IsBufferFull = (u32)TRUE;
+	}
+	DebugLog->LogBuffer.Offset = NextOffset;
+	XPlmi_BinLogUnlock(Msr);
+
+	for (Index = 0U; Index < Len; Index++) {
+		XPlmi_Out64(DebugLog->LogBuffer.StartAddr + Offset, Record[Index]);
+		Offset += XPLMI_WORD_LEN;
+		if (Offset >= DebugLog->LogBuffer.Len) {
+			Offset = 0U;
+		}
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function packs a string to a binary record as its length
+ * 		followed by its bytes, four bytes per word.
+ *
+ * @param	Record is the binary record
+ * @param	Index is the word of the record from which the string is packed
+ * @param	Str is the string to be packed
+ * @param	MaxLen is the maximum number of bytes to be packed
+ *
+ * @return	Index of the word after the string, or Index if the string
+ * 		does not fit in the record
+ *
+ *****************************************************************************/
+static u32 XPlmi_PackBinaryStr(u32 *Record, u32 Index, const char8 *Str,
+		u32 MaxLen)
+{
+	u32 Len = 0U;
+	u32 WordIdx = Index + 1U;
+	u32 ByteIdx;
+
+	if (Str != NULL) {
+		while ((Len < MaxLen) && (Str[Len] != '\0')) {
+			++Len;
+		}
+	}
+	if ((WordIdx + ((Len + XPLMI_WORD_LEN - 1U) / XPLMI_WORD_LEN)) >
+			XPLMI_BIN_LOG_MAX_LEN) {
+		WordIdx = Index;
+		goto END;
+	}
+
+	Record[Index] = Len;
+	for (ByteIdx = 0U; ByteIdx < Len; ByteIdx++) {
+		if ((ByteIdx % XPLMI_WORD_LEN) == 0U) {
+			Record[WordIdx] = 0U;
+		}
+		Record[WordIdx] |= (u32)(u8)Str[ByteIdx] <<
+			((ByteIdx % XPLMI_WORD_LEN) * 8U);
+		if ((ByteIdx % XPLMI_WORD_LEN) == (XPLMI_WORD_LEN - 1U)) {
+			++WordIdx;
+		}
+	}
+	if ((Len % XPLMI_WORD_LEN) != 0U) {
+		++WordIdx;
+	}
+
+END:
+	return WordIdx;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function stores a print to the debug log buffer as a binary
+ * 		record of its format string address and arguments. The print is
+ * 		formatted on the host by xplmi_log_decode. Arguments that do not
+ * 		fit in the record are dropped.
+ *
+ * @param	DebugType is the PLM Debug level for the message
+ * @param	Format is the format specified string of the print
+ * @param	Args is the argument list of the print
+ *
+ *****************************************************************************/
+static void XPlmi_StoreBinaryPrint(u16 DebugType, const char8 *Format,
+		va_list Args)
+{
+	u32 Record[XPLMI_BIN_LOG_MAX_LEN];
+	u32 Index = XPLMI_BIN_LOG_HDR_LEN;
+	const char8 *Fmt = Format;
+	u32 LongCnt;
+	u32 NextIndex;
+	u64 Arg64;
+
+	Record[Index] = (u32)(UINTPTR)Format;
+	++Index;
+
+	/* Walk the conversion specifiers to pick the arguments */
+	while ((*Fmt != '\0') && (Index < XPLMI_BIN_LOG_MAX_LEN)) {
+		if (*Fmt != '%') {
+			++Fmt;
+			continue;
+		}
+		++Fmt;
+		while (((*Fmt >= '0') && (*Fmt <= '9')) || (*Fmt == '-') ||
+				(*Fmt == '.')) {
+			++Fmt;
+		}
+		LongCnt = 0U;
+		while (*Fmt == 'l') {
+			++LongCnt;
+			++Fmt;
+		}
+		if (*Fmt == '\0') {
+			break;
+		}
+		if (*Fmt == 's') {
+			NextIndex = XPlmi_PackBinaryStr(Record, Index,
+				va_arg(Args, const char8 *), XPLMI_BIN_LOG_MAX_STR_LEN);
+			if (NextIndex == Index) {
+				break;
+			}
+			Index = NextIndex;
+		}
+		else if (*Fmt == 'p') {
+			Record[Index] = (u32)(UINTPTR)va_arg(Args, void *);
+			++Index;
+		}
+		else if (LongCnt > 1U) {
+			if ((Index + 1U) >= XPLMI_BIN_LOG_MAX_LEN) {
+				break;
+			}
+			Arg64 = va_arg(Args, u64);
+			Record[Index] = (u32)Arg64;
+			Record[Index + 1U] = (u32)(Arg64 >> 32U);
+			Index += 2U;
+		}
+		else if (*Fmt != '%') {
+			Record[Index] = va_arg(Args, u32);
+			++Index;
+		}
+		else {
+			/* %% has no argument */
+		}
+		++Fmt;
+	}
+
+	XPlmi_StoreBinaryRecord(Record, XPLMI_BIN_LOG_TYPE_PRINT, DebugType,
+		Index);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function collects the bytes printed outside XPlmi_Print and
+ * 		stores them as a text record at the end of each line. BinLogText
+ * 		is updated with interrupts disabled, so bytes printed from an
+ * 		interrupt handler are added to the line and not lost.
+ *
+ * @param	c is the character to be logged
+ *
+ *****************************************************************************/
+static void XPlmi_StoreBinaryText(char8 c)
+{
+	u32 Record[XPLMI_BIN_LOG_MAX_LEN];
+	u32 Len;
+	u32 Msr;
+
+	Msr = XPlmi_BinLogLock();
+	BinLogText[BinLogTextLen] = c;
+	++BinLogTextLen;
+	if ((c == '\n') || (BinLogTextLen == XPLMI_BIN_LOG_MAX_STR_LEN)) {
+		Len = XPlmi_PackBinaryStr(Record, XPLMI_BIN_LOG_HDR_LEN, BinLogText,
+			BinLogTextLen);
+		XPlmi_StoreBinaryRecord(Record, XPLMI_BIN_LOG_TYPE_TEXT, 0U, Len);
+		BinLogTextLen = 0U;
+	}
+	XPlmi_BinLogUnlock(Msr);
+}
+#endif
 
 /*****************************************************************************/
 /**
@@ -271,7 +536,9 @@ END:
  *****************************************************************************/
 void outbyte(char c)
 {
+#ifndef PLM_BINARY_LOG
 	u64 CurrentAddr;
+#endif
 	/** - If UART is enabled, send the byte to UART. */
 #if (XPLMI_UART_NUM_INSTANCES > 0U)
 	u32 *UartBaseAddr = XPlmi_GetUartBaseAddr();
@@ -280,6 +547,11 @@ void outbyte(char c)
 	}
 #endif
 	/** - Store the byte onto log buffer. */
+#ifdef PLM_BINARY_LOG
+	if ((DebugLog->PrintToBuf == (u8)TRUE) && (BinLogInPrint == (u8)FALSE)) {
+		XPlmi_StoreBinaryText(c);
+	}
+#else
 	if (DebugLog->PrintToBuf == (u8)TRUE) {
 		CurrentAddr = DebugLog->LogBuffer.StartAddr +
 			DebugLog->LogBuffer.Offset;
@@ -293,6 +565,7 @@ void outbyte(char c)
 		XPlmi_OutByte64(CurrentAddr, (u8)c);
 		++DebugLog->LogBuffer.Offset;
 	}
+#endif
 }
 
 /*****************************************************************************/
@@ -306,14 +579,49 @@ void outbyte(char c)
 void XPlmi_Print(u16 DebugType, const char8 *Ctrl1, ...)
 {
 	va_list Args;
+#if defined(PLM_BINARY_LOG) && (XPLMI_UART_NUM_INSTANCES > 0U)
+	u8 PrevInPrint;
+#endif
 
-	va_start(Args, Ctrl1);
+	if (((DebugType) & (DebugLog->LogLevel)) == 0U) {
+		goto END;
+	}
 
-	if (((DebugType) & (DebugLog->LogLevel)) != 0U) {
-		if ((DebugType & XPLMI_DEBUG_PRINT_TIMESTAMP_MASK) != 0U) {
-			XPlmi_PrintPlmTimeStamp();
-		}
-		xil_vprintf(Ctrl1, Args);
+#ifdef PLM_BINARY_LOG
+	/**
+	 * - Store the print to the log buffer as a binary record. It is
+	 * formatted only if UART prints are enabled.
+	 */
+	if (DebugLog->PrintToBuf == (u8)TRUE) {
+		va_start(Args, Ctrl1);
+		XPlmi_StoreBinaryPrint(DebugType, Ctrl1, Args);
+		va_end(Args);
 	}
+#if (XPLMI_UART_NUM_INSTANCES > 0U)
+	if (XPlmi_IsUartPrintInitialized() == (u8)FALSE) {
+		goto END;
+	}
+	/**
+	 * - A print from an interrupt handler restores the flag of the print
+	 * it interrupted instead of clearing it.
+	 */
+	PrevInPrint = BinLogInPrint;
+	BinLogInPrint = (u8)TRUE;
+#else
+	goto END;
+#endif
+#endif
+
+	va_start(Args, Ctrl1);
+	if ((DebugType & XPLMI_DEBUG_PRINT_TIMESTAMP_MASK) != 0U) {
+		XPlmi_PrintPlmTimeStamp();
+	}
+	xil_vprintf(Ctrl1, Args);
 	va_end(Args);
+#if defined(PLM_BINARY_LOG) && (XPLMI_UART_NUM_INSTANCES > 0U)
+	BinLogInPrint = PrevInPrint;
+#endif
+
+END:
+	return;
 }
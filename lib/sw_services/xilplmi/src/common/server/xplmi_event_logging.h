@@ -30,6 +30,7 @@
 *       bsv  07/19/2021 Disable UART prints when invalid header is encountered
 *                       in slave boot modes
 *       bm   08/12/2021 Added support to configure uart during run-time
+*       sb   10/16/2026 Added binary debug log record layout
 *
 *
 * </pre>
@@ -95,6 +96,38 @@ void XPlmi_InitDebugLogBuffer(void);
 /* Trace event IDs */
 #define XPLMI_TRACE_LOG_LOAD_IMAGE		(0x1U)
 
+/*
+ * Binary debug log records, stored in the debug log buffer instead of the
+ * formatted prints when PLM_BINARY_LOG is enabled
+ * 		0U - Header
+ * 			31:24 - XPLMI_BIN_LOG_MAGIC
+ * 			23:16 - Record length in words
+ * 			15:8  - Record type, with XPLMI_BIN_LOG_TYPE_TS_MASK set if
+ * 				the print has a time stamp
+ * 			7:0   - Debug type of the print
+ * 		1U - Time stamp in us, lower word
+ * 		2U - Time stamp in us, upper word
+ * 		3U - Print record: address of the format string in the PLM elf
+ * 		     Text record: length of the text in bytes, followed by the
+ * 		     text packed four bytes per word, first byte in bits 7:0
+ * 		4U - Print record: one word per argument, two words for 64 bit
+ * 		     arguments, lower word first. %s arguments are stored as
+ * 		     their length in bytes followed by the packed string
+ * 		...
+ */
+#define XPLMI_BIN_LOG_MAGIC			(0xB1U)
+#define XPLMI_BIN_LOG_MAGIC_SHIFT		(24U)
+#define XPLMI_BIN_LOG_LEN_SHIFT			(16U)
+#define XPLMI_BIN_LOG_LEN_MASK			(0xFFU)
+#define XPLMI_BIN_LOG_TYPE_SHIFT		(8U)
+#define XPLMI_BIN_LOG_TYPE_MASK			(0x7FU)
+#define XPLMI_BIN_LOG_TYPE_TS_MASK		(0x80U)
+#define XPLMI_BIN_LOG_TYPE_PRINT		(0x1U)
+#define XPLMI_BIN_LOG_TYPE_TEXT			(0x2U)
+#define XPLMI_BIN_LOG_HDR_LEN			(3U)
+#define XPLMI_BIN_LOG_MAX_LEN			(32U)
+#define XPLMI_BIN_LOG_MAX_STR_LEN		(32U)
+
 /*
  * Trace log functions
  * TraceBuffer structure
@@ -122,6 +122,7 @@
 *       pre  10/26/2024 Removed XPlmi_GetReadBackPropsValue, XPlmi_SetReadBackProps and
 *                       XPlmi_GetReadBackPropsInstance APIs
 *       bm   10/29/2024 Fix chunk boundary handling in KeyholeXfr logic
+*       sb   10/16/2026 Added IPI command ring command
 *
 * </pre>
 *
@@ -138,6 +139,7 @@
 #include "xstatus.h"
 #include "xplmi_proc.h"
 #include "xplmi_hw.h"
+#include "xplmi_ipi.h"
 #include "xcfupmc.h"
 #include "sleep.h"
 #include "xplmi_event_logging.h"
@@ -2348,6 +2350,7 @@ void XPlmi_GenericInit(void)
 		XPLMI_MODULE_COMMAND(XPlmi_SsitCfgSecComm),
 		XPLMI_MODULE_COMMAND(NULL),
 		XPLMI_MODULE_COMMAND(XPlmi_GetSsitSecCommStatus),
+		XPLMI_MODULE_COMMAND(XPlmi_IpiCmdRing),
 	};
 
 	/* Buffer to store access permissions of xilplmi generic module */
@@ -2406,6 +2409,7 @@ void XPlmi_GenericInit(void)
 		XPLMI_ALL_IPI_FULL_ACCESS(XPLMI_SSIT_CFG_SEC_COMM_CMD_ID),
 		XPLMI_ALL_IPI_FULL_ACCESS(XPLMI_GETSECCOMM_STATUS_CMD_ID),
 #endif
+		XPLMI_ALL_IPI_FULL_ACCESS(XPLMI_IPI_CMD_RING_CMD_ID),
 	};
 
 	/* This is to store CMD_END in xplm_modules section */
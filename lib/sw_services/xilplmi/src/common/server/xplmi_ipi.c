@@ -87,6 +87,10 @@
  *       pre  09/18/2024 Throwing error if SlrIndex is not valid
  *       pre  10/07/2024 Executing invalid command handler registered for SEM module
  *                       irrespective of SLR index field
+ *       sb   10/16/2026 Added IPI command ring to process batches of commands
+ *                       posted in shared memory with a single IPI
+ *       sb   10/16/2026 Validate the IPI command ring region at init
+ *       sb   10/16/2026 Reject commands with a deferred ack in the command ring
  *
  * </pre>
  *
@@ -106,6 +110,12 @@
 #include "xplmi_generic.h"
 #include "xplmi_hw.h"
 #include "xil_util.h"
+#ifdef PLM_IPI_CMD_RING
+#include "xplmi_defs.h"
+#ifndef PLM_IPI_CMD_RING_PROTECTED
+#error "PLM_IPI_CMD_RING requires PLM_IPI_CMD_RING_PROTECTED, the command ring of each IPI buffer index must be accessible to its master only"
+#endif
+#endif
 
 #ifdef XPLMI_IPI_DEVICE_ID
 
@@ -121,6 +131,21 @@
 #define XPLMI_IPI5_BUFFER_INDEX		(0x7U)
 #define XPLMI_ACCESS_PERM_MASK		(0x3U)
 #define XPLMI_ACCESS_PERM_SHIFT		(0x2U)
+#ifdef PLM_IPI_CMD_RING
+#define XPLMI_CMD_RING_HEAD_OFFSET	(0x0U)
+#define XPLMI_CMD_RING_TAIL_OFFSET	(0x40U)
+#define XPLMI_CMD_RING_ENTRY_OFFSET	(0x80U)
+#define XPLMI_CMD_RING_RESP_OFFSET	(XPLMI_CMD_RING_PAYLOAD_LEN * XPLMI_WORD_LEN)
+#define XPLMI_CMD_RING_ENTRY_SIZE	((XPLMI_CMD_RING_PAYLOAD_LEN + \
+					XPLMI_CMD_RING_RESP_LEN) * XPLMI_WORD_LEN)
+#define XPLMI_CMD_RING_CMD_ID_MASK	(XPLMI_CMD_MODULE_ID_MASK | \
+					XPLMI_PLM_GENERIC_CMD_ID_MASK)
+#define XPLMI_CMD_RING_CMD_ID		((XPLMI_MODULE_GENERIC_ID << \
+					XPLMI_CMD_MODULE_ID_SHIFT) | XPLMI_IPI_CMD_RING_CMD_ID)
+#define XPLMI_CMD_RING_DDR_LOW_END	(0x80000000U)
+#define XPLMI_CMD_RING_OCM_BASEADDR	(0xFFFC0000U)
+#define XPLMI_CMD_RING_OCM_END		(0x100000000U)
+#endif
 
 /************************** Function Prototypes ******************************/
 static u32 XPlmi_GetIpiReqType(u32 CmdId, u32 SrcIndex);
@@ -128,6 +153,11 @@ static XPlmi_SubsystemHandler XPlmi_GetPmSubsystemHandler(
 	XPlmi_SubsystemHandler SubsystemHandler);
 static int XPlmi_IpiDispatchHandler(void *Data);
 static int XPlmi_IpiCmdExecute(XPlmi_Cmd * CmdPtr, u32 * Payload);
+#ifdef PLM_IPI_CMD_RING
+static void XPlmi_IpiCmdRingInit(void);
+static int XPlmi_IpiCmdRingExecute(XPlmi_Cmd *RingCmd, u64 EntryAddr,
+	u32 SrcIndex);
+#endif
 
 /************************** Variable Definitions *****************************/
 
@@ -135,6 +165,9 @@ static int XPlmi_IpiCmdExecute(XPlmi_Cmd * CmdPtr, u32 * Payload);
 /* Instance of IPI Driver */
 static XIpiPsu IpiInst;
 static XIpiPsu_Config *IpiCfgPtr;
+#ifdef PLM_IPI_CMD_RING
+static u8 CmdRingEnabled = (u8)FALSE;
+#endif
 
 /*****************************************************************************/
 /**
@@ -247,6 +280,11 @@ int XPlmi_IpiInit(XPlmi_SubsystemHandler SubsystemHandler)
 
 	(void) XPlmi_GetPmSubsystemHandler(SubsystemHandler);
 
+#ifdef PLM_IPI_CMD_RING
+	/** - Validate the IPI command ring region. */
+	XPlmi_IpiCmdRingInit();
+#endif
+
 	/** - Register and Enable the IPI IRQ. */
 	Status = XPlmi_RegisterNEnableIpi();
 	if (Status != XST_SUCCESS) {
@@ -751,6 +789,218 @@ END:
 	return Status;
 }
 
+#ifdef PLM_IPI_CMD_RING
+/*****************************************************************************/
+/**
+ * @brief	This function validates the region reserved for IPI command rings
+ * 			at XPAR_PLM_IPI_CMD_RING_BASEADDR and enables the rings if it is
+ * 			valid. Each ring takes its own XPLMI_CMD_RING_STRIDE granule, so
+ * 			the region must be aligned to it and lie wholly in the low DDR
+ * 			or in the OCM. The XMPU/XPPU regions limiting each ring to its
+ * 			master are configured by the design, PLM_IPI_CMD_RING_PROTECTED
+ * 			confirms them at build time.
+ *
+ *****************************************************************************/
+static void XPlmi_IpiCmdRingInit(void)
+{
+	u64 BaseAddr = (u64)XPAR_PLM_IPI_CMD_RING_BASEADDR;
+	u64 EndAddr = BaseAddr + (u64)XPLMI_CMD_RING_REGION_LEN;
+
+	CmdRingEnabled = (u8)FALSE;
+	if ((BaseAddr == 0U) ||
+		((BaseAddr & (XPLMI_CMD_RING_STRIDE - 1U)) != 0U)) {
+		goto END;
+	}
+	if ((EndAddr <= (u64)XPLMI_CMD_RING_DDR_LOW_END) ||
+		((BaseAddr >= (u64)XPLMI_CMD_RING_OCM_BASEADDR) &&
+		(EndAddr <= XPLMI_CMD_RING_OCM_END))) {
+		CmdRingEnabled = (u8)TRUE;
+	}
+
+END:
+	if (CmdRingEnabled != (u8)TRUE) {
+		XPlmi_Printf(DEBUG_GENERAL, "ERROR: IPI command ring region "
+			"0x%x is invalid, command rings are disabled\n\r",
+			(u32)BaseAddr);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function processes the commands posted by the requester in
+ * 			the command ring of its IPI channel. The ring is kept in the
+ * 			region reserved at XPAR_PLM_IPI_CMD_RING_BASEADDR, one for each
+ * 			IPI buffer index, so that the requester can post a batch of
+ * 			commands and use a single IPI as doorbell for all of them. At
+ * 			most one ring of commands is processed for every doorbell.
+ * 			Each command is validated and executed as if it was received
+ * 			in the IPI message buffer, and its response is written to its
+ * 			ring entry before the Tail is moved past it. Response[1] of
+ * 			the doorbell has the number of commands processed. Commands
+ * 			which acknowledge the IPI on their own, like force power down
+ * 			and In-Place PLM Update, are rejected in the ring.
+ *
+ * @param	Cmd is pointer to the doorbell command structure
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_IPI_CMD_RING if the command rings are disabled, the
+ * 			requester has no command ring or the ring indexes are invalid.
+ *
+ *****************************************************************************/
+int XPlmi_IpiCmdRing(XPlmi_Cmd *Cmd)
+{
+	int Status = XST_FAILURE;
+	u32 MaskIndex;
+	u32 SrcIndex = IPI_NO_BUF_CHANNEL_INDEX;
+	u64 RingAddr;
+	u64 EntryAddr;
+	u32 Head;
+	u32 Tail;
+	u32 ProcessedCnt = 0U;
+	XPLMI_EXPORT_CMD(XPLMI_IPI_CMD_RING_CMD_ID, XPLMI_MODULE_GENERIC_ID,
+		XPLMI_CMD_ARG_CNT_ZERO, XPLMI_CMD_ARG_CNT_ZERO);
+
+	/** - Reject the doorbell if the ring region failed validation */
+	if (CmdRingEnabled != (u8)TRUE) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD_RING, 0);
+		goto END;
+	}
+
+	/** - Get the IPI buffer index of the requester */
+	for (MaskIndex = 0U; MaskIndex < XPLMI_IPI_MASK_COUNT; MaskIndex++) {
+		if (IpiInst.Config.TargetList[MaskIndex].Mask == Cmd->IpiMask) {
+			SrcIndex = IpiInst.Config.TargetList[MaskIndex].BufferIndex;
+			break;
+		}
+	}
+	if ((Cmd->IpiMask == 0U) || (SrcIndex > XPLMI_CMD_RING_MAX_BUF_INDEX)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD_RING, 0);
+		goto END;
+	}
+
+	/**
+	 * - Read the ring indexes and check that the requester did not post
+	 *   more commands than the ring holds
+	 */
+	RingAddr = XPLMI_CMD_RING_ADDR(XPAR_PLM_IPI_CMD_RING_BASEADDR, SrcIndex);
+	Head = XPlmi_In64(RingAddr + XPLMI_CMD_RING_HEAD_OFFSET);
+	Tail = XPlmi_In64(RingAddr + XPLMI_CMD_RING_TAIL_OFFSET);
+	if ((Head - Tail) > XPLMI_CMD_RING_ENTRIES) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD_RING, 0);
+		goto END;
+	}
+
+	/** - Process the posted commands in order */
+	while (Tail != Head) {
+		EntryAddr = RingAddr + XPLMI_CMD_RING_ENTRY_OFFSET +
+			((u64)(Tail & (XPLMI_CMD_RING_ENTRIES - 1U)) *
+			XPLMI_CMD_RING_ENTRY_SIZE);
+		(void)XPlmi_IpiCmdRingExecute(Cmd, EntryAddr, SrcIndex);
+		++Tail;
+		XPlmi_Out64(RingAddr + XPLMI_CMD_RING_TAIL_OFFSET, Tail);
+		++ProcessedCnt;
+		/**
+		 * - Stop if a command acknowledged the IPI on its own anyway, the
+		 *   doorbell must not be acknowledged twice
+		 */
+		if (Cmd->AckInPLM != (u8)TRUE) {
+			break;
+		}
+	}
+	Cmd->Response[1U] = ProcessedCnt;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function validates and executes one command of the IPI
+ * 			command ring and writes its response to the ring entry.
+ *
+ * @param	RingCmd is pointer to the doorbell command structure
+ * @param	EntryAddr is the address of the ring entry
+ * @param	SrcIndex is the IPI buffer index of the requester
+ *
+ * @return
+ * 			- XST_SUCCESS on success.
+ * 			- XPLMI_ERR_IPI_CMD if command cannot be executed through IPI.
+ * 			- XPLMI_IPI_MAX_BUF_SIZE_EXCEEDS if command is too long.
+ * 			- Other error codes returned through the called functions.
+ *
+ *****************************************************************************/
+static int XPlmi_IpiCmdRingExecute(XPlmi_Cmd *RingCmd, u64 EntryAddr,
+	u32 SrcIndex)
+{
+	volatile int Status = XST_FAILURE;
+	volatile int StatusTmp = XST_FAILURE;
+	u32 Payload[XPLMI_CMD_RING_PAYLOAD_LEN];
+	XPlmi_Cmd Cmd = {0U};
+	u32 Index;
+
+	/** - Copy the command out of the ring before validating it */
+	for (Index = 0U; Index < XPLMI_CMD_RING_PAYLOAD_LEN; Index++) {
+		Payload[Index] = XPlmi_In64(EntryAddr + ((u64)Index * XPLMI_WORD_LEN));
+	}
+
+	Cmd.AckInPLM = (u8)TRUE;
+	/** - Handlers which defer the acknowledgement reject ring commands */
+	Cmd.IsCmdRing = (u8)TRUE;
+	Cmd.IpiMask = RingCmd->IpiMask;
+	Cmd.SubsystemId = RingCmd->SubsystemId;
+	Cmd.CmdId = Payload[0U];
+	Cmd.IpiReqType = XPlmi_GetIpiReqType(Cmd.CmdId, SrcIndex);
+
+	/** - Rings cannot be nested */
+	if ((Cmd.CmdId & XPLMI_CMD_RING_CMD_ID_MASK) == XPLMI_CMD_RING_CMD_ID) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD_RING, 0);
+		goto END;
+	}
+
+	/** - Validate the command as if it was received through IPI */
+	Status = XST_FAILURE;
+	XSECURE_REDUNDANT_CALL(Status, StatusTmp, XPlmi_ValidateIpiCmd, &Cmd,
+			SrcIndex);
+	if ((Status != XST_SUCCESS) || (StatusTmp != XST_SUCCESS)) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD, Status | StatusTmp);
+		goto END;
+	}
+
+	Cmd.Len = (Cmd.CmdId >> 16U) & 255U;
+	if (Cmd.Len > XPLMI_MAX_IPI_CMD_LEN) {
+		Status = (int)XPLMI_IPI_MAX_BUF_SIZE_EXCEEDS;
+		goto END;
+	}
+	Cmd.Payload = (u32 *)&Payload[1U];
+
+	/** - Execute the command */
+	Status = XPlmi_IpiCmdExecute(&Cmd, Payload);
+	if (XST_SUCCESS != Status) {
+		XPlmi_Printf(DEBUG_GENERAL, "%s: IPI ring command failed for "
+				"Command ID: 0x%x\r\n", __func__, Cmd.CmdId);
+	}
+
+END:
+	/** - Write the response to the ring entry */
+	Cmd.Response[0U] = (u32)Status & (~(u32)XPLMI_WARNING_STATUS_MASK);
+	for (Index = 0U; Index < XPLMI_CMD_RING_RESP_LEN; Index++) {
+		XPlmi_Out64(EntryAddr + XPLMI_CMD_RING_RESP_OFFSET +
+			((u64)Index * XPLMI_WORD_LEN), Cmd.Response[Index]);
+	}
+	/**
+	 * - Pass on a deferred acknowledgement, no handler is expected to defer
+	 *   it for a ring command
+	 */
+	if (Cmd.AckInPLM != (u8)TRUE) {
+		RingCmd->AckInPLM = (u8)FALSE;
+	}
+
+	return Status;
+}
+#endif /* PLM_IPI_CMD_RING */
+
 /*****************************************************************************/
 /**
  * @brief	This function returns the IPI Instance pointer
@@ -42,6 +42,7 @@
 * 1.08  bm   06/23/2023 Added IPI access permissions validation
 * 1.09  bm   02/23/2024 Ack In-Place PLM Update request after complete restore
 * 1.10  sk   05/07/2024 Added declaration for get ipi instance function
+*       sb   10/16/2026 Added IPI command ring handler
 *
 * </pre>
 *
@@ -98,12 +99,19 @@ int XPlmi_IpiDrvInit(void);
 int XPlmi_ValidateIpiCmd(XPlmi_Cmd *Cmd, u32 SrcIndex);
 void XPlmi_IpiEnable(u32 IpiMask);
 XIpiPsu *XPlmi_GetIpiInstance(void);
+#ifdef PLM_IPI_CMD_RING
+int XPlmi_IpiCmdRing(XPlmi_Cmd *Cmd);
+#endif
 
 /************************** Variable Definitions *****************************/
 
 /*****************************************************************************/
 #endif /* XPLMI_IPI_DEVICE_ID */
 
+#if !defined(XPLMI_IPI_DEVICE_ID) || !defined(PLM_IPI_CMD_RING)
+#define XPlmi_IpiCmdRing	NULL /**< IPI command ring is not supported */
+#endif
+
 #ifdef __cplusplus
 }
 #endif
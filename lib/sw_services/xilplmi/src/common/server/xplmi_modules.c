@@ -22,6 +22,7 @@
 * 1.02  bm   10/14/2020 Code clean up
 * 1.03  td   07/08/2021 Fix doxygen warnings
 * 2.0   ng   11/11/2023 Implemented user modules
+* 2.1   sb   10/16/2026 Invalidate the CDO cache on module registration
 *
 * </pre>
 *
@@ -34,6 +35,7 @@
 
 /***************************** Include Files *********************************/
 #include "xplmi_modules.h"
+#include "xplmi_cdo_cache.h"
 #include "xil_assert.h"
 #include "xil_types.h"
 
@@ -76,6 +78,9 @@ void XPlmi_ModuleRegister(XPlmi_Module *Module)
 
 	Xil_AssertVoid(Modules[ModuleId] == NULL);
 	Modules[ModuleId] = Module;
+
+	/* Cached handler lookups may no longer match the module table */
+	XPlmi_CdoCacheInvalidate();
 }
 
 /*****************************************************************************/
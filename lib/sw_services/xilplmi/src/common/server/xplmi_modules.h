@@ -44,6 +44,7 @@
 * 2.0   ng   11/11/2023 Implemented user modules
 *       pre  07/11/2024 Implemented secure PLM to PLM communication
 *       pre  09/30/24 Added support for get secure communication status command
+*       sb   10/16/2026 Added IPI command ring command id
 *
 * </pre>
 *
@@ -211,6 +212,7 @@ typedef struct {
 #define XPLMI_LIST_MASK_POLL_CMD_ID	(42U)
 #define XPLMI_SSIT_CFG_SEC_COMM_CMD_ID (43U)
 #define XPLMI_GETSECCOMM_STATUS_CMD_ID (45U)
+#define XPLMI_IPI_CMD_RING_CMD_ID	(46U)
 #define XPLMI_CDO_END_CMD_ID		(0xFFU)
 
 /************************** Function Prototypes ******************************/
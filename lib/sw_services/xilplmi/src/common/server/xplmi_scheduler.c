@@ -50,6 +50,8 @@
 *       dd   09/12/2023 MISRA-C violation Rule 13.4 fixed
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       ng   01/28/2024 optimized u8 variables
+*       sb   10/16/2026 Replaced per tick scan of all tasks with a min-heap
+*                       ordered by trigger tick and added task statistics
 *
 * </pre>
 *
@@ -70,6 +72,10 @@
  */
 
 /************************** Constant Definitions *****************************/
+#define XPLMI_SCHED_TICK_WINDOW		(0x7FFFFFFFU) /**< Max ticks a trigger
+							can be ahead */
+#define XPLMI_SCHED_NOT_IN_HEAP		(0xFFU) /**< Heap index of tasks which
+						are not triggered */
 
 /**************************** Type Definitions *******************************/
 
@@ -81,8 +87,13 @@
  */
 
 /************************** Function Prototypes ******************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex);
+static u8 XPlmi_IsTickLater(u32 Tick1, u32 Tick2);
+static u8 XPlmi_SchedIsHeapOrdered(u32 ParentPos, u32 ChildPos);
+static void XPlmi_SchedHeapSwap(u32 Pos1, u32 Pos2);
+static void XPlmi_SchedHeapSiftUp(u32 HeapPos);
+static void XPlmi_SchedHeapSiftDown(u32 HeapPos);
+static void XPlmi_SchedHeapInsert(u32 TaskListIndex);
+static void XPlmi_SchedHeapDelete(u32 HeapPos);
 
 /************************** Variable Definitions *****************************/
 static XPlmi_Scheduler_t Sched;
@@ -91,62 +102,151 @@ static XPlmi_Scheduler_t Sched;
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is active or not, returns
-* 			corresponding status of the task
+* @brief	The function checks if a tick comes later than another tick. Ticks
+* 			wrap around, so the comparison is done on their difference.
 *
-* @param   	SchedPtr is Scheduler pointer
-* @param   	TaskListIndex is Task index
+* @param	Tick1 is the tick to be checked
+* @param	Tick2 is the tick to be compared with
 *
-* @return	TRUE or FALSE based on the task active status
+* @return	TRUE if Tick1 is later than Tick2, FALSE otherwise
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskActive(XPlmi_Scheduler_t *SchedPtr, u32 TaskListIndex)
+static u8 XPlmi_IsTickLater(u32 Tick1, u32 Tick2)
 {
 	u8 ReturnVal = (u8)FALSE;
 
-	if (NULL == SchedPtr->TaskList[TaskListIndex].CustomerFunc) {
-		goto END;
+	if (((Tick1 - Tick2) - 1U) < XPLMI_SCHED_TICK_WINDOW) {
+		ReturnVal = (u8)TRUE;
 	}
 
-	if (XPlmi_IsTaskNonPeriodic(SchedPtr, TaskListIndex) == (u8)TRUE) {
-		if (SchedPtr->TaskList[TaskListIndex].TriggerTime <=
-			SchedPtr->Tick) {
-			ReturnVal = (u8)TRUE;
-		}
-	} else {
-		if ((0U != SchedPtr->TaskList[TaskListIndex].Interval)
-		&& (0U == (SchedPtr->Tick
-		% SchedPtr->TaskList[TaskListIndex].Interval))) {
-			/* Periodic */
-			ReturnVal = (u8)TRUE;
-		}
+	return ReturnVal;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function checks if the task at a parent position of the heap
+* 			is not triggered later than the task at a child position.
+*
+* @param	ParentPos is the parent position in the heap
+* @param	ChildPos is the child position in the heap
+*
+* @return	TRUE if the two positions are in order, FALSE otherwise
+*
+****************************************************************************/
+static u8 XPlmi_SchedIsHeapOrdered(u32 ParentPos, u32 ChildPos)
+{
+	u8 ReturnVal = (u8)TRUE;
+
+	if (XPlmi_IsTickLater(Sched.TaskList[Sched.Heap[ParentPos]].TriggerTime,
+		Sched.TaskList[Sched.Heap[ChildPos]].TriggerTime) == (u8)TRUE) {
+		ReturnVal = (u8)FALSE;
 	}
 
-END:
 	return ReturnVal;
 }
 
 /******************************************************************************/
 /**
-* @brief	The function checks the specified task is periodic or not, returns
-* 			corresponding periodicity status.
+* @brief	The function swaps two positions of the heap and updates the heap
+* 			index of the tasks in them.
 *
-* @param    SchedPtr is the Scheduler pointer
-* @param    TaskListIndex is the Task index
+* @param	Pos1 is the first position in the heap
+* @param	Pos2 is the second position in the heap
+*
+****************************************************************************/
+static void XPlmi_SchedHeapSwap(u32 Pos1, u32 Pos2)
+{
+	u8 Idx = Sched.Heap[Pos1];
+
+	Sched.Heap[Pos1] = Sched.Heap[Pos2];
+	Sched.Heap[Pos2] = Idx;
+	Sched.TaskList[Sched.Heap[Pos1]].HeapIdx = (u8)Pos1;
+	Sched.TaskList[Sched.Heap[Pos2]].HeapIdx = (u8)Pos2;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function moves a task up the heap until its parent is not
+* 			triggered later than it.
 *
-* @return	TRUE or FALSE based on the task peridocity status
+* @param	HeapPos is the position of the task in the heap
 *
 ****************************************************************************/
-static u8 XPlmi_IsTaskNonPeriodic(const XPlmi_Scheduler_t *SchedPtr,
-	u32 TaskListIndex)
+static void XPlmi_SchedHeapSiftUp(u32 HeapPos)
 {
-	u8 ReturnVal = (u8)FALSE;
+	u32 Pos = HeapPos;
+	u32 ParentPos;
 
-	if (SchedPtr->TaskList[TaskListIndex].Type == XPLMI_NON_PERIODIC_TASK) {
-		ReturnVal = (u8)TRUE;
+	while (Pos > 0U) {
+		ParentPos = (Pos - 1U) / 2U;
+		if (XPlmi_SchedIsHeapOrdered(ParentPos, Pos) == (u8)TRUE) {
+			break;
+		}
+		XPlmi_SchedHeapSwap(ParentPos, Pos);
+		Pos = ParentPos;
 	}
+}
 
-	return ReturnVal;
+/******************************************************************************/
+/**
+* @brief	The function moves a task down the heap until none of its children
+* 			is triggered earlier than it.
+*
+* @param	HeapPos is the position of the task in the heap
+*
+****************************************************************************/
+static void XPlmi_SchedHeapSiftDown(u32 HeapPos)
+{
+	u32 Pos = HeapPos;
+	u32 ChildPos;
+
+	while (((2U * Pos) + 1U) < Sched.TaskCount) {
+		ChildPos = (2U * Pos) + 1U;
+		if (((ChildPos + 1U) < Sched.TaskCount) &&
+			(XPlmi_SchedIsHeapOrdered(ChildPos, ChildPos + 1U) ==
+			(u8)FALSE)) {
+			ChildPos++;
+		}
+		if (XPlmi_SchedIsHeapOrdered(Pos, ChildPos) == (u8)TRUE) {
+			break;
+		}
+		XPlmi_SchedHeapSwap(Pos, ChildPos);
+		Pos = ChildPos;
+	}
+}
+
+/******************************************************************************/
+/**
+* @brief	The function inserts a task into the heap as per its trigger tick.
+* 			Must be called with interrupts disabled.
+*
+* @param	TaskListIndex is the index of the task in the task list
+*
+****************************************************************************/
+static void XPlmi_SchedHeapInsert(u32 TaskListIndex)
+{
+	Sched.Heap[Sched.TaskCount] = (u8)TaskListIndex;
+	Sched.TaskList[TaskListIndex].HeapIdx = (u8)Sched.TaskCount;
+	Sched.TaskCount++;
+	XPlmi_SchedHeapSiftUp(Sched.TaskCount - 1U);
+}
+
+/******************************************************************************/
+/**
+* @brief	The function deletes the task at a position of the heap. Must be
+* 			called with interrupts disabled.
+*
+* @param	HeapPos is the position of the task in the heap
+*
+****************************************************************************/
+static void XPlmi_SchedHeapDelete(u32 HeapPos)
+{
+	Sched.TaskCount--;
+	if (HeapPos != Sched.TaskCount) {
+		XPlmi_SchedHeapSwap(HeapPos, Sched.TaskCount);
+		XPlmi_SchedHeapSiftUp(HeapPos);
+		XPlmi_SchedHeapSiftDown(Sched.TaskList[Sched.Heap[HeapPos]].HeapIdx);
+	}
 }
 
 /******************************************************************************/
@@ -167,13 +267,16 @@ void XPlmi_SchedulerInit(void)
 
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick = 0U;
+	Sched.TaskCount = 0U;
 }
 
 /******************************************************************************/
 /**
 * @brief	The function is scheduler handler and it is called at regular
 * 			intervals based on configured interval. Scheduler handler checks
-* 			and adds the user periodic task to PLM task queue.
+* 			and adds the user periodic task to PLM task queue. Only the tasks
+* 			at the top of the trigger heap are looked at, so a tick with no
+* 			task due costs a single comparison.
 *
 * @param	Data - Not used currently. Added as a part of generic interrupt
 * 			handler
@@ -188,46 +291,57 @@ void XPlmi_SchedulerHandler(void *Data)
 	Sched.LastTimerTick = XPlmi_GetTimerValue();
 	Sched.Tick++;
 	XPlmi_UtilRMW(PMC_PMC_MB_IO_IRQ_ACK, PMC_PMC_MB_IO_IRQ_ACK, 0x20U);
-	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+	/**
+	 * - Trigger the tasks at the top of the heap until one is not yet due
+	 */
+	while (Sched.TaskCount > 0U) {
+		Idx = Sched.Heap[0U];
+		if (XPlmi_IsTickLater(Sched.TaskList[Idx].TriggerTime,
+			Sched.Tick) == (u8)TRUE) {
+			break;
+		}
+		Task = Sched.TaskList[Idx].Task;
+		Sched.TaskList[Idx].Stats.TriggerCount++;
 		/**
-		 * - Check if the task is active and has a valid Callback
+		 * - Skip the task, if its already present in the queue
 		 */
-		if (XPlmi_IsTaskActive(&Sched, Idx) == (u8)TRUE) {
-			Task = Sched.TaskList[Idx].Task;
+		if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
+			Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
+			XPlmi_TaskTriggerNow(Task);
+		} else {
+			Sched.TaskList[Idx].Stats.MissCount++;
 			/**
-			 * - Skip the task, if its already present in the queue
+			 * - Check if a module has registered ErrorFunc for the task and
+			 * the previously scheduled task is executed or not
 			 */
-			if (metal_list_is_empty(&Task->TaskNode) == (int)TRUE) {
-				Task->State &= (u8)(~XPLMI_SCHED_TASK_MISSED);
-				XPlmi_TaskTriggerNow(Task);
-			} else {
+			if ((Sched.TaskList[Idx].ErrorFunc != NULL) &&
+				((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
+						(u8)0x0U)) {
 				/**
-				 * - Check if a module has registered ErrorFunc for the task and
-				 * the previously scheduled task is executed or not
+				 * - Update scheduler task state with task missed flag
 				 */
-				if ((Sched.TaskList[Idx].ErrorFunc != NULL) &&
-					((Task->State & (u8)(XPLMI_SCHED_TASK_MISSED)) ==
-							(u8)0x0U)) {
-					/**
-					 * - Update scheduler task state with task missed flag
-					 */
-					Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
-					/**
-					 * - Call the task specific ErrorFunc if
-					 *   previously scheduled task is not executed
-					 */
-					Sched.TaskList[Idx].ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
-				}
-			}
-			/**
-			 * - Remove the task from scheduler if it is non-periodic
-			 */
-			if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
-				Sched.TaskList[Idx].OwnerId = 0U;
-				Sched.TaskList[Idx].CustomerFunc = NULL;
-				Sched.TaskList[Idx].ErrorFunc = NULL;
+				Task->State |= (u8)XPLMI_SCHED_TASK_MISSED;
+				/**
+				 * - Call the task specific ErrorFunc if
+				 *   previously scheduled task is not executed
+				 */
+				Sched.TaskList[Idx].ErrorFunc(XPLMI_ERR_SCHED_TASK_MISSED);
 			}
 		}
+		/**
+		 * - Remove the task from scheduler if it is non-periodic,
+		 *   otherwise move it down the heap to its next trigger tick
+		 */
+		if (Sched.TaskList[Idx].Type == XPLMI_NON_PERIODIC_TASK) {
+			XPlmi_SchedHeapDelete(0U);
+			Sched.TaskList[Idx].HeapIdx = XPLMI_SCHED_NOT_IN_HEAP;
+			Sched.TaskList[Idx].OwnerId = 0U;
+			Sched.TaskList[Idx].CustomerFunc = NULL;
+			Sched.TaskList[Idx].ErrorFunc = NULL;
+		} else {
+			Sched.TaskList[Idx].TriggerTime += Sched.TaskList[Idx].Interval;
+			XPlmi_SchedHeapSiftDown(0U);
+		}
 	}
 	XPlmi_WdtHandler();
 
@@ -265,7 +379,7 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	int Status = XST_FAILURE;
 	XPlmi_PerfTime ExtraTime;
 	u32 Idx;
-	u32 TriggerTime = 0U;
+	u32 Interval = MilliSeconds / XPLMI_SCHED_TICK;
 	XPlmi_TaskNode *Task = NULL;
 	u8 TaskNodePresent = (u8)FALSE;
 
@@ -295,46 +409,69 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	 */
 	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
 		if (NULL == Sched.TaskList[Idx].CustomerFunc) {
-			/**
-			 * - Add Interval as a factor of TICK_MILLISECONDS
-			 */
-			Sched.TaskList[Idx].Interval = MilliSeconds / XPLMI_SCHED_TICK;
-			Sched.TaskList[Idx].OwnerId = OwnerId;
-			Sched.TaskList[Idx].CustomerFunc = CallbackFn;
-			Sched.TaskList[Idx].ErrorFunc = ErrorFunc;
-			Sched.TaskList[Idx].Type = TaskType;
-			Sched.TaskList[Idx].Data = Data;
-			/**
-			 * - Create a new task if task instance not found
-			 */
-			if (TaskNodePresent == (u8)FALSE) {
-				Task = XPlmi_TaskCreate(Priority, CallbackFn, Data);
-			}
-
-			if (Task == NULL) {
-				Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
-				XPlmi_Printf(DEBUG_INFO, "Task Creation "
-						"Err:0x%x\n\r", Status);
-				goto END;
-			}
-			Task->IntrId = XPLMI_INVALID_INTR_ID;
-			Sched.TaskList[Idx].Task = Task;
-			if (TaskType != XPLMI_PERIODIC_TASK) {
-				microblaze_disable_interrupts();
-				XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
-				if (Sched.Tick == 0U) {
-					ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
-				}
-				TriggerTime = Sched.Tick +
-					   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
-					   XPLMI_SCHED_TICK);
-				microblaze_enable_interrupts();
-			}
-			Sched.TaskList[Idx].TriggerTime = TriggerTime;
-			Status = XST_SUCCESS;
 			break;
 		}
 	}
+	if (Idx == XPLMI_SCHED_MAX_TASK) {
+		goto END;
+	}
+
+	/**
+	 * - Create a new task if task instance not found
+	 */
+	if (TaskNodePresent == (u8)FALSE) {
+		Task = XPlmi_TaskCreate(Priority, CallbackFn, Data);
+	}
+	if (Task == NULL) {
+		Status = XPlmi_UpdateStatus(XPLM_ERR_TASK_CREATE, 0);
+		XPlmi_Printf(DEBUG_INFO, "Task Creation "
+				"Err:0x%x\n\r", Status);
+		goto END;
+	}
+	Task->IntrId = XPLMI_INVALID_INTR_ID;
+	Task->SchedIdx = (u8)Idx;
+
+	/**
+	 * - Add Interval as a factor of TICK_MILLISECONDS
+	 */
+	Sched.TaskList[Idx].Interval = Interval;
+	Sched.TaskList[Idx].OwnerId = OwnerId;
+	Sched.TaskList[Idx].ErrorFunc = ErrorFunc;
+	Sched.TaskList[Idx].Type = TaskType;
+	Sched.TaskList[Idx].Data = Data;
+	Sched.TaskList[Idx].Task = Task;
+	Sched.TaskList[Idx].Stats.TriggerCount = 0U;
+	Sched.TaskList[Idx].Stats.MissCount = 0U;
+	Sched.TaskList[Idx].Stats.RunCount = 0U;
+	Sched.TaskList[Idx].Stats.MaxRunTime = 0U;
+	Sched.TaskList[Idx].Stats.RunTime = 0U;
+	Sched.TaskList[Idx].HeapIdx = XPLMI_SCHED_NOT_IN_HEAP;
+
+	microblaze_disable_interrupts();
+	if (TaskType != XPLMI_PERIODIC_TASK) {
+		XPlmi_MeasurePerfTime(Sched.LastTimerTick, &ExtraTime);
+		if (Sched.Tick == 0U) {
+			ExtraTime.TPerfMs %= XPLMI_SCHED_TICK;
+		}
+		Sched.TaskList[Idx].TriggerTime = Sched.Tick +
+			   (((u32)ExtraTime.TPerfMs + MilliSeconds) /
+			   XPLMI_SCHED_TICK);
+		XPlmi_SchedHeapInsert(Idx);
+	} else if (Interval != 0U) {
+		/**
+		 * - Periodic tasks are triggered on the ticks which are
+		 *   multiples of their interval, those shorter than a tick
+		 *   are never triggered
+		 */
+		Sched.TaskList[Idx].TriggerTime =
+			((Sched.Tick / Interval) + 1U) * Interval;
+		XPlmi_SchedHeapInsert(Idx);
+	} else {
+		/* For MISRA-C compliance */
+	}
+	Sched.TaskList[Idx].CustomerFunc = CallbackFn;
+	Status = XST_SUCCESS;
+	microblaze_enable_interrupts();
 
 END:
 	return Status;
@@ -371,11 +508,14 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 			((Sched.TaskList[Idx].Interval ==
 				(MilliSeconds / XPLMI_SCHED_TICK)) ||
 				(0U == MilliSeconds))) {
+			microblaze_disable_interrupts();
+			if (Sched.TaskList[Idx].HeapIdx != XPLMI_SCHED_NOT_IN_HEAP) {
+				XPlmi_SchedHeapDelete(Sched.TaskList[Idx].HeapIdx);
+			}
 			Sched.TaskList[Idx].Interval = 0U;
 			Sched.TaskList[Idx].OwnerId = 0U;
 			Sched.TaskList[Idx].CustomerFunc = NULL;
 			Sched.TaskList[Idx].Data = NULL;
-			microblaze_disable_interrupts();
 			if (metal_list_is_empty(&Sched.TaskList[Idx].Task->TaskNode) ==
 				(int)FALSE) {
 				metal_list_del(&Sched.TaskList[Idx].Task->TaskNode);
@@ -393,3 +533,75 @@ int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 
 	return Status;
 }
+
+/******************************************************************************/
+/**
+* @brief	The function returns the statistics of a registered scheduler
+* 			task.
+*
+* @param	OwnerId Id of the owner given while adding the task.
+* @param	CallbackFn callback function that is given while adding.
+* @param	Data is the pointer to the private data of the task
+* @param	Stats is the pointer to which the statistics are copied
+*
+* @return
+* 			- XST_SUCCESS on success and error code on failure
+*
+****************************************************************************/
+int XPlmi_SchedulerGetTaskStats(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+		const void *Data, XPlmi_SchedTaskStats *Stats)
+{
+	int Status = XST_FAILURE;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < XPLMI_SCHED_MAX_TASK; Idx++) {
+		if ((CallbackFn == Sched.TaskList[Idx].CustomerFunc) &&
+			(Sched.TaskList[Idx].OwnerId == OwnerId) &&
+			(Sched.TaskList[Idx].Data == Data)) {
+			microblaze_disable_interrupts();
+			*Stats = Sched.TaskList[Idx].Stats;
+			microblaze_enable_interrupts();
+			Status = XST_SUCCESS;
+			break;
+		}
+	}
+
+	return Status;
+}
+
+/******************************************************************************/
+/**
+* @brief	The function accounts the run time of a scheduler task handler. It
+* 			is called by the task dispatcher after the handler returns.
+*
+* @param	Task is the task node that was run
+* @param	StartTime is the timer value when the handler was called
+*
+****************************************************************************/
+void XPlmi_SchedulerUpdateRunTime(const XPlmi_TaskNode *Task, u64 StartTime)
+{
+	struct XPlmi_Task_t *SchedTask;
+	u64 RunTime;
+
+	if (Task->SchedIdx >= XPLMI_SCHED_MAX_TASK) {
+		goto END;
+	}
+	SchedTask = &Sched.TaskList[Task->SchedIdx];
+	/**
+	 * - Non-periodic tasks leave the scheduler when triggered, skip them
+	 */
+	if ((SchedTask->Task != Task) || (SchedTask->CustomerFunc == NULL)) {
+		goto END;
+	}
+
+	/* The timer counts down */
+	RunTime = StartTime - XPlmi_GetTimerValue();
+	SchedTask->Stats.RunCount++;
+	SchedTask->Stats.RunTime += RunTime;
+	if (RunTime > (u64)SchedTask->Stats.MaxRunTime) {
+		SchedTask->Stats.MaxRunTime = (u32)RunTime;
+	}
+
+END:
+	return;
+}
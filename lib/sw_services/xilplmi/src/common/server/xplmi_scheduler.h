@@ -32,6 +32,8 @@
 *       bsv  08/15/2021 Removed redundant element in structure
 * 1.04  bm   07/06/2022 Refactor versal and versal_net code
 * 1.05  nb   06/28/2023 Move XPLMI_SCHED_TICK here from .c file
+*       sb   10/16/2026 Keep scheduler tasks in a min-heap ordered by trigger
+*                       tick and added per task statistics
 *
 * </pre>
 *
@@ -60,22 +62,34 @@ extern "C" {
 typedef int (*XPlmi_Callback_t)(void *Data);
 typedef void (*XPlmi_ErrorFunc_t)(int Status);
 
+typedef struct {
+	u32 TriggerCount;	/**< Number of times the task was triggered */
+	u32 MissCount;		/**< Number of triggers missed as task was pending */
+	u32 RunCount;		/**< Number of times the task handler was run */
+	u32 MaxRunTime;		/**< Longest run of the task handler in timer cycles */
+	u64 RunTime;		/**< Total run time of the task handler in timer cycles */
+} XPlmi_SchedTaskStats;
+
 struct XPlmi_Task_t{
 	u32 Interval;
 	u32 OwnerId;
-	u32 TriggerTime;
+	u32 TriggerTime;	/**< Tick at which the task is triggered next */
 	XPlmi_Callback_t CustomerFunc;
 	XPlmi_ErrorFunc_t ErrorFunc;
 	XPlmi_TaskNode *Task;
 	const void *Data;
+	XPlmi_SchedTaskStats Stats;
 	u8 Type;
+	u8 HeapIdx;		/**< Position of the task in the trigger heap */
 };
 
 typedef struct {
 	struct XPlmi_Task_t TaskList[XPLMI_SCHED_MAX_TASK];
 	u64 LastTimerTick;
-	u32 TaskCount;
+	u32 TaskCount;		/**< Number of tasks in the trigger heap */
 	u32 Tick;
+	u8 Heap[XPLMI_SCHED_MAX_TASK]; /**< TaskList indexes, min-heap on
+					  TriggerTime */
 } XPlmi_Scheduler_t ;
 
 void XPlmi_SchedulerInit(void);
@@ -85,6 +99,9 @@ int XPlmi_SchedulerAddTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	void *Data,	u8 TaskType);
 int XPlmi_SchedulerRemoveTask(u32 OwnerId, XPlmi_Callback_t CallbackFn,
 	u32 MilliSeconds, const void *Data);
+int XPlmi_SchedulerGetTaskStats(u32 OwnerId, XPlmi_Callback_t CallbackFn,
+	const void *Data, XPlmi_SchedTaskStats *Stats);
+void XPlmi_SchedulerUpdateRunTime(const XPlmi_TaskNode *Task, u64 StartTime);
 
 /**
  * @}
@@ -45,6 +45,7 @@
 * 1.08  ng   11/11/2022 Updated doxygen comments
 * 2.00  ng   12/27/2023 Reduced log level for less frequent prints
 *       ng   01/28/2024 optimized u8 variables
+*       sb   10/16/2026 Account run time of scheduler tasks
 *
 * </pre>
 *
@@ -61,6 +62,7 @@
 #include "xplmi_wdt.h"
 #include "mb_interface.h"
 #include "xplmi_proc.h"
+#include "xplmi_scheduler.h"
 
 /************************** Constant Definitions *****************************/
 
@@ -103,6 +105,7 @@ XPlmi_TaskNode* XPlmi_TaskCreate(TaskPriority_t Priority,
 		goto END;
 	}
 	Task->Priority = Priority;
+	Task->SchedIdx = XPLMI_INVALID_SCHED_IDX;
 	Task->Delay = 0U;
 	metal_list_init(&Task->TaskNode);
 	Task->Handler = Handler;
@@ -199,8 +202,8 @@ void XPlmi_TaskDispatchLoop(void)
 	struct metal_list *Node[XPLMI_TASK_PRIORITIES];
 	XPlmi_TaskNode *Task;
 	u32 Index;
+	u64 TaskStartTime = 0U;
 #ifdef PLM_DEBUG_DETAILED
-	u64 TaskStartTime;
 	XPlmi_PerfTime PerfTime = {0U};
 #endif
 
@@ -247,11 +250,20 @@ void XPlmi_TaskDispatchLoop(void)
 #ifdef PLM_DEBUG_DETAILED
 			/* Call the task handler */
 			TaskStartTime = XPlmi_GetTimerValue();
+#else
+			if (Task->SchedIdx != XPLMI_INVALID_SCHED_IDX) {
+				TaskStartTime = XPlmi_GetTimerValue();
+			}
 #endif
 			Xil_AssertVoid(Task->Handler != NULL);
 			metal_list_del(&Task->TaskNode);
 			microblaze_enable_interrupts();
 			Status = Task->Handler(Task->PrivData);
+			if (Task->SchedIdx != XPLMI_INVALID_SCHED_IDX) {
+				microblaze_disable_interrupts();
+				XPlmi_SchedulerUpdateRunTime(Task, TaskStartTime);
+				microblaze_enable_interrupts();
+			}
 #ifdef PLM_DEBUG_DETAILED
 			XPlmi_MeasurePerfTime(TaskStartTime, &PerfTime);
 			XPlmi_Printf(DEBUG_PRINT_PERF, "%u.%03u ms: Task Time\n\r",
@@ -32,6 +32,7 @@
 * 1.05  bsv  03/05/2022 Fix exception while deleting two consecutive tasks of
 *                       same priority
 * 1.06  bm   01/03/2023 Create Secure Lockdown as a Critical Priority Task
+*       sb   10/16/2026 Added scheduler index to task node for task statistics
 *
 * </pre>
 *
@@ -58,6 +59,7 @@ extern "C" {
 #define XPLMI_TASK_MAX			(72U)
 #define XPLMI_TASK_PRIORITIES		(3U)
 #define XPLMI_INVALID_INTR_ID		(0xFFFFFFFFU)
+#define XPLMI_INVALID_SCHED_IDX		(0xFFU)
 
 
 #define XPLMI_SCHED_TASK_MISSED				(0x1U)
@@ -73,6 +75,7 @@ typedef struct XPlmi_TaskNode XPlmi_TaskNode;
 struct XPlmi_TaskNode {
     u8 Priority;
     u8 State;
+    u8 SchedIdx; /**< Scheduler task index, XPLMI_INVALID_SCHED_IDX if none */
     u32 IntrId;
     u32 Delay;
     struct metal_list TaskNode;
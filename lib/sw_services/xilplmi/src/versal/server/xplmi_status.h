@@ -130,6 +130,8 @@
 *       rama 09/05/2024 Added XPLM_ERR_STL_DIAG_TASK_CREATE, XPLM_ERR_STL_DIAG_TASK_REMOVE
 *                       error codes for STL diagnostic task scheduling
 *       pre  10/07/2024 Removed XPLMI_SSIT_NO_PENDING_EVENTS error code
+*       sb   10/16/2026 Added XPLMI_ERR_IPI_CMD_RING error code
+*       sb   10/16/2026 Added XLOADER_ERR_INVALID_BOOT_PROF_DEST error code
 *
 * </pre>
 *
@@ -367,6 +369,8 @@ typedef enum {
 	XPLMI_IPI_MAX_BUF_SIZE_EXCEEDS, /**< 0x1B3 - Error when IPI request size exceeds */
 	XPLMI_SSIT_SECURE_COMM_KEYWRITE_FAILURE, /**< 0x1B4 - Error if key write fails during
 	                 secure plm to plm communication establishment */
+	XPLMI_ERR_IPI_CMD_RING, /**< 0x1B5 - Error when the IPI command ring is
+				not available to the requester or its indexes are invalid */
 	/** Status codes used in PLM */
 	/* PLM error codes common for all platforms are from 0x200 to 0x29F */
 	XPLM_ERR_TASK_CREATE = 0x200,	/**< 0x200 - Error when task create
@@ -640,6 +644,8 @@ typedef enum {
 	XLOADER_ERR_RSA_NOT_ENABLED, /**< 0x374 - RSA code is excluded */
 	XLOADER_ERR_INVALID_PRTNCOPY_DEST_ADDR,	/**< 0x375 - Invalid Destination address in
 												PrtnCopy API for Raw Partition Loading*/
+	XLOADER_ERR_INVALID_BOOT_PROF_DEST,	/**< 0x376 - Invalid destination address or
+												size for the boot profile */
 
 	/* Xilloader error codes specific to platform are from 0x3A0 to 0x3FF */
 
@@ -51,6 +51,7 @@
 *       ma   09/20/2024 Added PMC_TAP_VERSION_COSIM mask for COSIM platform
 *                       Also, corrected XPLMI_PLATFORM_MASK value
 *       yog  09/30/2024 Corrected ASU RAM high address
+* 1.05  sb   10/16/2026 Added pre-decoded CDO command cache region
 *
 * </pre>
 *
@@ -728,6 +729,7 @@ static inline void XPlmi_OutByte64(u64 Addr, u8 Data)
 /*
  * PMC RAM Memory usage:
  * 0xF2000000U to 0xF201011FU - Used by XilLoader to process CDO
+ * 0xF2011000U to 0xF2013FFFU - Used by XilPlmi to cache pre-decoded CDO commands
  * 0xF2014000U to 0xF2014FFFU - Used for PLM Runtime Configuration Registers
  * 0xF2016000U to 0xF2016BFFU - Used for storing secure lockdown CDO proc data
  * 0xF2019000U to 0xF201CFFFU - Used by XilPlmi to store PLM prints
@@ -767,6 +769,10 @@ static inline void XPlmi_OutByte64(u64 Addr, u8 Data)
 #define XPLMI_PMCRAM_BUFFER_MEMORY			(XPLMI_PMCRAM_BASEADDR + 0x16000U)
 #define XPLMI_PMCRAM_BUFFER_MEMORY_LENGTH		(0xC00U)
 
+/* Pre-decoded CDO command cache address and length */
+#define XPLMI_CDO_CACHE_ADDR		(XPLMI_PMCRAM_BASEADDR + 0x11000U)
+#define XPLMI_CDO_CACHE_LEN		(0x3000U)	/* 12KB */
+
 /*
  * Definitions required from Efuse
  */
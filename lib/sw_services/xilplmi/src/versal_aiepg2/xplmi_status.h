@@ -54,6 +54,8 @@
 *       mss  03/13/2024 MISRA-C violatiom Rule 17.8 fixed
 * 2.1   mb   06/21/2024 Added error code for AES initialization fail
 *       pre  07/14/2024 Added error code for exceeding IPI buffer size
+*       sb   10/16/2026 Added XPLMI_ERR_IPI_CMD_RING error code
+*       sb   10/16/2026 Added XLOADER_ERR_INVALID_BOOT_PROF_DEST error code
 *
 * </pre>
 *
@@ -302,6 +304,8 @@ typedef enum {
 						retry later */
 	XPLMI_ERR_STORE_DATA_BACKUP,	/**< 0x1BC - Error when data structure storing fails */
 	XPLMI_IPI_MAX_BUF_SIZE_EXCEEDS, /**< 0x1BD - Error when IPI request size exceeds */
+	XPLMI_ERR_IPI_CMD_RING, /**< 0x1BE - Error when the IPI command ring is
+				not available to the requester or its indexes are invalid */
 
 	/** Status codes used in PLM */
 	/* PLM error codes common for all platforms are from 0x200 to 0x29F */
@@ -578,6 +582,8 @@ typedef enum {
 	XLOADER_ERR_RSA_NOT_ENABLED, /**< 0x374 - RSA code is excluded */
 	XLOADER_ERR_INVALID_PRTNCOPY_DEST_ADDR,	/**< 0x375 - Invalid Destination address in
 												PrtnCopy API for Raw Partition Loading*/
+	XLOADER_ERR_INVALID_BOOT_PROF_DEST,	/**< 0x376 - Invalid destination address or
+												size for the boot profile */
 
 	/* Xilloader error codes specific to platform are from 0x3A0 to 0x3FF */
 	XLOADER_ERR_WAKEUP_A78_0 = 0x3A0,	/**< 0x3A0 - Error waking up the A78-0 during handoff. */
@@ -194,6 +194,46 @@ extern "C" {
 /* Enable the below define to enable CFI selective read */
 //#define PLM_ENABLE_CFI_SELECTIVE_READ
 
+/**
+ * Enable the below define to cache the decoded commands of authenticated
+ * CDO partitions and dispatch them directly when the partition is loaded again
+ */
+//#define PLM_CDO_CACHE
+
+/**
+ * Enable the below defines to let IPI clients post batches of commands in
+ * rings kept in the region reserved at XPAR_PLM_IPI_CMD_RING_BASEADDR.
+ * PLM_IPI_CMD_RING_PROTECTED confirms that XMPU/XPPU let only the master of
+ * each IPI buffer index access its ring, the rings cannot be used without it.
+ */
+//#define PLM_IPI_CMD_RING
+//#define PLM_IPI_CMD_RING_PROTECTED
+
+/**
+ * Enable the below define to store PLM prints in the debug log buffer as
+ * binary records, which are decoded on the host with xplmi_log_decode
+ */
+//#define PLM_BINARY_LOG
+
+/**
+ * Enable the below define to record the device read, authentication,
+ * decryption, CDO processing and handoff times of every partition loaded
+ */
+//#define PLM_BOOT_PROFILE
+
+/**
+ * Enable the below define to read ahead the flash data following a
+ * sequential OSPI read while the loader processes the data read
+ */
+//#define PLM_OSPI_PREFETCH
+
+/**
+ * Enable the below define to restore the OSPI DLL taps tuned by an earlier
+ * OSPI init on the same flash, the taps are tuned again if the flash ID
+ * does not read back with them
+ */
+//#define PLM_OSPI_DLL_CACHE
+
 /************************** Function Prototypes ******************************/
 
 /************************** Variable Definitions *****************************/
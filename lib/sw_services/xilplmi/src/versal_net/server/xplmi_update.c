@@ -42,6 +42,7 @@
 *       bm   02/23/2024 Ack In-Place PLM Update request after complete restore
 *       am   04/10/2024 Fixed doxygen warnings
 *       sk   05/07/2024 Added support for In Place Update Error Notify
+* 2.1   sb   10/16/2026 Reject In-Place PLM Update from the IPI command ring
 *
 * </pre>
 *
@@ -603,6 +604,7 @@ static inline u32 XPlmi_GetPlmDbSize(void)
  * 			- XPLMI_ERR_INPLACE_UPDATE_TASK_NOT_FOUND if PLM Update task is not found.
  * 			- XPLMI_ERR_INPLACE_UPDATE_INVALID_PAYLOAD_LEN if Invalid Payload Len.
  * 			- XPLMI_ERR_INPLACE_UPDATE_FROM_IMAGE_STORE error during update from IS.
+ * 			- XPLMI_ERR_IPI_CMD_RING if the command is from an IPI command ring.
  *
  *
  *****************************************************************************/
@@ -629,6 +631,15 @@ int XPlmi_PlmUpdate(XPlmi_Cmd *Cmd)
 		goto END;
 	}
 
+	/*
+	 * The update is acknowledged after the restore, which cannot be done
+	 * for a command of the IPI command ring
+	 */
+	if (Cmd->IsCmdRing == (u8)TRUE) {
+		Status = XPlmi_UpdateStatus(XPLMI_ERR_IPI_CMD_RING, 0);
+		goto END;
+	}
+
 	if (XPlmi_IsPlmUpdateInProgress() == (u8)TRUE) {
 		XPlmi_Printf(DEBUG_GENERAL, "Update in Progress\n\r");
 		Status = XPLMI_ERR_INPLACE_UPDATE_IN_PROGRESS;
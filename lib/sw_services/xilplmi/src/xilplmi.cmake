@@ -153,6 +153,42 @@ if (XILPLMI_cfi_selective_read_en)
   set(PLM_ENABLE_CFI_SELECTIVE_READ " ")
 endif()
 
+option(XILPLMI_plm_cdo_cache_en "Enables or disables the pre-decoded CDO command cache for authenticated partitions" OFF)
+if (XILPLMI_plm_cdo_cache_en)
+  set(PLM_CDO_CACHE " ")
+endif()
+
+option(XILPLMI_plm_binary_log_en "Enables or disables binary records for PLM prints in the debug log buffer" OFF)
+if (XILPLMI_plm_binary_log_en)
+  set(PLM_BINARY_LOG " ")
+endif()
+
+option(XILPLMI_plm_boot_profile_en "Enables or disables the per partition boot time profile" OFF)
+if (XILPLMI_plm_boot_profile_en)
+  set(PLM_BOOT_PROFILE " ")
+endif()
+
+option(XILPLMI_plm_ospi_prefetch_en "Enables or disables the read ahead of sequential OSPI flash reads" OFF)
+if (XILPLMI_plm_ospi_prefetch_en)
+  set(PLM_OSPI_PREFETCH " ")
+endif()
+
+option(XILPLMI_plm_ospi_dll_cache_en "Enables or disables the reuse of the OSPI DLL taps tuned by an earlier OSPI init" OFF)
+if (XILPLMI_plm_ospi_dll_cache_en)
+  set(PLM_OSPI_DLL_CACHE " ")
+endif()
+
+set(XILPLMI_ipi_cmd_ring_baseaddr "0x0" CACHE STRING "Base address of the region reserved for IPI command rings, 0x0 disables them.")
+set(XILPLMI_IPI_CMD_RING_BASEADDR "${XILPLMI_ipi_cmd_ring_baseaddr}")
+option(XILPLMI_ipi_cmd_ring_protected "Confirms that XMPU/XPPU let only the master of each IPI buffer index access its 4KB command ring" OFF)
+if (NOT ((XILPLMI_ipi_cmd_ring_baseaddr STREQUAL "0x0") OR (XILPLMI_ipi_cmd_ring_baseaddr STREQUAL "0")))
+  if (NOT XILPLMI_ipi_cmd_ring_protected)
+    message(FATAL_ERROR "XILPLMI_ipi_cmd_ring_baseaddr requires XILPLMI_ipi_cmd_ring_protected, the command ring of each IPI buffer index must be accessible to its master only")
+  endif()
+  set(PLM_IPI_CMD_RING " ")
+  set(PLM_IPI_CMD_RING_PROTECTED " ")
+endif()
+
 set(XILPLMI_user_modules_count "0" CACHE STRING "Number of User Modules.")
 set(XILPLMI_USER_MODULES_COUNT "${XILPLMI_user_modules_count}")
 
@@ -551,6 +551,14 @@ static int XPm_ProcessCmd(XPlmi_Cmd * Cmd)
 					   Pload[3], Cmd->IpiReqType);
 		break;
 	case PM_API(PM_FORCE_POWERDOWN):
+		/**
+		 *  The ack of the force power down command is sent by xilpm,
+		 *  which is not possible for a command of the IPI command ring.
+		 */
+		if ((u8)TRUE == Cmd->IsCmdRing) {
+			Status = XPM_NO_FEATURE;
+			break;
+		}
 		Status = XPm_ForcePowerdown(SubsystemId, Pload[0], Pload[1],
 					    Cmd->IpiReqType, Cmd->IpiMask);
 		/**
@@ -35,6 +35,7 @@
 #       kpt  06/13/24 Added xsecure_key_slot_addr
 #       kal  07/24/24 Code refactoring for versal_aiepg2 plaform
 #       kal  09/25/24 Remove deleting folders which are set in secure_drc
+# 5.5   sb   10/16/26 Added softsha_ce_support parameter
 #
 ##############################################################################
 
@@ -408,6 +409,17 @@ proc xgen_opts_file {libhandle} {
 
 		close $file_handle
         }
+	# Get softsha_ce_support value set by user, by default it is FALSE
+	set value [common::get_property CONFIG.softsha_ce_support $libhandle]
+	if {$value == true} {
+		#Open xparameters.h file
+		set file_handle [hsi::utils::open_include_file "xparameters.h"]
+
+		puts $file_handle "\n/* Software SHA AArch64 kernel support */"
+		puts $file_handle "#define XSECURE_SOFTSHA_CE_SUPPORT\n"
+
+		close $file_handle
+	}
 	# Get cache_disable value set by user, by default it is FALSE
 	set value [common::get_property CONFIG.cache_disable $libhandle]
 	if {$value == true} {
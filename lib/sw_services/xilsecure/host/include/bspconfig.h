@@ -0,0 +1,27 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file bspconfig.h
+*
+* Host replacement of the generated BSP configuration. The software SHA
+* needs no BSP options.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef BSPCONFIG_H
+#define BSPCONFIG_H
+
+#endif /* BSPCONFIG_H */
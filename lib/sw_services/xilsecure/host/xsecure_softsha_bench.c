@@ -0,0 +1,465 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_softsha_bench.c
+*
+* This file contains the known answer tests and the benchmark of the
+* software SHA (xsecure_softsha.c). Every kernel built in is checked:
+* - against the FIPS 180-4 and FIPS 202 examples and the million 'a'
+*   message
+* - for the same digest with the data split into updates of all sizes
+* - through the XSecure_Sha384* API of the server (xsecure_sha384.c), for
+*   SHA2-384
+* Then the throughput and the time per message are measured for a range
+* of message sizes.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*       sb   10/16/26 Check the XSecure_Sha384* API
+*
+* </pre>
+*
+******************************************************************************/
+
+/***************************** Include Files *********************************/
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "xil_types.h"
+#include "xstatus.h"
+#include "xsecure_softsha.h"
+#include "xsecure_sha384.h"
+
+/************************** Constant Definitions *****************************/
+#define BENCH_MODES		(5U)	/**< Modes of the software SHA */
+#define BENCH_KATS		(5U)	/**< Known answers per mode */
+#define BENCH_SPLIT_MAX_LEN	(300U)	/**< Longest message of the split test */
+#define BENCH_MILLION		(1000000U)	/**< Length of the million 'a' KAT */
+
+/**************************** Type Definitions *******************************/
+/** Known answers of one mode */
+typedef struct {
+	XSecure_SoftShaMode Mode;	/**< Mode */
+	const char *Name;		/**< Name of the mode */
+	const char *Digest[BENCH_KATS];	/**< Digest of each KAT message */
+} Bench_KatSet;
+
+/************************** Variable Definitions *****************************/
+/** KAT messages, the last one is BENCH_MILLION times 'a' */
+static const char *KatMsg[BENCH_KATS - 1U] = {
+	"",
+	"abc",
+	"abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+	"abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmnhijklmno"
+	"ijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+};
+
+static const Bench_KatSet Kat[BENCH_MODES] = {
+	{ XSECURE_SOFTSHA_SHA2_384, "SHA2-384", {
+		"38b060a751ac96384cd9327eb1b1e36a21fdb71114be07434c0cc7bf63f6e1da"
+		"274edebfe76f65fbd51ad2f14898b95b",
+		"cb00753f45a35e8bb5a03d699ac65007272c32ab0eded1631a8b605a43ff5bed"
+		"8086072ba1e7cc2358baeca134c825a7",
+		"3391fdddfc8dc7393707a65b1b4709397cf8b1d162af05abfe8f450de5f36bc6"
+		"b0455a8520bc4e6f5fe95b1fe3c8452b",
+		"09330c33f71147e83d192fc782cd1b4753111b173b3b05d22fa08086e3b0f712"
+		"fcc7c71a557e2db966c3e9fa91746039",
+		"9d0e1809716474cb086e834e310a4a1ced149e9c00f248527972cec5704c2a5b"
+		"07b8b3dc38ecc4ebae97ddd87f3d8985",
+	} },
+	{ XSECURE_SOFTSHA_SHA2_512, "SHA2-512", {
+		"cf83e1357eefb8bdf1542850d66d8007d620e4050b5715dc83f4a921d36ce9ce"
+		"47d0d13c5d85f2b0ff8318d2877eec2f63b931bd47417a81a538327af927da3e",
+		"ddaf35a193617abacc417349ae20413112e6fa4e89a97ea20a9eeee64b55d39a"
+		"2192992a274fc1a836ba3c23a3feebbd454d4423643ce80e2a9ac94fa54ca49f",
+		"204a8fc6dda82f0a0ced7beb8e08a41657c16ef468b228a8279be331a703c335"
+		"96fd15c13b1b07f9aa1d3bea57789ca031ad85c7a71dd70354ec631238ca3445",
+		"8e959b75dae313da8cf4f72814fc143f8f7779c6eb9f7fa17299aeadb6889018"
+		"501d289e4900f7e4331b99dec4b5433ac7d329eeb6dd26545e96e55b874be909",
+		"e718483d0ce769644e2e42c7bc15b4638e1f98b13b2044285632a803afa973eb"
+		"de0ff244877ea60a4cb0432ce577c31beb009c5c2c49aa2e4eadb217ad8cc09b",
+	} },
+	{ XSECURE_SOFTSHA_SHA3_256, "SHA3-256", {
+		"a7ffc6f8bf1ed76651c14756a061d662f580ff4de43b49fa82d80a4b80f8434a",
+		"3a985da74fe225b2045c172d6bd390bd855f086e3e9d525b46bfe24511431532",
+		"41c0dba2a9d6240849100376a8235e2c82e1b9998a999e21db32dd97496d3376",
+		"916f6061fe879741ca6469b43971dfdb28b1a32dc36cb3254e812be27aad1d18",
+		"5c8875ae474a3634ba4fd55ec85bffd661f32aca75c6d699d0cdcb6c115891c1",
+	} },
+	{ XSECURE_SOFTSHA_SHA3_384, "SHA3-384", {
+		"0c63a75b845e4f7d01107d852e4c2485c51a50aaaa94fc61995e71bbee983a2a"
+		"c3713831264adb47fb6bd1e058d5f004",
+		"ec01498288516fc926459f58e2c6ad8df9b473cb0fc08c2596da7cf0e49be4b2"
+		"98d88cea927ac7f539f1edf228376d25",
+		"991c665755eb3a4b6bbdfb75c78a492e8c56a22c5c4d7e429bfdbc32b9d4ad5a"
+		"a04a1f076e62fea19eef51acd0657c22",
+		"79407d3b5916b59c3e30b09822974791c313fb9ecc849e406f23592d04f625dc"
+		"8c709b98b43b3852b337216179aa7fc7",
+		"eee9e24d78c1855337983451df97c8ad9eedf256c6334f8e948d252d5e0e7684"
+		"7aa0774ddb90a842190d2c558b4b8340",
+	} },
+	{ XSECURE_SOFTSHA_SHA3_512, "SHA3-512", {
+		"a69f73cca23a9ac5c8b567dc185a756e97c982164fe25859e0d1dcc1475c80a6"
+		"15b2123af1f5f94c11e3e9402c3ac558f500199d95b6d3e301758586281dcd26",
+		"b751850b1a57168a5693cd924b6b096e08f621827444f70d884f5d0240d2712e"
+		"10e116e9192af3c91a7ec57647e3934057340b4cf408d5a56592f8274eec53f0",
+		"04a371e84ecfb5b8b77cb48610fca8182dd457ce6f326a0fd3d7ec2f1e91636d"
+		"ee691fbe0c985302ba1b0d8dc78c086346b533b49c030d99a27daf1139d6e75e",
+		"afebb2ef542e6579c50cad06d2e578f9f8dd6881d7dc824d26360feebf18a4fa"
+		"73e3261122948efcfd492e74e82e2189ed0fb440d187f382270cb455f21dd185",
+		"3c3a876da14034ab60627c077bb98f7e120a2a5370212dffb3385a18d4f38859"
+		"ed311d0a9d5141ce9cc5c66ee689b266a8aa18ace8282a0e0db596c90b0a7b87",
+	} },
+};
+
+/** Message sizes of the benchmark */
+static const u32 BenchSize[] = { 64U, 256U, 1024U, 4096U, 65536U };
+
+static const char *KernelName[] = { "auto", "scalar", "ce" };
+
+/*****************************************************************************/
+/**
+ * @brief	This function prints the usage of the program.
+ *
+ * @param	Name is the name of the program
+ *
+ *****************************************************************************/
+static void Bench_Usage(const char *Name)
+{
+	printf("Usage: %s [options]\n\n", Name);
+	printf("Options:\n");
+	printf("\t-k\t\tOnly run the known answer tests\n");
+	printf("\t-t <ms>\t\tTime per benchmark point, 200 by default\n");
+	printf("\t-h\t\tHelp\n");
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the time in nanoseconds.
+ *
+ * @return
+ * 		- Monotonic time in nanoseconds
+ *
+ *****************************************************************************/
+static u64 Bench_TimeNs(void)
+{
+	struct timespec Ts;
+
+	(void)clock_gettime(CLOCK_MONOTONIC, &Ts);
+	return ((u64)Ts.tv_sec * 1000000000U) + (u64)Ts.tv_nsec;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function compares a digest with its hex string.
+ *
+ * @param	Hash is the digest
+ * @param	Len is the length of the digest in bytes
+ * @param	Hex is the expected digest in hex
+ *
+ * @return
+ * 		- XST_SUCCESS if they match
+ * 		- XST_FAILURE otherwise
+ *
+ *****************************************************************************/
+static int Bench_CmpHex(const u8 *Hash, u32 Len, const char *Hex)
+{
+	int Status = XST_FAILURE;
+	char Str[(XSECURE_SOFTSHA_MAX_DIGEST_SIZE * 2U) + 1U];
+	u32 Index;
+
+	for (Index = 0U; Index < Len; Index++) {
+		(void)snprintf(&Str[Index * 2U], 3U, "%02x", Hash[Index]);
+	}
+	Str[Len * 2U] = '\0';
+	if (strcmp(Str, Hex) == 0) {
+		Status = XST_SUCCESS;
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function runs the known answer tests of one mode with the
+ *		selected kernel.
+ *
+ * @param	KatPtr is the known answers of the mode
+ * @param	DigestSize is updated with the digest size of the mode
+ *
+ * @return
+ * 		- Number of failed tests
+ *
+ *****************************************************************************/
+static u32 Bench_RunKat(const Bench_KatSet *KatPtr, u32 *DigestSize)
+{
+	XSecure_SoftShaCtx Ctx;
+	u8 Hash[XSECURE_SOFTSHA_MAX_DIGEST_SIZE];
+	u8 Block[1000U];
+	u32 Fails = 0U;
+	u32 Index;
+
+	(void)XSecure_SoftShaStart(&Ctx, KatPtr->Mode);
+	*DigestSize = Ctx.DigestSize;
+
+	for (Index = 0U; Index < (BENCH_KATS - 1U); Index++) {
+		if ((XSecure_SoftShaDigest(KatPtr->Mode, (const u8 *)KatMsg[Index],
+			(u32)strlen(KatMsg[Index]), Hash, sizeof(Hash)) != XST_SUCCESS) ||
+			(Bench_CmpHex(Hash, *DigestSize, KatPtr->Digest[Index]) !=
+			XST_SUCCESS)) {
+			printf("  %s KAT %u failed\n", KatPtr->Name, Index);
+			++Fails;
+		}
+	}
+
+	/* One million 'a' in updates of 1000 bytes */
+	(void)memset(Block, 'a', sizeof(Block));
+	(void)XSecure_SoftShaStart(&Ctx, KatPtr->Mode);
+	for (Index = 0U; Index < (BENCH_MILLION / sizeof(Block)); Index++) {
+		(void)XSecure_SoftShaUpdate(&Ctx, Block, sizeof(Block));
+	}
+	if ((XSecure_SoftShaFinish(&Ctx, Hash, sizeof(Hash)) != XST_SUCCESS) ||
+		(Bench_CmpHex(Hash, *DigestSize, KatPtr->Digest[BENCH_KATS - 1U]) !=
+		XST_SUCCESS)) {
+		printf("  %s million 'a' KAT failed\n", KatPtr->Name);
+		++Fails;
+	}
+
+	return Fails;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function runs the SHA2-384 known answer tests through the
+ *		XSecure_Sha384* API with the selected kernel.
+ *
+ * @param	KatPtr is the known answers of SHA2-384
+ *
+ * @return
+ * 		- Number of failed tests
+ *
+ *****************************************************************************/
+static u32 Bench_RunSha384Kat(const Bench_KatSet *KatPtr)
+{
+	XSecure_Sha2Hash Hash;
+	u8 Block[1000U];
+	u32 Fails = 0U;
+	u32 Index;
+
+	for (Index = 0U; Index < (BENCH_KATS - 1U); Index++) {
+		if ((XSecure_Sha384Digest((u8 *)KatMsg[Index],
+			(u32)strlen(KatMsg[Index]), Hash.Hash) != XST_SUCCESS) ||
+			(Bench_CmpHex(Hash.Hash, sizeof(Hash.Hash),
+			KatPtr->Digest[Index]) != XST_SUCCESS)) {
+			printf("  XSecure_Sha384Digest KAT %u failed\n", Index);
+			++Fails;
+		}
+	}
+
+	/* One million 'a' in updates of 1000 bytes */
+	(void)memset(Block, 'a', sizeof(Block));
+	XSecure_Sha384Start();
+	for (Index = 0U; Index < (BENCH_MILLION / sizeof(Block)); Index++) {
+		(void)XSecure_Sha384Update(Block, sizeof(Block));
+	}
+	if ((XSecure_Sha384Finish(&Hash) != XST_SUCCESS) ||
+		(Bench_CmpHex(Hash.Hash, sizeof(Hash.Hash),
+		KatPtr->Digest[BENCH_KATS - 1U]) != XST_SUCCESS)) {
+		printf("  XSecure_Sha384 million 'a' KAT failed\n");
+		++Fails;
+	}
+
+	return Fails;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function checks that splitting the data into updates does
+ *		not change the digest. Every message length up to
+ *		BENCH_SPLIT_MAX_LEN is hashed in one update and in updates of
+ *		each size from 1 byte up, crossing every block boundary.
+ *
+ * @param	Mode is the SHA mode
+ * @param	DigestSize is the digest size of the mode in bytes
+ *
+ * @return
+ * 		- Number of failed tests
+ *
+ *****************************************************************************/
+static u32 Bench_Split(XSecure_SoftShaMode Mode, u32 DigestSize)
+{
+	XSecure_SoftShaCtx Ctx;
+	u8 Msg[BENCH_SPLIT_MAX_LEN];
+	u8 Ref[XSECURE_SOFTSHA_MAX_DIGEST_SIZE];
+	u8 Hash[XSECURE_SOFTSHA_MAX_DIGEST_SIZE];
+	u32 Len;
+	u32 Step;
+	u32 Offset;
+	u32 Chunk;
+	u32 Fails = 0U;
+
+	for (Len = 0U; Len < BENCH_SPLIT_MAX_LEN; Len++) {
+		Msg[Len] = (u8)((Len * 131U) + 7U);
+	}
+
+	for (Len = 0U; Len <= BENCH_SPLIT_MAX_LEN; Len++) {
+		(void)XSecure_SoftShaDigest(Mode, Msg, Len, Ref, sizeof(Ref));
+		for (Step = 1U; Step <= Len; Step++) {
+			(void)XSecure_SoftShaStart(&Ctx, Mode);
+			for (Offset = 0U; Offset < Len; Offset += Chunk) {
+				Chunk = ((Len - Offset) < Step) ? (Len - Offset) : Step;
+				(void)XSecure_SoftShaUpdate(&Ctx, &Msg[Offset], Chunk);
+			}
+			(void)XSecure_SoftShaFinish(&Ctx, Hash, sizeof(Hash));
+			if (memcmp(Hash, Ref, DigestSize) != 0) {
+				++Fails;
+			}
+		}
+	}
+
+	return Fails;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function measures one mode and message size with the
+ *		selected kernel.
+ *
+ * @param	Mode is the SHA mode
+ * @param	Size is the message size in bytes
+ * @param	Msg is the message
+ * @param	TimeMs is the time to measure for, in milliseconds
+ *
+ *****************************************************************************/
+static void Bench_Point(XSecure_SoftShaMode Mode, u32 Size, const u8 *Msg,
+	u32 TimeMs)
+{
+	u8 Hash[XSECURE_SOFTSHA_MAX_DIGEST_SIZE];
+	u64 Start = Bench_TimeNs();
+	u64 Elapsed;
+	u64 Cnt = 0U;
+
+	do {
+		(void)XSecure_SoftShaDigest(Mode, Msg, Size, Hash, sizeof(Hash));
+		++Cnt;
+		Elapsed = Bench_TimeNs() - Start;
+	} while (Elapsed < ((u64)TimeMs * 1000000U));
+
+	printf(" %8.1f %8.0f", ((double)Cnt * Size * 1000.0) / (double)Elapsed,
+		(double)Elapsed / (double)Cnt);
+}
+
+int main(int Argc, char *Argv[])
+{
+	int Status = XST_FAILURE;
+	int Opt;
+	u32 KatOnly = (u32)FALSE;
+	u32 TimeMs = 200U;
+	u32 Fails = 0U;
+	u32 KatFails;
+	u32 DigestSize;
+	u32 Mode;
+	u32 SizeIdx;
+	u32 Kernel;
+	u8 *Msg = NULL;
+
+	while ((Opt = getopt(Argc, Argv, "kt:h")) != -1) {
+		switch (Opt) {
+		case 'k':
+			KatOnly = (u32)TRUE;
+			break;
+		case 't':
+			TimeMs = (u32)strtoul(optarg, NULL, 0);
+			break;
+		case 'h':
+			Bench_Usage(Argv[0]);
+			Status = XST_SUCCESS;
+			goto END;
+		default:
+			Bench_Usage(Argv[0]);
+			goto END;
+		}
+	}
+
+	printf("Kernel selected at run time: %s\n",
+		KernelName[XSecure_SoftShaGetKernel()]);
+
+	for (Kernel = XSECURE_SOFTSHA_KERNEL_SCALAR;
+		Kernel <= XSECURE_SOFTSHA_KERNEL_CE; Kernel++) {
+		if (XSecure_SoftShaSetKernel((XSecure_SoftShaKernelType)Kernel) !=
+			XST_SUCCESS) {
+			printf("Kernel %s: not available\n", KernelName[Kernel]);
+			continue;
+		}
+		for (Mode = 0U; Mode < BENCH_MODES; Mode++) {
+			u32 SplitFails;
+
+			KatFails = Bench_RunKat(&Kat[Mode], &DigestSize);
+			SplitFails = Bench_Split(Kat[Mode].Mode, DigestSize);
+
+			printf("Kernel %-6s %s: KAT %s, split %s\n", KernelName[Kernel],
+				Kat[Mode].Name, (KatFails == 0U) ? "pass" : "FAIL",
+				(SplitFails == 0U) ? "pass" : "FAIL");
+			Fails += KatFails + SplitFails;
+		}
+		KatFails = Bench_RunSha384Kat(&Kat[0U]);
+		printf("Kernel %-6s XSecure_Sha384: KAT %s\n", KernelName[Kernel],
+			(KatFails == 0U) ? "pass" : "FAIL");
+		Fails += KatFails;
+	}
+	if (Fails != 0U) {
+		printf("%u tests failed\n", Fails);
+		goto END;
+	}
+	if (KatOnly == (u32)TRUE) {
+		Status = XST_SUCCESS;
+		goto END;
+	}
+
+	Msg = malloc(BenchSize[(sizeof(BenchSize) / sizeof(BenchSize[0U])) - 1U]);
+	if (Msg == NULL) {
+		goto END;
+	}
+	(void)memset(Msg, 0x5A, BenchSize[(sizeof(BenchSize) /
+		sizeof(BenchSize[0U])) - 1U]);
+
+	printf("\n%-8s %-6s", "Mode", "Kernel");
+	for (SizeIdx = 0U; SizeIdx < (sizeof(BenchSize) / sizeof(BenchSize[0U]));
+		SizeIdx++) {
+		printf(" %8uB MB/s ns/msg", BenchSize[SizeIdx]);
+	}
+	printf("\n");
+	for (Mode = 0U; Mode < BENCH_MODES; Mode++) {
+		for (Kernel = XSECURE_SOFTSHA_KERNEL_SCALAR;
+			Kernel <= XSECURE_SOFTSHA_KERNEL_CE; Kernel++) {
+			if (XSecure_SoftShaSetKernel((XSecure_SoftShaKernelType)Kernel) !=
+				XST_SUCCESS) {
+				continue;
+			}
+			printf("%-8s %-6s", Kat[Mode].Name, KernelName[Kernel]);
+			for (SizeIdx = 0U;
+				SizeIdx < (sizeof(BenchSize) / sizeof(BenchSize[0U]));
+				SizeIdx++) {
+				printf("      ");
+				Bench_Point(Kat[Mode].Mode, BenchSize[SizeIdx], Msg, TimeMs);
+			}
+			printf("\n");
+		}
+	}
+	Status = XST_SUCCESS;
+
+END:
+	free(Msg);
+	return (Status == XST_SUCCESS) ? 0 : 1;
+}
@@ -0,0 +1,226 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_softsha_ce_emu.h
+*
+* This file emulates, in C, the NEON intrinsics used by the AArch64 kernel
+* of the software SHA. Building xsecure_softsha.c with
+* XSECURE_SOFTSHA_CE_EMU on a host compiles that kernel with these
+* definitions, so it is checked against the known answers without an
+* AArch64 CPU. The instructions follow the pseudocode of the Arm
+* Architecture Reference Manual; only the lanes of 64-bit elements are
+* modelled.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 1.00  sb   10/16/26 First release
+*
+* </pre>
+*
+******************************************************************************/
+#ifndef XSECURE_SOFTSHA_CE_EMU_H
+#define XSECURE_SOFTSHA_CE_EMU_H
+
+#include <string.h>
+#include "xil_types.h"
+
+/**************************** Type Definitions *******************************/
+typedef struct {
+	u64 Val[2U];		/**< Lane 0, lane 1 */
+} uint64x2_t;
+
+typedef struct {
+	u8 Val[16U];		/**< Bytes in memory order */
+} uint8x16_t;
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define EMU_ROR64(X, N)	(((N) == 0U) ? (X) : (((X) >> (N)) | ((X) << (64U - (N)))))
+#define EMU_ROL64(X, N)	EMU_ROR64((X), (64U - (N)) & 63U)
+
+static inline uint64x2_t vld1q_u64(const u64 *Ptr)
+{
+	uint64x2_t R = {{Ptr[0U], Ptr[1U]}};
+
+	return R;
+}
+
+static inline void vst1q_u64(u64 *Ptr, uint64x2_t A)
+{
+	Ptr[0U] = A.Val[0U];
+	Ptr[1U] = A.Val[1U];
+}
+
+static inline uint8x16_t vld1q_u8(const u8 *Ptr)
+{
+	uint8x16_t R;
+
+	memcpy(R.Val, Ptr, sizeof(R.Val));
+	return R;
+}
+
+static inline uint8x16_t vrev64q_u8(uint8x16_t A)
+{
+	uint8x16_t R;
+	u32 Idx;
+
+	for (Idx = 0U; Idx < 16U; Idx++) {
+		R.Val[Idx] = A.Val[(Idx & ~7U) + (7U - (Idx & 7U))];
+	}
+	return R;
+}
+
+/* Lanes are little endian, as on AArch64 */
+static inline uint64x2_t vreinterpretq_u64_u8(uint8x16_t A)
+{
+	uint64x2_t R = {{0U, 0U}};
+	u32 Idx;
+
+	for (Idx = 0U; Idx < 16U; Idx++) {
+		R.Val[Idx / 8U] |= (u64)A.Val[Idx] << ((Idx % 8U) * 8U);
+	}
+	return R;
+}
+
+static inline uint64x2_t vdupq_n_u64(u64 V)
+{
+	uint64x2_t R = {{V, V}};
+
+	return R;
+}
+
+#define vgetq_lane_u64(A, Lane)	((A).Val[(Lane)])
+
+static inline uint64x2_t vaddq_u64(uint64x2_t A, uint64x2_t B)
+{
+	uint64x2_t R = {{A.Val[0U] + B.Val[0U], A.Val[1U] + B.Val[1U]}};
+
+	return R;
+}
+
+static inline uint64x2_t veorq_u64(uint64x2_t A, uint64x2_t B)
+{
+	uint64x2_t R = {{A.Val[0U] ^ B.Val[0U], A.Val[1U] ^ B.Val[1U]}};
+
+	return R;
+}
+
+/* Only the EXT #8 form, {A[1], B[0]}, is used */
+static inline uint64x2_t EmuExt(uint64x2_t A, uint64x2_t B, u32 N)
+{
+	uint64x2_t R = {{(N == 0U) ? A.Val[0U] : A.Val[1U],
+		(N == 0U) ? A.Val[1U] : B.Val[0U]}};
+
+	return R;
+}
+#define vextq_u64(A, B, N)	EmuExt((A), (B), (u32)(N))
+
+static inline uint64x2_t veor3q_u64(uint64x2_t A, uint64x2_t B, uint64x2_t C)
+{
+	uint64x2_t R = {{A.Val[0U] ^ B.Val[0U] ^ C.Val[0U],
+		A.Val[1U] ^ B.Val[1U] ^ C.Val[1U]}};
+
+	return R;
+}
+
+static inline uint64x2_t vrax1q_u64(uint64x2_t A, uint64x2_t B)
+{
+	uint64x2_t R = {{A.Val[0U] ^ EMU_ROL64(B.Val[0U], 1U),
+		A.Val[1U] ^ EMU_ROL64(B.Val[1U], 1U)}};
+
+	return R;
+}
+
+static inline uint64x2_t EmuXar(uint64x2_t A, uint64x2_t B, u32 Imm)
+{
+	uint64x2_t R = {{EMU_ROR64(A.Val[0U] ^ B.Val[0U], Imm),
+		EMU_ROR64(A.Val[1U] ^ B.Val[1U], Imm)}};
+
+	return R;
+}
+#define vxarq_u64(A, B, Imm)	EmuXar((A), (B), (u32)(Imm))
+
+static inline uint64x2_t vbcaxq_u64(uint64x2_t A, uint64x2_t B, uint64x2_t C)
+{
+	uint64x2_t R = {{A.Val[0U] ^ (B.Val[0U] & ~C.Val[0U]),
+		A.Val[1U] ^ (B.Val[1U] & ~C.Val[1U])}};
+
+	return R;
+}
+
+/* SHA512H Qd, Qn, Vm.2D with W = Qd, X = Qn, Y = Vm */
+static inline uint64x2_t vsha512hq_u64(uint64x2_t W, uint64x2_t X,
+	uint64x2_t Y)
+{
+	uint64x2_t R;
+	u64 Sigma1;
+	u64 Tmp;
+
+	Sigma1 = EMU_ROR64(Y.Val[1U], 14U) ^ EMU_ROR64(Y.Val[1U], 18U) ^
+		EMU_ROR64(Y.Val[1U], 41U);
+	R.Val[1U] = (Y.Val[1U] & X.Val[0U]) ^ (~Y.Val[1U] & X.Val[1U]);
+	R.Val[1U] += Sigma1 + W.Val[1U];
+	Tmp = R.Val[1U] + Y.Val[0U];
+	Sigma1 = EMU_ROR64(Tmp, 14U) ^ EMU_ROR64(Tmp, 18U) ^ EMU_ROR64(Tmp, 41U);
+	R.Val[0U] = (Tmp & Y.Val[1U]) ^ (~Tmp & X.Val[0U]);
+	R.Val[0U] += Sigma1 + W.Val[0U];
+
+	return R;
+}
+
+/* SHA512H2 Qd, Qn, Vm.2D with W = Qd, X = Qn, Y = Vm */
+static inline uint64x2_t vsha512h2q_u64(uint64x2_t W, uint64x2_t X,
+	uint64x2_t Y)
+{
+	uint64x2_t R;
+	u64 Sigma0;
+
+	Sigma0 = EMU_ROR64(Y.Val[0U], 28U) ^ EMU_ROR64(Y.Val[0U], 34U) ^
+		EMU_ROR64(Y.Val[0U], 39U);
+	R.Val[1U] = (X.Val[0U] & Y.Val[1U]) ^ (X.Val[0U] & Y.Val[0U]) ^
+		(Y.Val[1U] & Y.Val[0U]);
+	R.Val[1U] += Sigma0 + W.Val[1U];
+	Sigma0 = EMU_ROR64(R.Val[1U], 28U) ^ EMU_ROR64(R.Val[1U], 34U) ^
+		EMU_ROR64(R.Val[1U], 39U);
+	R.Val[0U] = (R.Val[1U] & Y.Val[0U]) ^ (R.Val[1U] & Y.Val[1U]) ^
+		(Y.Val[1U] & Y.Val[0U]);
+	R.Val[0U] += Sigma0 + W.Val[0U];
+
+	return R;
+}
+
+/* SHA512SU0 Vd.2D, Vn.2D with W = Vd, X = Vn */
+static inline uint64x2_t vsha512su0q_u64(uint64x2_t W, uint64x2_t X)
+{
+	uint64x2_t R;
+
+	R.Val[0U] = W.Val[0U] + (EMU_ROR64(W.Val[1U], 1U) ^
+		EMU_ROR64(W.Val[1U], 8U) ^ (W.Val[1U] >> 7U));
+	R.Val[1U] = W.Val[1U] + (EMU_ROR64(X.Val[0U], 1U) ^
+		EMU_ROR64(X.Val[0U], 8U) ^ (X.Val[0U] >> 7U));
+
+	return R;
+}
+
+/* SHA512SU1 Vd.2D, Vn.2D, Vm.2D with W = Vd, X = Vn, Y = Vm */
+static inline uint64x2_t vsha512su1q_u64(uint64x2_t W, uint64x2_t X,
+	uint64x2_t Y)
+{
+	uint64x2_t R;
+
+	R.Val[1U] = W.Val[1U] + (EMU_ROR64(X.Val[1U], 19U) ^
+		EMU_ROR64(X.Val[1U], 61U) ^ (X.Val[1U] >> 6U)) + Y.Val[1U];
+	R.Val[0U] = W.Val[0U] + (EMU_ROR64(X.Val[0U], 19U) ^
+		EMU_ROR64(X.Val[0U], 61U) ^ (X.Val[0U] >> 6U)) + Y.Val[0U];
+
+	return R;
+}
+
+#endif /* XSECURE_SOFTSHA_CE_EMU_H */
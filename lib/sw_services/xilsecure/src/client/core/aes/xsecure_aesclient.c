@@ -37,6 +37,7 @@
 * 5.3	vss  10/03/23 Added single API support for AES AAD and GMAC operations
 *	vss  03/04/24 Removed code redundancy for AesPerformOperation API
 * 5.4   yog  04/29/24 Fixed doxygen warnings.
+* 5.5   sb   10/16/26 Added XSecure_AesPerformBatch
 *
 * </pre>
 *
@@ -908,6 +909,84 @@ int XSecure_AesPerformOperation(const XSecure_ClientInstance *InstancePtr,
 	 */
 	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
 
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ *
+ * @brief	This function sends IPI request to encrypt or decrypt a list of
+ * 		AES-GCM messages in one request. Each entry carries the key
+ * 		source, IV, AAD, input, output and GCM tag of one message.
+ *
+ * @param	InstancePtr	Pointer to the client instance
+ * @param	Entry		Pointer to the list of batch entries
+ * @param	EntryCnt	Number of entries in the list
+ * @param	OperationId	XSECURE_ENCRYPT or XSECURE_DECRYPT
+ *
+ * @return
+ *		 - XST_SUCCESS  If all the entries are successful
+ *		 - XSECURE_AES_INVALID_PARAM  On invalid parameter
+ *		 - ErrorCode  Status of the first failing entry
+ *
+ * @note	The server writes the status of every entry to its Status
+ *		field. Invalidate the cache of the list before reading it.
+ *
+ ******************************************************************************/
+int XSecure_AesPerformBatch(const XSecure_ClientInstance *InstancePtr,
+	XSecure_AesBatchEntry *Entry, u32 EntryCnt, u32 OperationId)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_AesBatchParams *BatchParams = NULL;
+	u64 Buffer;
+	u32 MemSize;
+	u32 Index;
+	u32 Payload[XMAILBOX_PAYLOAD_LEN_3U];
+
+	if ((InstancePtr == NULL) || (InstancePtr->MailboxPtr == NULL) ||
+		(Entry == NULL) || (EntryCnt == 0U)) {
+		Status = XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	if ((OperationId != (u32)XSECURE_ENCRYPT) &&
+		(OperationId != (u32)XSECURE_DECRYPT)) {
+		Status = XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	MemSize = XMailbox_GetSharedMem(InstancePtr->MailboxPtr, (u64**)(UINTPTR)&BatchParams);
+	if ((BatchParams == NULL) || (MemSize < sizeof(XSecure_AesBatchParams))) {
+		Status = XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	/** Entries the server does not reach keep a failure status */
+	for (Index = 0U; Index < EntryCnt; Index++) {
+		Entry[Index].Status = (u32)XST_FAILURE;
+	}
+
+	BatchParams->EntryAddr = (u64)(UINTPTR)Entry;
+	BatchParams->EntryCnt = EntryCnt;
+	BatchParams->OperationId = OperationId;
+
+	Buffer = (u64)(UINTPTR)BatchParams;
+
+	XSecure_DCacheFlushRange(Entry, EntryCnt * sizeof(XSecure_AesBatchEntry));
+	XSecure_DCacheFlushRange(BatchParams, sizeof(XSecure_AesBatchParams));
+
+	/* Fill IPI Payload */
+	Payload[0U] = HEADER(0U, (InstancePtr->SlrIndex << XSECURE_SLR_INDEX_SHIFT) | XSECURE_API_AES_PERFORM_BATCH);
+	Payload[1U] = (u32)Buffer;
+	Payload[2U] = (u32)(Buffer >> 32U);
+
+	/**
+	 * Send an IPI request to the PLM by using the CDO command to call XSecure_AesPerformBatch
+	 * API and returns the status of the IPI response
+	 */
+	Status = XSecure_ProcessMailbox(InstancePtr->MailboxPtr, Payload, sizeof(Payload)/sizeof(u32));
+
 END:
 	return Status;
 }
@@ -28,6 +28,7 @@
 * 5.3	vss  10/03/23 Added single API support for AES AAD and GMAC operations
 *	vss  03/04/24 Removed code redundancy for AesPerformOperation API
 * 5.4   yog  04/29/24 Fixed doxygen grouping and doxygen warnings.
+* 5.5   sb   10/16/26 Added XSecure_AesPerformBatch prototype
 *
 * </pre>
 *
@@ -112,6 +113,8 @@ int XSecure_AesDecryptData(XSecure_ClientInstance *InstancePtr, XSecure_AesKeySo
 int XSecure_AesPerformOperation(const XSecure_ClientInstance *InstancePtr,
 		const XSecure_AesDataBlockParams *AesDataParams);
 int XSecure_AesGmacUpdateAad(XSecure_ClientInstance *InstancePtr, u64 AadAddr, u32 AadSize, u32 IsLastChunkSrc);
+int XSecure_AesPerformBatch(const XSecure_ClientInstance *InstancePtr,
+		XSecure_AesBatchEntry *Entry, u32 EntryCnt, u32 OperationId);
 
 #ifdef __cplusplus
 }
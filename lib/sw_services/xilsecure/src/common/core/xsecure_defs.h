@@ -35,6 +35,7 @@
 * 5.4   yog  04/29/24 Fixed doxygen warnings.
 *       mb   05/23/24 Added support for P-192 Curve
 *       mb   05/23/24 Added support for P-224 Curve
+* 5.5   sb   10/16/26 Added XSecure_AesBatchEntry and XSecure_AesBatchParams
 *
 * </pre>
 *
@@ -186,6 +187,31 @@ typedef struct {
 	u32 IsUpdateAadEn; /**<Enable if operation includes update AAD */
 } XSecure_AesDataBlockParams;
 
+/**
+ * Structure for one message of an AES-GCM batch. The server updates Status
+ * with the result of the message.
+ */
+typedef struct {
+	u64 IvAddr;	/**< IV address */
+	u64 InDataAddr;	/**< Input data address */
+	u64 OutDataAddr; /**< Output data address */
+	u64 GcmTagAddr;	/**< Gcm Tag address */
+	u64 AadAddr;	/**< Aad address */
+	u32 KeySrc;	/**< AES Key source */
+	u32 KeySize;	/**< Size of AES key */
+	u32 Size;	/**< Length of input data */
+	u32 AadSize;	/**< Aad size, zero if the message has no AAD */
+	u32 Status;	/**< Status of the message */
+	u32 Reserved;	/**< Reserved */
+} XSecure_AesBatchEntry;
+
+/** Structure for input parameters for AES-GCM batch operation */
+typedef struct {
+	u64 EntryAddr;	/**< Address of the XSecure_AesBatchEntry list */
+	u32 EntryCnt;	/**< Number of entries in the list */
+	u32 OperationId;/**< Operation type - Encrypt or decrypt */
+} XSecure_AesBatchParams;
+
 typedef enum {
 	XSECURE_ENCRYPT,	/**< Encrypt operation */
 	XSECURE_DECRYPT,	/**< Decrypt operation */
@@ -0,0 +1,1005 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_softsha.c
+*
+* This file contains the software SHA2-384/512 and SHA3-256/384/512
+* implementation. The block functions have two kernels:
+* - 64-bit scalar code, used on every processor
+* - AArch64 code using the SHA512 and SHA3 instructions (Armv8.2 crypto
+*   extensions), used on A78 when the CPU implements them. It is built only
+*   with XSECURE_SOFTSHA_CE_SUPPORT, which is off by default until the known
+*   answer tests of host/ are run on an A78.
+*
+* The kernel is selected at run time, on the first use, from the ID
+* registers of the CPU, or the hardware capabilities on Linux. The state
+* layout is the same for both kernels, so the selection can be changed
+* with XSecure_SoftShaSetKernel at any time.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.5   sb   10/16/26 Initial release
+*       sb   10/16/26 Build the AArch64 kernel only with
+*                     XSECURE_SOFTSHA_CE_SUPPORT
+*
+* </pre>
+*
+******************************************************************************/
+/**
+* @addtogroup xsecure_common_apis Xilsecure Common Apis
+* @{
+*/
+/***************************** Include Files *********************************/
+#include "xsecure_softsha.h"
+#include "xstatus.h"
+#include "xil_sutil.h"
+#ifdef SDT
+#include "xsecure_config.h"
+#else
+#include "xparameters.h"
+#endif
+
+#if defined(__aarch64__) && defined(__GNUC__) && \
+	defined(XSECURE_SOFTSHA_CE_SUPPORT)
+#include <arm_neon.h>
+#if defined(__linux__)
+#include <sys/auxv.h>
+#endif
+#define XSECURE_SOFTSHA_CE
+#elif defined(XSECURE_SOFTSHA_CE_EMU)
+/* Instructions emulated in C, to check the AArch64 kernel on a host */
+#include "xsecure_softsha_ce_emu.h"
+#define XSECURE_SOFTSHA_CE
+#endif
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_SOFTSHA_SHA2_BLOCK_SIZE	(128U)	/**< SHA2-384/512 block size */
+#define XSECURE_SOFTSHA_SHA2_LEN_SIZE	(16U)	/**< SHA2-384/512 length field */
+#define XSECURE_SOFTSHA_SHA2_ROUNDS	(80U)	/**< SHA2-384/512 rounds */
+#define XSECURE_SOFTSHA_SHA3_ROUNDS	(24U)	/**< Keccak-f[1600] rounds */
+#define XSECURE_SOFTSHA_SHA3_PAD	(0x06U)	/**< SHA3 domain and first pad
+						  bit */
+#define XSECURE_SOFTSHA_PAD_END		(0x80U)	/**< Last pad bit */
+
+#if defined(__aarch64__) && !defined(__linux__)
+#define XSECURE_SOFTSHA_ISAR0_SHA2_SHIFT	(12U)	/**< ID_AA64ISAR0_EL1.SHA2 */
+#define XSECURE_SOFTSHA_ISAR0_SHA3_SHIFT	(32U)	/**< ID_AA64ISAR0_EL1.SHA3 */
+#define XSECURE_SOFTSHA_ISAR0_FIELD_MASK	(0xFU)
+#define XSECURE_SOFTSHA_ISAR0_SHA512		(2U)	/**< SHA2 field with
+							  SHA512 */
+#endif
+
+#if defined(__aarch64__)
+#if defined(__clang__)
+#define XSECURE_SOFTSHA_TARGET_CE	__attribute__((target("sha3")))
+#else
+#define XSECURE_SOFTSHA_TARGET_CE	__attribute__((target("+sha3")))
+#endif
+#else
+#define XSECURE_SOFTSHA_TARGET_CE
+#endif
+
+/***************** Macros (Inline Functions) Definitions *********************/
+#define XSECURE_SOFTSHA_ROR64(X, N)	(((X) >> (N)) | ((X) << (64U - (N))))
+#define XSECURE_SOFTSHA_ROL64(X, N)	(((X) << (N)) | ((X) >> (64U - (N))))
+
+#define XSECURE_SHA512_BSIG0(X)	(XSECURE_SOFTSHA_ROR64((X), 28U) ^ \
+	XSECURE_SOFTSHA_ROR64((X), 34U) ^ XSECURE_SOFTSHA_ROR64((X), 39U))
+#define XSECURE_SHA512_BSIG1(X)	(XSECURE_SOFTSHA_ROR64((X), 14U) ^ \
+	XSECURE_SOFTSHA_ROR64((X), 18U) ^ XSECURE_SOFTSHA_ROR64((X), 41U))
+#define XSECURE_SHA512_SSIG0(X)	(XSECURE_SOFTSHA_ROR64((X), 1U) ^ \
+	XSECURE_SOFTSHA_ROR64((X), 8U) ^ ((X) >> 7U))
+#define XSECURE_SHA512_SSIG1(X)	(XSECURE_SOFTSHA_ROR64((X), 19U) ^ \
+	XSECURE_SOFTSHA_ROR64((X), 61U) ^ ((X) >> 6U))
+#define XSECURE_SHA512_CH(X, Y, Z)	(((X) & ((Y) ^ (Z))) ^ (Z))
+#define XSECURE_SHA512_MAJ(X, Y, Z)	(((X) & (Y)) | ((Z) & ((X) | (Y))))
+
+/** One SHA2-512 round, the caller rotates the roles of the working
+ * variables instead of moving them */
+#define XSECURE_SHA512_ROUND(A, B, C, D, E, F, G, H, Idx) \
+	do { \
+		T1 = (H) + XSECURE_SHA512_BSIG1(E) + XSECURE_SHA512_CH((E), (F), (G)) + \
+			Sha512K[Round + (Idx)] + W[(Idx)]; \
+		(D) += T1; \
+		(H) = T1 + XSECURE_SHA512_BSIG0(A) + XSECURE_SHA512_MAJ((A), (B), (C)); \
+	} while (0)
+
+/**************************** Type Definitions *******************************/
+/** Block functions of a kernel */
+typedef struct {
+	void (*Sha512Blocks)(u64 *State, const u8 *Data, u32 Blocks);
+	void (*KeccakAbsorb)(u64 *State, const u8 *Data, u32 Blocks, u32 Rate);
+} XSecure_SoftShaKernel;
+
+/************************** Function Prototypes ******************************/
+static u64 XSecure_SoftShaLoadBe64(const u8 *Data);
+static u64 XSecure_SoftShaLoadLe64(const u8 *Data);
+static void XSecure_Sha512Blocks(u64 *State, const u8 *Data, u32 Blocks);
+static void XSecure_KeccakAbsorb(u64 *State, const u8 *Data, u32 Blocks,
+	u32 Rate);
+static const XSecure_SoftShaKernel *XSecure_SoftShaSelectKernel(void);
+static void XSecure_SoftShaBlocks(XSecure_SoftShaCtx *Ctx, const u8 *Data,
+	u32 Blocks);
+#ifdef XSECURE_SOFTSHA_CE
+static u32 XSecure_SoftShaCpuHasCe(void);
+static void XSecure_Sha512BlocksCe(u64 *State, const u8 *Data, u32 Blocks);
+static void XSecure_KeccakAbsorbCe(u64 *State, const u8 *Data, u32 Blocks,
+	u32 Rate);
+#endif
+
+/************************** Variable Definitions *****************************/
+/** SHA2-384/512 round constants */
+static const u64 Sha512K[XSECURE_SOFTSHA_SHA2_ROUNDS] = {
+	0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL,
+	0xE9B5DBA58189DBBCULL, 0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL,
+	0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL, 0xD807AA98A3030242ULL,
+	0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+	0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL,
+	0xC19BF174CF692694ULL, 0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL,
+	0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL, 0x2DE92C6F592B0275ULL,
+	0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+	0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL,
+	0xBF597FC7BEEF0EE4ULL, 0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL,
+	0x06CA6351E003826FULL, 0x142929670A0E6E70ULL, 0x27B70A8546D22FFCULL,
+	0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+	0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL,
+	0x92722C851482353BULL, 0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL,
+	0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL, 0xD192E819D6EF5218ULL,
+	0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+	0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL,
+	0x34B0BCB5E19B48A8ULL, 0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL,
+	0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL, 0x748F82EE5DEFB2FCULL,
+	0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+	0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL,
+	0xC67178F2E372532BULL, 0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL,
+	0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL, 0x06F067AA72176FBAULL,
+	0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+	0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL,
+	0x431D67C49C100D4CULL, 0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL,
+	0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL,
+};
+
+/** SHA2-384 initial hash value */
+static const u64 Sha384Iv[8U] = {
+	0xCBBB9D5DC1059ED8ULL, 0x629A292A367CD507ULL, 0x9159015A3070DD17ULL,
+	0x152FECD8F70E5939ULL, 0x67332667FFC00B31ULL, 0x8EB44A8768581511ULL,
+	0xDB0C2E0D64F98FA7ULL, 0x47B5481DBEFA4FA4ULL,
+};
+
+/** SHA2-512 initial hash value */
+static const u64 Sha512Iv[8U] = {
+	0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL, 0x3C6EF372FE94F82BULL,
+	0xA54FF53A5F1D36F1ULL, 0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+	0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL,
+};
+
+/** Keccak-f[1600] round constants */
+static const u64 KeccakRc[XSECURE_SOFTSHA_SHA3_ROUNDS] = {
+	0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+	0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+	0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+	0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+	0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+	0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+	0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+	0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL,
+};
+
+static const XSecure_SoftShaKernel ScalarKernel = {
+	XSecure_Sha512Blocks,
+	XSecure_KeccakAbsorb,
+};
+
+#ifdef XSECURE_SOFTSHA_CE
+static const XSecure_SoftShaKernel CeKernel = {
+	XSecure_Sha512BlocksCe,
+	XSecure_KeccakAbsorbCe,
+};
+#endif
+
+/** Kernel in use, selected on the first use */
+static const XSecure_SoftShaKernel *KernelPtr = NULL;
+
+/*****************************************************************************/
+/**
+ * @brief	This function loads a big endian 64-bit word.
+ *
+ * @param	Data is the address of the word, need not be aligned
+ *
+ * @return
+ *		- Value of the word
+ *
+ ******************************************************************************/
+static u64 XSecure_SoftShaLoadBe64(const u8 *Data)
+{
+	return ((u64)Data[0U] << 56U) | ((u64)Data[1U] << 48U) |
+		((u64)Data[2U] << 40U) | ((u64)Data[3U] << 32U) |
+		((u64)Data[4U] << 24U) | ((u64)Data[5U] << 16U) |
+		((u64)Data[6U] << 8U) | (u64)Data[7U];
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function loads a little endian 64-bit word.
+ *
+ * @param	Data is the address of the word, need not be aligned
+ *
+ * @return
+ *		- Value of the word
+ *
+ ******************************************************************************/
+static u64 XSecure_SoftShaLoadLe64(const u8 *Data)
+{
+	return ((u64)Data[7U] << 56U) | ((u64)Data[6U] << 48U) |
+		((u64)Data[5U] << 40U) | ((u64)Data[4U] << 32U) |
+		((u64)Data[3U] << 24U) | ((u64)Data[2U] << 16U) |
+		((u64)Data[1U] << 8U) | (u64)Data[0U];
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function hashes whole SHA2-384/512 blocks with scalar
+ *		code. Sixteen rounds are unrolled so that the working
+ *		variables and the message schedule stay in registers.
+ *
+ * @param	State is the hash state
+ * @param	Data is the address of the blocks
+ * @param	Blocks is the number of blocks
+ *
+ ******************************************************************************/
+static void XSecure_Sha512Blocks(u64 *State, const u8 *Data, u32 Blocks)
+{
+	u64 W[16U];
+	u64 A, B, C, D, E, F, G, H;
+	u64 T1;
+	u32 Round;
+	u32 Idx;
+	u32 Count = Blocks;
+	const u8 *Block = Data;
+
+	while (Count > 0U) {
+		A = State[0U];
+		B = State[1U];
+		C = State[2U];
+		D = State[3U];
+		E = State[4U];
+		F = State[5U];
+		G = State[6U];
+		H = State[7U];
+
+		for (Idx = 0U; Idx < 16U; Idx++) {
+			W[Idx] = XSecure_SoftShaLoadBe64(&Block[Idx * 8U]);
+		}
+
+		for (Round = 0U; Round < XSECURE_SOFTSHA_SHA2_ROUNDS; Round += 16U) {
+			if (Round > 0U) {
+				/* W[t] for the next 16 rounds, in place */
+				for (Idx = 0U; Idx < 16U; Idx++) {
+					W[Idx] += XSECURE_SHA512_SSIG1(W[(Idx + 14U) & 15U]) +
+						W[(Idx + 9U) & 15U] +
+						XSECURE_SHA512_SSIG0(W[(Idx + 1U) & 15U]);
+				}
+			}
+			XSECURE_SHA512_ROUND(A, B, C, D, E, F, G, H, 0U);
+			XSECURE_SHA512_ROUND(H, A, B, C, D, E, F, G, 1U);
+			XSECURE_SHA512_ROUND(G, H, A, B, C, D, E, F, 2U);
+			XSECURE_SHA512_ROUND(F, G, H, A, B, C, D, E, 3U);
+			XSECURE_SHA512_ROUND(E, F, G, H, A, B, C, D, 4U);
+			XSECURE_SHA512_ROUND(D, E, F, G, H, A, B, C, 5U);
+			XSECURE_SHA512_ROUND(C, D, E, F, G, H, A, B, 6U);
+			XSECURE_SHA512_ROUND(B, C, D, E, F, G, H, A, 7U);
+			XSECURE_SHA512_ROUND(A, B, C, D, E, F, G, H, 8U);
+			XSECURE_SHA512_ROUND(H, A, B, C, D, E, F, G, 9U);
+			XSECURE_SHA512_ROUND(G, H, A, B, C, D, E, F, 10U);
+			XSECURE_SHA512_ROUND(F, G, H, A, B, C, D, E, 11U);
+			XSECURE_SHA512_ROUND(E, F, G, H, A, B, C, D, 12U);
+			XSECURE_SHA512_ROUND(D, E, F, G, H, A, B, C, 13U);
+			XSECURE_SHA512_ROUND(C, D, E, F, G, H, A, B, 14U);
+			XSECURE_SHA512_ROUND(B, C, D, E, F, G, H, A, 15U);
+		}
+
+		State[0U] += A;
+		State[1U] += B;
+		State[2U] += C;
+		State[3U] += D;
+		State[4U] += E;
+		State[5U] += F;
+		State[6U] += G;
+		State[7U] += H;
+
+		Block = &Block[XSECURE_SOFTSHA_SHA2_BLOCK_SIZE];
+		--Count;
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function absorbs whole SHA3 blocks with scalar code. Each
+ *		block is XORed into the state, which is then permuted with
+ *		Keccak-f[1600]. The state is kept in local variables across
+ *		the blocks.
+ *
+ * @param	State is the Keccak state
+ * @param	Data is the address of the blocks
+ * @param	Blocks is the number of blocks
+ * @param	Rate is the block size in bytes
+ *
+ ******************************************************************************/
+static void XSecure_KeccakAbsorb(u64 *State, const u8 *Data, u32 Blocks,
+	u32 Rate)
+{
+	u64 A[XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS];
+	u64 B[XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS];
+	u64 C[5U];
+	u64 D[5U];
+	u32 Round;
+	u32 Lane;
+	u32 Count = Blocks;
+	const u8 *Block = Data;
+
+	for (Lane = 0U; Lane < XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS; Lane++) {
+		A[Lane] = State[Lane];
+	}
+
+	while (Count > 0U) {
+		for (Lane = 0U; Lane < (Rate / 8U); Lane++) {
+			A[Lane] ^= XSecure_SoftShaLoadLe64(&Block[Lane * 8U]);
+		}
+
+		for (Round = 0U; Round < XSECURE_SOFTSHA_SHA3_ROUNDS; Round++) {
+			/* Theta */
+			C[0U] = A[0U] ^ A[5U] ^ A[10U] ^ A[15U] ^ A[20U];
+			C[1U] = A[1U] ^ A[6U] ^ A[11U] ^ A[16U] ^ A[21U];
+			C[2U] = A[2U] ^ A[7U] ^ A[12U] ^ A[17U] ^ A[22U];
+			C[3U] = A[3U] ^ A[8U] ^ A[13U] ^ A[18U] ^ A[23U];
+			C[4U] = A[4U] ^ A[9U] ^ A[14U] ^ A[19U] ^ A[24U];
+			D[0U] = C[4U] ^ XSECURE_SOFTSHA_ROL64(C[1U], 1U);
+			D[1U] = C[0U] ^ XSECURE_SOFTSHA_ROL64(C[2U], 1U);
+			D[2U] = C[1U] ^ XSECURE_SOFTSHA_ROL64(C[3U], 1U);
+			D[3U] = C[2U] ^ XSECURE_SOFTSHA_ROL64(C[4U], 1U);
+			D[4U] = C[3U] ^ XSECURE_SOFTSHA_ROL64(C[0U], 1U);
+			/* Rho and pi */
+			B[0U] = A[0U] ^ D[0U];
+			B[1U] = XSECURE_SOFTSHA_ROL64(A[6U] ^ D[1U], 44U);
+			B[2U] = XSECURE_SOFTSHA_ROL64(A[12U] ^ D[2U], 43U);
+			B[3U] = XSECURE_SOFTSHA_ROL64(A[18U] ^ D[3U], 21U);
+			B[4U] = XSECURE_SOFTSHA_ROL64(A[24U] ^ D[4U], 14U);
+			B[5U] = XSECURE_SOFTSHA_ROL64(A[3U] ^ D[3U], 28U);
+			B[6U] = XSECURE_SOFTSHA_ROL64(A[9U] ^ D[4U], 20U);
+			B[7U] = XSECURE_SOFTSHA_ROL64(A[10U] ^ D[0U], 3U);
+			B[8U] = XSECURE_SOFTSHA_ROL64(A[16U] ^ D[1U], 45U);
+			B[9U] = XSECURE_SOFTSHA_ROL64(A[22U] ^ D[2U], 61U);
+			B[10U] = XSECURE_SOFTSHA_ROL64(A[1U] ^ D[1U], 1U);
+			B[11U] = XSECURE_SOFTSHA_ROL64(A[7U] ^ D[2U], 6U);
+			B[12U] = XSECURE_SOFTSHA_ROL64(A[13U] ^ D[3U], 25U);
+			B[13U] = XSECURE_SOFTSHA_ROL64(A[19U] ^ D[4U], 8U);
+			B[14U] = XSECURE_SOFTSHA_ROL64(A[20U] ^ D[0U], 18U);
+			B[15U] = XSECURE_SOFTSHA_ROL64(A[4U] ^ D[4U], 27U);
+			B[16U] = XSECURE_SOFTSHA_ROL64(A[5U] ^ D[0U], 36U);
+			B[17U] = XSECURE_SOFTSHA_ROL64(A[11U] ^ D[1U], 10U);
+			B[18U] = XSECURE_SOFTSHA_ROL64(A[17U] ^ D[2U], 15U);
+			B[19U] = XSECURE_SOFTSHA_ROL64(A[23U] ^ D[3U], 56U);
+			B[20U] = XSECURE_SOFTSHA_ROL64(A[2U] ^ D[2U], 62U);
+			B[21U] = XSECURE_SOFTSHA_ROL64(A[8U] ^ D[3U], 55U);
+			B[22U] = XSECURE_SOFTSHA_ROL64(A[14U] ^ D[4U], 39U);
+			B[23U] = XSECURE_SOFTSHA_ROL64(A[15U] ^ D[0U], 41U);
+			B[24U] = XSECURE_SOFTSHA_ROL64(A[21U] ^ D[1U], 2U);
+			/* Chi */
+			A[0U] = B[0U] ^ (~B[1U] & B[2U]);
+			A[1U] = B[1U] ^ (~B[2U] & B[3U]);
+			A[2U] = B[2U] ^ (~B[3U] & B[4U]);
+			A[3U] = B[3U] ^ (~B[4U] & B[0U]);
+			A[4U] = B[4U] ^ (~B[0U] & B[1U]);
+			A[5U] = B[5U] ^ (~B[6U] & B[7U]);
+			A[6U] = B[6U] ^ (~B[7U] & B[8U]);
+			A[7U] = B[7U] ^ (~B[8U] & B[9U]);
+			A[8U] = B[8U] ^ (~B[9U] & B[5U]);
+			A[9U] = B[9U] ^ (~B[5U] & B[6U]);
+			A[10U] = B[10U] ^ (~B[11U] & B[12U]);
+			A[11U] = B[11U] ^ (~B[12U] & B[13U]);
+			A[12U] = B[12U] ^ (~B[13U] & B[14U]);
+			A[13U] = B[13U] ^ (~B[14U] & B[10U]);
+			A[14U] = B[14U] ^ (~B[10U] & B[11U]);
+			A[15U] = B[15U] ^ (~B[16U] & B[17U]);
+			A[16U] = B[16U] ^ (~B[17U] & B[18U]);
+			A[17U] = B[17U] ^ (~B[18U] & B[19U]);
+			A[18U] = B[18U] ^ (~B[19U] & B[15U]);
+			A[19U] = B[19U] ^ (~B[15U] & B[16U]);
+			A[20U] = B[20U] ^ (~B[21U] & B[22U]);
+			A[21U] = B[21U] ^ (~B[22U] & B[23U]);
+			A[22U] = B[22U] ^ (~B[23U] & B[24U]);
+			A[23U] = B[23U] ^ (~B[24U] & B[20U]);
+			A[24U] = B[24U] ^ (~B[20U] & B[21U]);
+			/* Iota */
+			A[0U] ^= KeccakRc[Round];
+		}
+
+		Block = &Block[Rate];
+		--Count;
+	}
+
+	for (Lane = 0U; Lane < XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS; Lane++) {
+		State[Lane] = A[Lane];
+	}
+}
+
+#ifdef XSECURE_SOFTSHA_CE
+/*****************************************************************************/
+/**
+ * @brief	This function checks whether the CPU implements the SHA512 and
+ *		SHA3 instructions.
+ *
+ * @return
+ *		- TRUE if both are implemented, FALSE otherwise
+ *
+ ******************************************************************************/
+static u32 XSecure_SoftShaCpuHasCe(void)
+{
+	u32 HasCe = (u32)FALSE;
+#if defined(__aarch64__) && defined(__linux__)
+	unsigned long HwCap = getauxval(AT_HWCAP);
+
+	if (((HwCap & HWCAP_SHA512) != 0U) && ((HwCap & HWCAP_SHA3) != 0U)) {
+		HasCe = (u32)TRUE;
+	}
+#elif defined(__aarch64__)
+	u64 Isar0;
+
+	__asm__ volatile ("mrs %0, id_aa64isar0_el1" : "=r" (Isar0));
+	if ((((Isar0 >> XSECURE_SOFTSHA_ISAR0_SHA2_SHIFT) &
+		XSECURE_SOFTSHA_ISAR0_FIELD_MASK) >= XSECURE_SOFTSHA_ISAR0_SHA512) &&
+		(((Isar0 >> XSECURE_SOFTSHA_ISAR0_SHA3_SHIFT) &
+		XSECURE_SOFTSHA_ISAR0_FIELD_MASK) != 0U)) {
+		HasCe = (u32)TRUE;
+	}
+#else
+	/* Emulated instructions are always available */
+	HasCe = (u32)TRUE;
+#endif
+
+	return HasCe;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function hashes whole SHA2-384/512 blocks with the SHA512
+ *		instructions. The working variables are kept in pairs, {a, b},
+ *		{c, d}, {e, f} and {g, h}, and each step does two rounds.
+ *
+ * @param	State is the hash state
+ * @param	Data is the address of the blocks
+ * @param	Blocks is the number of blocks
+ *
+ ******************************************************************************/
+static XSECURE_SOFTSHA_TARGET_CE void XSecure_Sha512BlocksCe(u64 *State,
+	const u8 *Data, u32 Blocks)
+{
+	uint64x2_t Ab = vld1q_u64(&State[0U]);
+	uint64x2_t Cd = vld1q_u64(&State[2U]);
+	uint64x2_t Ef = vld1q_u64(&State[4U]);
+	uint64x2_t Gh = vld1q_u64(&State[6U]);
+	uint64x2_t SavedAb;
+	uint64x2_t SavedCd;
+	uint64x2_t SavedEf;
+	uint64x2_t SavedGh;
+	uint64x2_t M[8U];
+	uint64x2_t Wk;
+	uint64x2_t T;
+	uint64x2_t NewAb;
+	uint64x2_t NewEf;
+	u32 Round;
+	u32 Idx;
+	u32 Count = Blocks;
+	const u8 *Block = Data;
+
+	while (Count > 0U) {
+		SavedAb = Ab;
+		SavedCd = Cd;
+		SavedEf = Ef;
+		SavedGh = Gh;
+
+		for (Idx = 0U; Idx < 8U; Idx++) {
+			M[Idx] = vreinterpretq_u64_u8(vrev64q_u8(
+				vld1q_u8(&Block[Idx * 16U])));
+		}
+
+		for (Round = 0U; Round < XSECURE_SOFTSHA_SHA2_ROUNDS; Round += 2U) {
+			/* M[Idx] holds W[Round] and W[Round + 1] */
+			Idx = (Round / 2U) & 7U;
+			Wk = vaddq_u64(M[Idx], vld1q_u64(&Sha512K[Round]));
+			if (Round < (XSECURE_SOFTSHA_SHA2_ROUNDS - 16U)) {
+				M[Idx] = vsha512su1q_u64(
+					vsha512su0q_u64(M[Idx], M[(Idx + 1U) & 7U]),
+					M[(Idx + 7U) & 7U],
+					vextq_u64(M[(Idx + 4U) & 7U], M[(Idx + 5U) & 7U], 1));
+			}
+			/* {g + K[t + 1] + W[t + 1], h + K[t] + W[t]} */
+			T = vaddq_u64(Gh, vextq_u64(Wk, Wk, 1));
+			T = vsha512hq_u64(T, vextq_u64(Ef, Gh, 1), vextq_u64(Cd, Ef, 1));
+			NewEf = vaddq_u64(Cd, T);
+			NewAb = vsha512h2q_u64(T, Cd, Ab);
+			Gh = Ef;
+			Ef = NewEf;
+			Cd = Ab;
+			Ab = NewAb;
+		}
+
+		Ab = vaddq_u64(Ab, SavedAb);
+		Cd = vaddq_u64(Cd, SavedCd);
+		Ef = vaddq_u64(Ef, SavedEf);
+		Gh = vaddq_u64(Gh, SavedGh);
+
+		Block = &Block[XSECURE_SOFTSHA_SHA2_BLOCK_SIZE];
+		--Count;
+	}
+
+	vst1q_u64(&State[0U], Ab);
+	vst1q_u64(&State[2U], Cd);
+	vst1q_u64(&State[4U], Ef);
+	vst1q_u64(&State[6U], Gh);
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function absorbs whole SHA3 blocks with the SHA3
+ *		instructions. Each lane of the Keccak state is held in the
+ *		low half of a vector register, so that theta, rho, pi and chi
+ *		map to EOR3, RAX1, XAR and BCAX.
+ *
+ * @param	State is the Keccak state
+ * @param	Data is the address of the blocks
+ * @param	Blocks is the number of blocks
+ * @param	Rate is the block size in bytes
+ *
+ ******************************************************************************/
+static XSECURE_SOFTSHA_TARGET_CE void XSecure_KeccakAbsorbCe(u64 *State,
+	const u8 *Data, u32 Blocks, u32 Rate)
+{
+	uint64x2_t A[XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS];
+	uint64x2_t B[XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS];
+	uint64x2_t C[5U];
+	uint64x2_t D[5U];
+	u32 Round;
+	u32 Lane;
+	u32 Count = Blocks;
+	const u8 *Block = Data;
+
+	for (Lane = 0U; Lane < XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS; Lane++) {
+		A[Lane] = vdupq_n_u64(State[Lane]);
+	}
+
+	while (Count > 0U) {
+		for (Lane = 0U; Lane < (Rate / 8U); Lane++) {
+			A[Lane] = veorq_u64(A[Lane],
+				vdupq_n_u64(XSecure_SoftShaLoadLe64(&Block[Lane * 8U])));
+		}
+
+		for (Round = 0U; Round < XSECURE_SOFTSHA_SHA3_ROUNDS; Round++) {
+			/* Theta */
+			C[0U] = veor3q_u64(veor3q_u64(A[0U], A[5U], A[10U]), A[15U], A[20U]);
+			C[1U] = veor3q_u64(veor3q_u64(A[1U], A[6U], A[11U]), A[16U], A[21U]);
+			C[2U] = veor3q_u64(veor3q_u64(A[2U], A[7U], A[12U]), A[17U], A[22U]);
+			C[3U] = veor3q_u64(veor3q_u64(A[3U], A[8U], A[13U]), A[18U], A[23U]);
+			C[4U] = veor3q_u64(veor3q_u64(A[4U], A[9U], A[14U]), A[19U], A[24U]);
+			D[0U] = vrax1q_u64(C[4U], C[1U]);
+			D[1U] = vrax1q_u64(C[0U], C[2U]);
+			D[2U] = vrax1q_u64(C[1U], C[3U]);
+			D[3U] = vrax1q_u64(C[2U], C[4U]);
+			D[4U] = vrax1q_u64(C[3U], C[0U]);
+			/* Rho and pi, XAR rotates right */
+			B[0U] = veorq_u64(A[0U], D[0U]);
+			B[1U] = vxarq_u64(A[6U], D[1U], 20);
+			B[2U] = vxarq_u64(A[12U], D[2U], 21);
+			B[3U] = vxarq_u64(A[18U], D[3U], 43);
+			B[4U] = vxarq_u64(A[24U], D[4U], 50);
+			B[5U] = vxarq_u64(A[3U], D[3U], 36);
+			B[6U] = vxarq_u64(A[9U], D[4U], 44);
+			B[7U] = vxarq_u64(A[10U], D[0U], 61);
+			B[8U] = vxarq_u64(A[16U], D[1U], 19);
+			B[9U] = vxarq_u64(A[22U], D[2U], 3);
+			B[10U] = vxarq_u64(A[1U], D[1U], 63);
+			B[11U] = vxarq_u64(A[7U], D[2U], 58);
+			B[12U] = vxarq_u64(A[13U], D[3U], 39);
+			B[13U] = vxarq_u64(A[19U], D[4U], 56);
+			B[14U] = vxarq_u64(A[20U], D[0U], 46);
+			B[15U] = vxarq_u64(A[4U], D[4U], 37);
+			B[16U] = vxarq_u64(A[5U], D[0U], 28);
+			B[17U] = vxarq_u64(A[11U], D[1U], 54);
+			B[18U] = vxarq_u64(A[17U], D[2U], 49);
+			B[19U] = vxarq_u64(A[23U], D[3U], 8);
+			B[20U] = vxarq_u64(A[2U], D[2U], 2);
+			B[21U] = vxarq_u64(A[8U], D[3U], 9);
+			B[22U] = vxarq_u64(A[14U], D[4U], 25);
+			B[23U] = vxarq_u64(A[15U], D[0U], 23);
+			B[24U] = vxarq_u64(A[21U], D[1U], 62);
+			/* Chi */
+			A[0U] = vbcaxq_u64(B[0U], B[2U], B[1U]);
+			A[1U] = vbcaxq_u64(B[1U], B[3U], B[2U]);
+			A[2U] = vbcaxq_u64(B[2U], B[4U], B[3U]);
+			A[3U] = vbcaxq_u64(B[3U], B[0U], B[4U]);
+			A[4U] = vbcaxq_u64(B[4U], B[1U], B[0U]);
+			A[5U] = vbcaxq_u64(B[5U], B[7U], B[6U]);
+			A[6U] = vbcaxq_u64(B[6U], B[8U], B[7U]);
+			A[7U] = vbcaxq_u64(B[7U], B[9U], B[8U]);
+			A[8U] = vbcaxq_u64(B[8U], B[5U], B[9U]);
+			A[9U] = vbcaxq_u64(B[9U], B[6U], B[5U]);
+			A[10U] = vbcaxq_u64(B[10U], B[12U], B[11U]);
+			A[11U] = vbcaxq_u64(B[11U], B[13U], B[12U]);
+			A[12U] = vbcaxq_u64(B[12U], B[14U], B[13U]);
+			A[13U] = vbcaxq_u64(B[13U], B[10U], B[14U]);
+			A[14U] = vbcaxq_u64(B[14U], B[11U], B[10U]);
+			A[15U] = vbcaxq_u64(B[15U], B[17U], B[16U]);
+			A[16U] = vbcaxq_u64(B[16U], B[18U], B[17U]);
+			A[17U] = vbcaxq_u64(B[17U], B[19U], B[18U]);
+			A[18U] = vbcaxq_u64(B[18U], B[15U], B[19U]);
+			A[19U] = vbcaxq_u64(B[19U], B[16U], B[15U]);
+			A[20U] = vbcaxq_u64(B[20U], B[22U], B[21U]);
+			A[21U] = vbcaxq_u64(B[21U], B[23U], B[22U]);
+			A[22U] = vbcaxq_u64(B[22U], B[24U], B[23U]);
+			A[23U] = vbcaxq_u64(B[23U], B[20U], B[24U]);
+			A[24U] = vbcaxq_u64(B[24U], B[21U], B[20U]);
+			/* Iota */
+			A[0U] = veorq_u64(A[0U], vdupq_n_u64(KeccakRc[Round]));
+		}
+
+		Block = &Block[Rate];
+		--Count;
+	}
+
+	for (Lane = 0U; Lane < XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS; Lane++) {
+		State[Lane] = vgetq_lane_u64(A[Lane], 0);
+	}
+}
+#endif
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the kernel in use, selecting the fastest
+ *		kernel the CPU supports on the first call.
+ *
+ * @return
+ *		- Block functions of the kernel
+ *
+ ******************************************************************************/
+static const XSecure_SoftShaKernel *XSecure_SoftShaSelectKernel(void)
+{
+	if (KernelPtr == NULL) {
+		KernelPtr = &ScalarKernel;
+#ifdef XSECURE_SOFTSHA_CE
+		if (XSecure_SoftShaCpuHasCe() == (u32)TRUE) {
+			KernelPtr = &CeKernel;
+		}
+#endif
+	}
+
+	return KernelPtr;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function hashes whole blocks of a stream.
+ *
+ * @param	Ctx is the stream
+ * @param	Data is the address of the blocks
+ * @param	Blocks is the number of blocks
+ *
+ ******************************************************************************/
+static void XSecure_SoftShaBlocks(XSecure_SoftShaCtx *Ctx, const u8 *Data,
+	u32 Blocks)
+{
+	const XSecure_SoftShaKernel *Kernel = XSecure_SoftShaSelectKernel();
+
+	if ((Ctx->Mode == XSECURE_SOFTSHA_SHA2_384) ||
+		(Ctx->Mode == XSECURE_SOFTSHA_SHA2_512)) {
+		Kernel->Sha512Blocks(Ctx->State, Data, Blocks);
+	}
+	else {
+		Kernel->KeccakAbsorb(Ctx->State, Data, Blocks, Ctx->BlockSize);
+	}
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function selects the kernel of the software SHA. It is
+ *		meant for benchmarks and tests; by default the fastest kernel
+ *		the CPU supports is used.
+ *
+ * @param	Kernel is the kernel to use
+ *
+ * @return
+ *		- XST_SUCCESS if the kernel is selected
+ *		- XST_INVALID_PARAM if the kernel is not supported by this
+ *		build or the CPU
+ *
+ ******************************************************************************/
+int XSecure_SoftShaSetKernel(XSecure_SoftShaKernelType Kernel)
+{
+	int Status = XST_INVALID_PARAM;
+
+	if (Kernel == XSECURE_SOFTSHA_KERNEL_AUTO) {
+		KernelPtr = NULL;
+		(void)XSecure_SoftShaSelectKernel();
+		Status = XST_SUCCESS;
+	}
+	else if (Kernel == XSECURE_SOFTSHA_KERNEL_SCALAR) {
+		KernelPtr = &ScalarKernel;
+		Status = XST_SUCCESS;
+	}
+#ifdef XSECURE_SOFTSHA_CE
+	else if ((Kernel == XSECURE_SOFTSHA_KERNEL_CE) &&
+		(XSecure_SoftShaCpuHasCe() == (u32)TRUE)) {
+		KernelPtr = &CeKernel;
+		Status = XST_SUCCESS;
+	}
+#endif
+	else {
+		/* Kernel not available */
+	}
+
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function returns the kernel of the software SHA.
+ *
+ * @return
+ *		- XSECURE_SOFTSHA_KERNEL_SCALAR or XSECURE_SOFTSHA_KERNEL_CE
+ *
+ ******************************************************************************/
+XSecure_SoftShaKernelType XSecure_SoftShaGetKernel(void)
+{
+	XSecure_SoftShaKernelType Kernel = XSECURE_SOFTSHA_KERNEL_SCALAR;
+
+#ifdef XSECURE_SOFTSHA_CE
+	if (XSecure_SoftShaSelectKernel() == &CeKernel) {
+		Kernel = XSECURE_SOFTSHA_KERNEL_CE;
+	}
+#endif
+
+	return Kernel;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function starts a software SHA stream.
+ *
+ * @param	Ctx is the stream
+ * @param	Mode is the SHA mode
+ *
+ * @return
+ *		- XST_SUCCESS on success
+ *		- XST_INVALID_PARAM on invalid parameter
+ *
+ ******************************************************************************/
+int XSecure_SoftShaStart(XSecure_SoftShaCtx *Ctx, XSecure_SoftShaMode Mode)
+{
+	int Status = XST_INVALID_PARAM;
+	const u64 *Iv = NULL;
+	u32 Index;
+
+	if (Ctx == NULL) {
+		goto END;
+	}
+
+	switch (Mode) {
+	case XSECURE_SOFTSHA_SHA2_384:
+		Iv = Sha384Iv;
+		Ctx->BlockSize = XSECURE_SOFTSHA_SHA2_BLOCK_SIZE;
+		Ctx->DigestSize = 48U;
+		break;
+	case XSECURE_SOFTSHA_SHA2_512:
+		Iv = Sha512Iv;
+		Ctx->BlockSize = XSECURE_SOFTSHA_SHA2_BLOCK_SIZE;
+		Ctx->DigestSize = 64U;
+		break;
+	case XSECURE_SOFTSHA_SHA3_256:
+		Ctx->DigestSize = 32U;
+		break;
+	case XSECURE_SOFTSHA_SHA3_384:
+		Ctx->DigestSize = 48U;
+		break;
+	case XSECURE_SOFTSHA_SHA3_512:
+		Ctx->DigestSize = 64U;
+		break;
+	default:
+		goto END;
+	}
+
+	for (Index = 0U; Index < XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS; Index++) {
+		Ctx->State[Index] = ((Iv != NULL) && (Index < 8U)) ? Iv[Index] : 0U;
+	}
+	if (Iv == NULL) {
+		/* Rate of the SHA3 sponge, capacity is twice the digest */
+		Ctx->BlockSize = (XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS * 8U) -
+			(2U * Ctx->DigestSize);
+	}
+	Ctx->Mode = Mode;
+	Ctx->Len = 0U;
+	Ctx->BufLen = 0U;
+	Ctx->IsStarted = (u32)TRUE;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function hashes data of a software SHA stream. Whole
+ *		blocks are hashed from the data in place, only a partial
+ *		block is copied to the stream.
+ *
+ * @param	Ctx is the stream
+ * @param	Data is the address of the data
+ * @param	Size is the size of the data in bytes
+ *
+ * @return
+ *		- XST_SUCCESS on success
+ *		- XST_INVALID_PARAM on invalid parameter or a stream that
+ *		is not started
+ *
+ ******************************************************************************/
+int XSecure_SoftShaUpdate(XSecure_SoftShaCtx *Ctx, const u8 *Data, u32 Size)
+{
+	int Status = XST_INVALID_PARAM;
+	const u8 *Src = Data;
+	u32 Len = Size;
+	u32 Fill;
+	u32 Blocks;
+
+	if ((Ctx == NULL) || (Ctx->IsStarted != (u32)TRUE) ||
+		((Data == NULL) && (Size != 0U))) {
+		goto END;
+	}
+
+	Ctx->Len += Len;
+	if (Ctx->BufLen > 0U) {
+		Fill = Ctx->BlockSize - Ctx->BufLen;
+		if (Fill > Len) {
+			Fill = Len;
+		}
+		(void)Xil_SMemCpy(&Ctx->Buf[Ctx->BufLen], Fill, Src, Fill, Fill);
+		Ctx->BufLen += Fill;
+		Src = &Src[Fill];
+		Len -= Fill;
+		if (Ctx->BufLen < Ctx->BlockSize) {
+			Status = XST_SUCCESS;
+			goto END;
+		}
+		XSecure_SoftShaBlocks(Ctx, Ctx->Buf, 1U);
+		Ctx->BufLen = 0U;
+	}
+
+	Blocks = Len / Ctx->BlockSize;
+	if (Blocks > 0U) {
+		XSecure_SoftShaBlocks(Ctx, Src, Blocks);
+		Src = &Src[Blocks * Ctx->BlockSize];
+		Len -= Blocks * Ctx->BlockSize;
+	}
+
+	if (Len > 0U) {
+		(void)Xil_SMemCpy(Ctx->Buf, sizeof(Ctx->Buf), Src, Len, Len);
+		Ctx->BufLen = Len;
+	}
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function pads the last block of a software SHA stream and
+ *		reads out the digest. The stream is cleared afterwards.
+ *
+ * @param	Ctx is the stream
+ * @param	Hash is the buffer for the digest
+ * @param	HashBufSize is the size of Hash in bytes
+ *
+ * @return
+ *		- XST_SUCCESS on success
+ *		- XST_INVALID_PARAM on invalid parameter, a stream that is not
+ *		started or a buffer smaller than the digest
+ *
+ ******************************************************************************/
+int XSecure_SoftShaFinish(XSecure_SoftShaCtx *Ctx, u8 *Hash, u32 HashBufSize)
+{
+	int Status = XST_INVALID_PARAM;
+	u32 Index;
+	u64 BitLen;
+
+	if ((Ctx == NULL) || (Hash == NULL) || (Ctx->IsStarted != (u32)TRUE) ||
+		(HashBufSize < Ctx->DigestSize)) {
+		goto END;
+	}
+
+	if ((Ctx->Mode == XSECURE_SOFTSHA_SHA2_384) ||
+		(Ctx->Mode == XSECURE_SOFTSHA_SHA2_512)) {
+		/* 0x80, zeros and the 128-bit big endian length in bits */
+		Ctx->Buf[Ctx->BufLen] = XSECURE_SOFTSHA_PAD_END;
+		++Ctx->BufLen;
+		(void)Xil_SMemSet(&Ctx->Buf[Ctx->BufLen],
+			Ctx->BlockSize - Ctx->BufLen, 0U,
+			Ctx->BlockSize - Ctx->BufLen);
+		if (Ctx->BufLen > (Ctx->BlockSize - XSECURE_SOFTSHA_SHA2_LEN_SIZE)) {
+			XSecure_SoftShaBlocks(Ctx, Ctx->Buf, 1U);
+			(void)Xil_SMemSet(Ctx->Buf, Ctx->BlockSize, 0U,
+				Ctx->BlockSize);
+		}
+		BitLen = Ctx->Len << 3U;
+		Ctx->Buf[Ctx->BlockSize - 9U] = (u8)(Ctx->Len >> 61U);
+		for (Index = 0U; Index < 8U; Index++) {
+			Ctx->Buf[Ctx->BlockSize - 1U - Index] = (u8)(BitLen >> (Index * 8U));
+		}
+		XSecure_SoftShaBlocks(Ctx, Ctx->Buf, 1U);
+		for (Index = 0U; Index < Ctx->DigestSize; Index++) {
+			Hash[Index] = (u8)(Ctx->State[Index / 8U] >>
+				(56U - ((Index % 8U) * 8U)));
+		}
+	}
+	else {
+		/* SHA3 padding, 01 domain bits then 10*1 */
+		(void)Xil_SMemSet(&Ctx->Buf[Ctx->BufLen],
+			Ctx->BlockSize - Ctx->BufLen, 0U,
+			Ctx->BlockSize - Ctx->BufLen);
+		Ctx->Buf[Ctx->BufLen] = XSECURE_SOFTSHA_SHA3_PAD;
+		Ctx->Buf[Ctx->BlockSize - 1U] |= XSECURE_SOFTSHA_PAD_END;
+		XSecure_SoftShaBlocks(Ctx, Ctx->Buf, 1U);
+		for (Index = 0U; Index < Ctx->DigestSize; Index++) {
+			Hash[Index] = (u8)(Ctx->State[Index / 8U] >>
+				((Index % 8U) * 8U));
+		}
+	}
+	(void)Xil_SecureZeroize((u8 *)Ctx, sizeof(*Ctx));
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function calculates the digest of data with the software
+ *		SHA.
+ *
+ * @param	Mode is the SHA mode
+ * @param	Data is the address of the data
+ * @param	Size is the size of the data in bytes
+ * @param	Hash is the buffer for the digest
+ * @param	HashBufSize is the size of Hash in bytes
+ *
+ * @return
+ *		- XST_SUCCESS on success
+ *		- XST_INVALID_PARAM on invalid parameter
+ *
+ ******************************************************************************/
+int XSecure_SoftShaDigest(XSecure_SoftShaMode Mode, const u8 *Data, u32 Size,
+	u8 *Hash, u32 HashBufSize)
+{
+	int Status = XST_INVALID_PARAM;
+	XSecure_SoftShaCtx Ctx;
+
+	Status = XSecure_SoftShaStart(&Ctx, Mode);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XSecure_SoftShaUpdate(&Ctx, Data, Size);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XSecure_SoftShaFinish(&Ctx, Hash, HashBufSize);
+
+END:
+	(void)Xil_SecureZeroize((u8 *)&Ctx, sizeof(Ctx));
+	return Status;
+}
+/** @} */
@@ -0,0 +1,94 @@
+/******************************************************************************
+* Copyright (c) 2026 Advanced Micro Devices, Inc. All Rights Reserved.
+* SPDX-License-Identifier: MIT
+******************************************************************************/
+
+/*****************************************************************************/
+/**
+*
+* @file xsecure_softsha.h
+*
+* This file contains the declarations of the software SHA2-384/512 and
+* SHA3-256/384/512 implementation. It is used where the SHA engines are not
+* available or are in use by another stream, and on the application
+* processors where hashing a short message on the CPU is faster than an IPI
+* round trip to the PLM.
+*
+* <pre>
+* MODIFICATION HISTORY:
+*
+* Ver   Who  Date     Changes
+* ----- ---- -------- -------------------------------------------------------
+* 5.5   sb   10/16/26 Initial release
+*
+* </pre>
+*
+******************************************************************************/
+/**
+* @addtogroup xsecure_common_apis Xilsecure Common Apis
+* @{
+*/
+#ifndef XSECURE_SOFTSHA_H
+#define XSECURE_SOFTSHA_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/***************************** Include Files *********************************/
+#include "xil_types.h"
+
+/************************** Constant Definitions *****************************/
+#define XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS	(25U)	/**< Keccak state,
+							  SHA2 uses the first 8 */
+#define XSECURE_SOFTSHA_MAX_BLOCK_SIZE		(136U)	/**< SHA3-256 rate in
+							  bytes */
+#define XSECURE_SOFTSHA_MAX_DIGEST_SIZE		(64U)	/**< SHA2-512 and
+							  SHA3-512 digest size */
+
+/**************************** Type Definitions *******************************/
+/** Modes of the software SHA */
+typedef enum {
+	XSECURE_SOFTSHA_SHA2_384 = 0,	/**< SHA2-384 */
+	XSECURE_SOFTSHA_SHA2_512,	/**< SHA2-512 */
+	XSECURE_SOFTSHA_SHA3_256,	/**< SHA3-256 */
+	XSECURE_SOFTSHA_SHA3_384,	/**< SHA3-384 */
+	XSECURE_SOFTSHA_SHA3_512,	/**< SHA3-512 */
+} XSecure_SoftShaMode;
+
+/** Kernels of the software SHA */
+typedef enum {
+	XSECURE_SOFTSHA_KERNEL_AUTO = 0,	/**< Fastest kernel the CPU
+						  supports */
+	XSECURE_SOFTSHA_KERNEL_SCALAR,		/**< 64-bit scalar code */
+	XSECURE_SOFTSHA_KERNEL_CE,		/**< AArch64 SHA512 and SHA3
+						  instructions */
+} XSecure_SoftShaKernelType;
+
+/** Software SHA stream */
+typedef struct {
+	u64 State[XSECURE_SOFTSHA_STATE_SIZE_IN_DWORDS];	/**< Hash state */
+	u8 Buf[XSECURE_SOFTSHA_MAX_BLOCK_SIZE];	/**< Partial block */
+	u64 Len;		/**< Bytes hashed so far */
+	u32 BufLen;		/**< Bytes in Buf */
+	u32 BlockSize;		/**< Block size or rate in bytes */
+	u32 DigestSize;		/**< Digest size in bytes */
+	XSecure_SoftShaMode Mode;	/**< Mode of the stream */
+	u32 IsStarted;		/**< Stream is started */
+} XSecure_SoftShaCtx;
+
+/************************** Function Prototypes ******************************/
+int XSecure_SoftShaStart(XSecure_SoftShaCtx *Ctx, XSecure_SoftShaMode Mode);
+int XSecure_SoftShaUpdate(XSecure_SoftShaCtx *Ctx, const u8 *Data, u32 Size);
+int XSecure_SoftShaFinish(XSecure_SoftShaCtx *Ctx, u8 *Hash, u32 HashBufSize);
+int XSecure_SoftShaDigest(XSecure_SoftShaMode Mode, const u8 *Data, u32 Size,
+	u8 *Hash, u32 HashBufSize);
+int XSecure_SoftShaSetKernel(XSecure_SoftShaKernelType Kernel);
+XSecure_SoftShaKernelType XSecure_SoftShaGetKernel(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* XSECURE_SOFTSHA_H */
+/** @} */
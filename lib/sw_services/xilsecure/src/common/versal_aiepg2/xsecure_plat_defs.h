@@ -17,6 +17,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.4   kal  07/24/24 Initial release
 *       sk   08/22/24 Added support for key transfer to ASU
+* 5.5   sb   10/16/26 Added XSECURE_API_AES_PERFORM_BATCH
 *
 * </pre>
 *
@@ -109,7 +110,8 @@ typedef enum {
 	XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY,/**< 37U */
 	XSECURE_API_SHA_INIT,
 	XSECURE_API_SHA_FINISH,
-	XSECURE_API_MAX,				/**< 39U */
+	XSECURE_API_AES_PERFORM_BATCH,		/**< 40U */
+	XSECURE_API_MAX,				/**< 41U */
 } XSecure_ApiId;
 
 /**< XilSecure KAT ids */
@@ -34,6 +34,7 @@
 *       kpt  05/26/24 Add support for RSA CRT and RRN operation
 *       kpt  06/13/24 Add support for XSECURE_API_RSA_RELEASE_KEY
 *       kpt  06/30/24 Updated version number
+* 5.5   sb   10/16/26 Added XSECURE_API_AES_PERFORM_BATCH
 *
 * </pre>
 *
@@ -115,7 +116,8 @@ typedef enum {
 	XSECURE_API_RESERVED, /**< 36U */
 	XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY,/**< 37U */
 	XSECURE_API_RSA_RELEASE_KEY,/**< 38U */
-	XSECURE_API_MAX,				/**< 39U */
+	XSECURE_API_AES_PERFORM_BATCH,		/**< 39U */
+	XSECURE_API_MAX,				/**< 40U */
 } XSecure_ApiId;
 
 /**< XilSecure KAT ids */
@@ -42,6 +42,7 @@
 *       ma    09/17/24   Replaced XPlmi_MemCpy64 with XSecure_MemCpy64 in
 *                        XSecure_AesEncUpdate and XSecure_AesDecUpdate
 *       tri   10/08/24   Configure DmaSwap before transferring IV to AES engine
+* 5.5   sb    10/16/26   Added XSecure_AesPerformBatch for AES-GCM batches
 *
 * </pre>
 *
@@ -70,6 +71,8 @@
 			/**< Key Size mask */
 #define XSECURE_PMCDMA_DEVICEID		(PMCDMA_0_DEVICE_ID)
 			/**< AES destination key source mask for KEK decryption */
+#define XSECURE_AES_BATCH_CHUNK_ENTRIES	(8U)
+			/**< Batch entries copied to PMC RAM at a time */
 
 /************************** Function Prototypes *****************************/
 static int XSecure_AesOperationInit(u32 SrcAddrLow, u32 SrcAddrHigh);
@@ -86,6 +89,9 @@ static int XSecure_IsKeySrcValid(u32 KeySrc);
 static int XSecure_AesIsDataContextLost(void);
 static void XSecure_MakeAesFree(void);
 static int XSecure_AesConfig(u32 OperationId, u32 KeySrc, u32 KeySize, u64 IvAddr);
+static int XSecure_AesPerformBatch(u32 SrcAddrLow, u32 SrcAddrHigh);
+static int XSecure_AesBatchEntryOp(u32 OperationId,
+	const XSecure_AesBatchEntry *Entry);
 /*****************************************************************************/
 /**
  * @brief	This function calls respective IPI handler based on the API_ID
@@ -179,6 +185,10 @@ int XSecure_AesIpiHandler(XPlmi_Cmd *Cmd)
 		/**   - @ref XSecure_AesPerformOperation */
 		Status = XSecure_AesPerformOperation(Pload[0], Pload[1]);
 		break;
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
+		/**   - @ref XSecure_AesPerformBatch */
+		Status = XSecure_AesPerformBatch(Pload[0], Pload[1]);
+		break;
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
 		Status = XST_INVALID_PARAM;
@@ -690,6 +700,151 @@ END:
 	return Status;
 }
 
+/*****************************************************************************/
+/**
+ * @brief	This function handler encrypts or decrypts a list of AES-GCM
+ *		messages in one request. The entries are copied to PMC RAM
+ *		XSECURE_AES_BATCH_CHUNK_ENTRIES at a time and processed in
+ *		order. The key of every entry is loaded and cleared as for a
+ *		single message. A failing entry does not stop the batch; the
+ *		status of every entry is written back to its Status field.
+ *
+ * @param	SrcAddrLow	Lower 32 bit address of the XSecure_AesBatchParams
+ * 				structure.
+ * @param	SrcAddrHigh	Higher 32 bit address of the XSecure_AesBatchParams
+ * 				structure.
+ *
+ * @return
+ *		 - XST_SUCCESS  If all the entries are successful
+ *		 - XSECURE_AES_INVALID_PARAM  On invalid parameter
+ *		 - ErrorCode  Status of the first failing entry, or the error
+ *		of copying the entries
+ *
+ ******************************************************************************/
+static int XSecure_AesPerformBatch(u32 SrcAddrLow, u32 SrcAddrHigh)
+{
+	volatile int Status = XST_FAILURE;
+	int BatchStatus = XST_SUCCESS;
+	u64 Addr = ((u64)SrcAddrHigh << 32U) | (u64)SrcAddrLow;
+	u64 EntryAddr;
+	u32 Index = 0U;
+	u32 Idx;
+	u32 Cnt;
+	XSecure_AesBatchParams BatchParams;
+	XSecure_AesBatchEntry Entry[XSECURE_AES_BATCH_CHUNK_ENTRIES];
+	XSecure_Aes *XSecureAesInstPtr = XSecure_GetAesInstance();
+
+	Status = XPlmi_MemCpy64((u64)(UINTPTR)&BatchParams, Addr,
+		sizeof(BatchParams));
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if ((BatchParams.EntryAddr == 0U) || (BatchParams.EntryCnt == 0U) ||
+		((BatchParams.OperationId != (u32)XSECURE_ENCRYPT) &&
+		(BatchParams.OperationId != (u32)XSECURE_DECRYPT))) {
+		Status = (int)XSECURE_AES_INVALID_PARAM;
+		goto END;
+	}
+
+	if (XSecureAesInstPtr->AesState == XSECURE_AES_UNINITIALIZED) {
+		Status = XSecure_AesInit();
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	while (Index < BatchParams.EntryCnt) {
+		Cnt = BatchParams.EntryCnt - Index;
+		if (Cnt > XSECURE_AES_BATCH_CHUNK_ENTRIES) {
+			Cnt = XSECURE_AES_BATCH_CHUNK_ENTRIES;
+		}
+		EntryAddr = BatchParams.EntryAddr +
+			((u64)Index * sizeof(XSecure_AesBatchEntry));
+
+		Status = XPlmi_MemCpy64((u64)(UINTPTR)Entry, EntryAddr,
+			Cnt * sizeof(XSecure_AesBatchEntry));
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+
+		for (Idx = 0U; Idx < Cnt; Idx++) {
+			Entry[Idx].Status = (u32)XSecure_AesBatchEntryOp(
+				BatchParams.OperationId, &Entry[Idx]);
+			if ((Entry[Idx].Status != (u32)XST_SUCCESS) &&
+				(BatchStatus == XST_SUCCESS)) {
+				BatchStatus = (int)Entry[Idx].Status;
+			}
+		}
+
+		/** Write the status of the entries back */
+		Status = XPlmi_MemCpy64(EntryAddr, (u64)(UINTPTR)Entry,
+			Cnt * sizeof(XSecure_AesBatchEntry));
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Index += Cnt;
+	}
+	Status = BatchStatus;
+
+END:
+	if (Status != XST_SUCCESS) {
+		XSecure_MakeAesFree();
+	}
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief	This function encrypts or decrypts one message of a batch and
+ *		generates or verifies its GCM tag.
+ *
+ * @param	OperationId	Decides whether operation is encryption/decryption
+ * @param	Entry		Pointer to the batch entry of the message
+ *
+ * @return
+ *		 - XST_SUCCESS  If the message is processed successfully
+ *		 - ErrorCode  On failure
+ *
+ ******************************************************************************/
+static int XSecure_AesBatchEntryOp(u32 OperationId,
+	const XSecure_AesBatchEntry *Entry)
+{
+	volatile int Status = XST_FAILURE;
+	XSecure_Aes *XSecureAesInstPtr = XSecure_GetAesInstance();
+
+	/** Validate key source and initialise AES to encryption/decryption */
+	Status = XSecure_AesConfig(OperationId, Entry->KeySrc, Entry->KeySize,
+		Entry->IvAddr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+
+	if (Entry->AadSize != 0U) {
+		Status = XST_FAILURE;
+		Status = XSecure_AesUpdateAad(XSecureAesInstPtr, Entry->AadAddr,
+			Entry->AadSize);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+	}
+
+	Status = XST_FAILURE;
+	if (OperationId == (u32)XSECURE_ENCRYPT) {
+		Status = XSecure_AesEncryptData(XSecureAesInstPtr,
+			Entry->InDataAddr, Entry->OutDataAddr, Entry->Size,
+			Entry->GcmTagAddr);
+	}
+	else {
+		Status = XSecure_AesDecryptData(XSecureAesInstPtr,
+			Entry->InDataAddr, Entry->OutDataAddr, Entry->Size,
+			Entry->GcmTagAddr);
+	}
+
+END:
+	return Status;
+}
+
 /*****************************************************************************/
 /**
  * @brief	This function checks for valid KeySrc
@@ -19,6 +19,11 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.4   kal  07/24/24 Initial release
 *       tri  10/07/24 Added easier approach to enable SHA2 Crypto engine in PMC
+*       sb   10/16/26 Added per client SHA contexts and software continuation
+*                     of SHA2-384 streams when the engine is in use
+*       sb   10/16/26 Continue SHA2-384/512 and SHA3-256/384/512 streams
+*                     with the software SHA of xilsecure
+*       sb   10/16/26 Take the engines per update and evict idle streams
 *
 * </pre>
 *
@@ -36,17 +41,73 @@
 #include "xsecure_error.h"
 #include "xplmi_hw.h"
 #include "xplmi.h"
+#include "xplmi_proc.h"
+#include "xsecure_softsha.h"
 
 /************************** Constant Definitions *****************************/
+#define XSECURE_SHA_MAX_CTX		(4U)	/**< Maximum concurrent SHA
+						  streams */
+#define XSECURE_SHA_SW_CHUNK_SIZE	(1024U)	/**< Bytes copied per software
+						  hash step */
+#define XSECURE_SHA_IDLE_TIMEOUT_MS	(1000U)	/**< Time without a command
+						  after which a stream can be
+						  evicted */
 
-static XSecure_Sha *XSecureShaInstPtr = NULL;
+#define XSECURE_SHA_CTX_PENDING		(0U)	/**< No data hashed yet */
+#define XSECURE_SHA_CTX_ENGINE		(1U)	/**< Hashed on the engine */
+#define XSECURE_SHA_CTX_SOFTWARE	(2U)	/**< Hashed in software */
+#define XSECURE_SHA_CTX_DONE		(3U)	/**< Hash is ready */
+
+/**************************** Type Definitions *******************************/
+/**
+ * SHA stream of one IPI client. The engines have no registers to save and
+ * restore an intermediate hash state, so an engine is taken only when a
+ * stream sends its data:
+ * - A stream sent in a single last update is hashed on the engine of its
+ *   mode within that update, and the engine is released before the update
+ *   returns.
+ * - A stream sent in several updates owns the engine from its first update
+ *   to SHA_FINISH. If the engine is owned by another stream, it is hashed in
+ *   software instead. Its state stays in its context between updates.
+ * - A stream that sends no command for XSECURE_SHA_IDLE_TIMEOUT_MS is
+ *   evicted when its engine or context is needed by another client.
+ */
+typedef struct {
+	u32 IsUsed;		/**< Context holds a stream */
+	u32 IpiMask;		/**< Client of the stream */
+	u32 ShaMode;		/**< SHA mode of the stream */
+	u32 State;		/**< Pending, engine, software or done */
+	XSecure_Sha *ShaInstPtr;	/**< Engine of the mode of the stream */
+	u32 IsLastUpdate;	/**< Last update of the stream is done */
+	u64 LastUseMs;		/**< Time of the last command of the stream */
+	XSecure_Sha3Hash Hash;	/**< Hash of a stream in done state */
+	u32 HashSize;		/**< Size of Hash in bytes */
+	XSecure_SoftShaCtx SwCtx;	/**< Software SHA state */
+} XSecure_ShaIpiCtx;
 
 /************************** Function Prototypes *****************************/
 
-static int XSecure_ShaModeInit(u32 ShaMode);
-static int XSecure_ShaModeUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
-	u32 EndLast);
-static int XSecure_ShaModeFinish(u32 OutAddrLow, u32 OutAddrHigh, u32 HashSize);
+static u64 XSecure_ShaGetTimeMs(void);
+static XSecure_ShaIpiCtx *XSecure_ShaGetCtx(u32 IpiMask);
+static XSecure_ShaIpiCtx *XSecure_ShaGetFreeCtx(void);
+static void XSecure_ShaFreeCtx(XSecure_ShaIpiCtx *Ctx);
+static u32 XSecure_ShaIsIdle(const XSecure_ShaIpiCtx *Ctx);
+static u32 XSecure_ShaIsEngineFree(const XSecure_Sha *ShaInstPtr);
+static int XSecure_ShaEngineDigest(XSecure_ShaIpiCtx *Ctx, u64 DataAddr,
+	u32 Size);
+static int XSecure_ShaSwStart(XSecure_ShaIpiCtx *Ctx, u32 ShaMode);
+static int XSecure_ShaSwUpdate(XSecure_ShaIpiCtx *Ctx, u64 DataAddr, u32 Size);
+static int XSecure_ShaModeInit(u32 IpiMask, u32 ShaMode);
+static int XSecure_ShaModeUpdate(u32 IpiMask, u32 SrcAddrLow, u32 SrcAddrHigh,
+	u32 Size, u32 EndLast);
+static int XSecure_ShaModeFinish(u32 IpiMask, u32 OutAddrLow, u32 OutAddrHigh,
+	u32 HashSize);
+
+/************************** Variable Definitions *****************************/
+static XSecure_ShaIpiCtx ShaIpiCtx[XSECURE_SHA_MAX_CTX];
+
+/** Buffer the data of software hashed streams is copied to */
+static u8 ShaSwBuf[XSECURE_SHA_SW_CHUNK_SIZE] __attribute__ ((aligned(4U)));
 
 /*************************** Function Definitions *****************************/
 
@@ -75,13 +136,15 @@ int XSecure_ShaIpiHandler(XPlmi_Cmd *Cmd)
 
 	switch (Cmd->CmdId & XSECURE_API_ID_MASK) {
         case XSECURE_API(XSECURE_API_SHA_INIT):
-		Status = XSecure_ShaModeInit(Pload[0U]);
+		Status = XSecure_ShaModeInit(Cmd->IpiMask, Pload[0U]);
 		break;
 	case XSECURE_API(XSECURE_API_SHA_UPDATE):
-		Status = XSecure_ShaModeUpdate(Pload[0U], Pload[1U], Pload[2U], Pload[3U]);
+		Status = XSecure_ShaModeUpdate(Cmd->IpiMask, Pload[0U], Pload[1U],
+			Pload[2U], Pload[3U]);
 		break;
 	case XSECURE_API(XSECURE_API_SHA_FINISH):
-		Status = XSecure_ShaModeFinish(Pload[0U], Pload[1U], Pload[2U]);
+		Status = XSecure_ShaModeFinish(Cmd->IpiMask, Pload[0U], Pload[1U],
+			Pload[2U]);
 		break;
 	default:
 		XSecure_Printf(XSECURE_DEBUG_GENERAL, "CMD: INVALID PARAM\r\n");
@@ -94,109 +157,522 @@ END:
 
 /*****************************************************************************/
 /**
- * @brief       This function initializes SHA3 instance.
+ * @brief       This function returns the time since the PLM started.
+ *
+ * @return
+ *	-	Time in milliseconds
+ *
+ ******************************************************************************/
+static u64 XSecure_ShaGetTimeMs(void)
+{
+	XPlmi_PerfTime PerfTime;
+
+	XPlmi_MeasurePerfTime((XPLMI_PIT1_CYCLE_VALUE << 32U) |
+		XPLMI_PIT2_CYCLE_VALUE, &PerfTime);
+
+	return PerfTime.TPerfMs;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function returns the SHA stream of an IPI client.
+ *
+ * @param	IpiMask is the IPI mask of the client
+ *
+ * @return
+ *	-	Pointer to the context of the stream, NULL if the client has none
+ *
+ ******************************************************************************/
+static XSecure_ShaIpiCtx *XSecure_ShaGetCtx(u32 IpiMask)
+{
+	XSecure_ShaIpiCtx *Ctx = NULL;
+	u32 Index;
+
+	for (Index = 0U; Index < XSECURE_SHA_MAX_CTX; Index++) {
+		if ((ShaIpiCtx[Index].IsUsed == (u32)TRUE) &&
+			(ShaIpiCtx[Index].IpiMask == IpiMask)) {
+			Ctx = &ShaIpiCtx[Index];
+			break;
+		}
+	}
+
+	return Ctx;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function returns an unused SHA stream context. If all
+ *		contexts are in use, the least recently used stream is evicted
+ *		if it is idle.
+ *
+ * @return
+ *	-	Pointer to the context, NULL if all contexts are in use
+ *
+ ******************************************************************************/
+static XSecure_ShaIpiCtx *XSecure_ShaGetFreeCtx(void)
+{
+	XSecure_ShaIpiCtx *Ctx = NULL;
+	XSecure_ShaIpiCtx *LruCtx = NULL;
+	u32 Index;
+
+	for (Index = 0U; Index < XSECURE_SHA_MAX_CTX; Index++) {
+		if (ShaIpiCtx[Index].IsUsed != (u32)TRUE) {
+			Ctx = &ShaIpiCtx[Index];
+			goto END;
+		}
+		if ((LruCtx == NULL) ||
+			(ShaIpiCtx[Index].LastUseMs < LruCtx->LastUseMs)) {
+			LruCtx = &ShaIpiCtx[Index];
+		}
+	}
+
+	if ((LruCtx != NULL) && (XSecure_ShaIsIdle(LruCtx) == (u32)TRUE)) {
+		XSecure_Printf(XSECURE_DEBUG_GENERAL, "SHA stream of IPI mask "
+			"0x%x evicted\r\n", LruCtx->IpiMask);
+		XSecure_ShaFreeCtx(LruCtx);
+		Ctx = LruCtx;
+	}
+
+END:
+	return Ctx;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function ends a SHA stream. The engine of the stream, if
+ *		it owns one, is placed in reset and becomes available to other
+ *		streams.
+ *
+ * @param	Ctx is the context of the stream
+ *
+ ******************************************************************************/
+static void XSecure_ShaFreeCtx(XSecure_ShaIpiCtx *Ctx)
+{
+	if (Ctx->State == XSECURE_SHA_CTX_ENGINE) {
+		XSecure_SetReset(Ctx->ShaInstPtr->BaseAddress,
+			XSECURE_SHA_RESET_OFFSET);
+		Ctx->ShaInstPtr->ShaState = XSECURE_SHA_INITIALIZED;
+	}
+	(void)Xil_SMemSet(&Ctx->SwCtx, sizeof(Ctx->SwCtx), 0U,
+		sizeof(Ctx->SwCtx));
+	(void)Xil_SMemSet(&Ctx->Hash, sizeof(Ctx->Hash), 0U,
+		sizeof(Ctx->Hash));
+	Ctx->ShaInstPtr = NULL;
+	Ctx->State = XSECURE_SHA_CTX_PENDING;
+	Ctx->IsLastUpdate = (u32)FALSE;
+	Ctx->IsUsed = (u32)FALSE;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function checks whether a SHA stream has sent no command
+ *		for XSECURE_SHA_IDLE_TIMEOUT_MS.
+ *
+ * @param	Ctx is the context of the stream
+ *
+ * @return
+ *	-	TRUE if the stream is idle, FALSE otherwise
+ *
+ ******************************************************************************/
+static u32 XSecure_ShaIsIdle(const XSecure_ShaIpiCtx *Ctx)
+{
+	u32 IsIdle = (u32)FALSE;
+
+	if ((XSecure_ShaGetTimeMs() - Ctx->LastUseMs) >=
+		XSECURE_SHA_IDLE_TIMEOUT_MS) {
+		IsIdle = (u32)TRUE;
+	}
+
+	return IsIdle;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function checks whether an engine can be taken by a SHA
+ *		stream. An idle stream owning the engine is evicted.
+ *
+ * @param	ShaInstPtr is the SHA instance of the engine
+ *
+ * @return
+ *	-	TRUE if the engine is free, FALSE if an active stream owns it
+ *
+ ******************************************************************************/
+static u32 XSecure_ShaIsEngineFree(const XSecure_Sha *ShaInstPtr)
+{
+	u32 IsFree = (u32)TRUE;
+	u32 Index;
+
+	for (Index = 0U; Index < XSECURE_SHA_MAX_CTX; Index++) {
+		if ((ShaIpiCtx[Index].IsUsed != (u32)TRUE) ||
+			(ShaIpiCtx[Index].State != XSECURE_SHA_CTX_ENGINE) ||
+			(ShaIpiCtx[Index].ShaInstPtr != ShaInstPtr)) {
+			continue;
+		}
+		if (XSecure_ShaIsIdle(&ShaIpiCtx[Index]) == (u32)TRUE) {
+			XSecure_Printf(XSECURE_DEBUG_GENERAL, "SHA stream of IPI "
+				"mask 0x%x evicted\r\n", ShaIpiCtx[Index].IpiMask);
+			XSecure_ShaFreeCtx(&ShaIpiCtx[Index]);
+		}
+		else {
+			IsFree = (u32)FALSE;
+		}
+		break;
+	}
+
+	return IsFree;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function starts a SHA stream for an IPI client. A stream
+ *		the client already has is dropped. The engine is not taken
+ *		until the stream sends its data.
+ *
+ * @param	IpiMask is the IPI mask of the client
+ * @param	ShaMode is the SHA mode of the stream
  *
  * @return
  *	-	XST_SUCCESS - If the initialization is successful
+ *	-	XST_DEVICE_BUSY - If no context is available
  *	-	ErrorCode - If there is a failure
  *
  ******************************************************************************/
-static int XSecure_ShaModeInit(u32 ShaMode)
+static int XSecure_ShaModeInit(u32 IpiMask, u32 ShaMode)
 {
 	int Status = XST_FAILURE;
 	XPmcDma *PmcDmaInstPtr = XPlmi_GetDmaInstance(PMCDMA_0_DEVICE);
+	XSecure_Sha *ShaInstPtr = NULL;
+	XSecure_ShaIpiCtx *Ctx;
 
 	if ((ShaMode  == XSECURE_SHA3_384) || (ShaMode  == XSECURE_SHAKE_256) ||
 	    (ShaMode == XSECURE_SHA3_256) || (ShaMode  == XSECURE_SHA3_512)) {
-		XSecureShaInstPtr = XSecure_GetSha3Instance(XSECURE_SHA_0_DEVICE_ID);
+		ShaInstPtr = XSecure_GetSha3Instance(XSECURE_SHA_0_DEVICE_ID);
 	}
 	else if ((ShaMode == XSECURE_SHA2_384) || (ShaMode == XSECURE_SHA2_256) ||
 		 (ShaMode == XSECURE_SHA2_512)) {
-		XSecureShaInstPtr = XSecure_GetSha2Instance(XSECURE_SHA_1_DEVICE_ID);
+		ShaInstPtr = XSecure_GetSha2Instance(XSECURE_SHA_1_DEVICE_ID);
 	}
 	else {
 		XSecure_Printf(DEBUG_PRINT_ALWAYS, "Invalid SHA mode\r\n");
 	}
 
-	if (NULL == PmcDmaInstPtr) {
+	if ((NULL == PmcDmaInstPtr) || (NULL == ShaInstPtr)) {
+		Status = (int)XSECURE_SHA_INVALID_PARAM;
 		goto END;
 	}
 
-	Status = XSecure_ShaInitialize(XSecureShaInstPtr, PmcDmaInstPtr);
+	/** Drop the current stream of the client, if any */
+	Ctx = XSecure_ShaGetCtx(IpiMask);
+	if (Ctx != NULL) {
+		XSecure_ShaFreeCtx(Ctx);
+	}
+	else {
+		Ctx = XSecure_ShaGetFreeCtx();
+		if (Ctx == NULL) {
+			Status = XST_DEVICE_BUSY;
+			goto END;
+		}
+	}
+
+	Ctx->IpiMask = IpiMask;
+	Ctx->ShaMode = ShaMode;
+	Ctx->ShaInstPtr = ShaInstPtr;
+	Ctx->State = XSECURE_SHA_CTX_PENDING;
+	Ctx->IsLastUpdate = (u32)FALSE;
+	Ctx->LastUseMs = XSecure_ShaGetTimeMs();
+	Ctx->IsUsed = (u32)TRUE;
+	Status = XST_SUCCESS;
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function hashes the data of a stream sent in a single
+ *		update on the engine of its mode, and releases the engine.
+ *
+ * @param	Ctx is the context of the stream
+ * @param	DataAddr is the address of the data
+ * @param	Size is the size of the data in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - If the hash is calculated
+ *	-	ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_ShaEngineDigest(XSecure_ShaIpiCtx *Ctx, u64 DataAddr,
+	u32 Size)
+{
+	int Status = XST_FAILURE;
+	XPmcDma *PmcDmaInstPtr = XPlmi_GetDmaInstance(PMCDMA_0_DEVICE);
+
+	Status = XSecure_ShaInitialize(Ctx->ShaInstPtr, PmcDmaInstPtr);
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	Status = XSecure_ShaDigest(Ctx->ShaInstPtr,
+		(XSecure_ShaMode)Ctx->ShaMode, DataAddr, Size,
+		(u64)(UINTPTR)Ctx->Hash.Hash, sizeof(Ctx->Hash.Hash));
+	Ctx->HashSize = Ctx->ShaInstPtr->ShaDigestSize;
+
+END:
+	XSecure_SetReset(Ctx->ShaInstPtr->BaseAddress,
+		XSECURE_SHA_RESET_OFFSET);
+	Ctx->ShaInstPtr->ShaState = XSECURE_SHA_INITIALIZED;
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function starts the software SHA stream of a context.
+ *
+ * @param	Ctx is the context of the stream
+ * @param	ShaMode is the SHA mode of the stream
+ *
+ * @return
+ *	-	XST_SUCCESS - If the stream is started
+ *	-	XST_DEVICE_BUSY - If the mode has no software implementation
+ *
+ ******************************************************************************/
+static int XSecure_ShaSwStart(XSecure_ShaIpiCtx *Ctx, u32 ShaMode)
+{
+	int Status = XST_FAILURE;
+	XSecure_SoftShaMode SwMode;
+
+	switch (ShaMode) {
+	case XSECURE_SHA2_384:
+		SwMode = XSECURE_SOFTSHA_SHA2_384;
+		break;
+	case XSECURE_SHA2_512:
+		SwMode = XSECURE_SOFTSHA_SHA2_512;
+		break;
+	case XSECURE_SHA3_256:
+		SwMode = XSECURE_SOFTSHA_SHA3_256;
+		break;
+	case XSECURE_SHA3_384:
+		SwMode = XSECURE_SOFTSHA_SHA3_384;
+		break;
+	case XSECURE_SHA3_512:
+		SwMode = XSECURE_SOFTSHA_SHA3_512;
+		break;
+	default:
+		Status = XST_DEVICE_BUSY;
+		goto END;
+	}
+
+	Status = XSecure_SoftShaStart(&Ctx->SwCtx, SwMode);
+
+END:
+	return Status;
+}
+
+/*****************************************************************************/
+/**
+ * @brief       This function hashes the data of a software SHA stream.
+ *		The data is copied to the PMC RAM in chunks of
+ *		XSECURE_SHA_SW_CHUNK_SIZE bytes.
+ *
+ * @param	Ctx is the context of the stream
+ * @param	DataAddr is the address of the data
+ * @param	Size is the size of the data in bytes
+ *
+ * @return
+ *	-	XST_SUCCESS - If the update is successful
+ *	-	ErrorCode - If there is a failure
+ *
+ ******************************************************************************/
+static int XSecure_ShaSwUpdate(XSecure_ShaIpiCtx *Ctx, u64 DataAddr, u32 Size)
+{
+	int Status = XST_FAILURE;
+	u32 Offset = 0U;
+	u32 Len;
+
+	Status = XSecure_ValidateShaDataSize(Size);
 	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_SHA_INVALID_PARAM;
 		goto END;
 	}
-	Status = XSecure_ShaStart(XSecureShaInstPtr, (XSecure_ShaMode)ShaMode);
+
+	while (Offset < Size) {
+		Len = Size - Offset;
+		if (Len > XSECURE_SHA_SW_CHUNK_SIZE) {
+			Len = XSECURE_SHA_SW_CHUNK_SIZE;
+		}
+		Status = XPlmi_MemCpy64((u64)(UINTPTR)ShaSwBuf, DataAddr + Offset,
+			Len);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Status = XSecure_SoftShaUpdate(&Ctx->SwCtx, ShaSwBuf, Len);
+		if (Status != XST_SUCCESS) {
+			goto END;
+		}
+		Offset += Len;
+	}
+	Status = XST_SUCCESS;
 
 END:
+	(void)Xil_SMemSet(ShaSwBuf, sizeof(ShaSwBuf), 0U, sizeof(ShaSwBuf));
 	return Status;
 }
 
 /*****************************************************************************/
 /**
- * @brief       This function handler calls XSecure_ShaUpdate64Bit or
- * 		XSecure_ShaFinish based on the Continue bit in the command
+ * @brief       This function handler updates the SHA stream of the client
+ *		with the data, as the last update if EndLast is set. The first
+ *		update of the stream picks where it is hashed.
  *
+ * @param	IpiMask		- IPI mask of the client
  * @param	SrcAddrLow	- Lower 32 bit address of the input data
  * 				on which hash has to be calculated
  * @param	SrcAddrHigh	- Higher 32 bit address of the input data
  * 				on which hash has to be calculated
  * @param	Size		- Size of the input data in bytes to be
  * 				updated
- * @param	DstAddrLow	- Lower 32 bit address of the output data
- * 				where hash to be stored
- * @param	DstAddrHigh	- Higher 32 bit address of the output data
- * 				where hash to be stored
+ * @param	EndLast		- TRUE if this is the last update
  *
  * @return
- *	-	XST_SUCCESS - If the sha update/fnish is successful
+ *	-	XST_SUCCESS - If the sha update is successful
+ *	-	XST_DEVICE_BUSY - If the engine is in use and the mode has no
+ *		software implementation, the stream is kept for a retry
  *	-	ErrorCode - If there is a failure
  *
  ******************************************************************************/
-static int XSecure_ShaModeUpdate(u32 SrcAddrLow, u32 SrcAddrHigh, u32 Size,
-				u32 EndLast)
+static int XSecure_ShaModeUpdate(u32 IpiMask, u32 SrcAddrLow, u32 SrcAddrHigh,
+	u32 Size, u32 EndLast)
 {
 	int Status = XST_FAILURE;
 	u64 DataAddr = ((u64)SrcAddrHigh << XSECURE_ADDR_HIGH_SHIFT) | (u64)SrcAddrLow;
+	XSecure_ShaIpiCtx *Ctx = XSecure_ShaGetCtx(IpiMask);
+	XPmcDma *PmcDmaInstPtr = XPlmi_GetDmaInstance(PMCDMA_0_DEVICE);
 
-	if (EndLast == TRUE) {
-		Status = XSecure_ShaLastUpdate(XSecureShaInstPtr);
-		if (Status != XST_SUCCESS) {
-			goto END;
+	if ((Ctx == NULL) || (Ctx->IsLastUpdate == (u32)TRUE)) {
+		Status = (int)XSECURE_SHA_STATE_MISMATCH_ERROR;
+		goto END;
+	}
+	Ctx->LastUseMs = XSecure_ShaGetTimeMs();
+
+	/** Pick the engine or software for the first update of the stream */
+	if (Ctx->State == XSECURE_SHA_CTX_PENDING) {
+		if (XSecure_ShaIsEngineFree(Ctx->ShaInstPtr) == (u32)TRUE) {
+			if (EndLast == TRUE) {
+				Status = XSecure_ShaEngineDigest(Ctx, DataAddr, Size);
+				if (Status == XST_SUCCESS) {
+					Ctx->State = XSECURE_SHA_CTX_DONE;
+					Ctx->IsLastUpdate = (u32)TRUE;
+				}
+				goto END;
+			}
+			Status = XSecure_ShaInitialize(Ctx->ShaInstPtr,
+				PmcDmaInstPtr);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			Status = XSecure_ShaStart(Ctx->ShaInstPtr,
+				(XSecure_ShaMode)Ctx->ShaMode);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			Ctx->State = XSECURE_SHA_CTX_ENGINE;
+		}
+		else {
+			/** Continue in software while another stream owns the engine */
+			Status = XSecure_ShaSwStart(Ctx, Ctx->ShaMode);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+			Ctx->State = XSECURE_SHA_CTX_SOFTWARE;
 		}
 	}
-	Status = XSecure_ShaUpdate(XSecureShaInstPtr, DataAddr, Size);
+
+	if (Ctx->State == XSECURE_SHA_CTX_ENGINE) {
+		if (EndLast == TRUE) {
+			Status = XSecure_ShaLastUpdate(Ctx->ShaInstPtr);
+			if (Status != XST_SUCCESS) {
+				goto END;
+			}
+		}
+		Status = XSecure_ShaUpdate(Ctx->ShaInstPtr, DataAddr, Size);
+	}
+	else {
+		Status = XSecure_ShaSwUpdate(Ctx, DataAddr, Size);
+	}
+	if (Status != XST_SUCCESS) {
+		goto END;
+	}
+	if (EndLast == TRUE) {
+		Ctx->IsLastUpdate = (u32)TRUE;
+	}
+
 END:
+	if ((Status != XST_SUCCESS) && (Status != XST_DEVICE_BUSY) &&
+		(Ctx != NULL)) {
+		XSecure_ShaFreeCtx(Ctx);
+	}
 	return Status;
 }
 
 /*****************************************************************************/
 /**
- * @brief       This function handler calls XSecure_ShaFinish function.
+ * @brief       This function handler ends the SHA stream of the client and
+ *		copies the hash to the output address.
  *
- * @param	HashSize	- Size of the input data in bytes to be
- * 				updated
- * @param	DstAddrLow	- Lower 32 bit address of the output data
+ * @param	IpiMask		- IPI mask of the client
+ * @param	OutAddrLow	- Lower 32 bit address of the output data
  * 				where hash to be stored
- * @param	DstAddrHigh	- Higher 32 bit address of the output data
+ * @param	OutAddrHigh	- Higher 32 bit address of the output data
  * 				where hash to be stored
+ * @param	HashSize	- Size of the hash buffer in bytes
  *
  * @return
- *	-	XST_SUCCESS - If the sha update/fnish is successful
+ *	-	XST_SUCCESS - If the sha finish is successful
  *	-	ErrorCode - If there is a failure
  *
  ******************************************************************************/
-static int XSecure_ShaModeFinish(u32 OutAddrLow, u32 OutAddrHigh, u32 HashSize)
+static int XSecure_ShaModeFinish(u32 IpiMask, u32 OutAddrLow, u32 OutAddrHigh,
+	u32 HashSize)
 {
 	int Status = XST_FAILURE;
 	u64 DstAddr = ((u64)OutAddrHigh << XSECURE_ADDR_HIGH_SHIFT) | (u64)OutAddrLow;
 	XSecure_Sha3Hash Hash = {0U};
+	XSecure_ShaIpiCtx *Ctx = XSecure_ShaGetCtx(IpiMask);
 
-	Status = XSecure_ShaFinish(XSecureShaInstPtr, (u64)(UINTPTR)&Hash, HashSize);
+	if (Ctx == NULL) {
+		Status = (int)XSECURE_SHA_STATE_MISMATCH_ERROR;
+		goto END;
+	}
+
+	if (Ctx->State == XSECURE_SHA_CTX_ENGINE) {
+		Status = XSecure_ShaFinish(Ctx->ShaInstPtr, (u64)(UINTPTR)&Hash,
+			HashSize);
+	}
+	else if (Ctx->IsLastUpdate != (u32)TRUE) {
+		Status = (int)XSECURE_SHA_STATE_MISMATCH_ERROR;
+	}
+	else if (Ctx->State == XSECURE_SHA_CTX_DONE) {
+		if (HashSize < Ctx->HashSize) {
+			Status = (int)XSECURE_SHA_INVALID_PARAM;
+		}
+		else {
+			Status = Xil_SMemCpy(Hash.Hash, sizeof(Hash.Hash),
+				Ctx->Hash.Hash, sizeof(Ctx->Hash.Hash),
+				sizeof(Ctx->Hash.Hash));
+		}
+	}
+	else if (HashSize < Ctx->SwCtx.DigestSize) {
+		Status = (int)XSECURE_SHA_INVALID_PARAM;
+	}
+	else {
+		Status = XSecure_SoftShaFinish(&Ctx->SwCtx, Hash.Hash,
+			sizeof(Hash.Hash));
+	}
+	XSecure_ShaFreeCtx(Ctx);
 	if (Status == XST_SUCCESS) {
 		Status = XPlmi_DmaXfr((u64)(UINTPTR)(Hash.Hash), DstAddr,
 				XSECURE_SHA3_HASH_LENGTH_IN_WORDS, XPLMI_PMCDMA_0);
 	}
 
+END:
 	return Status;
 }
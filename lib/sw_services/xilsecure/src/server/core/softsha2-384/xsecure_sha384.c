@@ -10,7 +10,8 @@
 * @file xsecure_sha384.c
 *
 * This file contains the implementation of the interface functions for SHA2-384
-* driver.
+* driver. The hash is calculated by the software SHA of xsecure_softsha.c, so
+* that it uses the kernel selected at run time for the processor.
 * <pre>
 * MODIFICATION HISTORY:
 *
@@ -19,6 +20,7 @@
 * 1.0   har  01/02/23 Initial release
 *       kal  19/05/23 Added Sha2 Start, Update and Finish APIs support
 *       dd   10/11/23 MISRA-C violation Rule 1.1 fixed
+* 5.5   sb   10/16/26 Use the software SHA of xsecure_softsha.c
 *
 * </pre>
 *
@@ -31,12 +33,12 @@
 #include "xstatus.h"
 #include "xsecure_error.h"
 #include "xsecure_sha384.h"
-#include "SoftSHA.h"
+#include "xsecure_softsha.h"
 
 /************************** Constant Definitions *****************************/
 
 /**************************** Type Definitions *******************************/
-sha384_context ShaCtx;
+static XSecure_SoftShaCtx ShaCtx;
 
 /************************** Function Prototypes ******************************/
 
@@ -63,9 +65,11 @@ int XSecure_Sha384Digest(u8* Data, u32 Size, u8* Hash)
 		goto END;
 	}
 
-	sha_384(Data, Size, Hash);
-
-	Status = XST_SUCCESS;
+	Status = XSecure_SoftShaDigest(XSECURE_SOFTSHA_SHA2_384, Data, Size,
+		Hash, XSECURE_HASH_SIZE_IN_BYTES);
+	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_SHA384_INVALID_PARAM;
+	}
 
 END:
 	return Status;
@@ -78,7 +82,7 @@ END:
  ******************************************************************************/
 void XSecure_Sha384Start(void)
 {
-	sha384_starts(&ShaCtx);
+	(void)XSecure_SoftShaStart(&ShaCtx, XSECURE_SOFTSHA_SHA2_384);
 }
 
 /*****************************************************************************/
@@ -103,9 +107,10 @@ int XSecure_Sha384Update(u8* Data, u32 Size)
 		goto END;
 	}
 
-	sha384_update(&ShaCtx, Data, Size);
-
-	Status = XST_SUCCESS;
+	Status = XSecure_SoftShaUpdate(&ShaCtx, Data, Size);
+	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_SHA384_INVALID_PARAM;
+	}
 
 END:
 	return Status;
@@ -132,9 +137,11 @@ int XSecure_Sha384Finish(XSecure_Sha2Hash *ResHash)
 		goto END;
 	}
 
-	sha384_finish(&ShaCtx, ResHash->Hash);
-
-	Status = XST_SUCCESS;
+	Status = XSecure_SoftShaFinish(&ShaCtx, ResHash->Hash,
+		XSECURE_HASH_SIZE_IN_BYTES);
+	if (Status != XST_SUCCESS) {
+		Status = (int)XSECURE_SHA384_INVALID_PARAM;
+	}
 
 END:
 	return Status;
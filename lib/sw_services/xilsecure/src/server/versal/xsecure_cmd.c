@@ -32,6 +32,7 @@
 *       bm   07/05/2023 Added crypto check in features command
 *       ng   07/05/2023 Added support for system device tree flow
 *       mb   07/31/2024 Added the check to validate Payload for NULL pointer
+* 5.5   sb   10/16/2026 Added XSECURE_API_AES_PERFORM_BATCH
 *
 * </pre>
 *
@@ -100,6 +101,7 @@ static XPlmi_AccessPerm_t XSecure_AccessPermBuff[XSECURE_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_SET_DPA_CM),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_KAT),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_OPERATION),
+	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_BATCH),
 };
 
 static XPlmi_Module XPlmi_Secure =
@@ -186,6 +188,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	case XSECURE_API(XSECURE_API_AES_SET_DPA_CM):
 	case XSECURE_API(XSECURE_API_KAT):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION):
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
 #endif
 		Status = XSecure_CryptoCheck();
 		if (Status != XST_SUCCESS) {
@@ -265,6 +268,7 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_AES_KEK_DECRYPT):
 	case XSECURE_API(XSECURE_API_AES_SET_DPA_CM):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION):
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
 		/**   - @ref XSecure_AesIpiHandler */
 		Status = XSecure_AesIpiHandler(Cmd);
 		break;
@@ -17,6 +17,7 @@
 * ----- ---- -------- -------------------------------------------------------
 * 5.4   kal  07/24/24 Initial release
 *       sk   08/22/24 Added support for key transfer to ASU
+* 5.5   sb   10/16/26 Added XSECURE_API_AES_PERFORM_BATCH
 *
 * </pre>
 *
@@ -88,6 +89,7 @@ static XPlmi_AccessPerm_t XSecure_AccessPermBuff[XSECURE_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_GEN_SHARED_SECRET),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_ASU_KEY_TRANSFER),
+	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_BATCH),
 };
 
 static XPlmi_Module XPlmi_Secure =
@@ -153,6 +155,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	case XSECURE_API(XSECURE_API_TRNG_GENERATE):
 	case XSECURE_API(XSECURE_API_KAT):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION):
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY):
 #endif
 		Status = XSecure_CryptoCheck();
@@ -227,6 +230,7 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_AES_KEK_DECRYPT):
 	case XSECURE_API(XSECURE_API_AES_SET_DPA_CM):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION):
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
 		Status = XSecure_AesIpiHandler(Cmd);
 		break;
 	case XSECURE_API(XSECURE_API_TRNG_GENERATE):
@@ -36,6 +36,7 @@
 * 5.3   har  02/06/2024 Added support for AES operation and zeroize key
 * 5.4   kpt  06/13/2024 Added XSECURE_API_RSA_RELEASE_KEY
 *       mb   07/31/2024 Added the check to validate Payload for NULL pointer
+* 5.5   sb   10/16/2026 Added XSECURE_API_AES_PERFORM_BATCH
 *
 * </pre>
 *
@@ -115,6 +116,7 @@ static XPlmi_AccessPerm_t XSecure_AccessPermBuff[XSECURE_API_MAX] =
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_KEY_UNWRAP),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_OPERATION_AND_ZEROIZE_KEY),
 	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_RSA_RELEASE_KEY),
+	XPLMI_ALL_IPI_FULL_ACCESS(XSECURE_API_AES_PERFORM_BATCH),
 };
 
 static XPlmi_Module XPlmi_Secure =
@@ -179,6 +181,7 @@ static int XSecure_FeaturesCmd(u32 ApiId)
 	case XSECURE_API(XSECURE_API_TRNG_GENERATE):
 	case XSECURE_API(XSECURE_API_KAT):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION):
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
 	case XSECURE_API(XSECURE_API_UPDATE_DDR_KAT_STATUS):
 	case XSECURE_API(XSECURE_API_UPDATE_HNIC_KAT_STATUS):
 	case XSECURE_API(XSECURE_API_UPDATE_CPM5N_KAT_STATUS):
@@ -263,6 +266,7 @@ static int XSecure_ProcessCmd(XPlmi_Cmd *Cmd)
 	case XSECURE_API(XSECURE_API_AES_KEK_DECRYPT):
 	case XSECURE_API(XSECURE_API_AES_SET_DPA_CM):
 	case XSECURE_API(XSECURE_API_AES_PERFORM_OPERATION):
+	case XSECURE_API(XSECURE_API_AES_PERFORM_BATCH):
 		Status = XSecure_AesIpiHandler(Cmd);
 		break;
 	case XSECURE_API(XSECURE_API_TRNG_GENERATE):
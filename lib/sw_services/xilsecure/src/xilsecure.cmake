@@ -44,6 +44,11 @@ elseif("${CMAKE_MACHINE}" STREQUAL "Versal")
   set_property(CACHE XILSECURE_mode PROPERTY STRINGS "client" "server")
 endif()
 
+option(XILSECURE_softsha_ce_support "Enables the AArch64 kernel of the software SHA using the SHA512 and SHA3 instructions" OFF)
+if(XILSECURE_softsha_ce_support)
+  set(XSECURE_SOFTSHA_CE_SUPPORT " ")
+endif()
+
 option(XILSECURE_cache_disable "Enables/Disables Cache for XilSecure client library." ON)
 if(XILSECURE_mode STREQUAL "client")
   if(XILSECURE_cache_disable)